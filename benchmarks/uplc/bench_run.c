@@ -29,8 +29,15 @@
 #include "uplc/arena/uplc_arena.h"
 #include "uplc/ast/uplc_program.h"
 #include "uplc/flat/flat_decode.h"
+#include "uplc/flat/flat_encode.h"
 #include "uplc/flat/flat_reader.h"
+#include "uplc/machine/uplc_lower.h"
 #include "uplc/machine/uplc_machine.h"
+#include "uplc/machine/uplc_optimize.h"
+
+#include "allocators.h"
+
+#include <cardano/buffer.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -64,62 +71,112 @@ static const size_t MAX_ITERATIONS = 10000U;
  */
 static const size_t FLAT_SUFFIX_LEN = 5U;
 
+/* STATIC STATE **************************************************************/
+
+/**
+ * \brief Number of host allocation calls seen by the counting allocators.
+ */
+static uint64_t s_host_mallocs = 0U;
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Reads the current monotonic clock in nanoseconds.
+ * \brief Flat-decodes a script.
  *
- * \return Nanoseconds from an arbitrary fixed origin, suitable for measuring
- *         elapsed time.
+ * \param[in] arena The arena the program is allocated from.
+ * \param[in] bytes The raw flat bytes of the script.
+ * \param[in] size The number of bytes in \p bytes.
+ * \param[out] program The decoded program.
+ *
+ * \return 0 on success, or -1 on a decode error.
  */
-static uint64_t
-now_ns(void)
+static int
+decode_script(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t size, const cardano_uplc_program_t** program)
 {
-  struct timespec ts;
-  clock_gettime(CLOCK_MONOTONIC, &ts);
+  cardano_uplc_flat_reader_t reader;
 
-  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+  if (cardano_uplc_flat_reader_init(&reader, bytes, size) != CARDANO_SUCCESS)
+  {
+    return -1;
+  }
+
+  if (cardano_uplc_flat_decode_program(arena, &reader, program) != CARDANO_SUCCESS)
+  {
+    return -1;
+  }
+
+  return 0;
 }
 
 /**
- * \brief Runs one full benchmark iteration: flat-decode then CEK evaluation.
+ * \brief Evaluates a program.
  *
  * Evaluates under Plutus V3 semantics with an effectively unlimited budget,
  * matching the benchmark suite's methodology.
  *
- * \param[in] arena The arena serving every interior allocation of the
- *            iteration; the caller resets it between iterations.
- * \param[in] bytes The raw flat bytes of the script.
- * \param[in] size The number of bytes in \p bytes.
+ * \param[in] arena The arena serving the evaluation.
+ * \param[in] program The program to evaluate.
  * \param[out] result The script outcome and spent budget.
  *
- * \return 0 when the host decoded and evaluated the script (whatever the
- *         script outcome), or -1 on a decode or evaluation host error.
+ * \return 0 when the host evaluated the program (whatever the script outcome),
+ *         or -1 on a host error.
  */
 static int
-evaluate_script(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t size, cardano_uplc_eval_result_t* result)
+evaluate_program(cardano_uplc_arena_t* arena, const cardano_uplc_program_t* program, cardano_uplc_eval_result_t* result)
 {
-  cardano_uplc_flat_reader_t    reader;
-  const cardano_uplc_program_t* program = NULL;
+  const cardano_uplc_budget_t budget = { INT64_MAX, INT64_MAX };
 
-  if (cardano_uplc_flat_reader_init(&reader, bytes, size) != CARDANO_SUCCESS)
+  if (cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, budget, result) != CARDANO_SUCCESS)
   {
     return -1;
   }
 
-  if (cardano_uplc_flat_decode_program(arena, &reader, &program) != CARDANO_SUCCESS)
+  return 0;
+}
+
+/**
+ * \brief Lowers a decoded program and evaluates it.
+ *
+ * \param[in] arena The arena serving the lowering and the evaluation.
+ * \param[in] program The decoded program.
+ * \param[out] result The script outcome and spent budget.
+ *
+ * \return 0 when the host lowered and evaluated the program (whatever the
+ *         script outcome), or -1 on a host error.
+ */
+static int
+run_program(cardano_uplc_arena_t* arena, const cardano_uplc_program_t* program, cardano_uplc_eval_result_t* result)
+{
+  if (cardano_uplc_int_lower_program(arena, program, &program) != CARDANO_SUCCESS)
   {
     return -1;
   }
 
-  const cardano_uplc_budget_t budget = { INT64_MAX, INT64_MAX };
+  return evaluate_program(arena, program, result);
+}
 
-  if (cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, budget, result) != CARDANO_SUCCESS)
+/**
+ * \brief Returns the flat-encoded size of a program.
+ *
+ * \param[in] program The program to encode.
+ *
+ * \return The size in bytes, or 0 when the program cannot be encoded.
+ */
+static size_t
+encoded_size(const cardano_uplc_program_t* program)
+{
+  cardano_buffer_t* flat = NULL;
+
+  if (cardano_uplc_int_flat_encode_program(program, &flat) != CARDANO_SUCCESS)
   {
-    return -1;
+    return 0U;
   }
 
-  return 0;
+  const size_t size = cardano_buffer_get_size(flat);
+
+  cardano_buffer_unref(&flat);
+
+  return size;
 }
 
 /**
@@ -155,7 +212,7 @@ check_script_runs(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t
 {
   cardano_uplc_eval_result_t result = { 0 };
 
-  const int status = evaluate_script(arena, bytes, size, &result);
+  const int status = cardano_bench_evaluate_flat(arena, bytes, size, &result, NULL);
 
   cardano_uplc_arena_reset(arena);
 
@@ -176,7 +233,7 @@ warm_up(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t size)
   {
     cardano_uplc_eval_result_t result = { 0 };
 
-    (void)evaluate_script(arena, bytes, size, &result);
+    (void)cardano_bench_evaluate_flat(arena, bytes, size, &result, NULL);
     cardano_uplc_arena_reset(arena);
   }
 }
@@ -187,7 +244,8 @@ warm_up(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t size)
  * Iterates until at least \ref MIN_ITERATIONS samples have been taken and
  * \ref TIME_BUDGET_NS nanoseconds have elapsed, capped at
  * \ref MAX_ITERATIONS. Each sample times one full decode + evaluate; the
- * arena reset between iterations is left outside the timed region.
+ * lowering in between and the arena reset after each iteration are left out
+ * of the sample.
  *
  * \param[in] arena The arena serving the iterations.
  * \param[in] bytes The raw flat bytes of the script.
@@ -207,9 +265,11 @@ measure(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t size, uin
   {
     cardano_uplc_eval_result_t result = { 0 };
 
-    const uint64_t start = now_ns();
-    (void)evaluate_script(arena, bytes, size, &result);
-    const uint64_t elapsed = now_ns() - start;
+    uint64_t lower_ns = 0U;
+
+    const uint64_t start = cardano_bench_now_ns();
+    (void)cardano_bench_evaluate_flat(arena, bytes, size, &result, &lower_ns);
+    const uint64_t elapsed = cardano_bench_now_ns() - start - lower_ns;
 
     cardano_uplc_arena_reset(arena);
 
@@ -226,6 +286,72 @@ measure(cardano_uplc_arena_t* arena, const byte_t* bytes, const size_t size, uin
   return count;
 }
 
+/**
+ * \brief malloc wrapper that counts the calls reaching the host allocator.
+ *
+ * \param[in] size The number of bytes to allocate.
+ *
+ * \return The allocation, or NULL on failure.
+ */
+static void*
+counting_malloc(const size_t size)
+{
+  ++s_host_mallocs;
+
+  return malloc(size);
+}
+
+/**
+ * \brief realloc wrapper that counts the calls reaching the host allocator.
+ *
+ * \param[in] ptr The allocation to resize, or NULL.
+ * \param[in] size The new size in bytes.
+ *
+ * \return The resized allocation, or NULL on failure.
+ */
+static void*
+counting_realloc(void* ptr, const size_t size)
+{
+  ++s_host_mallocs;
+
+  return realloc(ptr, size);
+}
+
+/**
+ * \brief Records the memory footprint of one cold evaluation of a script.
+ *
+ * Evaluates the script once in a fresh arena with counting allocators
+ * installed, then reads the arena's served bytes and live block count before
+ * releasing it. The counting allocators are only installed for this run, so
+ * the timed iterations go straight to the host allocator.
+ *
+ * \param[in] bytes The raw flat bytes of the script.
+ * \param[in] size The number of bytes in \p bytes.
+ * \param[out] out The result receiving the memory figures.
+ */
+static void
+measure_memory(const byte_t* bytes, const size_t size, cardano_bench_result_t* out)
+{
+  cardano_uplc_arena_t*      arena  = NULL;
+  cardano_uplc_eval_result_t result = { 0 };
+
+  s_host_mallocs = 0U;
+  cardano_set_allocators(counting_malloc, counting_realloc, free);
+
+  if (cardano_uplc_arena_new(0U, &arena) == CARDANO_SUCCESS)
+  {
+    (void)cardano_bench_evaluate_flat(arena, bytes, size, &result, NULL);
+
+    out->peak_arena_bytes = cardano_uplc_arena_bytes_used(arena);
+    out->arena_blocks     = cardano_uplc_arena_block_count(arena);
+  }
+
+  out->host_mallocs = s_host_mallocs;
+
+  cardano_uplc_arena_free(&arena);
+  cardano_set_allocators(malloc, realloc, free);
+}
+
 /**
  * \brief Fills a benchmark result from raw duration samples.
  *
@@ -272,6 +398,45 @@ status_to_string(const cardano_uplc_eval_status_t status)
 
 /* DEFINITIONS ***************************************************************/
 
+uint64_t
+cardano_bench_now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+int
+cardano_bench_evaluate_flat(
+  cardano_uplc_arena_t*       arena,
+  const byte_t*               bytes,
+  const size_t                size,
+  cardano_uplc_eval_result_t* result,
+  uint64_t*                   lower_ns)
+{
+  const cardano_uplc_program_t* program = NULL;
+
+  if (decode_script(arena, bytes, size, &program) != 0)
+  {
+    return -1;
+  }
+
+  const uint64_t lower_start = cardano_bench_now_ns();
+
+  if (cardano_uplc_int_lower_program(arena, program, &program) != CARDANO_SUCCESS)
+  {
+    return -1;
+  }
+
+  if (lower_ns != NULL)
+  {
+    *lower_ns = cardano_bench_now_ns() - lower_start;
+  }
+
+  return evaluate_program(arena, program, result);
+}
+
 int
 cardano_bench_run_file(const char* dir, const char* file_name, cardano_bench_result_t* out)
 {
@@ -306,6 +471,7 @@ cardano_bench_run_file(const char* dir, const char* file_name, cardano_bench_res
     return 0;
   }
 
+  measure_memory(bytes, size, out);
   warm_up(arena, bytes, size);
 
   uint64_t* samples = (uint64_t*)malloc(MAX_ITERATIONS * sizeof(uint64_t));
@@ -353,7 +519,7 @@ cardano_bench_verify_file(const char* dir, const char* file_name)
 
   cardano_uplc_eval_result_t result = { 0 };
 
-  if (evaluate_script(arena, bytes, size, &result) != 0)
+  if (cardano_bench_evaluate_flat(arena, bytes, size, &result, NULL) != 0)
   {
     printf("%s,host_error,0,0\n", file_name);
   }
@@ -372,3 +538,58 @@ cardano_bench_verify_file(const char* dir, const char* file_name)
 
   return 0;
 }
+
+int
+cardano_bench_optimize_file(const char* dir, const char* file_name)
+{
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/%s", dir, file_name);
+
+  size_t  size  = 0U;
+  byte_t* bytes = cardano_bench_io_read_file(path, &size);
+
+  if (bytes == NULL)
+  {
+    printf("%s,read_error,0,0,0,0,0,0\n", file_name);
+    return -1;
+  }
+
+  cardano_uplc_arena_t* arena = NULL;
+
+  if (cardano_uplc_arena_new(0U, &arena) != CARDANO_SUCCESS)
+  {
+    free(bytes);
+    return -1;
+  }
+
+  const cardano_uplc_program_t* program   = NULL;
+  const cardano_uplc_program_t* optimized = NULL;
+  cardano_uplc_eval_result_t    before    = { 0 };
+  cardano_uplc_eval_result_t    after     = { 0 };
+
+  if ((decode_script(arena, bytes, size, &program) != 0)
+    || (cardano_uplc_int_optimize_program(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, &optimized) != CARDANO_SUCCESS)
+    || (run_program(arena, program, &before) != 0)
+    || (run_program(arena, optimized, &after) != 0))
+  {
+    printf("%s,host_error,0,0,0,0,0,0\n", file_name);
+  }
+  else
+  {
+    printf(
+      "%s,%s,%zu,%zu,%lld,%lld,%lld,%lld\n",
+      file_name,
+      (after.status == before.status) ? status_to_string(after.status) : "mismatch",
+      encoded_size(program),
+      encoded_size(optimized),
+      (long long)before.spent.cpu,
+      (long long)after.spent.cpu,
+      (long long)before.spent.mem,
+      (long long)after.spent.mem);
+  }
+
+  cardano_uplc_arena_free(&arena);
+  free(bytes);
+
+  return 0;
+}
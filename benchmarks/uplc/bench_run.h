@@ -24,6 +24,9 @@
 
 /* INCLUDES ******************************************************************/
 
+#include "uplc/arena/uplc_arena.h"
+#include "uplc/machine/uplc_eval_result.h"
+
 #include <stddef.h>
 #include <stdint.h>
 
@@ -39,6 +42,11 @@ extern "C" {
  * Times are in nanoseconds over full decode + evaluate iterations. A script
  * that fails to decode or evaluate reports zero iterations and all-zero
  * statistics, which the benchmark suite treats as a failure.
+ *
+ * The memory figures come from one extra cold evaluation in a fresh arena:
+ * the arena bytes served (the peak, since an arena only grows until it is
+ * reset), the arena blocks holding them, and the number of malloc and realloc
+ * calls that reached the host allocator, arena blocks included.
  */
 typedef struct cardano_bench_result_t
 {
@@ -49,8 +57,43 @@ typedef struct cardano_bench_result_t
     uint64_t min_ns;
     uint64_t max_ns;
     uint64_t stddev_ns;
+    uint64_t peak_arena_bytes;
+    uint64_t arena_blocks;
+    uint64_t host_mallocs;
 } cardano_bench_result_t;
 
+/**
+ * \brief Reads the current monotonic clock in nanoseconds.
+ *
+ * \return Nanoseconds from an arbitrary fixed origin, suitable for measuring
+ *         elapsed time.
+ */
+uint64_t
+cardano_bench_now_ns(void);
+
+/**
+ * \brief Runs one full benchmark iteration: flat-decode, lowering, then CEK evaluation.
+ *
+ * The decoded program is lowered before it runs, so the timings and the
+ * --verify budgets both cover the lowered form the machine is tuned for.
+ * Lowering is a one-off preparation step rather than part of the
+ * decode + evaluate protocol, so its duration is reported separately for the
+ * timing loops to leave out of their samples.
+ *
+ * \param[in] arena The arena serving every interior allocation of the
+ *            iteration; the caller resets it between iterations.
+ * \param[in] bytes The raw flat bytes of the script.
+ * \param[in] size The number of bytes in \p bytes.
+ * \param[out] result The script outcome and spent budget.
+ * \param[out] lower_ns If not NULL, receives the nanoseconds spent lowering
+ *             the decoded program.
+ *
+ * \return 0 when the host decoded and evaluated the script (whatever the
+ *         script outcome), or -1 on a decode or evaluation host error.
+ */
+int
+cardano_bench_evaluate_flat(cardano_uplc_arena_t* arena, const byte_t* bytes, size_t size, cardano_uplc_eval_result_t* result, uint64_t* lower_ns);
+
 /**
  * \brief Benchmarks one .flat script: repeated flat-decode + CEK evaluation.
  *
@@ -91,6 +134,24 @@ cardano_bench_run_file(const char* dir, const char* file_name, cardano_bench_res
 int
 cardano_bench_verify_file(const char* dir, const char* file_name);
 
+/**
+ * \brief Optimizes one .flat script and prints a size and budget delta CSV row.
+ *
+ * Prints "name,status,size_before,size_after,cpu_before,cpu_after,mem_before,mem_after"
+ * to stdout. The script is run through the UPLC optimizer, and both the original
+ * and the optimized program are flat-encoded and evaluated once under Plutus V3
+ * semantics. status is the outcome token of \ref cardano_bench_verify_file, or
+ * "mismatch" when the two programs reach different outcomes.
+ *
+ * \param[in] dir The directory holding the script.
+ * \param[in] file_name The .flat file name within \p dir.
+ *
+ * \return 0 when the script was processed and reported, or -1 on a host
+ *         error (an error row is still printed for unreadable files).
+ */
+int
+cardano_bench_optimize_file(const char* dir, const char* file_name);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,349 @@
+/**
+ * \file bench_throughput.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "bench_throughput.h"
+
+#include "bench_run.h"
+#include "utils/bench_io.h"
+
+#include "uplc/arena/uplc_arena.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Time budget of each worker thread, in nanoseconds.
+ */
+static const uint64_t THROUGHPUT_BUDGET_NS = 5000000000ULL;
+
+/**
+ * \brief Initial capacity of a worker's latency sample buffer.
+ */
+static const size_t INITIAL_SAMPLE_CAPACITY = 4096U;
+
+/* TYPES *********************************************************************/
+
+/**
+ * \brief One loaded script.
+ */
+typedef struct throughput_script_t
+{
+    byte_t* bytes;
+    size_t  size;
+} throughput_script_t;
+
+/**
+ * \brief State of one worker thread.
+ *
+ * The scripts are shared read-only; everything else is owned by the worker
+ * until it is joined.
+ */
+typedef struct throughput_worker_t
+{
+    pthread_t                  thread;
+    const throughput_script_t* scripts;
+    size_t                     script_count;
+    size_t                     first_script;
+    uint64_t                   deadline_ns;
+    uint64_t*                  samples;
+    size_t                     sample_count;
+    size_t                     sample_capacity;
+    int                        failed;
+} throughput_worker_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Appends one latency sample to a worker, growing its buffer as needed.
+ *
+ * \param[in,out] worker The worker.
+ * \param[in] sample The duration to record.
+ *
+ * \return 0 on success, or -1 when the buffer cannot grow.
+ */
+static int
+record_sample(throughput_worker_t* worker, const uint64_t sample)
+{
+  if (worker->sample_count == worker->sample_capacity)
+  {
+    const size_t capacity = (worker->sample_capacity == 0U) ? INITIAL_SAMPLE_CAPACITY : (worker->sample_capacity * 2U);
+    uint64_t*    grown    = (uint64_t*)realloc(worker->samples, capacity * sizeof(uint64_t));
+
+    if (grown == NULL)
+    {
+      return -1;
+    }
+
+    worker->samples         = grown;
+    worker->sample_capacity = capacity;
+  }
+
+  worker->samples[worker->sample_count] = sample;
+  ++worker->sample_count;
+
+  return 0;
+}
+
+/**
+ * \brief Body of a worker thread: cycles through the scripts until its deadline.
+ *
+ * Runs at least one full pass over the scripts, starting from its own first
+ * script, and keeps going until the deadline passes. Each sample times one
+ * decode + evaluate; the arena reset is left outside the timed region.
+ *
+ * \param[in,out] context The worker state.
+ *
+ * \return NULL.
+ */
+static void*
+run_worker(void* context)
+{
+  throughput_worker_t*  worker = (throughput_worker_t*)context;
+  cardano_uplc_arena_t* arena  = NULL;
+
+  if (cardano_uplc_arena_new(0U, &arena) != CARDANO_SUCCESS)
+  {
+    worker->failed = 1;
+
+    return NULL;
+  }
+
+  size_t next = worker->first_script;
+
+  while ((worker->sample_count < worker->script_count) || (cardano_bench_now_ns() < worker->deadline_ns))
+  {
+    const throughput_script_t* script = &worker->scripts[next];
+    cardano_uplc_eval_result_t result = { 0 };
+
+    uint64_t lower_ns = 0U;
+
+    const uint64_t start = cardano_bench_now_ns();
+    (void)cardano_bench_evaluate_flat(arena, script->bytes, script->size, &result, &lower_ns);
+    const uint64_t elapsed = cardano_bench_now_ns() - start - lower_ns;
+
+    cardano_uplc_arena_reset(arena);
+
+    if (record_sample(worker, elapsed) != 0)
+    {
+      worker->failed = 1;
+      break;
+    }
+
+    next = ((next + 1U) == worker->script_count) ? 0U : (next + 1U);
+  }
+
+  cardano_uplc_arena_free(&arena);
+
+  return NULL;
+}
+
+/**
+ * \brief Reads every script and keeps those that decode and evaluate.
+ *
+ * \param[in] dir The directory holding the scripts.
+ * \param[in] files The .flat file names within \p dir.
+ * \param[in] file_count The number of file names.
+ * \param[out] scripts The loaded scripts; must hold \p file_count entries.
+ *
+ * \return The number of scripts loaded.
+ */
+static size_t
+load_scripts(const char* dir, char** files, const size_t file_count, throughput_script_t* scripts)
+{
+  cardano_uplc_arena_t* arena = NULL;
+  size_t                count = 0U;
+
+  if (cardano_uplc_arena_new(0U, &arena) != CARDANO_SUCCESS)
+  {
+    return 0U;
+  }
+
+  for (size_t i = 0U; i < file_count; ++i)
+  {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dir, files[i]);
+
+    size_t  size  = 0U;
+    byte_t* bytes = cardano_bench_io_read_file(path, &size);
+
+    if (bytes == NULL)
+    {
+      continue;
+    }
+
+    cardano_uplc_eval_result_t result = { 0 };
+
+    const int status = cardano_bench_evaluate_flat(arena, bytes, size, &result, NULL);
+
+    cardano_uplc_arena_reset(arena);
+
+    if (status != 0)
+    {
+      fprintf(stderr, "  %s: decode/eval host error\n", files[i]);
+      free(bytes);
+
+      continue;
+    }
+
+    scripts[count].bytes = bytes;
+    scripts[count].size  = size;
+    ++count;
+  }
+
+  cardano_uplc_arena_free(&arena);
+
+  return count;
+}
+
+/**
+ * \brief Fills the outcome of a throughput run from its joined workers.
+ *
+ * \param[in,out] workers The joined workers; their samples are sorted.
+ * \param[in] thread_count The number of workers.
+ * \param[in] elapsed_ns The wall-clock time of the run.
+ * \param[out] out The outcome; its thread array must hold \p thread_count entries.
+ */
+static void
+fill_throughput(throughput_worker_t* workers, const size_t thread_count, const uint64_t elapsed_ns, cardano_bench_throughput_t* out)
+{
+  out->evaluations = 0U;
+  out->elapsed_ns  = elapsed_ns;
+
+  for (size_t i = 0U; i < thread_count; ++i)
+  {
+    cardano_bench_thread_result_t* thread = &out->threads[i];
+
+    thread->evaluations = workers[i].sample_count;
+
+    if (workers[i].sample_count > 0U)
+    {
+      thread->latency = cardano_bench_stats_compute(workers[i].samples, workers[i].sample_count);
+    }
+
+    out->evaluations += thread->evaluations;
+  }
+
+  out->scripts_per_sec = (elapsed_ns == 0U) ? 0.0 : ((double)out->evaluations * 1e9 / (double)elapsed_ns);
+}
+
+/* DEFINITIONS ***************************************************************/
+
+int
+cardano_bench_run_throughput(const char* dir, char** files, const size_t file_count, const size_t thread_count, cardano_bench_throughput_t* out)
+{
+  memset(out, 0, sizeof(*out));
+
+  if ((file_count == 0U) || (thread_count == 0U))
+  {
+    return -1;
+  }
+
+  throughput_script_t* scripts = (throughput_script_t*)calloc(file_count, sizeof(throughput_script_t));
+  throughput_worker_t* workers = (throughput_worker_t*)calloc(thread_count, sizeof(throughput_worker_t));
+
+  out->threads = (cardano_bench_thread_result_t*)calloc(thread_count, sizeof(cardano_bench_thread_result_t));
+
+  if ((scripts == NULL) || (workers == NULL) || (out->threads == NULL))
+  {
+    free(scripts);
+    free(workers);
+    cardano_bench_throughput_free(out);
+
+    return -1;
+  }
+
+  const size_t script_count = load_scripts(dir, files, file_count, scripts);
+  int          status       = (script_count == 0U) ? -1 : 0;
+  size_t       started      = 0U;
+
+  const uint64_t start = cardano_bench_now_ns();
+
+  for (size_t i = 0U; (i < thread_count) && (status == 0); ++i)
+  {
+    workers[i].scripts      = scripts;
+    workers[i].script_count = script_count;
+    workers[i].first_script = (i * script_count) / thread_count;
+    workers[i].deadline_ns  = start + THROUGHPUT_BUDGET_NS;
+
+    if (pthread_create(&workers[i].thread, NULL, run_worker, &workers[i]) != 0)
+    {
+      status = -1;
+    }
+    else
+    {
+      ++started;
+    }
+  }
+
+  for (size_t i = 0U; i < started; ++i)
+  {
+    (void)pthread_join(workers[i].thread, NULL);
+
+    if (workers[i].failed)
+    {
+      status = -1;
+    }
+  }
+
+  const uint64_t elapsed = cardano_bench_now_ns() - start;
+
+  if (status == 0)
+  {
+    out->thread_count = thread_count;
+    out->script_count = script_count;
+
+    fill_throughput(workers, thread_count, elapsed, out);
+  }
+  else
+  {
+    cardano_bench_throughput_free(out);
+  }
+
+  for (size_t i = 0U; i < thread_count; ++i)
+  {
+    free(workers[i].samples);
+  }
+
+  for (size_t i = 0U; i < script_count; ++i)
+  {
+    free(scripts[i].bytes);
+  }
+
+  free(workers);
+  free(scripts);
+
+  return status;
+}
+
+void
+cardano_bench_throughput_free(cardano_bench_throughput_t* throughput)
+{
+  free(throughput->threads);
+
+  throughput->threads      = NULL;
+  throughput->thread_count = 0U;
+}
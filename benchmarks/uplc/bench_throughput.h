@@ -0,0 +1,103 @@
+/**
+ * \file bench_throughput.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_BENCH_THROUGHPUT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_BENCH_THROUGHPUT_H
+
+/* INCLUDES ******************************************************************/
+
+#include "utils/bench_stats.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Measurement outcome of one worker thread of a throughput run.
+ *
+ * \c latency summarizes the duration of every decode + evaluate the thread
+ * ran; it is all zero when the thread ran none.
+ */
+typedef struct cardano_bench_thread_result_t
+{
+    uint64_t              evaluations;
+    cardano_bench_stats_t latency;
+} cardano_bench_thread_result_t;
+
+/**
+ * \brief Measurement outcome of a throughput run.
+ *
+ * \c scripts_per_sec is the total number of evaluations across all threads
+ * divided by the wall-clock time from the start of the first thread to the
+ * end of the last.
+ */
+typedef struct cardano_bench_throughput_t
+{
+    size_t                         thread_count;
+    size_t                         script_count;
+    uint64_t                       evaluations;
+    uint64_t                       elapsed_ns;
+    double                         scripts_per_sec;
+    cardano_bench_thread_result_t* threads;
+} cardano_bench_throughput_t;
+
+/**
+ * \brief Runs every script concurrently on several threads and measures throughput.
+ *
+ * Loads the scripts once, drops those that fail to decode or evaluate, then
+ * starts \p thread_count threads that each cycle through the whole script set
+ * (each from a different starting script) with their own arena, decoding and
+ * evaluating under Plutus V3 semantics with an unlimited budget and resetting
+ * the arena between iterations. Every thread runs for the same 5 second time
+ * budget and at least one full pass over the scripts.
+ *
+ * \param[in] dir The directory holding the scripts.
+ * \param[in] files The .flat file names within \p dir.
+ * \param[in] file_count The number of file names.
+ * \param[in] thread_count The number of worker threads; at least 1.
+ * \param[out] out The measurement outcome; release it with
+ *             \ref cardano_bench_throughput_free.
+ *
+ * \return 0 on success, or -1 when no script is runnable or on a host error
+ *         such as an out-of-memory condition or a thread that cannot start.
+ */
+int
+cardano_bench_run_throughput(const char* dir, char** files, size_t file_count, size_t thread_count, cardano_bench_throughput_t* out);
+
+/**
+ * \brief Releases the per-thread results of a throughput run.
+ *
+ * \param[in,out] throughput The throughput run to release; its thread array is
+ *                freed and cleared.
+ */
+void
+cardano_bench_throughput_free(cardano_bench_throughput_t* throughput);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BIGLUP_LABS_INCLUDE_CARDANO_BENCH_THROUGHPUT_H */
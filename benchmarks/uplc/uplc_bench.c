@@ -26,12 +26,16 @@
  * files (the cardano-plutus-vm-benchmark plutus_use_cases corpus) and emits
  * the JSON schema consumed by that suite's parsers. A --verify mode instead
  * evaluates each script once and prints "name,status,cpu,mem" CSV rows for
- * cross-VM differential checks.
+ * cross-VM differential checks, and an --optimize mode runs each script
+ * through the UPLC optimizer and prints its size and budget deltas as CSV.
+ * With --threads N the scripts are instead run concurrently on N threads and
+ * the aggregate throughput and per-thread latencies are reported.
  */
 
 /* INCLUDES ******************************************************************/
 
 #include "bench_run.h"
+#include "bench_throughput.h"
 #include "utils/bench_io.h"
 #include "utils/bench_report.h"
 
@@ -49,7 +53,9 @@ typedef struct bench_options_t
     const char* data_dir;
     const char* out_path;
     int         verify;
+    int         optimize;
     int         quiet;
+    size_t      threads;
 } bench_options_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -61,7 +67,8 @@ typedef struct bench_options_t
  * \param[in] argv The argument vector.
  * \param[out] options The parsed options.
  *
- * \return 0 on success, or -1 when no data directory was given.
+ * \return 0 on success, or -1 when no data directory was given or the thread
+ *         count is not a positive number.
  */
 static int
 parse_options(const int argc, char** argv, bench_options_t* options)
@@ -74,10 +81,25 @@ parse_options(const int argc, char** argv, bench_options_t* options)
     {
       options->verify = 1;
     }
+    else if (strcmp(argv[i], "--optimize") == 0)
+    {
+      options->optimize = 1;
+    }
     else if ((strcmp(argv[i], "--quiet") == 0) || (strcmp(argv[i], "-q") == 0))
     {
       options->quiet = 1;
     }
+    else if ((strcmp(argv[i], "--threads") == 0) && ((i + 1) < argc))
+    {
+      const long threads = strtol(argv[++i], NULL, 10);
+
+      if (threads <= 0)
+      {
+        return -1;
+      }
+
+      options->threads = (size_t)threads;
+    }
     else if ((strcmp(argv[i], "-o") == 0) && ((i + 1) < argc))
     {
       options->out_path = argv[++i];
@@ -117,6 +139,104 @@ run_verify_mode(const bench_options_t* options, char** files, const size_t file_
   return 0;
 }
 
+/**
+ * \brief Runs optimize mode: one size and budget delta CSV row per script.
+ *
+ * \param[in] options The parsed command line options.
+ * \param[in] files The script file names.
+ * \param[in] file_count The number of script file names.
+ *
+ * \return The process exit code.
+ */
+static int
+run_optimize_mode(const bench_options_t* options, char** files, const size_t file_count)
+{
+  printf("name,status,size_before,size_after,cpu_before,cpu_after,mem_before,mem_after\n");
+
+  for (size_t i = 0U; i < file_count; ++i)
+  {
+    (void)cardano_bench_optimize_file(options->data_dir, files[i]);
+  }
+
+  return 0;
+}
+
+/**
+ * \brief Opens the report stream: the -o file when given, stdout otherwise.
+ *
+ * \param[in] options The parsed command line options.
+ *
+ * \return The stream, or NULL when the output file cannot be opened.
+ */
+static FILE*
+open_output(const bench_options_t* options)
+{
+  if (options->out_path == NULL)
+  {
+    return stdout;
+  }
+
+  FILE* out = fopen(options->out_path, "w");
+
+  if (out == NULL)
+  {
+    fprintf(stderr, "Cannot open output file: %s\n", options->out_path);
+  }
+
+  return out;
+}
+
+/**
+ * \brief Runs throughput mode: every script on N threads, one JSON report.
+ *
+ * \param[in] options The parsed command line options.
+ * \param[in] files The script file names.
+ * \param[in] file_count The number of script file names.
+ *
+ * \return The process exit code.
+ */
+static int
+run_throughput_mode(const bench_options_t* options, char** files, const size_t file_count)
+{
+  cardano_bench_throughput_t throughput;
+
+  if (cardano_bench_run_throughput(options->data_dir, files, file_count, options->threads, &throughput) != 0)
+  {
+    fprintf(stderr, "Throughput run failed\n");
+    return 1;
+  }
+
+  if (!options->quiet)
+  {
+    fprintf(
+      stderr,
+      "  %zu threads, %zu scripts: %.1f scripts/sec (%llu evaluations)\n",
+      throughput.thread_count,
+      throughput.script_count,
+      throughput.scripts_per_sec,
+      (unsigned long long)throughput.evaluations);
+  }
+
+  FILE* out = open_output(options);
+
+  if (out == NULL)
+  {
+    cardano_bench_throughput_free(&throughput);
+    return 1;
+  }
+
+  cardano_bench_report_write_throughput_json(out, &throughput);
+
+  if (out != stdout)
+  {
+    fclose(out);
+  }
+
+  cardano_bench_throughput_free(&throughput);
+
+  return 0;
+}
+
 /**
  * \brief Runs benchmark mode: measures every script and writes the JSON report.
  *
@@ -152,19 +272,13 @@ run_bench_mode(const bench_options_t* options, char** files, const size_t file_c
     }
   }
 
-  FILE* out = stdout;
+  FILE* out = open_output(options);
 
-  if (options->out_path != NULL)
+  if (out == NULL)
   {
-    out = fopen(options->out_path, "w");
+    free(results);
 
-    if (out == NULL)
-    {
-      fprintf(stderr, "Cannot open output file: %s\n", options->out_path);
-      free(results);
-
-      return 1;
-    }
+    return 1;
   }
 
   cardano_bench_report_write_json(out, results, result_count);
@@ -196,7 +310,7 @@ main(const int argc, char** argv)
 
   if (parse_options(argc, argv, &options) != 0)
   {
-    fprintf(stderr, "Usage: %s [--verify] [--quiet] [--format json] [-o out.json] <flat-dir>\n", argv[0]);
+    fprintf(stderr, "Usage: %s [--verify | --optimize | --threads N] [--quiet] [--format json] [-o out.json] <flat-dir>\n", argv[0]);
     return 1;
   }
 
@@ -209,9 +323,24 @@ main(const int argc, char** argv)
     return 1;
   }
 
-  const int exit_code = options.verify
-    ? run_verify_mode(&options, files, file_count)
-    : run_bench_mode(&options, files, file_count);
+  int exit_code = 0;
+
+  if (options.verify)
+  {
+    exit_code = run_verify_mode(&options, files, file_count);
+  }
+  else if (options.optimize)
+  {
+    exit_code = run_optimize_mode(&options, files, file_count);
+  }
+  else if (options.threads > 0U)
+  {
+    exit_code = run_throughput_mode(&options, files, file_count);
+  }
+  else
+  {
+    exit_code = run_bench_mode(&options, files, file_count);
+  }
 
   cardano_bench_io_free_file_list(files, file_count);
 
@@ -46,7 +46,10 @@ write_json_entry(FILE* out, const cardano_bench_result_t* result, const int is_l
     "      \"median_ns\": %llu,\n"
     "      \"min_ns\": %llu,\n"
     "      \"max_ns\": %llu,\n"
-    "      \"stddev_ns\": %llu\n"
+    "      \"stddev_ns\": %llu,\n"
+    "      \"peak_arena_bytes\": %llu,\n"
+    "      \"arena_blocks\": %llu,\n"
+    "      \"host_mallocs\": %llu\n"
     "    }%s\n",
     result->name,
     (unsigned long long)result->iterations,
@@ -55,6 +58,43 @@ write_json_entry(FILE* out, const cardano_bench_result_t* result, const int is_l
     (unsigned long long)result->min_ns,
     (unsigned long long)result->max_ns,
     (unsigned long long)result->stddev_ns,
+    (unsigned long long)result->peak_arena_bytes,
+    (unsigned long long)result->arena_blocks,
+    (unsigned long long)result->host_mallocs,
+    is_last ? "" : ",");
+}
+
+/**
+ * \brief Writes one entry of the JSON "per_thread" array.
+ *
+ * \param[in] out The stream to write to.
+ * \param[in] index The thread index.
+ * \param[in] thread The thread's measurement to serialize.
+ * \param[in] is_last Whether this entry is the last of the array.
+ */
+static void
+write_thread_entry(FILE* out, const size_t index, const cardano_bench_thread_result_t* thread, const int is_last)
+{
+  fprintf(
+    out,
+    "    {\n"
+    "      \"thread\": %zu,\n"
+    "      \"evaluations\": %llu,\n"
+    "      \"mean_ns\": %llu,\n"
+    "      \"median_ns\": %llu,\n"
+    "      \"p90_ns\": %llu,\n"
+    "      \"p99_ns\": %llu,\n"
+    "      \"min_ns\": %llu,\n"
+    "      \"max_ns\": %llu\n"
+    "    }%s\n",
+    index,
+    (unsigned long long)thread->evaluations,
+    (unsigned long long)thread->latency.mean_ns,
+    (unsigned long long)thread->latency.median_ns,
+    (unsigned long long)thread->latency.p90_ns,
+    (unsigned long long)thread->latency.p99_ns,
+    (unsigned long long)thread->latency.min_ns,
+    (unsigned long long)thread->latency.max_ns,
     is_last ? "" : ",");
 }
 
@@ -83,3 +123,31 @@ cardano_bench_report_write_json(FILE* out, const cardano_bench_result_t* results
 
   fprintf(out, "  ]\n}\n");
 }
+
+void
+cardano_bench_report_write_throughput_json(FILE* out, const cardano_bench_throughput_t* throughput)
+{
+  fprintf(
+    out,
+    "{\n"
+    "  \"timestamp\": %lld,\n"
+    "  \"threads\": %zu,\n"
+    "  \"scripts\": %zu,\n"
+    "  \"evaluations\": %llu,\n"
+    "  \"elapsed_ns\": %llu,\n"
+    "  \"scripts_per_sec\": %.1f,\n"
+    "  \"per_thread\": [\n",
+    (long long)time(NULL),
+    throughput->thread_count,
+    throughput->script_count,
+    (unsigned long long)throughput->evaluations,
+    (unsigned long long)throughput->elapsed_ns,
+    throughput->scripts_per_sec);
+
+  for (size_t i = 0U; i < throughput->thread_count; ++i)
+  {
+    write_thread_entry(out, i, &throughput->threads[i], ((i + 1U) == throughput->thread_count) ? 1 : 0);
+  }
+
+  fprintf(out, "  ]\n}\n");
+}
@@ -25,6 +25,7 @@
 /* INCLUDES ******************************************************************/
 
 #include "../bench_run.h"
+#include "../bench_throughput.h"
 
 #include <stdio.h>
 
@@ -47,7 +48,8 @@ cardano_bench_report_progress(const cardano_bench_result_t* result);
  *
  * Emits the object consumed by cardano-plutus-vm-benchmark's parsers: a
  * timestamp and a "benchmarks" array whose entries carry the script name,
- * iteration count and nanosecond statistics.
+ * iteration count and nanosecond statistics, plus the script's peak arena
+ * bytes, arena block count and host allocation count.
  *
  * \param[in] out The stream to write to.
  * \param[in] results The measurements to serialize.
@@ -56,6 +58,20 @@ cardano_bench_report_progress(const cardano_bench_result_t* result);
 void
 cardano_bench_report_write_json(FILE* out, const cardano_bench_result_t* results, size_t count);
 
+/**
+ * \brief Writes a throughput run as JSON.
+ *
+ * Emits a timestamp, the thread and script counts, the total evaluations, the
+ * wall-clock time and aggregate scripts per second, and a "per_thread" array
+ * with each thread's evaluation count and latency statistics (mean, median,
+ * 90th and 99th percentile, min and max, in nanoseconds).
+ *
+ * \param[in] out The stream to write to.
+ * \param[in] throughput The throughput run to serialize.
+ */
+void
+cardano_bench_report_write_throughput_json(FILE* out, const cardano_bench_throughput_t* throughput);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
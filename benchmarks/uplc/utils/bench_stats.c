@@ -50,6 +50,23 @@ compare_u64(const void* a, const void* b)
   return (lhs > rhs) ? 1 : 0;
 }
 
+/**
+ * \brief Returns the nearest-rank percentile of sorted samples.
+ *
+ * \param[in] samples The duration samples, sorted ascending.
+ * \param[in] count The number of samples; must be at least 1.
+ * \param[in] percent The percentile, from 1 to 100.
+ *
+ * \return The smallest sample at or above \p percent percent of the samples.
+ */
+static uint64_t
+percentile(const uint64_t* samples, const size_t count, const size_t percent)
+{
+  const size_t rank = ((count * percent) + 99U) / 100U;
+
+  return samples[(rank == 0U) ? 0U : (rank - 1U)];
+}
+
 /* DEFINITIONS ***************************************************************/
 
 cardano_bench_stats_t
@@ -84,6 +101,8 @@ cardano_bench_stats_compute(uint64_t* samples, const size_t count)
     .min_ns    = samples[0],
     .max_ns    = samples[count - 1U],
     .stddev_ns = (uint64_t)sqrt((double)(uint64_t)(variance_sum / count)),
+    .p90_ns    = percentile(samples, count, 90U),
+    .p99_ns    = percentile(samples, count, 99U),
   };
 
   return stats;
@@ -43,13 +43,16 @@ typedef struct cardano_bench_stats_t
     uint64_t min_ns;
     uint64_t max_ns;
     uint64_t stddev_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
 } cardano_bench_stats_t;
 
 /**
  * \brief Computes summary statistics over duration samples.
  *
  * Sorts \p samples in place, then derives the mean, median (midpoint average
- * for even counts), minimum, maximum and population standard deviation. The
+ * for even counts), minimum, maximum, population standard deviation and the
+ * nearest-rank 90th and 99th percentiles. The
  * accumulations run over 128-bit integers so no sample sum or squared
  * deviation can overflow.
  *
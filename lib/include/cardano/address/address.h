@@ -297,7 +297,12 @@ CARDANO_EXPORT cardano_error_t cardano_address_from_string(
  *                    size is being calculated. The object must not be NULL.
  *
  * \return The size in bytes needed to store the string representation of the address, including
- *         the null terminator. If the input \p address is NULL, the behavior is undefined.
+ *         the null terminator. Returns zero if \p address is NULL or if the string could not be
+ *         allocated.
+ *
+ * \note The string is formatted and cached on the first call to this function, \ref cardano_address_to_string
+ *       or \ref cardano_address_get_string, so this call may allocate. A failed allocation is not cached;
+ *       a later call tries again.
  *
  * Usage Example:
  * \code{.c}
@@ -339,6 +344,7 @@ CARDANO_EXPORT size_t cardano_address_get_string_size(const cardano_address_t* a
  *
  * \return Returns \ref CARDANO_SUCCESS if the conversion is successful. If the buffer is too small, returns
  *         \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE. If the \p address or \p data is NULL, returns \ref CARDANO_ERROR_POINTER_IS_NULL.
+ *         If the string could not be allocated, returns \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
  *
  * Usage Example:
  * \code{.c}
@@ -377,8 +383,12 @@ CARDANO_EXPORT cardano_error_t cardano_address_to_string(
  * \param[in] address A constant pointer to the \ref cardano_address_t object from which
  *                    the string is to be retrieved.
  *
- * \return A constant pointer to the internal string representation of the address. If the input
- *         \p address is NULL, the return value is NULL, indicating an error.
+ * \return A constant pointer to the internal string representation of the address. Returns NULL if
+ *         \p address is NULL or if the string could not be allocated; callers must check for NULL
+ *         before using the result.
+ *
+ * \note The string is formatted and cached on first access, so this call may allocate. A failed
+ *       allocation is not cached; a later call tries again.
  *
  * \note The returned string will remain valid as long as the \ref cardano_address_t object is not modified
  *       or freed. Once \ref cardano_address_unref is called on the address object, the string pointer
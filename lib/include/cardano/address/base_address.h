@@ -30,6 +30,7 @@
 
 #include <cardano/common/credential.h>
 #include <cardano/common/network_id.h>
+#include <cardano/crypto/bip32_public_key.h>
 
 /* FORWARD DECLARATIONS *****************************************************/
 
@@ -93,6 +94,57 @@ CARDANO_EXPORT cardano_error_t cardano_base_address_from_credentials(
   cardano_credential_t*    stake,
   cardano_base_address_t** base_address);
 
+/**
+ * \brief Derives the payment keys of a run of consecutive indices and writes their base addresses to a flat array.
+ *
+ * This function derives the role key `account_key/role` once and, for every index in
+ * [\p start_index, \p start_index + \p count), writes the raw bytes of the base address whose payment credential is
+ * the key hash of `account_key/role/index` and whose stake credential is \p stake. Each address takes
+ * `1 + 2 * CARDANO_BLAKE2B_HASH_SIZE_224` (57) bytes: the header byte followed by the payment and stake hashes.
+ *
+ * Unlike \ref cardano_base_address_from_credentials, no key, credential or address objects are created and nothing is
+ * bech32 encoded, which makes this function suitable for scanning address gap limits. An address can later be turned
+ * into an object with \ref cardano_base_address_from_bytes when needed.
+ *
+ * \param[in]  account_key The BIP32 public key of the account (i.e. `m/1852'/1815'/account'`).
+ * \param[in]  network_id The network identifier of the addresses.
+ * \param[in]  role The role of the payment keys (e.g. 0 for external, 1 for internal chain). Must not be hardened.
+ * \param[in]  start_index The index of the first payment key to derive.
+ * \param[in]  count The number of addresses to derive. The last index must not be hardened.
+ * \param[in]  stake The stake credential shared by all the addresses.
+ * \param[out] addresses The buffer that receives the address bytes.
+ * \param[in]  addresses_size The size of \p addresses in bytes. Must be at least `count * 57`.
+ *
+ * \return \ref CARDANO_SUCCESS if the addresses were written, \ref CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX if
+ *         the role or any of the indices is hardened, \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if \p addresses is
+ *         too small, or another error code on failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_bip32_public_key_t* account_key = ...; // Assume this is initialized
+ * cardano_credential_t* stake = ...; // Assume this is initialized
+ * byte_t addresses[20U * 57U] = { 0 };
+ *
+ * cardano_error_t result = cardano_base_address_derive_bytes(
+ *   account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 20U, stake, addresses, sizeof(addresses));
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // &addresses[i * 57U] holds the base address of the key account_key/0/i.
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_base_address_derive_bytes(
+  const cardano_bip32_public_key_t* account_key,
+  cardano_network_id_t              network_id,
+  uint32_t                          role,
+  uint32_t                          start_index,
+  size_t                            count,
+  const cardano_credential_t*       stake,
+  byte_t*                           addresses,
+  size_t                            addresses_size);
+
 /**
  * \brief Converts a general Cardano address to a base address.
  *
@@ -26,6 +26,7 @@
 
 #include <cardano/common/credential.h>
 #include <cardano/common/network_id.h>
+#include <cardano/crypto/bip32_public_key.h>
 #include <cardano/error.h>
 #include <cardano/export.h>
 #include <cardano/typedefs.h>
@@ -102,6 +103,48 @@ CARDANO_EXPORT cardano_error_t cardano_enterprise_address_from_credentials(
   cardano_credential_t*          payment,
   cardano_enterprise_address_t** enterprise_address);
 
+/**
+ * \brief Derives the payment keys of a run of consecutive indices and writes their enterprise addresses to a flat array.
+ *
+ * This function derives the role key `account_key/role` once and, for every index in
+ * [\p start_index, \p start_index + \p count), writes the raw bytes of the enterprise address whose payment
+ * credential is the key hash of `account_key/role/index`. Each address takes `1 + CARDANO_BLAKE2B_HASH_SIZE_224` (29)
+ * bytes: the header byte followed by the payment hash.
+ *
+ * Unlike \ref cardano_enterprise_address_from_credentials, no key, credential or address objects are created and
+ * nothing is bech32 encoded, which makes this function suitable for scanning address gap limits.
+ *
+ * \param[in]  account_key The BIP32 public key of the account (i.e. `m/1852'/1815'/account'`).
+ * \param[in]  network_id The network identifier of the addresses.
+ * \param[in]  role The role of the payment keys (e.g. 0 for external, 1 for internal chain). Must not be hardened.
+ * \param[in]  start_index The index of the first payment key to derive.
+ * \param[in]  count The number of addresses to derive. The last index must not be hardened.
+ * \param[out] addresses The buffer that receives the address bytes.
+ * \param[in]  addresses_size The size of \p addresses in bytes. Must be at least `count * 29`.
+ *
+ * \return \ref CARDANO_SUCCESS if the addresses were written, \ref CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX if
+ *         the role or any of the indices is hardened, \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if \p addresses is
+ *         too small, or another error code on failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_bip32_public_key_t* account_key = ...; // Assume this is initialized
+ * byte_t addresses[20U * 29U] = { 0 };
+ *
+ * cardano_error_t result = cardano_enterprise_address_derive_bytes(
+ *   account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 20U, addresses, sizeof(addresses));
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_enterprise_address_derive_bytes(
+  const cardano_bip32_public_key_t* account_key,
+  cardano_network_id_t              network_id,
+  uint32_t                          role,
+  uint32_t                          start_index,
+  size_t                            count,
+  byte_t*                           addresses,
+  size_t                            addresses_size);
+
 /**
  * \brief Converts a general Cardano address to an enterprise address.
  *
@@ -0,0 +1,393 @@
+/**
+ * \file block.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_BLOCK_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_BLOCK_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/common/protocol_version.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A Shelley-or-later Cardano block.
+ *
+ * A block is made of a header and four parallel sequences: the transaction bodies, their witness sets,
+ * the auxiliary data of the transactions that carry any, and (from Alonzo on) the indices of the
+ * transactions whose scripts failed phase-2 validation.
+ *
+ * Decoding a block only validates its structure and reads its header; the transactions themselves are
+ * decoded on demand by \ref cardano_block_get_transaction from slices of the block's own encoding.
+ */
+typedef struct cardano_block_t cardano_block_t;
+
+/**
+ * \brief Creates a \ref cardano_block_t from a CBOR reader.
+ *
+ * Accepts a bare block (an array of four elements up to Mary, five from Alonzo on) as well as the
+ * `[era, block]` envelope produced by the node's chain-sync and block-fetch protocols. Byron blocks are
+ * not supported.
+ *
+ * The header is fully decoded and the encoding of each transaction body, witness set and auxiliary data
+ * is located, but none of them is decoded: use \ref cardano_block_get_transaction or
+ * \ref cardano_block_get_transaction_id for that. The block keeps a single copy of its encoding.
+ *
+ * \param[in] reader A pointer to an initialized \ref cardano_cbor_reader_t that is ready to read the CBOR-encoded data.
+ * \param[out] block A pointer to a pointer of \ref cardano_block_t that will be set to the address
+ *                   of the newly created block object upon successful decoding.
+ *
+ * \return A \ref cardano_error_t value indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS
+ *         if the block was successfully created, or an appropriate error code if an error occurred.
+ *
+ * \note If the function fails, the last error can be retrieved by calling \ref cardano_cbor_reader_get_last_error with the reader.
+ *       The caller is responsible for freeing the created \ref cardano_block_t object by calling
+ *       \ref cardano_block_unref when it is no longer needed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t* reader = cardano_cbor_reader_new(cbor_data, data_size);
+ * cardano_block_t* block = NULL;
+ *
+ * cardano_error_t result = cardano_block_from_cbor(reader, &block);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Use the block
+ *
+ *   // Once done, ensure to clean up and release the block
+ *   cardano_block_unref(&block);
+ * }
+ * else
+ * {
+ *   const char* error = cardano_cbor_reader_get_last_error(reader);
+ *   printf("Failed to decode block: %s\n", error);
+ * }
+ *
+ * cardano_cbor_reader_unref(&reader); // Cleanup the CBOR reader
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_block_from_cbor(cardano_cbor_reader_t* reader, cardano_block_t** block);
+
+/**
+ * \brief Gets the height of the block in the chain.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return The block number, or zero if \p block is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_block_get_block_number(const cardano_block_t* block);
+
+/**
+ * \brief Gets the slot the block was minted in.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return The absolute slot number, or zero if \p block is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_block_get_slot(const cardano_block_t* block);
+
+/**
+ * \brief Gets the size of the block body as declared in its header, in bytes.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return The declared body size, or zero if \p block is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_block_get_body_size(const cardano_block_t* block);
+
+/**
+ * \brief Gets the hash of the block header, which identifies the block.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return A new reference to the Blake2b-256 hash of the header, or NULL if \p block is NULL.
+ *         The caller must release it with \ref cardano_blake2b_hash_unref.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_blake2b_hash_t* cardano_block_get_header_hash(const cardano_block_t* block);
+
+/**
+ * \brief Gets the hash of the header of the preceding block.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return A new reference to the previous header hash, or NULL if \p block is NULL or if the block
+ *         follows the genesis. The caller must release it with \ref cardano_blake2b_hash_unref.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_blake2b_hash_t* cardano_block_get_previous_hash(const cardano_block_t* block);
+
+/**
+ * \brief Gets the hash of the block body as declared in its header.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return A new reference to the body hash, or NULL if \p block is NULL. The caller must release it
+ *         with \ref cardano_blake2b_hash_unref.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_blake2b_hash_t* cardano_block_get_body_hash(const cardano_block_t* block);
+
+/**
+ * \brief Gets the protocol version the block was minted under.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return A new reference to the protocol version, or NULL if \p block is NULL. The caller must release
+ *         it with \ref cardano_protocol_version_unref.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_protocol_version_t* cardano_block_get_protocol_version(const cardano_block_t* block);
+
+/**
+ * \brief Gets the number of transactions in the block.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ *
+ * \return The number of transactions, or zero if \p block is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_block_get_transaction_count(const cardano_block_t* block);
+
+/**
+ * \brief Decodes one transaction of the block.
+ *
+ * The transaction is assembled from its body, witness set and auxiliary data, and is flagged as invalid
+ * when the block lists it among the transactions that failed phase-2 validation. Each call decodes the
+ * transaction anew.
+ *
+ * This function only reads from \p block, so several threads may decode different (or the same)
+ * transactions of one block at the same time, as long as none of them releases the block meanwhile.
+ * A chain follower can thus spread the transactions of a block over its own worker threads (see
+ * \ref object_batch_threads).
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ * \param[in] index The position of the transaction in the block.
+ * \param[out] transaction On success, the decoded transaction. The caller must release it with
+ *                         \ref cardano_transaction_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p block or
+ *         \p transaction is NULL, \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is not less than
+ *         the transaction count, or the error of the failing decoder if the transaction is malformed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_block_t* block = ...; // Assume block is already initialized
+ *
+ * for (size_t i = 0U; i < cardano_block_get_transaction_count(block); ++i)
+ * {
+ *   cardano_transaction_t* transaction = NULL;
+ *
+ *   if (cardano_block_get_transaction(block, i, &transaction) == CARDANO_SUCCESS)
+ *   {
+ *     // Use the transaction
+ *   }
+ *
+ *   cardano_transaction_unref(&transaction);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_block_get_transaction(
+  const cardano_block_t*  block,
+  size_t                  index,
+  cardano_transaction_t** transaction);
+
+/**
+ * \brief Computes the id of one transaction of the block without decoding it.
+ *
+ * The id is the Blake2b-256 hash of the transaction body exactly as it is encoded in the block, so it
+ * matches \ref cardano_transaction_get_id on the decoded transaction. Like
+ * \ref cardano_block_get_transaction, this function may be called from several threads at once.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ * \param[in] index The position of the transaction in the block.
+ * \param[out] id On success, the transaction id. The caller must release it with
+ *                \ref cardano_blake2b_hash_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p block or \p id is
+ *         NULL, or \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is not less than the transaction count.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_block_get_transaction_id(
+  const cardano_block_t*   block,
+  size_t                   index,
+  cardano_blake2b_hash_t** id);
+
+/**
+ * \brief Tells whether a transaction of the block passed phase-2 validation.
+ *
+ * \param[in] block A constant pointer to the \ref cardano_block_t object.
+ * \param[in] index The position of the transaction in the block.
+ *
+ * \return false if the block lists the transaction as invalid, or if \p block is NULL or \p index is
+ *         out of bounds; true otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_block_is_transaction_valid(const cardano_block_t* block, size_t index);
+
+/**
+ * \brief Decrements the reference count of a cardano_block_t object.
+ *
+ * This function is responsible for managing the lifecycle of a \ref cardano_block_t object
+ * by decreasing its reference count. When the reference count reaches zero, the block is
+ * finalized; its associated resources are released, and its memory is deallocated.
+ *
+ * \param[in,out] block A pointer to the pointer of the block object. This double
+ *                      indirection allows the function to set the caller's pointer to
+ *                      NULL, avoiding dangling pointer issues after the object has been
+ *                      freed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_block_t* block = ...; // Assume block is already initialized
+ *
+ * // Perform operations with the block...
+ *
+ * cardano_block_unref(&block);
+ * // At this point, block is NULL and cannot be used.
+ * \endcode
+ *
+ * \note After calling \ref cardano_block_unref, the pointer to the \ref cardano_block_t object
+ *       will be set to NULL to prevent its reuse.
+ */
+CARDANO_EXPORT void cardano_block_unref(cardano_block_t** block);
+
+/**
+ * \brief Increases the reference count of the cardano_block_t object.
+ *
+ * This function is used to manually increment the reference count of an cardano_block_t
+ * object, indicating that another part of the code has taken ownership of it. This
+ * ensures the object remains allocated and valid until all owners have released their
+ * reference by calling \ref cardano_block_unref.
+ *
+ * \param block A pointer to the cardano_block_t object whose reference count is to be incremented.
+ *
+ * Usage Example:
+ * \code{.c}
+ * // Assuming block is a previously created block object
+ *
+ * cardano_block_ref(block);
+ *
+ * // Now block can be safely used elsewhere without worrying about premature deallocation
+ * \endcode
+ *
+ * \note Always ensure that for every call to \ref cardano_block_ref there is a corresponding
+ * call to \ref cardano_block_unref to prevent memory leaks.
+ */
+CARDANO_EXPORT void cardano_block_ref(cardano_block_t* block);
+
+/**
+ * \brief Retrieves the current reference count of the cardano_block_t object.
+ *
+ * This function returns the number of active references to an cardano_block_t object. It's useful
+ * for debugging purposes or managing the lifecycle of the object in complex scenarios.
+ *
+ * \warning This function does not account for transitive references. A transitive reference
+ * occurs when an object holds a reference to another object, rather than directly to the
+ * cardano_block_t. As such, the reported count may not fully represent the total number
+ * of conceptual references in cases where such transitive relationships exist.
+ *
+ * \param block A pointer to the cardano_block_t object whose reference count is queried.
+ *              The object must not be NULL.
+ *
+ * \return The number of active references to the specified cardano_block_t object. If the object
+ * is properly managed (i.e., every \ref cardano_block_ref call is matched with a
+ * \ref cardano_block_unref call), this count should reach zero right before the object
+ * is deallocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * // Assuming block is a previously created block object
+ *
+ * size_t ref_count = cardano_block_refcount(block);
+ *
+ * printf("Reference count: %zu\n", ref_count);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_block_refcount(const cardano_block_t* block);
+
+/**
+ * \brief Sets the last error message for a given cardano_block_t object.
+ *
+ * Records an error message in the block's last_error buffer, overwriting any existing message.
+ * This is useful for storing descriptive error information that can be later retrieved. The message
+ * is truncated if it exceeds the buffer's capacity.
+ *
+ * \param[in] block A pointer to the \ref cardano_block_t instance whose last error message is
+ *                  to be set. If \c NULL, the function does nothing.
+ * \param[in] message A null-terminated string containing the error message. If \c NULL, the block's
+ *                    last_error is set to an empty string, indicating no error.
+ *
+ * \note The error message is limited to 1023 characters, including the null terminator, due to the
+ * fixed size of the last_error buffer.
+ */
+CARDANO_EXPORT void cardano_block_set_last_error(
+  cardano_block_t* block,
+  const char*      message);
+
+/**
+ * \brief Retrieves the last error message recorded for a specific block.
+ *
+ * This function returns a pointer to the null-terminated string containing
+ * the last error message set by \ref cardano_block_set_last_error for the given
+ * block. If no error message has been set, or if the last_error buffer was
+ * explicitly cleared, an empty string is returned, indicating no error.
+ *
+ * \param[in] block A pointer to the \ref cardano_block_t instance whose last error
+ *                  message is to be retrieved. If the block is NULL, the function
+ *                  returns a generic error message indicating the null block.
+ *
+ * \return A pointer to a null-terminated string containing the last error
+ *         message for the specified block. If the block is NULL, "Object is NULL."
+ *         is returned to indicate the error.
+ *
+ * \note The returned string points to internal storage within the object and
+ *       must not be modified by the caller. The string remains valid until the
+ *       next call to \ref cardano_block_set_last_error for the same block, or until
+ *       the block is deallocated.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_block_get_last_error(
+  const cardano_block_t* block);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_BLOCK_H
@@ -56,6 +56,7 @@
 #include <cardano/auxiliary_data/plutus_v4_script_list.h>
 #include <cardano/auxiliary_data/transaction_metadata.h>
 #include <cardano/bip39.h>
+#include <cardano/block/block.h>
 #include <cardano/buffer.h>
 #include <cardano/cbor/cbor_major_type.h>
 #include <cardano/cbor/cbor_reader.h>
@@ -107,6 +108,7 @@
 #include <cardano/common/reward_address_list.h>
 #include <cardano/common/unit_interval.h>
 #include <cardano/common/utxo.h>
+#include <cardano/common/utxo_snapshot.h>
 #include <cardano/common/withdrawal_map.h>
 #include <cardano/crypto/bip32_private_key.h>
 #include <cardano/crypto/bip32_public_key.h>
@@ -127,6 +129,8 @@
 #include <cardano/json/json_format.h>
 #include <cardano/json/json_object.h>
 #include <cardano/json/json_object_type.h>
+#include <cardano/json/json_reader.h>
+#include <cardano/json/json_token_type.h>
 #include <cardano/json/json_writer.h>
 #include <cardano/key_handlers/account_derivation_path.h>
 #include <cardano/key_handlers/cip_1852_constants.h>
@@ -175,6 +179,7 @@
 #include <cardano/protocol_params/proposed_param_updates.h>
 #include <cardano/protocol_params/protocol_param_update.h>
 #include <cardano/protocol_params/update.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
 #include <cardano/scripts/native_scripts/native_script.h>
 #include <cardano/scripts/native_scripts/native_script_list.h>
 #include <cardano/scripts/native_scripts/native_script_type.h>
@@ -194,6 +199,7 @@
 #include <cardano/scripts/script_language.h>
 #include <cardano/slot_config.h>
 #include <cardano/time.h>
+#include <cardano/transaction/phase1_validation.h>
 #include <cardano/transaction/sub_transaction.h>
 #include <cardano/transaction/transaction.h>
 #include <cardano/transaction_body/account_balance_interval.h>
@@ -227,6 +233,7 @@
 #include <cardano/transaction_builder/transaction_builder.h>
 #include <cardano/typedefs.h>
 #include <cardano/uplc/uplc_apply_params.h>
+#include <cardano/uplc/uplc_script.h>
 #include <cardano/voting_procedures/governance_action_id_list.h>
 #include <cardano/voting_procedures/vote.h>
 #include <cardano/voting_procedures/voter.h>
@@ -0,0 +1,403 @@
+/**
+ * \file utxo_snapshot.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UTXO_SNAPSHOT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UTXO_SNAPSHOT_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The size in bytes of the transaction id of a snapshot entry.
+ */
+#define CARDANO_UTXO_SNAPSHOT_TX_ID_SIZE (32U)
+
+/**
+ * \brief The size in bytes of the policy id of a snapshot asset.
+ */
+#define CARDANO_UTXO_SNAPSHOT_POLICY_ID_SIZE (28U)
+
+/**
+ * \brief A read-only view over a binary UTxO set snapshot.
+ *
+ * A snapshot is a flat, versioned encoding of a UTxO set meant to be loaded in place: a fixed
+ * header, a table of fixed-size entries (transaction id, output index, lovelace, asset range and
+ * the location of the address, datum and script reference), a table of fixed-size assets and a
+ * blob holding the variable-length parts. All integers are little-endian.
+ *
+ * Loading a snapshot validates its layout once and copies nothing, so the bytes can come straight
+ * from a file mapped into memory. The fields of every entry can then be read without creating any
+ * object, and only the entries actually needed (for example, the ones a wallet hands to a coin
+ * selector) are materialized into \ref cardano_utxo_t objects.
+ */
+typedef struct cardano_utxo_snapshot_t cardano_utxo_snapshot_t;
+
+/**
+ * \brief Encodes a UTxO set as a snapshot.
+ *
+ * Datums and script references are kept as their CBOR encoding and decoded again only when an
+ * entry is materialized.
+ *
+ * \param[in] utxos The UTxO set to encode.
+ * \param[out] snapshot On success, a new buffer holding the snapshot. The caller must release it
+ *             with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_ARGUMENT if an output holds a negative amount, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_utxo_list_t* utxos    = ...; // Assume utxos is already initialized
+ * cardano_buffer_t*    snapshot = NULL;
+ *
+ * if (cardano_utxo_snapshot_encode(utxos, &snapshot) == CARDANO_SUCCESS)
+ * {
+ *   // Write cardano_buffer_get_data(snapshot) to disk.
+ *
+ *   cardano_buffer_unref(&snapshot);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_utxo_snapshot_encode(const cardano_utxo_list_t* utxos, cardano_buffer_t** snapshot);
+
+/**
+ * \brief Loads a snapshot in place.
+ *
+ * The snapshot borrows \p data: nothing is copied, and \p data must stay valid and unchanged until
+ * the snapshot is released. \p data needs no particular alignment.
+ *
+ * \param[in] data The snapshot bytes, for instance a file mapped into memory.
+ * \param[in] size The number of bytes in \p data.
+ * \param[out] snapshot On success, the loaded snapshot. The caller must release it with
+ *             \ref cardano_utxo_snapshot_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p data or
+ *         \p snapshot is NULL, \ref CARDANO_ERROR_INVALID_MAGIC if \p data is not a snapshot,
+ *         \ref CARDANO_ERROR_NOT_IMPLEMENTED if the snapshot has a format version this library does
+ *         not know, \ref CARDANO_ERROR_DECODING if the snapshot is truncated or inconsistent, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const byte_t*            data     = ...; // Assume the snapshot file is mapped here
+ * cardano_utxo_snapshot_t* snapshot = NULL;
+ *
+ * if (cardano_utxo_snapshot_load(data, size, &snapshot) == CARDANO_SUCCESS)
+ * {
+ *   for (size_t i = 0U; i < cardano_utxo_snapshot_get_count(snapshot); ++i)
+ *   {
+ *     printf("%llu lovelace\n", cardano_utxo_snapshot_get_lovelace(snapshot, i));
+ *   }
+ *
+ *   cardano_utxo_snapshot_unref(&snapshot);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_utxo_snapshot_load(const byte_t* data, size_t size, cardano_utxo_snapshot_t** snapshot);
+
+/**
+ * \brief Gets the number of entries in a snapshot.
+ *
+ * \param[in] snapshot The snapshot.
+ *
+ * \return The number of entries, or zero if \p snapshot is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_utxo_snapshot_get_count(const cardano_utxo_snapshot_t* snapshot);
+
+/**
+ * \brief Gets the transaction id of an entry.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return A pointer to the \ref CARDANO_UTXO_SNAPSHOT_TX_ID_SIZE bytes of the id inside the snapshot,
+ *         or NULL if \p snapshot is NULL or \p index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const byte_t* cardano_utxo_snapshot_get_tx_id(const cardano_utxo_snapshot_t* snapshot, size_t index);
+
+/**
+ * \brief Gets the output index of an entry within its transaction.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return The output index, or zero if \p snapshot is NULL or \p index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_utxo_snapshot_get_output_index(const cardano_utxo_snapshot_t* snapshot, size_t index);
+
+/**
+ * \brief Gets the lovelace held by an entry.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return The lovelace, or zero if \p snapshot is NULL or \p index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_utxo_snapshot_get_lovelace(const cardano_utxo_snapshot_t* snapshot, size_t index);
+
+/**
+ * \brief Gets the address of an entry.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ * \param[out] address On success, a pointer to the address bytes inside the snapshot.
+ * \param[out] address_size On success, the number of address bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer is NULL,
+ *         or \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_snapshot_get_address(
+  const cardano_utxo_snapshot_t* snapshot,
+  size_t                         index,
+  const byte_t**                 address,
+  size_t*                        address_size);
+
+/**
+ * \brief Gets the number of native assets held by an entry.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return The number of assets, or zero if \p snapshot is NULL or \p index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_utxo_snapshot_get_asset_count(const cardano_utxo_snapshot_t* snapshot, size_t index);
+
+/**
+ * \brief Gets one native asset held by an entry.
+ *
+ * Assets are stored in the order of the multi-asset map of the output they came from.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ * \param[in] asset_index The index of the asset within the entry.
+ * \param[out] policy_id On success, a pointer to the \ref CARDANO_UTXO_SNAPSHOT_POLICY_ID_SIZE bytes of
+ *             the policy id inside the snapshot.
+ * \param[out] asset_name On success, a pointer to the asset name bytes inside the snapshot.
+ * \param[out] asset_name_size On success, the number of asset name bytes.
+ * \param[out] quantity On success, the quantity held.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer is NULL,
+ *         or \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index or \p asset_index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_snapshot_get_asset(
+  const cardano_utxo_snapshot_t* snapshot,
+  size_t                         index,
+  size_t                         asset_index,
+  const byte_t**                 policy_id,
+  const byte_t**                 asset_name,
+  size_t*                        asset_name_size,
+  int64_t*                       quantity);
+
+/**
+ * \brief Checks whether an entry carries a datum, either inline or by hash.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return \c true if the entry has a datum; \c false otherwise, or if \p snapshot is NULL or \p index
+ *         is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_utxo_snapshot_has_datum(const cardano_utxo_snapshot_t* snapshot, size_t index);
+
+/**
+ * \brief Checks whether an entry carries a script reference.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return \c true if the entry has a script reference; \c false otherwise, or if \p snapshot is NULL
+ *         or \p index is out of bounds.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_utxo_snapshot_has_script_ref(const cardano_utxo_snapshot_t* snapshot, size_t index);
+
+/**
+ * \brief Materializes one entry as a UTxO object.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ * \param[out] utxo On success, a new UTxO. The caller must release it with \ref cardano_utxo_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer is NULL,
+ *         \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is out of bounds, a decoding error if the
+ *         address, datum or script reference of the entry is malformed, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_snapshot_get_utxo(
+  const cardano_utxo_snapshot_t* snapshot,
+  size_t                         index,
+  cardano_utxo_t**               utxo);
+
+/**
+ * \brief Materializes a selection of entries as a UTxO list.
+ *
+ * This is the bridge to the APIs that take a \ref cardano_utxo_list_t, such as the coin selectors: a
+ * caller filters the snapshot through its views and materializes only the candidates.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] indices The indices of the entries to materialize, in the order they are added to the
+ *            list, or NULL to materialize every entry.
+ * \param[in] count The number of elements in \p indices. Ignored if \p indices is NULL.
+ * \param[out] utxos On success, a new list. The caller must release it with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p snapshot or
+ *         \p utxos is NULL, \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if an index is out of bounds, a
+ *         decoding error if an entry is malformed, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_utxo_snapshot_t* snapshot = ...; // Assume snapshot is already loaded
+ * size_t                   selected[64];
+ * size_t                   count = 0U;
+ *
+ * for (size_t i = 0U; (i < cardano_utxo_snapshot_get_count(snapshot)) && (count < 64U); ++i)
+ * {
+ *   if (!cardano_utxo_snapshot_has_script_ref(snapshot, i))
+ *   {
+ *     selected[count++] = i;
+ *   }
+ * }
+ *
+ * cardano_utxo_list_t* utxos = NULL;
+ *
+ * if (cardano_utxo_snapshot_get_utxos(snapshot, selected, count, &utxos) == CARDANO_SUCCESS)
+ * {
+ *   // Hand utxos to a coin selector.
+ *
+ *   cardano_utxo_list_unref(&utxos);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_snapshot_get_utxos(
+  const cardano_utxo_snapshot_t* snapshot,
+  const size_t*                  indices,
+  size_t                         count,
+  cardano_utxo_list_t**          utxos);
+
+/**
+ * \brief Decrements the reference count of a cardano_utxo_snapshot_t object.
+ *
+ * This function is responsible for managing the lifecycle of a \ref cardano_utxo_snapshot_t object
+ * by decreasing its reference count. When the reference count reaches zero, the snapshot is
+ * finalized; its associated resources are released, and its memory is deallocated. The bytes
+ * it was loaded from are not owned by the snapshot and are left untouched.
+ *
+ * \param[in,out] snapshot A pointer to the pointer of the snapshot object. This double
+ *                         indirection allows the function to set the caller's pointer to
+ *                         NULL, avoiding dangling pointer issues after the object has been
+ *                         freed.
+ *
+ * \note After calling \ref cardano_utxo_snapshot_unref, the pointer to the \ref cardano_utxo_snapshot_t object
+ *       will be set to NULL to prevent its reuse.
+ */
+CARDANO_EXPORT void cardano_utxo_snapshot_unref(cardano_utxo_snapshot_t** snapshot);
+
+/**
+ * \brief Increases the reference count of the cardano_utxo_snapshot_t object.
+ *
+ * This function is used to manually increment the reference count of an cardano_utxo_snapshot_t
+ * object, indicating that another part of the code has taken ownership of it. This
+ * ensures the object remains allocated and valid until all owners have released their
+ * reference by calling \ref cardano_utxo_snapshot_unref.
+ *
+ * \param snapshot A pointer to the cardano_utxo_snapshot_t object whose reference count is to be incremented.
+ *
+ * \note Always ensure that for every call to \ref cardano_utxo_snapshot_ref there is a corresponding
+ * call to \ref cardano_utxo_snapshot_unref to prevent memory leaks.
+ */
+CARDANO_EXPORT void cardano_utxo_snapshot_ref(cardano_utxo_snapshot_t* snapshot);
+
+/**
+ * \brief Retrieves the current reference count of the cardano_utxo_snapshot_t object.
+ *
+ * This function returns the number of active references to an cardano_utxo_snapshot_t object. It's useful
+ * for debugging purposes or managing the lifecycle of the object in complex scenarios.
+ *
+ * \param snapshot A pointer to the cardano_utxo_snapshot_t object whose reference count is queried.
+ *
+ * \return The number of active references to the specified cardano_utxo_snapshot_t object, or 0 if
+ *         \p snapshot is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_utxo_snapshot_refcount(const cardano_utxo_snapshot_t* snapshot);
+
+/**
+ * \brief Sets the last error message for a given cardano_utxo_snapshot_t object.
+ *
+ * Records an error message in the snapshot's last_error buffer, overwriting any existing message.
+ * The message is truncated if it exceeds the buffer's capacity.
+ *
+ * \param[in] snapshot A pointer to the \ref cardano_utxo_snapshot_t instance whose last error message is
+ *                     to be set. If \c NULL, the function does nothing.
+ * \param[in] message A null-terminated string containing the error message.
+ *
+ * \note The error message is limited to 1023 characters, including the null terminator, due to the
+ * fixed size of the last_error buffer.
+ */
+CARDANO_EXPORT void cardano_utxo_snapshot_set_last_error(
+  cardano_utxo_snapshot_t* snapshot,
+  const char*              message);
+
+/**
+ * \brief Retrieves the last error message recorded for a specific snapshot.
+ *
+ * \param[in] snapshot A pointer to the \ref cardano_utxo_snapshot_t instance whose last error
+ *                     message is to be retrieved.
+ *
+ * \return A pointer to a null-terminated string containing the last error message for the
+ *         specified snapshot. If the snapshot is NULL, "Object is NULL." is returned.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_utxo_snapshot_get_last_error(
+  const cardano_utxo_snapshot_t* snapshot);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_UTXO_SNAPSHOT_H
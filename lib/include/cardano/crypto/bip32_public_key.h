@@ -258,6 +258,52 @@ CARDANO_EXPORT cardano_error_t cardano_bip32_public_key_derive(
   size_t                            indices_count,
   cardano_bip32_public_key_t**      derived_bip32_public_key);
 
+/**
+ * \brief Derives a run of consecutive child keys of a role and writes their key hashes to a flat array.
+ *
+ * This function derives the role key `account_key/role` once and then the keys `account_key/role/index` for every
+ * index in [\p start_index, \p start_index + \p count). For each key, the Blake2b-224 hash of its Ed25519 public key
+ * (the hash used as the payment or stake credential of an address) is written to \p key_hashes, one after the other.
+ *
+ * No key objects are created, which makes this function suitable for scanning address gap limits, where the same
+ * role key would otherwise be derived again for every index.
+ *
+ * The function runs on the calling thread (see \ref object_batch_threads) and only reads \p account_key, so a scan can
+ * be split by account, or by index range with one call per range.
+ *
+ * \param[in]  account_key The BIP32 public key of the account (i.e. `m/1852'/1815'/account'`).
+ * \param[in]  role The role of the keys (e.g. 0 for external, 1 for internal chain). Must not be hardened.
+ * \param[in]  start_index The index of the first key to derive.
+ * \param[in]  count The number of keys to derive. The last index must not be hardened.
+ * \param[out] key_hashes The buffer that receives the key hashes, \ref CARDANO_BLAKE2B_HASH_SIZE_224 bytes per key.
+ * \param[in]  key_hashes_size The size of \p key_hashes in bytes. Must be at least `count * CARDANO_BLAKE2B_HASH_SIZE_224`.
+ *
+ * \return \ref CARDANO_SUCCESS if the key hashes were written, \ref CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX if
+ *         the role or any of the indices is hardened, \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if \p key_hashes is
+ *         too small, or another error code on failure.
+ *
+ * Example Usage:
+ * \code
+ * cardano_bip32_public_key_t* account_key = ...; // Assume this is initialized
+ * byte_t key_hashes[20U * CARDANO_BLAKE2B_HASH_SIZE_224] = { 0 };
+ *
+ * cardano_error_t error = cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 0U, 20U, key_hashes, sizeof(key_hashes));
+ *
+ * if (error == CARDANO_SUCCESS)
+ * {
+ *   // &key_hashes[i * CARDANO_BLAKE2B_HASH_SIZE_224] is the hash of the key account_key/0/i.
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip32_public_key_derive_key_hashes(
+  const cardano_bip32_public_key_t* account_key,
+  uint32_t                          role,
+  uint32_t                          start_index,
+  size_t                            count,
+  byte_t*                           key_hashes,
+  size_t                            key_hashes_size);
+
 /**
  * \brief Converts a BIP32 public key to an Ed25519 public key.
  *
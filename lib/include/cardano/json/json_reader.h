@@ -0,0 +1,318 @@
+/**
+ * \file json_reader.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_JSON_READER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_JSON_READER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/json/json_token_type.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Provides a API for forward-only, pull-style reading of UTF-8 encoded JSON text.
+ *
+ * Unlike \ref cardano_json_object_parse, the reader does not build a tree of JSON objects: each call to
+ * \ref cardano_json_reader_read advances to the next token and exposes its value until the following call.
+ * Memory use is independent of the size of the document, apart from a scratch buffer that holds the
+ * decoded value of the current string token.
+ */
+typedef struct cardano_json_reader_t cardano_json_reader_t;
+
+/**
+ * \brief Creates a new JSON reader over a JSON document.
+ *
+ * The reader does not copy the document; \p json must remain valid and unchanged for as long as the reader is used.
+ *
+ * \param[in] json A pointer to the JSON text. It does not need to be null-terminated.
+ * \param[in] size The size of the JSON text in bytes.
+ *
+ * \return A pointer to the newly created \ref cardano_json_reader_t, or \c NULL if \p json is NULL or memory could
+ *         not be allocated. The caller must release it with \ref cardano_json_reader_unref.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const char*            json   = "{ \"slot\": 42 }";
+ * cardano_json_reader_t* reader = cardano_json_reader_new(json, strlen(json));
+ *
+ * if (reader != NULL)
+ * {
+ *   // Read tokens
+ *
+ *   cardano_json_reader_unref(&reader);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_json_reader_t* cardano_json_reader_new(const char* json, size_t size);
+
+/**
+ * \brief Advances the reader to the next token.
+ *
+ * The reader validates the structure of the document as it goes: a syntax error, a nesting depth beyond the
+ * library limit or trailing data after the root value is reported as \ref CARDANO_ERROR_INVALID_JSON, and every
+ * later call returns the same error. Once the root value has been read completely, the reader reports
+ * \ref CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] token Receives the type of the token the reader moved to.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_JSON if the document is malformed, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if a string could not be decoded.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
+ *
+ * while ((cardano_json_reader_read(reader, &token) == CARDANO_SUCCESS) && (token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT))
+ * {
+ *   if (token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME)
+ *   {
+ *     size_t      name_size = 0U;
+ *     const char* name      = cardano_json_reader_get_string(reader, &name_size);
+ *
+ *     printf("Property: %s\n", name);
+ *   }
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_read(cardano_json_reader_t* reader, cardano_json_token_type_t* token);
+
+/**
+ * \brief Skips the children of the current token.
+ *
+ * If the current token is a property name, the reader moves past its value. If the current token starts an
+ * object or an array, the reader moves to the token that ends it. For any other token this function does nothing.
+ *
+ * \param[in] reader The JSON reader instance.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p reader is NULL, or the error
+ *         reported by \ref cardano_json_reader_read while skipping.
+ *
+ * Usage Example:
+ * \code{.c}
+ * if (!is_known_property)
+ * {
+ *   cardano_error_t result = cardano_json_reader_skip(reader);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_skip(cardano_json_reader_t* reader);
+
+/**
+ * \brief Retrieves the type of the current token.
+ *
+ * \param[in] reader The JSON reader instance.
+ *
+ * \return The type of the current token, or \ref CARDANO_JSON_TOKEN_TYPE_NONE if \p reader is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_json_token_type_t cardano_json_reader_get_token_type(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Retrieves the nesting depth of the current token.
+ *
+ * The root value is at depth 0; the tokens inside the root object or array are at depth 1, and so on.
+ *
+ * \param[in] reader The JSON reader instance.
+ *
+ * \return The nesting depth of the current token, or 0 if \p reader is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_json_reader_get_depth(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Retrieves the offset in the document just past the current token.
+ *
+ * Together with the offset recorded at a \ref CARDANO_JSON_TOKEN_TYPE_START_OBJECT or
+ * \ref CARDANO_JSON_TOKEN_TYPE_START_ARRAY token, the offset at the matching end token delimits the text
+ * of a whole value, which can then be handed to another parser.
+ *
+ * \param[in] reader The JSON reader instance.
+ *
+ * \return The number of bytes of the document consumed so far, or 0 if \p reader is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_json_reader_get_offset(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Retrieves the decoded value of the current string or property name token.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] size If not NULL, receives the length of the value in bytes, excluding the null terminator.
+ *
+ * \return A pointer to the null-terminated, unescaped value, or \c NULL if the current token is neither a string
+ *         nor a property name. The value is owned by the reader and is only valid until the next call to
+ *         \ref cardano_json_reader_read or \ref cardano_json_reader_skip.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_json_reader_get_string(const cardano_json_reader_t* reader, size_t* size);
+
+/**
+ * \brief Retrieves the value of the current token as an unsigned integer.
+ *
+ * Number tokens and string tokens that hold a decimal integer are accepted.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] value Receives the value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL,
+ *         \ref CARDANO_ERROR_JSON_TYPE_MISMATCH if the token is neither a number nor a string,
+ *         \ref CARDANO_ERROR_DECODING if the value is not an integer, or \ref CARDANO_ERROR_INTEGER_OVERFLOW if it
+ *         is out of the range of \c uint64_t.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_uint(const cardano_json_reader_t* reader, uint64_t* value);
+
+/**
+ * \brief Retrieves the value of the current token as a signed integer.
+ *
+ * Number tokens and string tokens that hold a decimal integer are accepted.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] value Receives the value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL,
+ *         \ref CARDANO_ERROR_JSON_TYPE_MISMATCH if the token is neither a number nor a string,
+ *         \ref CARDANO_ERROR_DECODING if the value is not an integer, or \ref CARDANO_ERROR_INTEGER_OVERFLOW if it
+ *         is out of the range of \c int64_t.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_signed_int(const cardano_json_reader_t* reader, int64_t* value);
+
+/**
+ * \brief Retrieves the value of the current number token as a double.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] value Receives the value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL,
+ *         \ref CARDANO_ERROR_JSON_TYPE_MISMATCH if the token is not a number, or \ref CARDANO_ERROR_DECODING if
+ *         the value is out of the range of \c double.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_double(const cardano_json_reader_t* reader, double* value);
+
+/**
+ * \brief Retrieves the value of the current boolean token.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] value Receives the value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL, or
+ *         \ref CARDANO_ERROR_JSON_TYPE_MISMATCH if the token is not a boolean.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_boolean(const cardano_json_reader_t* reader, bool* value);
+
+/**
+ * \brief Checks whether the current number token has a fraction or an exponent.
+ *
+ * \param[in] reader The JSON reader instance.
+ *
+ * \return \c true if the current token is a number written with a fraction or an exponent, \c false otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_json_reader_get_is_real_number(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Decrements the reference count of a JSON reader.
+ *
+ * When the reference count reaches zero the reader is deallocated and \p json_reader is set to NULL.
+ *
+ * \param[in,out] json_reader A pointer to the JSON reader pointer.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_reader_t* reader = cardano_json_reader_new(json, size);
+ *
+ * // Use the reader
+ *
+ * cardano_json_reader_unref(&reader);
+ * // reader is now NULL
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_json_reader_unref(cardano_json_reader_t** json_reader);
+
+/**
+ * \brief Increments the reference count of a JSON reader.
+ *
+ * \param[in,out] json_reader The JSON reader.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_reader_ref(reader);
+ * // Use the reader, then release the extra reference
+ * cardano_json_reader_unref(&reader);
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_json_reader_ref(cardano_json_reader_t* json_reader);
+
+/**
+ * \brief Retrieves the reference count of a JSON reader.
+ *
+ * \param[in] json_reader The JSON reader.
+ *
+ * \return The number of active references, or 0 if \p json_reader is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_json_reader_refcount(const cardano_json_reader_t* json_reader);
+
+/**
+ * \brief Sets the last error message for a JSON reader.
+ *
+ * \param[in,out] reader The JSON reader. If NULL, the call has no effect.
+ * \param[in] message A null-terminated error message. If NULL, the last error message is cleared.
+ *
+ * \note The error message is limited to 1023 characters due to the fixed size of the last error buffer
+ *       (1024 characters), including the null terminator. Longer messages are truncated.
+ */
+CARDANO_EXPORT void cardano_json_reader_set_last_error(cardano_json_reader_t* reader, const char* message);
+
+/**
+ * \brief Retrieves the last error message recorded for a JSON reader.
+ *
+ * When \ref cardano_json_reader_read reports a malformed document, the message describes the problem.
+ *
+ * \param[in] reader The JSON reader.
+ *
+ * \return A pointer to the null-terminated last error message, or a generic message if \p reader is NULL.
+ *         The string is owned by the reader and must not be freed.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_json_reader_get_last_error(const cardano_json_reader_t* reader);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_JSON_READER_H
@@ -0,0 +1,100 @@
+/**
+ * \file json_token_type.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_JSON_TOKEN_TYPE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_JSON_TOKEN_TYPE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/export.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Enumerates the tokens a \ref cardano_json_reader_t can stop at.
+ */
+typedef enum
+{
+  /**
+   * \brief No token has been read yet.
+   */
+  CARDANO_JSON_TOKEN_TYPE_NONE = 0,
+
+  /**
+   * \brief The start of a JSON object (`{`).
+   */
+  CARDANO_JSON_TOKEN_TYPE_START_OBJECT = 1,
+
+  /**
+   * \brief The end of a JSON object (`}`).
+   */
+  CARDANO_JSON_TOKEN_TYPE_END_OBJECT = 2,
+
+  /**
+   * \brief The start of a JSON array (`[`).
+   */
+  CARDANO_JSON_TOKEN_TYPE_START_ARRAY = 3,
+
+  /**
+   * \brief The end of a JSON array (`]`).
+   */
+  CARDANO_JSON_TOKEN_TYPE_END_ARRAY = 4,
+
+  /**
+   * \brief The name of an object property. The property's value is the next token.
+   */
+  CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME = 5,
+
+  /**
+   * \brief A JSON string value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_STRING = 6,
+
+  /**
+   * \brief A JSON number value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_NUMBER = 7,
+
+  /**
+   * \brief A JSON boolean value (`true` or `false`).
+   */
+  CARDANO_JSON_TOKEN_TYPE_BOOLEAN = 8,
+
+  /**
+   * \brief A JSON null value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_NULL = 9,
+
+  /**
+   * \brief The root value has been read completely and only whitespace follows it.
+   */
+  CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT = 10
+} cardano_json_token_type_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_JSON_TOKEN_TYPE_H
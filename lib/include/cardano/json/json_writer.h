@@ -45,6 +45,21 @@ extern "C" {
  */
 typedef struct cardano_json_writer_t cardano_json_writer_t;
 
+/**
+ * \brief Receives the output of a streaming JSON writer.
+ *
+ * The writer calls the sink with consecutive chunks of the document, in order. A chunk is only valid for the
+ * duration of the call; the sink must consume or copy it before returning.
+ *
+ * \param[in] context The opaque pointer given to \ref cardano_json_writer_new_with_sink.
+ * \param[in] data The next chunk of the document.
+ * \param[in] size The size of the chunk in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS if the chunk was consumed. Any other value is recorded as the writer's error and
+ *         stops further output.
+ */
+typedef cardano_error_t (*cardano_json_writer_sink_func_t)(void* context, const byte_t* data, size_t size);
+
 /**
  * \brief Creates a new JSON writer instance.
  *
@@ -83,6 +98,57 @@ typedef struct cardano_json_writer_t cardano_json_writer_t;
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_json_writer_t* cardano_json_writer_new(cardano_json_format_t format);
 
+/**
+ * \brief Creates a new JSON writer that streams its output to a sink.
+ *
+ * A writer created by \ref cardano_json_writer_new keeps the whole document in memory until it is encoded. A
+ * streaming writer instead hands its output to \p sink every time \p flush_threshold bytes are pending, so
+ * exporting a document of any size (for example, a block's worth of transactions with \ref cardano_transaction_to_cip116_json)
+ * needs a constant amount of memory. Writes larger than the threshold are passed to the sink directly.
+ *
+ * A streaming writer is used like any other writer, except that its output cannot be retrieved with
+ * \ref cardano_json_writer_encode or \ref cardano_json_writer_encode_in_buffer. Call \ref cardano_json_writer_flush
+ * once the document is complete to hand the remaining output to the sink; pending output is discarded if the writer
+ * is released without being flushed.
+ *
+ * \param[in] format The format of the JSON output (compact or pretty).
+ * \param[in] sink The function that receives the output.
+ * \param[in] context An opaque pointer passed to every call of \p sink. May be NULL.
+ * \param[in] flush_threshold The number of pending bytes that triggers a flush, which is also the size of the
+ *            writer's internal buffer.
+ *
+ * \return A pointer to a newly allocated \ref cardano_json_writer_t instance, or \c NULL if \p sink is NULL,
+ *         \p flush_threshold is zero or memory could not be allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * static cardano_error_t
+ * write_to_file(void* context, const byte_t* data, size_t size)
+ * {
+ *   return (fwrite(data, 1, size, (FILE*)context) == size) ? CARDANO_SUCCESS : CARDANO_ERROR_ENCODING;
+ * }
+ *
+ * ...
+ *
+ * cardano_json_writer_t* writer = cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, write_to_file, file, 4096);
+ *
+ * cardano_error_t result = cardano_transaction_to_cip116_json(transaction, writer);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   result = cardano_json_writer_flush(writer);
+ * }
+ *
+ * cardano_json_writer_unref(&writer);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_json_writer_t* cardano_json_writer_new_with_sink(
+  cardano_json_format_t           format,
+  cardano_json_writer_sink_func_t sink,
+  void*                           context,
+  size_t                          flush_threshold);
+
 /**
  * \brief Writes a property name to the JSON output.
  *
@@ -1390,6 +1456,8 @@ CARDANO_EXPORT cardano_json_context_t cardano_json_writer_get_context(cardano_js
  *
  * This function determines the size of the buffer needed to store the  data encoded by the writer.
  * It is intended to be used before calling `cardano_json_writer_encode` to allocate a buffer of appropriate size.
+ * For a writer created by \ref cardano_json_writer_new_with_sink it counts every byte written so far, including
+ * those already handed to the sink.
  *
  * \param[in] writer The source writer whose encoded data size is being calculated.
  *
@@ -1507,6 +1575,32 @@ CARDANO_EXPORT cardano_error_t cardano_json_writer_encode_in_buffer(
   cardano_json_writer_t* writer,
   cardano_buffer_t**     buffer);
 
+/**
+ * \brief Hands the pending output of a streaming writer to its sink.
+ *
+ * Writers created by \ref cardano_json_writer_new_with_sink flush on their own as their buffer fills up; call this
+ * function once the document is complete to flush the remainder. For writers without a sink this function does
+ * nothing.
+ *
+ * \param[in] writer The JSON writer instance to flush.
+ *
+ * \return \ref CARDANO_SUCCESS if the pending output was handed to the sink, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p writer is NULL, the writer's recorded error if a previous write failed, or the error returned by the sink.
+ *
+ * \code{.c}
+ * cardano_json_writer_t* writer = cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, sink, context, 4096);
+ *
+ * cardano_json_writer_write_start_object(writer);
+ * cardano_json_writer_write_end_object(writer);
+ *
+ * cardano_error_t result = cardano_json_writer_flush(writer);
+ *
+ * cardano_json_writer_unref(&writer);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_writer_flush(cardano_json_writer_t* writer);
+
 /**
  * \brief Resets the writer, clearing all written data.
  *
@@ -145,6 +145,53 @@ CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_bip32_sign_transaction
   size_t                           num_paths,
   cardano_vkey_witness_set_t**     vkey_witness_set);
 
+/**
+ * \brief Signs a batch of transactions using BIP32 Hierarchical Deterministic (HD) keys.
+ *
+ * Produces the same witness sets as calling \ref cardano_secure_key_handler_bip32_sign_transaction once per request,
+ * but lets the handler share the expensive steps across the batch. The software handler asks for the passphrase and
+ * decrypts its key material once, and derives each distinct derivation path once, no matter how many transactions it signs.
+ * Handlers that do not implement batching are called once per transaction.
+ *
+ * The software handler signs on the calling thread (see \ref object_batch_threads) and wipes the decrypted root key and
+ * the derived keys before it returns. To sign on several threads, give each thread its own handler.
+ *
+ * \param[in] secure_key_handler A pointer to the secure key handler managing the cryptographic key operations.
+ * \param[in] requests An array of transactions to sign, each with the derivation paths of the keys that must sign it.
+ * \param[in] num_requests The number of requests in the `requests` array.
+ * \param[out] vkey_witness_sets An array of `num_requests` pointers that receives the witness set of each request, in order.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during signing. On failure, every entry of
+ *          `vkey_witness_sets` is set to NULL.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_derivation_path_t       payment_key = { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0, 0, 0 };
+ * cardano_bip32_signing_request_t requests[2] = {
+ *   { tx1, &payment_key, 1 },
+ *   { tx2, &payment_key, 1 }
+ * };
+ * cardano_vkey_witness_set_t* witnesses[2] = { NULL, NULL };
+ *
+ * cardano_error_t result = cardano_secure_key_handler_bip32_sign_transactions(handler, requests, 2, witnesses);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Apply the witnesses, then release them.
+ *   cardano_vkey_witness_set_unref(&witnesses[0]);
+ *   cardano_vkey_witness_set_unref(&witnesses[1]);
+ * }
+ * \endcode
+ *
+ * \note The caller is responsible for releasing every witness set to avoid memory leaks.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_bip32_sign_transactions(
+  cardano_secure_key_handler_t*          secure_key_handler,
+  const cardano_bip32_signing_request_t* requests,
+  size_t                                 num_requests,
+  cardano_vkey_witness_set_t**           vkey_witness_sets);
+
 /**
  * \brief Retrieves the extended BIP32 account public key for a given derivation path.
  *
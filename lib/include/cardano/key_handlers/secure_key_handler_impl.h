@@ -60,6 +60,29 @@ extern "C" {
  */
 typedef struct cardano_secure_key_handler_impl_t cardano_secure_key_handler_impl_t;
 
+/**
+ * \brief A transaction to sign in a batch, together with the BIP32 derivation paths of the keys that must sign it.
+ *
+ * \see cardano_secure_key_handler_bip32_sign_transactions
+ */
+typedef struct cardano_bip32_signing_request_t
+{
+    /**
+     * \brief The transaction to be signed.
+     */
+    cardano_transaction_t* tx;
+
+    /**
+     * \brief The derivation paths of the keys that must sign the transaction.
+     */
+    const cardano_derivation_path_t* derivation_paths;
+
+    /**
+     * \brief The number of derivation paths in the `derivation_paths` array.
+     */
+    size_t num_paths;
+} cardano_bip32_signing_request_t;
+
 /* CALLBACKS *****************************************************************/
 
 /**
@@ -92,6 +115,33 @@ typedef cardano_error_t (*cardano_bip32_sign_transaction_func_t)(
   size_t                             num_paths,
   cardano_vkey_witness_set_t**       vkey_witness_set);
 
+/**
+ * \brief Callback function type for signing a batch of transactions using BIP32 Hierarchical Deterministic (HD) keys.
+ *
+ * The `cardano_bip32_sign_transactions_func_t` typedef defines the signature for a callback function that signs several
+ * transactions in one call. Implementations can amortize the work a single signature would repeat for every transaction,
+ * such as acquiring the passphrase, decrypting the key material, deriving keys or opening a session with a hardware device.
+ *
+ * This function is expected to:
+ * - Produce one `vkey_witness_set` per request, in the same order as `requests`, each holding one witness per
+ *   derivation path of its request.
+ * - Either succeed for every request or fail as a whole, leaving every entry of `vkey_witness_sets` set to NULL.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation that manages cryptographic operations.
+ * \param requests An array of transactions to sign, each with the derivation paths of the keys that must sign it.
+ * \param num_requests The number of requests in the `requests` array.
+ * \param vkey_witness_sets An array of `num_requests` pointers that will receive the witness set of each request.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during signing.
+ *
+ * \note Every witness set must be released by the caller to avoid memory leaks.
+ */
+typedef cardano_error_t (*cardano_bip32_sign_transactions_func_t)(
+  cardano_secure_key_handler_impl_t*     secure_key_handler_impl,
+  const cardano_bip32_signing_request_t* requests,
+  size_t                                 num_requests,
+  cardano_vkey_witness_set_t**           vkey_witness_sets);
+
 /**
  * \brief Callback function type for retrieving a BIP32 extended account public key.
  *
@@ -300,6 +350,17 @@ typedef struct cardano_secure_key_handler_impl_t
      * \see cardano_serialize_secure_key_handler_func_t for more details on the function signature.
      */
     cardano_serialize_secure_key_handler_func_t serialize;
+
+    /**
+     * \brief Callback function to sign a batch of transactions using BIP32 keys.
+     *
+     * \note
+     * This function is only applicable to key handlers of type `CARDANO_SECURE_KEY_HANDLER_TYPE_BIP32` and is optional. When it
+     * is NULL, batches are signed by calling `bip32_sign_transaction` once per transaction.
+     *
+     * \see cardano_bip32_sign_transactions_func_t for more details on the function signature.
+     */
+    cardano_bip32_sign_transactions_func_t bip32_sign_transactions;
 } cardano_secure_key_handler_impl_t;
 
 #ifdef __cplusplus
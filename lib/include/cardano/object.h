@@ -54,6 +54,41 @@ typedef void (*cardano_object_deallocator_t)(void* data);
  * \brief Base object type.
  *
  * All objects in the library are derived from this type.
+ *
+ * \section object_thread_safety Sharing objects between threads
+ *
+ * By default reference counts are plain integers and an object must only be used from one
+ * thread at a time. When the library is configured with `-DATOMIC_REFCOUNT_ENABLED=ON`,
+ * \ref cardano_object_ref and \ref cardano_object_unref update the count atomically, and an
+ * object may then be shared between threads as long as every thread holds its own reference
+ * and only calls read functions on it. Read functions are the `get`, `has`, `to_cbor`,
+ * `to_cip116_json`, hash and equality functions of the library types: they never write to the
+ * object they are given, only to the reference counts of the children they return. CBOR caches
+ * are filled once while decoding and only cleared by mutating functions. The one exception is
+ * \ref cardano_address_t, which formats its string and decodes its credentials on first use; in
+ * the atomic build those fields are published with a compare-and-swap, so concurrent first reads
+ * are safe and all return the same value. This is what allows a decoded protocol parameter set,
+ * cost model, UTxO list or reference script to be shared by several workers without copying it.
+ *
+ * The following remain unsafe to use concurrently, even in the atomic build:
+ *
+ * - Any function that modifies an object (`set`, `add`, `remove`, `clear_cbor_cache`, sorting,
+ *   and so on) while another thread uses the same object or one of its children.
+ * - \ref cardano_object_set_last_error and the per-type `set_last_error` functions, and reading
+ *   the last error of an object another thread may be setting.
+ * - Objects that keep working state across calls, such as CBOR readers and writers, providers,
+ *   transaction builders and UPLC script handles. Use one per thread.
+ * - \ref cardano_set_allocators, which must be called before any object is created.
+ *
+ * \section object_batch_threads Batch functions and threads
+ *
+ * The library never starts threads of its own. Functions that work on a batch, such as
+ * verifying the witnesses of a block, signing several transactions or deriving a run of keys,
+ * do all their work on the calling thread. A caller that wants the work spread over several
+ * cores splits the batch and calls the function once per part from its own workers, following
+ * the sharing rules above. This keeps the library free of any threading dependency on the
+ * platforms it targets, and leaves scheduling to applications that usually already run their
+ * own worker pools. Each batch function documents how its input may be split.
  */
 typedef struct cardano_object_t
 {
@@ -67,6 +102,9 @@ typedef struct cardano_object_t
  *
  * If the reference count reaches zero, the object memory is deallocated.
  *
+ * \note In builds configured with `ATOMIC_REFCOUNT_ENABLED` the decrement is atomic, so
+ * threads sharing an object may release their references concurrently.
+ *
  * \param[in] object Pointer to the object whose reference count is to be decremented.
  */
 CARDANO_EXPORT void cardano_object_unref(cardano_object_t** object);
@@ -76,6 +114,9 @@ CARDANO_EXPORT void cardano_object_unref(cardano_object_t** object);
  *
  * Ensures that the object remains allocated until the last reference is released.
  *
+ * \note In builds configured with `ATOMIC_REFCOUNT_ENABLED` the increment is atomic. A thread
+ * may only take a new reference through a reference it already holds.
+ *
  * \param[in] object object whose reference count is to be incremented.
  */
 CARDANO_EXPORT void cardano_object_ref(cardano_object_t* object);
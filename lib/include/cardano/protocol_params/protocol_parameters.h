@@ -2806,6 +2806,43 @@ CARDANO_EXPORT cardano_error_t cardano_protocol_parameters_set_ref_script_cost_m
   cardano_protocol_parameters_t* protocol_parameters,
   cardano_unit_interval_t*       ref_script_cost_multiplier);
 
+/**
+ * \brief Creates a shallow clone of a protocol parameters object.
+ *
+ * This function creates a new \ref cardano_protocol_parameters_t object holding the same values as the
+ * provided protocol parameters. Scalar parameters are copied; the nested objects (unit intervals, cost
+ * models, execution unit prices and limits, voting thresholds, the protocol version and the extra
+ * entropy) are not duplicated; instead, their reference counts are incremented.
+ *
+ * \param[in] protocol_parameters The protocol parameters to be cloned. Must not be \c NULL.
+ *
+ * \return A pointer to the new \ref cardano_protocol_parameters_t object, or \c NULL if \p protocol_parameters
+ * is \c NULL or if memory allocation fails.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_protocol_parameters_t* clone = cardano_protocol_parameters_clone(protocol_parameters);
+ *
+ * if (clone == NULL)
+ * {
+ *     // Handle error (e.g., memory allocation failure)
+ * }
+ *
+ * // Setting a parameter on the clone leaves the original untouched
+ * cardano_protocol_parameters_set_min_fee_a(clone, 50);
+ *
+ * cardano_protocol_parameters_unref(&clone);
+ * \endcode
+ *
+ * \note The clone and the original share the same nested objects. Replacing a parameter through a setter
+ *       only affects the object it is called on, but modifying a shared nested object in place is visible
+ *       through both.
+ *
+ * \see cardano_protocol_parameters_unref()
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_protocol_parameters_t* cardano_protocol_parameters_clone(cardano_protocol_parameters_t* protocol_parameters);
+
 /**
  * \brief Decrements the reference count of a cardano_protocol_parameters_t object.
  *
@@ -0,0 +1,161 @@
+/**
+ * \file caching_provider.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CACHING_PROVIDER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CACHING_PROVIDER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/providers/provider.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Function pointer type for reading the current time.
+ *
+ * \param[in] context The opaque context given alongside the clock in
+ *                    \ref cardano_caching_provider_options_t.
+ *
+ * \return The current time, in milliseconds. Only differences between readings matter, except
+ *         for epoch scoping of protocol parameters, which expects Unix time.
+ */
+typedef uint64_t (*cardano_caching_provider_clock_func_t)(void* context);
+
+/**
+ * \brief Tuning of a caching provider.
+ *
+ * Start from \ref cardano_caching_provider_options_default and override the fields that matter.
+ */
+typedef struct cardano_caching_provider_options_t
+{
+    /**
+     * \brief How long protocol parameters are served from the cache, in milliseconds.
+     *
+     * On networks with a known epoch schedule (mainnet, preprod and preview) cached parameters
+     * are also dropped as soon as the epoch they were fetched in ends, whatever this TTL says.
+     */
+    uint64_t parameters_ttl_ms;
+
+    /**
+     * \brief How long unspent outputs, by address or by input, are served from the cache, in milliseconds.
+     */
+    uint64_t utxo_ttl_ms;
+
+    /**
+     * \brief How long resolved datums are served from the cache, in milliseconds.
+     */
+    uint64_t datum_ttl_ms;
+
+    /**
+     * \brief The maximum number of entries each cache holds. A cache that fills up is emptied.
+     */
+    size_t max_entries;
+
+    /**
+     * \brief The clock the TTLs are measured with, or NULL for the system wall clock.
+     */
+    cardano_caching_provider_clock_func_t clock;
+
+    /**
+     * \brief The opaque context passed to \ref clock.
+     */
+    void* clock_context;
+} cardano_caching_provider_options_t;
+
+/**
+ * \brief Gets the default caching provider options.
+ *
+ * Protocol parameters are cached for 10 minutes (and never past the end of their epoch), unspent
+ * outputs for 20 seconds and datums for one hour, with up to 1024 entries per cache, measured
+ * with the system wall clock.
+ *
+ * \return The default options.
+ */
+CARDANO_EXPORT cardano_caching_provider_options_t cardano_caching_provider_options_default(void);
+
+/**
+ * \brief Creates a provider that caches and batches the requests it forwards to another provider.
+ *
+ * The returned provider answers repeated requests from memory:
+ *
+ * - protocol parameters are cached for \c parameters_ttl_ms and never past the end of the epoch
+ *   they were fetched in;
+ * - unspent outputs are cached by address and by transaction input for \c utxo_ttl_ms. The outputs
+ *   listed for an address also seed the by-input cache, so resolving them later costs nothing.
+ *   Submitting a transaction through the caching provider drops every cached address listing and
+ *   every input the transaction spends;
+ * - datums are cached by hash for \c datum_ttl_ms. A datum never changes for a given hash, so the
+ *   TTL only bounds memory. Reference scripts travel inside the outputs that carry them and are
+ *   cached along with those outputs.
+ *
+ * \ref cardano_provider_resolve_unspent_outputs answers every input it has cached and forwards the
+ * rest to the backend in a single batched call; the resolved outputs are returned in input order.
+ * Every other request is forwarded as is.
+ *
+ * Every caller gets its own copy of a cached value: protocol parameters are returned as clones (see
+ * \ref cardano_protocol_parameters_clone), and unspent outputs and datums as deep copies, so editing a
+ * returned value never affects the cache or what other callers are served. Like every provider, a
+ * caching provider must not be used from several threads at once.
+ *
+ * \param[in]  backend  The provider to forward requests to. Must not be NULL. The caching provider
+ *                      keeps a reference to it.
+ * \param[in]  options  The cache tuning, or NULL for \ref cardano_caching_provider_options_default.
+ * \param[out] provider On success, the caching provider. Release it with \ref cardano_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p backend or
+ *         \p provider is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the provider cannot
+ *         be allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_provider_t* backend = ...; // Assume this is initialized
+ * cardano_provider_t* provider = NULL;
+ *
+ * cardano_caching_provider_options_t options = cardano_caching_provider_options_default();
+ * options.utxo_ttl_ms = 5000U;
+ *
+ * cardano_error_t result = cardano_caching_provider_new(backend, &options, &provider);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Use provider wherever backend was used.
+ * }
+ *
+ * cardano_provider_unref(&provider);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_caching_provider_new(
+  cardano_provider_t*                       backend,
+  const cardano_caching_provider_options_t* options,
+  cardano_provider_t**                      provider);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CACHING_PROVIDER_H
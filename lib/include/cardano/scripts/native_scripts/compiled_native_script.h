@@ -0,0 +1,283 @@
+/**
+ * \file compiled_native_script.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_COMPILED_NATIVE_SCRIPT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_COMPILED_NATIVE_SCRIPT_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/guard_set.h>
+#include <cardano/crypto/blake2b_hash_set.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/scripts/native_scripts/native_script.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A native script compiled for repeated evaluation.
+ *
+ * Compiling flattens the script tree into a post-order array of predicates and interns every key hash
+ * and guard credential it mentions into a sorted table, so evaluating the script walks a flat array and
+ * resolves each signer with a binary search instead of traversing the reference-counted script objects.
+ * Compile a script once and evaluate it against as many signer sets and validity intervals as needed.
+ */
+typedef struct cardano_compiled_native_script_t cardano_compiled_native_script_t;
+
+/**
+ * \brief Compiles a native script for evaluation.
+ *
+ * \param[in] native_script The native script to compile.
+ * \param[out] compiled_native_script On success, the compiled script. The caller must release it with
+ *             \ref cardano_compiled_native_script_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL, or another
+ *         error code if the script could not be read.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_native_script_t*          script   = ...;
+ * cardano_compiled_native_script_t* compiled = NULL;
+ *
+ * cardano_error_t result = cardano_compiled_native_script_new(script, &compiled);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Evaluate the compiled script
+ *
+ *   cardano_compiled_native_script_unref(&compiled);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_compiled_native_script_new(
+  cardano_native_script_t*           native_script,
+  cardano_compiled_native_script_t** compiled_native_script);
+
+/**
+ * \brief Evaluates a compiled native script against a transaction's signers and validity interval.
+ *
+ * A \c sig predicate holds when its key hash is in \p signers, an \c invalid_before predicate holds when the
+ * transaction's lower bound is set and not before the script's slot, an \c invalid_after predicate holds when
+ * the transaction's upper bound is set and not after the script's slot, and a \c require_guard predicate holds
+ * when its credential is in \p guards.
+ *
+ * When the script is satisfied, \p minimal_signers receives a subset of \p signers that is enough to satisfy
+ * it on its own: every \c all node keeps the signers of all its children, and every \c any and \c n_of_k node
+ * keeps only the satisfied children that need the fewest signers. The set is minimal node by node; when
+ * branches share keys a smaller set may exist.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ * \param[in] signers The key hashes that sign the transaction. May be NULL if there are none.
+ * \param[in] invalid_before The transaction's validity start slot, or NULL if it has none.
+ * \param[in] invalid_after The transaction's validity end slot, or NULL if it has none.
+ * \param[in] guards The transaction's guards. May be NULL if there are none.
+ * \param[out] satisfied Receives whether the script is satisfied.
+ * \param[out] minimal_signers If not NULL, receives the minimal satisfying signers; the set is empty when the
+ *             script is not satisfied. The caller must release it with \ref cardano_blake2b_hash_set_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p compiled_native_script or
+ *         \p satisfied is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if memory could not be allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_compiled_native_script_t* compiled = ...;
+ * cardano_blake2b_hash_set_t*       signers  = ...;
+ * const uint64_t                    ttl      = 1000;
+ * bool                              ok       = false;
+ * cardano_blake2b_hash_set_t*       minimal  = NULL;
+ *
+ * cardano_error_t result = cardano_compiled_native_script_evaluate(compiled, signers, NULL, &ttl, NULL, &ok, &minimal);
+ *
+ * if ((result == CARDANO_SUCCESS) && ok)
+ * {
+ *   printf("%zu witnesses needed\n", cardano_blake2b_hash_set_get_length(minimal));
+ * }
+ *
+ * cardano_blake2b_hash_set_unref(&minimal);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_compiled_native_script_evaluate(
+  const cardano_compiled_native_script_t* compiled_native_script,
+  const cardano_blake2b_hash_set_t*       signers,
+  const uint64_t*                         invalid_before,
+  const uint64_t*                         invalid_after,
+  const cardano_guard_set_t*              guards,
+  bool*                                   satisfied,
+  cardano_blake2b_hash_set_t**            minimal_signers);
+
+/**
+ * \brief Retrieves every distinct key hash a compiled native script mentions in a \c sig predicate.
+ *
+ * Evaluating a script with this set as its signers tells whether any combination of signatures can satisfy it,
+ * and how many are needed at least.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ * \param[out] key_hashes On success, the key hashes in ascending order. The caller must release the set with
+ *             \ref cardano_blake2b_hash_set_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if memory could not be allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_compiled_native_script_t* compiled   = ...;
+ * cardano_blake2b_hash_set_t*       key_hashes = NULL;
+ *
+ * cardano_error_t result = cardano_compiled_native_script_get_key_hashes(compiled, &key_hashes);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   cardano_blake2b_hash_set_unref(&key_hashes);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_compiled_native_script_get_key_hashes(
+  const cardano_compiled_native_script_t* compiled_native_script,
+  cardano_blake2b_hash_set_t**            key_hashes);
+
+/**
+ * \brief Compiles and evaluates a native script once.
+ *
+ * This is a shorthand for \ref cardano_compiled_native_script_new followed by
+ * \ref cardano_compiled_native_script_evaluate. Compile the script explicitly when it is evaluated more than once.
+ *
+ * \param[in] native_script The native script to evaluate.
+ * \param[in] signers The key hashes that sign the transaction. May be NULL if there are none.
+ * \param[in] invalid_before The transaction's validity start slot, or NULL if it has none.
+ * \param[in] invalid_after The transaction's validity end slot, or NULL if it has none.
+ * \param[in] guards The transaction's guards. May be NULL if there are none.
+ * \param[out] satisfied Receives whether the script is satisfied.
+ * \param[out] minimal_signers If not NULL, receives the minimal satisfying signers. The caller must release it
+ *             with \ref cardano_blake2b_hash_set_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code as described for
+ *         \ref cardano_compiled_native_script_new and \ref cardano_compiled_native_script_evaluate.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_native_script_t*    script  = ...;
+ * cardano_blake2b_hash_set_t* signers = ...;
+ * bool                        ok      = false;
+ *
+ * cardano_error_t result = cardano_native_script_evaluate(script, signers, NULL, NULL, NULL, &ok, NULL);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_native_script_evaluate(
+  cardano_native_script_t*          native_script,
+  const cardano_blake2b_hash_set_t* signers,
+  const uint64_t*                   invalid_before,
+  const uint64_t*                   invalid_after,
+  const cardano_guard_set_t*        guards,
+  bool*                             satisfied,
+  cardano_blake2b_hash_set_t**      minimal_signers);
+
+/**
+ * \brief Decrements the reference count of a compiled native script.
+ *
+ * When the reference count reaches zero the compiled script is deallocated and \p compiled_native_script is set
+ * to NULL.
+ *
+ * \param[in,out] compiled_native_script A pointer to the compiled script pointer.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_compiled_native_script_t* compiled = ...;
+ *
+ * cardano_compiled_native_script_unref(&compiled);
+ * // compiled is now NULL if this was the last reference
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_compiled_native_script_unref(cardano_compiled_native_script_t** compiled_native_script);
+
+/**
+ * \brief Increments the reference count of a compiled native script.
+ *
+ * \param[in,out] compiled_native_script The compiled script.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_compiled_native_script_t* compiled = ...;
+ *
+ * cardano_compiled_native_script_ref(compiled);
+ * // Use the compiled script, then release the extra reference
+ * cardano_compiled_native_script_unref(&compiled);
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_compiled_native_script_ref(cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Retrieves the reference count of a compiled native script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return The number of active references, or 0 if \p compiled_native_script is NULL.
+ *
+ * Usage Example:
+ * \code{.c}
+ * size_t ref_count = cardano_compiled_native_script_refcount(compiled);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_compiled_native_script_refcount(const cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Sets the last error message for a compiled native script.
+ *
+ * \param[in,out] compiled_native_script The compiled script. If NULL, the call has no effect.
+ * \param[in] message A null-terminated error message. If NULL, the last error message is cleared.
+ *
+ * \note The error message is limited to 1023 characters due to the fixed size of the last error buffer
+ *       (1024 characters), including the null terminator. Longer messages are truncated.
+ */
+CARDANO_EXPORT void cardano_compiled_native_script_set_last_error(
+  cardano_compiled_native_script_t* compiled_native_script,
+  const char*                       message);
+
+/**
+ * \brief Retrieves the last error message recorded for a compiled native script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return A pointer to the null-terminated last error message, or a generic message if \p compiled_native_script
+ *         is NULL. The string is owned by the compiled script and must not be freed.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_compiled_native_script_get_last_error(
+  const cardano_compiled_native_script_t* compiled_native_script);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_COMPILED_NATIVE_SCRIPT_H
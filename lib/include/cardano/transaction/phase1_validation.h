@@ -0,0 +1,223 @@
+/**
+ * \file phase1_validation.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_PHASE1_VALIDATION_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_PHASE1_VALIDATION_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/protocol_params/protocol_parameters.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The ledger rules a transaction can break during phase-1 validation.
+ *
+ * Each violation is a distinct bit, so the violations found in one pass over a transaction
+ * are reported together as a bitwise OR in \ref cardano_phase1_validation_result_t.
+ */
+typedef enum
+{
+  /**
+   * \brief The transaction spends no inputs.
+   */
+  CARDANO_PHASE1_VIOLATION_INPUT_SET_EMPTY = 1 << 0,
+
+  /**
+   * \brief An input, collateral input or reference input is missing from the resolved UTxOs.
+   */
+  CARDANO_PHASE1_VIOLATION_BAD_INPUTS = 1 << 1,
+
+  /**
+   * \brief The fee is lower than the minimum fee.
+   */
+  CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL = 1 << 2,
+
+  /**
+   * \brief The consumed and produced values differ.
+   */
+  CARDANO_PHASE1_VIOLATION_VALUE_NOT_CONSERVED = 1 << 3,
+
+  /**
+   * \brief An output holds less than the minimum ADA for its size.
+   */
+  CARDANO_PHASE1_VIOLATION_OUTPUT_TOO_SMALL = 1 << 4,
+
+  /**
+   * \brief The serialized value of an output exceeds the maximum value size.
+   */
+  CARDANO_PHASE1_VIOLATION_OUTPUT_VALUE_TOO_LARGE = 1 << 5,
+
+  /**
+   * \brief The serialized transaction exceeds the maximum transaction size.
+   */
+  CARDANO_PHASE1_VIOLATION_MAX_TX_SIZE_EXCEEDED = 1 << 6,
+
+  /**
+   * \brief The redeemers declare more execution units than a transaction may use.
+   */
+  CARDANO_PHASE1_VIOLATION_EX_UNITS_TOO_BIG = 1 << 7,
+
+  /**
+   * \brief The current slot is outside the transaction's validity interval.
+   */
+  CARDANO_PHASE1_VIOLATION_OUTSIDE_VALIDITY_INTERVAL = 1 << 8,
+
+  /**
+   * \brief The transaction runs scripts but has no collateral inputs.
+   */
+  CARDANO_PHASE1_VIOLATION_NO_COLLATERAL_INPUTS = 1 << 9,
+
+  /**
+   * \brief The transaction has more collateral inputs than allowed.
+   */
+  CARDANO_PHASE1_VIOLATION_TOO_MANY_COLLATERAL_INPUTS = 1 << 10,
+
+  /**
+   * \brief The collateral balance does not cover the required percentage of the fee.
+   */
+  CARDANO_PHASE1_VIOLATION_INSUFFICIENT_COLLATERAL = 1 << 11,
+
+  /**
+   * \brief The declared total collateral does not match the collateral balance.
+   */
+  CARDANO_PHASE1_VIOLATION_INCORRECT_TOTAL_COLLATERAL = 1 << 12,
+
+  /**
+   * \brief A key hash that must sign the transaction has no vkey witness.
+   */
+  CARDANO_PHASE1_VIOLATION_MISSING_VKEY_WITNESSES = 1 << 13,
+
+  /**
+   * \brief A native script in the witness set is not satisfied by the vkey witnesses, validity interval and guards.
+   */
+  CARDANO_PHASE1_VIOLATION_NATIVE_SCRIPT_FAILED = 1 << 14,
+
+  /**
+   * \brief The collateral inputs hold native assets that the collateral return does not give back.
+   */
+  CARDANO_PHASE1_VIOLATION_COLLATERAL_CONTAINS_NON_ADA = 1 << 15
+} cardano_phase1_violation_t;
+
+/**
+ * \brief The outcome of phase-1 validation.
+ */
+typedef struct cardano_phase1_validation_result_t
+{
+    /**
+     * \brief The bitwise OR of every \ref cardano_phase1_violation_t found; 0 when the transaction is valid.
+     */
+    uint32_t violations;
+
+    /**
+     * \brief The minimum fee of the transaction. Only computed when every input resolves.
+     */
+    uint64_t min_fee;
+
+    /**
+     * \brief The serialized size of the transaction, in bytes.
+     */
+    size_t tx_size;
+
+    /**
+     * \brief The number of outputs, including the collateral return, holding less than their minimum ADA.
+     */
+    size_t undersized_output_count;
+
+    /**
+     * \brief The number of required key hashes without a vkey witness. Only computed when every input resolves.
+     */
+    size_t missing_signer_count;
+} cardano_phase1_validation_result_t;
+
+/**
+ * \brief Converts a phase-1 violation to its human readable form.
+ *
+ * \param[in] violation The violation to get the string representation for.
+ * \return Human readable form of the given violation.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_phase1_violation_to_string(cardano_phase1_violation_t violation);
+
+/**
+ * \brief Checks a transaction against the phase-1 ledger rules.
+ *
+ * Phase-1 validation covers every rule that does not need a Plutus script to run: the input
+ * sets, the minimum fee, value preservation, the minimum ADA and maximum value size of each
+ * output and of the collateral return, the maximum transaction size, the validity interval,
+ * execution unit limits, collateral, the presence of a vkey witness for every required signer, and the native scripts
+ * in the witness set. A transaction
+ * that fails any of these rules is rejected by a node before its scripts are evaluated.
+ *
+ * Every rule is checked in a single pass and all violations are reported together, so a
+ * batch of candidate transactions can be filtered locally without a round trip to a node.
+ * Signatures are not verified here; see \ref cardano_transaction_verify_vkey_witnesses.
+ *
+ * \param[in] transaction The transaction to validate.
+ * \param[in] resolved_inputs The UTxOs the transaction spends, uses as collateral and references.
+ * \param[in] protocol_params The protocol parameters in effect.
+ * \param[in] current_slot The slot the validity interval is checked against.
+ * \param[out] result Receives the violations found and the figures they were judged on.
+ *
+ * \return \ref CARDANO_SUCCESS if the transaction was checked, whether or not it is valid,
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer argument is NULL, or another error
+ *         code if a rule could not be evaluated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_transaction_t*             tx       = ...;
+ * cardano_utxo_list_t*               utxos    = ...;
+ * cardano_protocol_parameters_t*     params   = ...;
+ * cardano_phase1_validation_result_t report   = { 0 };
+ *
+ * cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, current_slot, &report);
+ *
+ * if ((result == CARDANO_SUCCESS) && (report.violations != 0U))
+ * {
+ *   if ((report.violations & CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL) != 0U)
+ *   {
+ *     printf("%s, minimum fee is %llu\n", cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL), report.min_fee);
+ *   }
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_validate_phase1(
+  cardano_transaction_t*              transaction,
+  cardano_utxo_list_t*                resolved_inputs,
+  cardano_protocol_parameters_t*      protocol_params,
+  uint64_t                            current_slot,
+  cardano_phase1_validation_result_t* result);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_PHASE1_VALIDATION_H
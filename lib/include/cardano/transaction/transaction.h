@@ -752,6 +752,75 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_get_unique_signers(
   cardano_utxo_list_t*         resolved_inputs,
   cardano_blake2b_hash_set_t** unique_signers);
 
+/**
+ * \brief Verifies the vkey and bootstrap witness signatures of a transaction against its body hash.
+ *
+ * Every witness in the transaction's \ref cardano_vkey_witness_set_t and
+ * \ref cardano_bootstrap_witness_set_t is checked with strict (cofactorless) Ed25519
+ * verification over the transaction id, which is computed once for the whole witness set.
+ * This checks signatures only; whether the witnesses cover every required signer is a
+ * separate question (see \ref cardano_transaction_get_unique_signers).
+ *
+ * \param[in] transaction The transaction whose witnesses are verified.
+ * \param[out] vkey_valid Optional array receiving one flag per vkey witness, in witness set order.
+ *                        May be NULL.
+ * \param[in] vkey_valid_size The number of elements in \p vkey_valid.
+ * \param[out] bootstrap_valid Optional array receiving one flag per bootstrap witness, in witness
+ *                             set order. May be NULL.
+ * \param[in] bootstrap_valid_size The number of elements in \p bootstrap_valid.
+ * \param[out] invalid_count Receives the number of witnesses whose signature did not verify.
+ *
+ * \return \ref CARDANO_SUCCESS if every witness was checked (whether or not it verified),
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if \p transaction or \p invalid_count is NULL,
+ *         \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if a flag array is shorter than its witness
+ *         set, or another error code if a witness could not be read.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_transaction_t* tx      = ...; // Received from the network
+ * size_t                 invalid = 0U;
+ *
+ * cardano_error_t result = cardano_transaction_verify_vkey_witnesses(tx, NULL, 0U, NULL, 0U, &invalid);
+ *
+ * if ((result == CARDANO_SUCCESS) && (invalid == 0U))
+ * {
+ *   // All signatures are valid
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_verify_vkey_witnesses(
+  cardano_transaction_t* transaction,
+  bool*                  vkey_valid,
+  size_t                 vkey_valid_size,
+  bool*                  bootstrap_valid,
+  size_t                 bootstrap_valid_size,
+  size_t*                invalid_count);
+
+/**
+ * \brief Verifies the witness signatures of several transactions, such as the transactions of a block.
+ *
+ * Each transaction is checked as by \ref cardano_transaction_verify_vkey_witnesses. The function
+ * runs on the calling thread (see \ref object_batch_threads) and keeps no shared state, so a block
+ * can be split into contiguous slices of \p transactions and \p valid, one per worker. In default
+ * builds no object may be reachable from two slices; in builds configured with
+ * `ATOMIC_REFCOUNT_ENABLED` the slices may share objects (see \ref object_thread_safety).
+ *
+ * \param[in] transactions The transactions to verify. Must not contain NULL entries.
+ * \param[in] count The number of transactions.
+ * \param[out] valid An array of \p count flags; \c valid[i] is set to \c true when every witness of
+ *                   \c transactions[i] verifies.
+ *
+ * \return \ref CARDANO_SUCCESS if every transaction was checked,
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if \p transactions, an entry of it, or \p valid is NULL,
+ *         or another error code if a witness could not be read.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_verify_vkey_witnesses_many(
+  cardano_transaction_t* const* transactions,
+  size_t                        count,
+  bool*                         valid);
+
 /**
  * \brief Finds the index of an input in the transaction's canonically ordered input set.
  *
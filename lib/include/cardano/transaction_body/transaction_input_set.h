@@ -256,7 +256,8 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_get(const cardano_t
 /**
  * \brief Adds an element to a transaction_input list.
  *
- * This function adds the specified element to the end of the provided \ref cardano_transaction_input_set_t object.
+ * This function inserts the specified element into the provided \ref cardano_transaction_input_set_t object at the
+ * position that keeps the set in canonical (sorted) order.
  *
  * \param[in] transaction_input_set A constant pointer to the \ref cardano_transaction_input_set_t object to which
  *                        the element is to be added.
@@ -288,6 +289,41 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_get(const cardano_t
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_add(cardano_transaction_input_set_t* transaction_input_set, cardano_transaction_input_t* element);
 
+/**
+ * \brief Finds the position of an input in a transaction_input set.
+ *
+ * Inputs in the set are kept in canonical order (by transaction id, then output index), so the position of an
+ * input is also the index a redeemer must use to point at it. The input is found with a binary search.
+ *
+ * \param[in]  transaction_input_set A constant pointer to the \ref cardano_transaction_input_set_t object to search.
+ * \param[in]  id The id of the transaction that produced the output spent by the input.
+ * \param[in]  output_index The index of the output in that transaction.
+ * \param[out] index On success, receives the position of the input in the set.
+ *
+ * \return \ref CARDANO_SUCCESS if the input was found, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if the set does not
+ *         contain it, or \ref CARDANO_ERROR_POINTER_IS_NULL if any of the pointers is NULL.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_transaction_input_set_t* transaction_input_set = ...; // Assume this is initialized
+ * cardano_blake2b_hash_t* tx_id = ...; // Assume this is initialized
+ * size_t index = 0U;
+ *
+ * cardano_error_t result = cardano_transaction_input_set_find_index(transaction_input_set, tx_id, 0U, &index);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // The input tx_id#0 is at position `index` of the set.
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_find_index(
+  const cardano_transaction_input_set_t* transaction_input_set,
+  const cardano_blake2b_hash_t*          id,
+  uint64_t                               output_index,
+  size_t*                                index);
+
 /**
  * \brief Determines if the transaction input set uses tags in its encoding.
  *
@@ -52,7 +52,8 @@ extern "C" {
  * - Adding collateral inputs if the transaction includes scripts.
  *
  * \param[in, out] unbalanced_tx              A pointer to the transaction that needs balancing.
- * \param[in]      foreign_signature_count    The number of expected extra signatures, not specified in the transaction.
+ * \param[in]      foreign_signature_count    The number of expected extra signatures, not specified in the transaction. Signers of the
+ *                                            native scripts in the witness set are already counted and must not be included.
  * \param[in]      protocol_params            A pointer to the protocol parameters required for fee calculation and balancing.
  * \param[in]      reference_inputs           A list of resolved reference inputs that have already been included in the transaction.
  * \param[in]      pre_selected_utxo          A list of UTXOs that must be included in the transaction inputs.
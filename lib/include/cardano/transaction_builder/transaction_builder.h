@@ -1031,6 +1031,11 @@ CARDANO_EXPORT void cardano_tx_builder_mint_token_with_id_ex(
  * \note This function influences only the fee estimation and does not modify the actual required signers for
  *       the transaction. Errors related to setting the signer count are deferred and will only be reported
  *       when `cardano_tx_builder_build` is called.
+ *
+ * \note The fee estimate already includes the keys the transaction body and its resolved inputs require,
+ *       and the minimal set of keys that satisfies each native script in the witness set. The padding is
+ *       added on top of those, so it should only count signatures the builder cannot see; padding for
+ *       native-script signers counts them twice and overestimates the fee.
  */
 CARDANO_EXPORT void cardano_tx_builder_pad_signer_count(cardano_tx_builder_t* builder, size_t count);
 
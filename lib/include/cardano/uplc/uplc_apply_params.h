@@ -25,9 +25,11 @@
 /* INCLUDES ******************************************************************/
 
 #include <cardano/buffer.h>
+#include <cardano/crypto/blake2b_hash.h>
 #include <cardano/error.h>
 #include <cardano/export.h>
 #include <cardano/plutus_data/plutus_list.h>
+#include <cardano/scripts/plutus_scripts/plutus_language_version.h>
 #include <cardano/typedefs.h>
 
 /* DECLARATIONS **************************************************************/
@@ -81,6 +83,213 @@ cardano_uplc_apply_params_to_script(
   size_t                       script_size,
   cardano_buffer_t**           out_script);
 
+/**
+ * \brief A cache of parameterized script applications.
+ *
+ * Applying parameters to a blueprint validator decodes the base script, binds the
+ * parameters and re-encodes the result to flat and CBOR. A backend that keeps
+ * instantiating the same few blueprints with the same few parameter sets repeats
+ * that work for identical inputs. The cache remembers each application, keyed by
+ * the Blake2b-256 hash of the base script bytes, the Blake2b-256 hash of the CBOR
+ * encoding of the parameter list and the Plutus language, and returns the applied
+ * script bytes and the ledger script hash without touching the UPLC machinery
+ * again.
+ *
+ * It also keeps the decoded base programs, keyed by the base script hash, so a
+ * base script applied to a parameter set it has not seen is not decoded again.
+ * Both tables hold at most the capacity given at construction and evict the least
+ * recently used entry when full.
+ *
+ * The cache is not thread safe; a caller sharing one between threads must
+ * serialize access to it.
+ */
+typedef struct cardano_uplc_apply_params_cache_t cardano_uplc_apply_params_cache_t;
+
+/**
+ * \brief Creates a new, empty apply-params cache.
+ *
+ * \param[in] capacity The maximum number of applied scripts, and of decoded base
+ *            programs, the cache keeps. Must be greater than zero.
+ * \param[out] cache On success, set to the new cache. The caller owns it and
+ *             releases it with \ref cardano_uplc_apply_params_cache_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p cache is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT if \p capacity is
+ *         zero, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the cache cannot
+ *         be allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_uplc_apply_params_cache_t* cache = NULL;
+ * cardano_error_t result = cardano_uplc_apply_params_cache_new(64, &cache);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Use the cache for every parameterized script the backend builds.
+ *
+ *   cardano_uplc_apply_params_cache_unref(&cache);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_uplc_apply_params_cache_new(size_t capacity, cardano_uplc_apply_params_cache_t** cache);
+
+/**
+ * \brief Applies parameters to a script through the cache.
+ *
+ * Produces the same bytes as \ref cardano_uplc_apply_params_to_script for the same
+ * \p params and \p script_bytes, and the hash the ledger assigns to the applied
+ * script in \p language. A repeated application is served from the cache; a new
+ * parameter set for a known base script reuses its decoded program. Failures are
+ * not cached.
+ *
+ * The cache is keyed by the encoded form of \p params, so two encodings of the same
+ * data (for example a definite and an indefinite list) are cached separately. They
+ * still produce the same applied script.
+ *
+ * \param[in] cache The cache. Must not be NULL.
+ * \param[in] language The Plutus language of the script, which selects the tag of
+ *            the script hash.
+ * \param[in] params The parameters to apply, or NULL to apply none.
+ * \param[in] script_bytes The compiled script bytes, CBOR-wrapped flat.
+ * \param[in] script_size The number of bytes in \p script_bytes.
+ * \param[out] out_script On success, a newly allocated buffer holding the applied
+ *             script bytes. The caller owns it and releases it with
+ *             \ref cardano_buffer_unref.
+ * \param[out] out_hash On success, the Blake2b-224 script hash of the applied script.
+ *             The caller owns it and releases it with \ref cardano_blake2b_hash_unref.
+ *             May be NULL when the hash is not needed.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p cache or \p out_script is NULL or \p script_bytes is NULL while
+ *         \p script_size is non-zero, \ref CARDANO_ERROR_INVALID_ARGUMENT for an
+ *         unknown \p language, or any error
+ *         \ref cardano_uplc_apply_params_to_script reports for the same input.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_uplc_apply_params_cache_apply(
+  cardano_uplc_apply_params_cache_t* cache,
+  cardano_plutus_language_version_t  language,
+  const cardano_plutus_list_t*       params,
+  const byte_t*                      script_bytes,
+  size_t                             script_size,
+  cardano_buffer_t**                 out_script,
+  cardano_blake2b_hash_t**           out_hash);
+
+/**
+ * \brief Drops every applied script and decoded base program the cache holds.
+ *
+ * \param[in] cache The cache to clear. If NULL, the function does nothing.
+ */
+CARDANO_EXPORT void cardano_uplc_apply_params_cache_clear(cardano_uplc_apply_params_cache_t* cache);
+
+/**
+ * \brief Returns how many applications the cache served without applying.
+ *
+ * \param[in] cache The cache to query.
+ *
+ * \return The number of cache hits since the cache was created, or 0 if \p cache
+ *         is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_uplc_apply_params_cache_get_hits(const cardano_uplc_apply_params_cache_t* cache);
+
+/**
+ * \brief Returns how many applications the cache had to compute.
+ *
+ * \param[in] cache The cache to query.
+ *
+ * \return The number of cache misses since the cache was created, or 0 if
+ *         \p cache is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_uplc_apply_params_cache_get_misses(const cardano_uplc_apply_params_cache_t* cache);
+
+/**
+ * \brief Decrements the reference count of an apply-params cache object.
+ *
+ * This function is responsible for managing the lifecycle of a \ref cardano_uplc_apply_params_cache_t
+ * object by decreasing its reference count. When the reference count reaches zero, the cache is
+ * finalized; its cached scripts and decoded programs are released, and its memory is deallocated.
+ *
+ * \param[in,out] cache A pointer to the pointer of the cache object. This double indirection allows
+ *                      the function to set the caller's pointer to NULL, avoiding dangling pointer
+ *                      issues after the object has been freed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_uplc_apply_params_cache_t* cache = NULL;
+ * cardano_error_t result = cardano_uplc_apply_params_cache_new(64, &cache);
+ *
+ * // Perform operations with the cache...
+ *
+ * cardano_uplc_apply_params_cache_unref(&cache);
+ * // At this point, cache is NULL and cannot be used.
+ * \endcode
+ *
+ * \note After calling \ref cardano_uplc_apply_params_cache_unref, the pointer to the
+ *       \ref cardano_uplc_apply_params_cache_t object will be set to NULL to prevent its reuse.
+ */
+CARDANO_EXPORT void cardano_uplc_apply_params_cache_unref(cardano_uplc_apply_params_cache_t** cache);
+
+/**
+ * \brief Increases the reference count of the cardano_uplc_apply_params_cache_t object.
+ *
+ * This function is used to manually increment the reference count of a cache object, indicating
+ * that another part of the code has taken ownership of it. This ensures the object remains
+ * allocated and valid until all owners have released their reference by calling
+ * \ref cardano_uplc_apply_params_cache_unref.
+ *
+ * \param cache A pointer to the cache object whose reference count is to be incremented.
+ *
+ * \note Always ensure that for every call to \ref cardano_uplc_apply_params_cache_ref there is a
+ * corresponding call to \ref cardano_uplc_apply_params_cache_unref to prevent memory leaks.
+ */
+CARDANO_EXPORT void cardano_uplc_apply_params_cache_ref(cardano_uplc_apply_params_cache_t* cache);
+
+/**
+ * \brief Retrieves the current reference count of the cardano_uplc_apply_params_cache_t object.
+ *
+ * \warning This function does not account for transitive references. A transitive reference
+ * occurs when an object holds a reference to another object, rather than directly to the
+ * cardano_uplc_apply_params_cache_t. As such, the reported count may not fully represent the
+ * total number of conceptual references in cases where such transitive relationships exist.
+ *
+ * \param cache A pointer to the cache object whose reference count is queried.
+ *
+ * \return The number of active references to the specified cache object, or 0 if it is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_uplc_apply_params_cache_refcount(const cardano_uplc_apply_params_cache_t* cache);
+
+/**
+ * \brief Sets the last error message for a given apply-params cache object.
+ *
+ * \param[in] cache A pointer to the \ref cardano_uplc_apply_params_cache_t instance whose last
+ *                  error message is to be set. If \c NULL, the function does nothing.
+ * \param[in] message A null-terminated string containing the error message. If \c NULL, the
+ *                    cache's last_error is set to an empty string, indicating no error.
+ *
+ * \note The error message is limited to 1023 characters, including the null terminator, due to the
+ * fixed size of the last_error buffer.
+ */
+CARDANO_EXPORT void cardano_uplc_apply_params_cache_set_last_error(cardano_uplc_apply_params_cache_t* cache, const char* message);
+
+/**
+ * \brief Retrieves the last error message recorded for a specific apply-params cache.
+ *
+ * \param[in] cache A pointer to the \ref cardano_uplc_apply_params_cache_t instance whose last
+ *                  error message is to be retrieved.
+ *
+ * \return A pointer to a null-terminated string containing the last error message for the
+ *         specified cache. If the cache is NULL, "Object is NULL." is returned to indicate
+ *         the error.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_uplc_apply_params_cache_get_last_error(const cardano_uplc_apply_params_cache_t* cache);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
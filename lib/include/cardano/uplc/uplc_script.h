@@ -0,0 +1,302 @@
+/**
+ * \file uplc_script.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UPLC_UPLC_SCRIPT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UPLC_UPLC_SCRIPT_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/protocol_params/cost_model.h>
+#include <cardano/scripts/plutus_scripts/plutus_language_version.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief An Untyped Plutus Core term. The type is opaque outside the library.
+ */
+struct cardano_uplc_term_t;
+
+/**
+ * \brief The outcome of a script evaluation.
+ */
+typedef enum
+{
+  /**
+   * \brief The script returned a value: it succeeded.
+   */
+  CARDANO_UPLC_SCRIPT_STATUS_SUCCESS = 0,
+
+  /**
+   * \brief The script evaluated to an error term: it failed.
+   */
+  CARDANO_UPLC_SCRIPT_STATUS_FAILURE = 1,
+
+  /**
+   * \brief The script ran out of its CPU or memory budget.
+   */
+  CARDANO_UPLC_SCRIPT_STATUS_OUT_OF_BUDGET = 2,
+
+  /**
+   * \brief The script called a builtin this library does not implement yet.
+   */
+  CARDANO_UPLC_SCRIPT_STATUS_UNSUPPORTED_BUILTIN = 3
+} cardano_uplc_script_status_t;
+
+/**
+ * \brief The result of one script evaluation.
+ */
+typedef struct cardano_uplc_script_result_t
+{
+    /**
+     * \brief The outcome of the evaluation.
+     */
+    cardano_uplc_script_status_t status;
+
+    /**
+     * \brief The CPU units the evaluation consumed, reported on every outcome.
+     */
+    uint64_t cpu;
+
+    /**
+     * \brief The memory units the evaluation consumed, reported on every outcome.
+     */
+    uint64_t memory;
+
+    /**
+     * \brief The term the script returned when \c status is \ref CARDANO_UPLC_SCRIPT_STATUS_SUCCESS,
+     *        NULL on every other outcome.
+     *
+     * The term is owned by the script handle and stays valid until the next call to
+     * \ref cardano_uplc_script_evaluate on the same script, or until the script is released.
+     */
+    const struct cardano_uplc_term_t* term;
+} cardano_uplc_script_result_t;
+
+/**
+ * \brief A Plutus script loaded for repeated evaluation.
+ *
+ * Loading decodes the script once, prepares its term tree for the machine and selects the cost model
+ * it is charged with. Each evaluation then only applies its arguments and runs the machine, inside
+ * memory the handle keeps and recycles between evaluations, so evaluating the same validator against
+ * many datums and redeemers costs no decoding and almost no allocation.
+ *
+ * A script handle must not be used from several threads at once; load one per thread instead.
+ */
+typedef struct cardano_uplc_script_t cardano_uplc_script_t;
+
+/**
+ * \brief Loads a Plutus script for evaluation.
+ *
+ * \param[in] language The Plutus language of the script, which selects the machine semantics and, when
+ *            \p cost_model is NULL, the default cost model.
+ * \param[in] script_bytes The compiled script bytes as they appear in a witness set: flat bytes wrapped
+ *            in a single CBOR byte string.
+ * \param[in] script_size The number of bytes in \p script_bytes.
+ * \param[in] cost_model The ledger cost model to charge the script with, or NULL for the library
+ *            default of \p language. Its language must be \p language; parameters it lacks are
+ *            charged at the maximum cost, as the ledger does.
+ * \param[in] protocol_major The major protocol version the script is evaluated under, which gates the
+ *            builtins available to it.
+ * \param[out] script On success, the loaded script. The caller must release it with
+ *             \ref cardano_uplc_script_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p script_bytes or
+ *         \p script is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT if \p language is unknown or
+ *         \p cost_model is for another language, \ref CARDANO_ERROR_DECODING if the bytes are not
+ *         a valid script, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_uplc_script_t* script = NULL;
+ *
+ * cardano_error_t result = cardano_uplc_script_new(
+ *   CARDANO_PLUTUS_LANGUAGE_VERSION_V3,
+ *   script_bytes,
+ *   script_size,
+ *   cost_model,
+ *   10U,
+ *   &script);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Evaluate the script as many times as needed.
+ *
+ *   cardano_uplc_script_unref(&script);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_uplc_script_new(
+  cardano_plutus_language_version_t language,
+  const byte_t*                     script_bytes,
+  size_t                            script_size,
+  const cardano_cost_model_t*       cost_model,
+  uint64_t                          protocol_major,
+  cardano_uplc_script_t**           script);
+
+/**
+ * \brief Applies arguments to a loaded script and evaluates it under a budget.
+ *
+ * The arguments are applied in order, \c args[0] first, so a Plutus V1 or V2 spending validator takes
+ * the datum, the redeemer and the script context, and a Plutus V3 script takes the script context
+ * alone. The loaded script is not changed: every evaluation starts from the script as loaded.
+ *
+ * A script that fails or exhausts its budget is not an error of this function: it returns
+ * \ref CARDANO_SUCCESS and reports the outcome, and the budget consumed, in \p result.
+ *
+ * The memory of an evaluation, including the returned term and the script's references to \p args,
+ * is kept until the next evaluation on the same script or until the script is released.
+ *
+ * \param[in] script The loaded script.
+ * \param[in] args The Plutus data arguments, or NULL when \p arg_count is zero. No element may be NULL.
+ * \param[in] arg_count The number of arguments.
+ * \param[in] max_cpu The CPU units the evaluation may consume.
+ * \param[in] max_memory The memory units the evaluation may consume.
+ * \param[out] result On success, the outcome of the evaluation.
+ *
+ * \return \ref CARDANO_SUCCESS when the script ran (whatever its outcome),
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if \p script, \p result, \p args (with a non-zero
+ *         \p arg_count) or an argument is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_uplc_script_t* script = ...; // Assume script is already loaded
+ *
+ * for (size_t i = 0U; i < redeemer_count; ++i)
+ * {
+ *   cardano_plutus_data_t*       args[] = { datum, redeemers[i], context };
+ *   cardano_uplc_script_result_t result = { 0 };
+ *
+ *   if (cardano_uplc_script_evaluate(script, args, 3U, 10000000000U, 14000000U, &result) == CARDANO_SUCCESS)
+ *   {
+ *     printf("status %d, cpu %llu, memory %llu\n", result.status, result.cpu, result.memory);
+ *   }
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_uplc_script_evaluate(
+  cardano_uplc_script_t*        script,
+  cardano_plutus_data_t* const* args,
+  size_t                        arg_count,
+  uint64_t                      max_cpu,
+  uint64_t                      max_memory,
+  cardano_uplc_script_result_t* result);
+
+/**
+ * \brief Gets the Plutus language a script was loaded as.
+ *
+ * \param[in] script The loaded script.
+ *
+ * \return The language of the script, or \ref CARDANO_PLUTUS_LANGUAGE_VERSION_V1 if \p script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_plutus_language_version_t cardano_uplc_script_get_language(const cardano_uplc_script_t* script);
+
+/**
+ * \brief Decrements the reference count of a cardano_uplc_script_t object.
+ *
+ * This function is responsible for managing the lifecycle of a \ref cardano_uplc_script_t object
+ * by decreasing its reference count. When the reference count reaches zero, the script is
+ * finalized; its associated resources are released, and its memory is deallocated.
+ *
+ * \param[in,out] script A pointer to the pointer of the script object. This double
+ *                       indirection allows the function to set the caller's pointer to
+ *                       NULL, avoiding dangling pointer issues after the object has been
+ *                       freed.
+ *
+ * \note After calling \ref cardano_uplc_script_unref, the pointer to the \ref cardano_uplc_script_t object
+ *       will be set to NULL to prevent its reuse.
+ */
+CARDANO_EXPORT void cardano_uplc_script_unref(cardano_uplc_script_t** script);
+
+/**
+ * \brief Increases the reference count of the cardano_uplc_script_t object.
+ *
+ * This function is used to manually increment the reference count of an cardano_uplc_script_t
+ * object, indicating that another part of the code has taken ownership of it. This
+ * ensures the object remains allocated and valid until all owners have released their
+ * reference by calling \ref cardano_uplc_script_unref.
+ *
+ * \param script A pointer to the cardano_uplc_script_t object whose reference count is to be incremented.
+ *
+ * \note Always ensure that for every call to \ref cardano_uplc_script_ref there is a corresponding
+ * call to \ref cardano_uplc_script_unref to prevent memory leaks.
+ */
+CARDANO_EXPORT void cardano_uplc_script_ref(cardano_uplc_script_t* script);
+
+/**
+ * \brief Retrieves the current reference count of the cardano_uplc_script_t object.
+ *
+ * This function returns the number of active references to an cardano_uplc_script_t object. It's useful
+ * for debugging purposes or managing the lifecycle of the object in complex scenarios.
+ *
+ * \param script A pointer to the cardano_uplc_script_t object whose reference count is queried.
+ *
+ * \return The number of active references to the specified cardano_uplc_script_t object, or 0 if
+ *         \p script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_uplc_script_refcount(const cardano_uplc_script_t* script);
+
+/**
+ * \brief Sets the last error message for a given cardano_uplc_script_t object.
+ *
+ * Records an error message in the script's last_error buffer, overwriting any existing message.
+ * The message is truncated if it exceeds the buffer's capacity.
+ *
+ * \param[in] script A pointer to the \ref cardano_uplc_script_t instance whose last error message is
+ *                   to be set. If \c NULL, the function does nothing.
+ * \param[in] message A null-terminated string containing the error message.
+ *
+ * \note The error message is limited to 1023 characters, including the null terminator, due to the
+ * fixed size of the last_error buffer.
+ */
+CARDANO_EXPORT void cardano_uplc_script_set_last_error(
+  cardano_uplc_script_t* script,
+  const char*            message);
+
+/**
+ * \brief Retrieves the last error message recorded for a specific script.
+ *
+ * \param[in] script A pointer to the \ref cardano_uplc_script_t instance whose last error
+ *                   message is to be retrieved.
+ *
+ * \return A pointer to a null-terminated string containing the last error message for the
+ *         specified script. If the script is NULL, "Object is NULL." is returned.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_uplc_script_get_last_error(
+  const cardano_uplc_script_t* script);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_UPLC_UPLC_SCRIPT_H
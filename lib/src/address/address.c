@@ -273,7 +273,14 @@ cardano_address_get_string_size(const cardano_address_t* address)
     return 0U;
   }
 
-  return cardano_safe_strlen(address->address_str, 1024) + 1U;
+  const char* str = _cardano_address_get_formatted_string(address);
+
+  if (str == NULL)
+  {
+    return 0U;
+  }
+
+  return cardano_safe_strlen(str, 1024) + 1U;
 }
 
 cardano_error_t
@@ -294,14 +301,21 @@ cardano_address_to_string(const cardano_address_t* address, char* data, const si
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
+  const char* str = _cardano_address_get_formatted_string(address);
+
+  if (str == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   const size_t src_size = cardano_address_get_string_size(address);
 
-  if (size < cardano_address_get_string_size(address))
+  if (size < src_size)
   {
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  cardano_safe_memcpy(data, size, address->address_str, src_size);
+  cardano_safe_memcpy(data, size, str, src_size);
 
   return CARDANO_SUCCESS;
 }
@@ -314,7 +328,7 @@ cardano_address_get_string(const cardano_address_t* address)
     return NULL;
   }
 
-  return address->address_str;
+  return _cardano_address_get_formatted_string(address);
 }
 
 bool
@@ -459,12 +473,7 @@ cardano_address_get_network_id(const cardano_address_t* address, cardano_network
     return CARDANO_SUCCESS;
   }
 
-  if (address->network_id == NULL)
-  {
-    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
-  }
-
-  *network_id = *address->network_id;
+  *network_id = address->network_id;
 
   return CARDANO_SUCCESS;
 }
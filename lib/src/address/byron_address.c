@@ -72,7 +72,8 @@ cardano_byron_address_from_credentials(
   address->base.last_error[0]        = '\0';
   address->base.deallocator          = _cardano_address_deallocate;
   address->type                      = CARDANO_ADDRESS_TYPE_BYRON;
-  address->network_id                = NULL;
+  address->network_id                = (attributes.magic == -1) ? CARDANO_NETWORK_ID_MAIN_NET : CARDANO_NETWORK_ID_TEST_NET;
+  address->address_str               = NULL;
   address->payment_credential        = NULL;
   address->stake_credential          = NULL;
   address->stake_pointer             = NULL;
@@ -94,14 +95,6 @@ cardano_byron_address_from_credentials(
     return packing_result;
   }
 
-  const cardano_error_t encoding_result = cardano_encoding_base58_encode(address->address_data, address->address_data_size, address->address_str, sizeof(address->address_str));
-
-  if (encoding_result != CARDANO_SUCCESS)
-  {
-    _cardano_address_deallocate(&address);
-    return encoding_result;
-  }
-
   *byron_address = _cardano_from_address_to_byron(address);
 
   return CARDANO_SUCCESS;
@@ -28,6 +28,7 @@
 #include <cardano/error.h>
 
 #include "../allocators.h"
+#include "../string_safe.h"
 #include "./internals/addr_common.h"
 #include "./internals/enterprise_addr_pack.h"
 
@@ -38,6 +39,11 @@
 
 static const size_t ADDRESS_HEADER_SIZE = 1;
 
+/**
+ * \brief The number of key hashes derived at a time by \ref cardano_enterprise_address_derive_bytes.
+ */
+#define DERIVE_BYTES_CHUNK_SIZE 32U
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -78,15 +84,8 @@ cardano_enterprise_address_from_credentials(
     ? CARDANO_ADDRESS_TYPE_ENTERPRISE_KEY
     : CARDANO_ADDRESS_TYPE_ENTERPRISE_SCRIPT;
 
-  address->network_id = _cardano_malloc(sizeof(cardano_network_id_t));
-
-  if (address->network_id == NULL)
-  {
-    _cardano_free(address);
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
-  *address->network_id        = network_id;
+  address->network_id         = network_id;
+  address->address_str        = NULL;
   address->payment_credential = payment;
   address->stake_credential   = NULL;
   address->byron_content      = NULL;
@@ -94,13 +93,6 @@ cardano_enterprise_address_from_credentials(
   address->address_data_size  = ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224;
 
   _cardano_pack_enterprise_address(address, address->address_data, sizeof(address->address_data));
-  _cardano_to_bech32_addr(
-    address->address_data,
-    address->address_data_size,
-    network_id,
-    address->type,
-    address->address_str,
-    1024);
 
   cardano_credential_ref(payment);
 
@@ -109,6 +101,52 @@ cardano_enterprise_address_from_credentials(
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_enterprise_address_derive_bytes(
+  const cardano_bip32_public_key_t* account_key,
+  const cardano_network_id_t        network_id,
+  const uint32_t                    role,
+  const uint32_t                    start_index,
+  const size_t                      count,
+  byte_t*                           addresses,
+  const size_t                      addresses_size)
+{
+  static const size_t address_size = ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224;
+
+  if ((account_key == NULL) || (addresses == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((addresses_size / address_size) < count)
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  const byte_t header = ((byte_t)CARDANO_ADDRESS_TYPE_ENTERPRISE_KEY << 4U) | (byte_t)network_id;
+
+  byte_t          key_hashes[DERIVE_BYTES_CHUNK_SIZE * (size_t)CARDANO_BLAKE2B_HASH_SIZE_224] = { 0 };
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t offset = 0U; (offset < count) && (result == CARDANO_SUCCESS); offset += DERIVE_BYTES_CHUNK_SIZE)
+  {
+    const size_t chunk_size = ((count - offset) < DERIVE_BYTES_CHUNK_SIZE) ? (count - offset) : DERIVE_BYTES_CHUNK_SIZE;
+
+    result = cardano_bip32_public_key_derive_key_hashes(account_key, role, start_index + (uint32_t)offset, chunk_size, key_hashes, sizeof(key_hashes));
+
+    for (size_t i = 0U; (i < chunk_size) && (result == CARDANO_SUCCESS); ++i)
+    {
+      byte_t* address = &addresses[(offset + i) * address_size];
+
+      address[0] = header;
+
+      cardano_safe_memcpy(&address[ADDRESS_HEADER_SIZE], address_size - ADDRESS_HEADER_SIZE, &key_hashes[i * (size_t)CARDANO_BLAKE2B_HASH_SIZE_224], CARDANO_BLAKE2B_HASH_SIZE_224);
+    }
+  }
+
+  return result;
+}
+
 cardano_error_t
 cardano_enterprise_address_from_address(
   const cardano_address_t*       address,
@@ -174,11 +212,11 @@ cardano_enterprise_address_get_payment_credential(
     return NULL;
   }
 
-  cardano_address_t* address = _cardano_from_enterprise_to_address(enterprise_address);
+  cardano_credential_t* credential = _cardano_address_get_payment_credential(_cardano_from_enterprise_to_address(enterprise_address));
 
-  cardano_credential_ref(address->payment_credential);
+  cardano_credential_ref(credential);
 
-  return address->payment_credential;
+  return credential;
 }
 
 cardano_error_t
@@ -21,14 +21,22 @@
 
 /* INCLUDES ******************************************************************/
 
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/encoding/base58.h>
 #include <cardano/encoding/bech32.h>
 
 #include "../../allocators.h"
+#include "../../config.h"
+#include "../../string_safe.h"
 #include "addr_common.h"
 
 #include <assert.h>
 #include <string.h>
 
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+#include <stdatomic.h>
+#endif
+
 /* CONSTANTS *****************************************************************/
 
 static const char* BECH32_PREFIX_MAINNET       = "addr";
@@ -41,6 +49,58 @@ static const size_t BECH32_PREFIX_STAKE_LENGTH         = 5;
 static const size_t BECH32_PREFIX_TESTNET_LENGTH       = 9;
 static const size_t BECH32_PREFIX_STAKE_TESTNET_LENGTH = 10;
 
+static const size_t ADDRESS_HEADER_SIZE = 1;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads one of the memoized fields of an address.
+ *
+ * \param slot The field to read.
+ *
+ * \return The memoized value, or NULL if it has not been computed yet.
+ */
+static void*
+load_memo(void* const* slot)
+{
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+  return atomic_load_explicit((_Atomic(void*)*)(void*)(void**)slot, memory_order_acquire);
+#else
+  return *slot;
+#endif
+}
+
+/**
+ * \brief Stores a freshly computed value in one of the memoized fields of an address.
+ *
+ * Addresses are filled in from read functions, so in the atomic build two threads
+ * sharing an address may both compute the same field. Only the first one to finish
+ * stores its value; the other gets that value back and must release its own.
+ *
+ * \param slot The field to fill.
+ * \param value The value computed by the caller.
+ *
+ * \return The value now stored in the field.
+ */
+static void*
+publish_memo(void** slot, void* value)
+{
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+  void* expected = NULL;
+
+  if (atomic_compare_exchange_strong_explicit((_Atomic(void*)*)(void*)slot, &expected, value, memory_order_acq_rel, memory_order_acquire))
+  {
+    return value;
+  }
+
+  return expected;
+#else
+  *slot = value;
+
+  return value;
+#endif
+}
+
 /* IMPLEMENTATION ************************************************************/
 
 const char*
@@ -368,6 +428,205 @@ _cardano_to_bech32_addr(
   CARDANO_UNUSED(result);
 }
 
+cardano_error_t
+_cardano_address_new(
+  const cardano_address_type_t type,
+  const cardano_network_id_t   network_id,
+  const byte_t*                data,
+  const size_t                 size,
+  cardano_address_t**          address)
+{
+  assert(data != NULL);
+  assert(address != NULL);
+
+  cardano_address_t* new_address = NULL;
+
+  if (size > sizeof(new_address->address_data))
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  new_address = _cardano_malloc(sizeof(cardano_address_t));
+
+  if (new_address == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  new_address->base.ref_count     = 1;
+  new_address->base.last_error[0] = '\0';
+  new_address->base.deallocator   = _cardano_address_deallocate;
+  new_address->type               = type;
+  new_address->address_data_size  = size;
+  new_address->network_id         = network_id;
+  new_address->stake_pointer      = NULL;
+  new_address->address_str        = NULL;
+  new_address->payment_credential = NULL;
+  new_address->stake_credential   = NULL;
+  new_address->byron_content      = NULL;
+
+  cardano_safe_memcpy(new_address->address_data, sizeof(new_address->address_data), data, size);
+
+  *address = new_address;
+
+  return CARDANO_SUCCESS;
+}
+
+const char*
+_cardano_address_get_formatted_string(const cardano_address_t* address)
+{
+  assert(address != NULL);
+
+  cardano_address_t* memo   = (cardano_address_t*)((const void*)address);
+  char*              cached = (char*)load_memo((void* const*)(void*)&memo->address_str);
+
+  if (cached != NULL)
+  {
+    return cached;
+  }
+
+  size_t             size = 0U;
+
+  if (address->type == CARDANO_ADDRESS_TYPE_BYRON)
+  {
+    size = cardano_encoding_base58_get_encoded_length(address->address_data, address->address_data_size);
+  }
+  else
+  {
+    size_t      hrp_size = 0U;
+    const char* hrp      = _cardano_get_bech32_prefix(address->type, address->network_id, &hrp_size);
+
+    size = cardano_encoding_bech32_get_encoded_length(hrp, hrp_size, address->address_data, address->address_data_size);
+  }
+
+  if (size == 0U)
+  {
+    return NULL;
+  }
+
+  char* str = (char*)_cardano_malloc(size);
+
+  if (str == NULL)
+  {
+    return NULL;
+  }
+
+  if (address->type == CARDANO_ADDRESS_TYPE_BYRON)
+  {
+    if (cardano_encoding_base58_encode(address->address_data, address->address_data_size, str, size) != CARDANO_SUCCESS)
+    {
+      _cardano_free(str);
+
+      return NULL;
+    }
+  }
+  else
+  {
+    _cardano_to_bech32_addr(address->address_data, address->address_data_size, address->network_id, address->type, str, size);
+  }
+
+  cached = (char*)publish_memo((void**)(void*)&memo->address_str, str);
+
+  if (cached != str)
+  {
+    _cardano_free(str);
+  }
+
+  return cached;
+}
+
+cardano_credential_t*
+_cardano_address_get_payment_credential(cardano_address_t* address)
+{
+  assert(address != NULL);
+
+  cardano_credential_t* cached = (cardano_credential_t*)load_memo((void* const*)(void*)&address->payment_credential);
+
+  if (cached != NULL)
+  {
+    return cached;
+  }
+
+  cardano_credential_type_t credential_type = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+
+  if (_cardano_get_payment_credential_type(address->type, &credential_type) != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  if (address->address_data_size < (ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224))
+  {
+    return NULL;
+  }
+
+  cardano_credential_t* credential = NULL;
+  cardano_error_t       result     = cardano_credential_from_hash_bytes(
+    &address->address_data[ADDRESS_HEADER_SIZE],
+    CARDANO_BLAKE2B_HASH_SIZE_224,
+    credential_type,
+    &credential);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  cached = (cardano_credential_t*)publish_memo((void**)(void*)&address->payment_credential, credential);
+
+  if (cached != credential)
+  {
+    cardano_credential_unref(&credential);
+  }
+
+  return cached;
+}
+
+cardano_credential_t*
+_cardano_address_get_stake_credential(cardano_address_t* address)
+{
+  assert(address != NULL);
+
+  cardano_credential_t* cached = (cardano_credential_t*)load_memo((void* const*)(void*)&address->stake_credential);
+
+  if (cached != NULL)
+  {
+    return cached;
+  }
+
+  cardano_credential_type_t credential_type = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+
+  if (_cardano_get_stake_credential_type(address->type, &credential_type) != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  if (address->address_data_size < (ADDRESS_HEADER_SIZE + (2U * (size_t)CARDANO_BLAKE2B_HASH_SIZE_224)))
+  {
+    return NULL;
+  }
+
+  cardano_credential_t* credential = NULL;
+  cardano_error_t       result     = cardano_credential_from_hash_bytes(
+    &address->address_data[ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224],
+    CARDANO_BLAKE2B_HASH_SIZE_224,
+    credential_type,
+    &credential);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  cached = (cardano_credential_t*)publish_memo((void**)(void*)&address->stake_credential, credential);
+
+  if (cached != credential)
+  {
+    cardano_credential_unref(&credential);
+  }
+
+  return cached;
+}
+
 void
 _cardano_address_deallocate(void* object)
 {
@@ -375,10 +634,10 @@ _cardano_address_deallocate(void* object)
 
   cardano_address_t* address = (cardano_address_t*)object;
 
-  if (address->network_id != NULL)
+  if (address->address_str != NULL)
   {
-    _cardano_free(address->network_id);
-    address->network_id = NULL;
+    _cardano_free(address->address_str);
+    address->address_str = NULL;
   }
 
   if (address->stake_pointer != NULL)
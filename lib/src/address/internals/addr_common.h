@@ -45,16 +45,26 @@
  * \brief Represents a Cardano address.
  *
  * This structure encapsulates all the necessary information for a Cardano address.
+ *
+ * The serialized bytes in \c address_data are the source of truth. The bech32 or
+ * base58 string and the payment and stake credentials are derived from them only
+ * when first requested (see \ref _cardano_address_get_formatted_string,
+ * \ref _cardano_address_get_payment_credential and
+ * \ref _cardano_address_get_stake_credential) and memoized in \c address_str,
+ * \c payment_credential and \c stake_credential, so decoding an address costs one
+ * allocation and no encoding work. The memoized fields are written from read
+ * functions, so in the atomic reference count build they are filled with a
+ * compare-and-swap and an address can still be read from several threads.
  */
 typedef struct cardano_address_t
 {
     cardano_object_t                 base;
     cardano_address_type_t           type;
-    char                             address_str[1024];
     byte_t                           address_data[128];
     size_t                           address_data_size;
-    cardano_network_id_t*            network_id;
+    cardano_network_id_t             network_id;
     cardano_stake_pointer_t*         stake_pointer;
+    char*                            address_str;
     cardano_credential_t*            payment_credential;
     cardano_credential_t*            stake_credential;
     cardano_byron_address_content_t* byron_content;
@@ -394,6 +404,61 @@ void _cardano_to_bech32_addr(
   char*                  address,
   size_t                 address_size);
 
+/**
+ * \brief Allocates a Shelley-era address over its serialized bytes.
+ *
+ * Only the bytes, type and network id are stored; the string and the credentials
+ * are left to be derived on demand.
+ *
+ * \param[in] type The address type.
+ * \param[in] network_id The network id.
+ * \param[in] data The serialized address, header byte included.
+ * \param[in] size The size of \p data. Must not exceed the inline byte buffer.
+ * \param[out] address On success, the new address with a reference count of one.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ADDRESS_FORMAT if
+ *         \p size does not fit, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+cardano_error_t _cardano_address_new(
+  cardano_address_type_t type,
+  cardano_network_id_t   network_id,
+  const byte_t*          data,
+  size_t                 size,
+  cardano_address_t**    address);
+
+/**
+ * \brief Gets the bech32 (or, for Byron, base58) string of an address, formatting it on first use.
+ *
+ * The string is memoized on the address, which is why a const address is updated
+ * in place; addresses are always heap objects, so this is safe.
+ *
+ * \param[in] address The address.
+ *
+ * \return The null-terminated string, owned by the address, or NULL if it could
+ *         not be allocated.
+ */
+const char* _cardano_address_get_formatted_string(const cardano_address_t* address);
+
+/**
+ * \brief Gets the payment credential of an address, decoding it on first use.
+ *
+ * \param[in] address The address.
+ *
+ * \return The credential, borrowed from the address (no reference is added), or NULL
+ *         if the address type has no payment credential or it could not be allocated.
+ */
+cardano_credential_t* _cardano_address_get_payment_credential(cardano_address_t* address);
+
+/**
+ * \brief Gets the stake credential of a base address, decoding it on first use.
+ *
+ * \param[in] address The address.
+ *
+ * \return The credential, borrowed from the address (no reference is added), or NULL
+ *         if the address type has no stake credential or it could not be allocated.
+ */
+cardano_credential_t* _cardano_address_get_stake_credential(cardano_address_t* address);
+
 /**
  * \brief Deallocates a address object.
  *
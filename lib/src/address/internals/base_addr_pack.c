@@ -35,6 +35,31 @@
 
 static const size_t ADDRESS_HEADER_SIZE = 1;
 
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Maps the payment and stake credential types of a base address to its address type.
+ *
+ * \param[in] payment_type The payment credential type.
+ * \param[in] stake_type The stake credential type.
+ *
+ * \return The base address type.
+ */
+static cardano_address_type_t
+base_address_type(const cardano_credential_type_t payment_type, const cardano_credential_type_t stake_type)
+{
+  if (payment_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH)
+  {
+    return (stake_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH)
+      ? CARDANO_ADDRESS_TYPE_BASE_PAYMENT_KEY_STAKE_KEY
+      : CARDANO_ADDRESS_TYPE_BASE_PAYMENT_KEY_STAKE_SCRIPT;
+  }
+
+  return (stake_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH)
+    ? CARDANO_ADDRESS_TYPE_BASE_PAYMENT_SCRIPT_STAKE_KEY
+    : CARDANO_ADDRESS_TYPE_BASE_PAYMENT_SCRIPT_STAKE_SCRIPT;
+}
+
 /* IMPLEMENTATION ************************************************************/
 
 cardano_error_t
@@ -60,25 +85,7 @@ _cardano_get_base_address_type(
   assert(get_type_result == CARDANO_SUCCESS);
   CARDANO_UNUSED(get_type_result);
 
-  if ((payment_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH) && (stake_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH))
-  {
-    *type = CARDANO_ADDRESS_TYPE_BASE_PAYMENT_KEY_STAKE_KEY;
-  }
-
-  if ((payment_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH) && (stake_type == CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH))
-  {
-    *type = CARDANO_ADDRESS_TYPE_BASE_PAYMENT_KEY_STAKE_SCRIPT;
-  }
-
-  if ((payment_type == CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH) && (stake_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH))
-  {
-    *type = CARDANO_ADDRESS_TYPE_BASE_PAYMENT_SCRIPT_STAKE_KEY;
-  }
-
-  if ((payment_type == CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH) && (stake_type == CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH))
-  {
-    *type = CARDANO_ADDRESS_TYPE_BASE_PAYMENT_SCRIPT_STAKE_SCRIPT;
-  }
+  *type = base_address_type(payment_type, stake_type);
 
   return CARDANO_SUCCESS;
 }
@@ -110,42 +117,26 @@ _cardano_unpack_base_address(const byte_t* data, const size_t size, cardano_base
   assert(credential_type_result == CARDANO_SUCCESS);
   CARDANO_UNUSED(credential_type_result);
 
-  cardano_credential_t* payment_credential = NULL;
-  cardano_credential_t* stake_credential   = NULL;
+  // The credentials are decoded from the bytes only when first asked for.
+  const size_t packed_size = ADDRESS_HEADER_SIZE + (2U * (size_t)CARDANO_BLAKE2B_HASH_SIZE_224);
+  byte_t       packed[ADDRESS_HEADER_SIZE + (2U * (size_t)CARDANO_BLAKE2B_HASH_SIZE_224)];
 
-  cardano_error_t credential_result = cardano_credential_from_hash_bytes(
-    &data[ADDRESS_HEADER_SIZE],
-    CARDANO_BLAKE2B_HASH_SIZE_224,
-    payment_type,
-    &payment_credential);
+  type = base_address_type(payment_type, stake_type);
 
-  if (credential_result != CARDANO_SUCCESS)
-  {
-    return credential_result;
-  }
+  packed[0] = ((byte_t)type << 4U) | (byte_t)network_id;
+  cardano_safe_memcpy(&packed[ADDRESS_HEADER_SIZE], packed_size - ADDRESS_HEADER_SIZE, &data[ADDRESS_HEADER_SIZE], packed_size - ADDRESS_HEADER_SIZE);
 
-  credential_result = cardano_credential_from_hash_bytes(
-    &data[(size_t)CARDANO_BLAKE2B_HASH_SIZE_224 + ADDRESS_HEADER_SIZE],
-    CARDANO_BLAKE2B_HASH_SIZE_224,
-    stake_type,
-    &stake_credential);
+  cardano_address_t*    new_address = NULL;
+  const cardano_error_t result      = _cardano_address_new(type, network_id, packed, packed_size, &new_address);
 
-  if (credential_result != CARDANO_SUCCESS)
+  if (result != CARDANO_SUCCESS)
   {
-    cardano_credential_unref(&payment_credential);
-    return credential_result;
+    return result;
   }
 
-  cardano_error_t base_address_result = cardano_base_address_from_credentials(
-    network_id,
-    payment_credential,
-    stake_credential,
-    address);
-
-  cardano_credential_unref(&payment_credential);
-  cardano_credential_unref(&stake_credential);
+  *address = _cardano_from_address_to_base(new_address);
 
-  return base_address_result;
+  return CARDANO_SUCCESS;
 }
 
 void
@@ -160,7 +151,7 @@ _cardano_pack_base_address(const cardano_address_t* address, byte_t* data, const
   cardano_blake2b_hash_t* payment_cred_hash = cardano_credential_get_hash(address->payment_credential);
   cardano_blake2b_hash_t* stake_cred_hash   = cardano_credential_get_hash(address->stake_credential);
 
-  data[0] = ((byte_t)address->type << 4U) | (byte_t)(*address->network_id);
+  data[0] = ((byte_t)address->type << 4U) | (byte_t)(address->network_id);
 
   cardano_safe_memcpy(
     &data[ADDRESS_HEADER_SIZE],
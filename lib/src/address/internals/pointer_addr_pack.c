@@ -195,7 +195,7 @@ _cardano_pack_pointer_address(const cardano_address_t* address, byte_t* data, co
   assert(address != NULL);
   assert(data != NULL);
 
-  data[0] = ((byte_t)address->type << 4U) | (byte_t)(*address->network_id);
+  data[0] = ((byte_t)address->type << 4U) | (byte_t)(address->network_id);
 
   cardano_safe_memcpy(
     &data[ADDRESS_HEADER_SIZE],
@@ -60,27 +60,34 @@ _cardano_unpack_reward_address(const byte_t* data, size_t size, cardano_reward_a
     return credential_type_result;
   }
 
-  cardano_credential_t* payment_credential = NULL;
+  const size_t packed_size = ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224;
+  byte_t       packed[ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224];
 
-  cardano_error_t credential_result = cardano_credential_from_hash_bytes(
-    &data[ADDRESS_HEADER_SIZE],
-    CARDANO_BLAKE2B_HASH_SIZE_224,
-    payment_type,
-    &payment_credential);
+  type = (payment_type == CARDANO_CREDENTIAL_TYPE_KEY_HASH)
+    ? CARDANO_ADDRESS_TYPE_REWARD_KEY
+    : CARDANO_ADDRESS_TYPE_REWARD_SCRIPT;
+
+  packed[0] = ((byte_t)type << 4U) | (byte_t)network_id;
+  cardano_safe_memcpy(&packed[ADDRESS_HEADER_SIZE], packed_size - ADDRESS_HEADER_SIZE, &data[ADDRESS_HEADER_SIZE], packed_size - ADDRESS_HEADER_SIZE);
+
+  cardano_address_t*    new_address = NULL;
+  const cardano_error_t result      = _cardano_address_new(type, network_id, packed, packed_size, &new_address);
 
-  if (credential_result != CARDANO_SUCCESS)
+  if (result != CARDANO_SUCCESS)
   {
-    return credential_result;
+    return result;
   }
 
-  cardano_error_t reward_address_result = cardano_reward_address_from_credentials(
-    network_id,
-    payment_credential,
-    address);
+  // Reward addresses are only ever used through their credential, so it is decoded up front.
+  if (_cardano_address_get_payment_credential(new_address) == NULL)
+  {
+    _cardano_address_deallocate(new_address);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
-  cardano_credential_unref(&payment_credential);
+  *address = _cardano_from_address_to_reward(new_address);
 
-  return reward_address_result;
+  return CARDANO_SUCCESS;
 }
 
 void
@@ -93,7 +100,7 @@ _cardano_pack_reward_address(const cardano_address_t* address, byte_t* data, con
 
   cardano_blake2b_hash_t* payment_cred_hash = cardano_credential_get_hash(address->payment_credential);
 
-  data[0] = ((byte_t)address->type << 4U) | (byte_t)(*address->network_id);
+  data[0] = ((byte_t)address->type << 4U) | (byte_t)(address->network_id);
 
   cardano_safe_memcpy(
     &data[ADDRESS_HEADER_SIZE],
@@ -78,40 +78,23 @@ cardano_pointer_address_from_credentials(
     ? CARDANO_ADDRESS_TYPE_POINTER_KEY
     : CARDANO_ADDRESS_TYPE_POINTER_SCRIPT;
 
-  address->network_id = _cardano_malloc(sizeof(cardano_network_id_t));
-
-  if (address->network_id == NULL)
-  {
-    _cardano_free(address);
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
   address->stake_pointer = _cardano_malloc(sizeof(cardano_stake_pointer_t));
 
   if (address->stake_pointer == NULL)
   {
-    _cardano_free(address->network_id);
     _cardano_free(address);
 
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  *address->network_id        = network_id;
+  address->network_id         = network_id;
+  address->address_str        = NULL;
   address->payment_credential = payment;
   address->stake_credential   = NULL;
   address->byron_content      = NULL;
   *address->stake_pointer     = pointer;
   address->address_data_size  = _cardano_pack_pointer_address(address, address->address_data, sizeof(address->address_data));
 
-  _cardano_to_bech32_addr(
-    address->address_data,
-    address->address_data_size,
-    network_id,
-    address->type,
-    address->address_str,
-    1024);
-
   cardano_credential_ref(payment);
 
   *pointer_address = _cardano_from_address_to_pointer(address);
@@ -184,11 +167,11 @@ cardano_pointer_address_get_payment_credential(
     return NULL;
   }
 
-  cardano_address_t* address = _cardano_from_pointer_to_address(pointer_address);
+  cardano_credential_t* credential = _cardano_address_get_payment_credential(_cardano_from_pointer_to_address(pointer_address));
 
-  cardano_credential_ref(address->payment_credential);
+  cardano_credential_ref(credential);
 
-  return address->payment_credential;
+  return credential;
 }
 
 cardano_error_t
@@ -78,15 +78,8 @@ cardano_reward_address_from_credentials(
     ? CARDANO_ADDRESS_TYPE_REWARD_KEY
     : CARDANO_ADDRESS_TYPE_REWARD_SCRIPT;
 
-  address->network_id = _cardano_malloc(sizeof(cardano_network_id_t));
-
-  if (address->network_id == NULL)
-  {
-    _cardano_free(address);
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
-  *address->network_id        = network_id;
+  address->network_id         = network_id;
+  address->address_str        = NULL;
   address->payment_credential = credential;
   address->stake_credential   = NULL;
   address->byron_content      = NULL;
@@ -94,13 +87,6 @@ cardano_reward_address_from_credentials(
   address->address_data_size  = ADDRESS_HEADER_SIZE + (size_t)CARDANO_BLAKE2B_HASH_SIZE_224;
 
   _cardano_pack_reward_address(address, address->address_data, sizeof(address->address_data));
-  _cardano_to_bech32_addr(
-    address->address_data,
-    address->address_data_size,
-    network_id,
-    address->type,
-    address->address_str,
-    1024);
 
   cardano_credential_ref(credential);
 
@@ -173,11 +159,11 @@ cardano_reward_address_get_credential(cardano_reward_address_t* reward_address)
     return NULL;
   }
 
-  cardano_address_t* address = _cardano_from_reward_to_address(reward_address);
+  cardano_credential_t* credential = _cardano_address_get_payment_credential(_cardano_from_reward_to_address(reward_address));
 
-  cardano_credential_ref(address->payment_credential);
+  cardano_credential_ref(credential);
 
-  return address->payment_credential;
+  return credential;
 }
 
 cardano_error_t
@@ -95,7 +95,7 @@ CARDANO_EXPORT void _cardano_free(void* ptr);
  * \warning This function modifies the global state and should therefore be used with caution.
  * Changing the memory handlers while allocated items exist will result in a `free`/`malloc` mismatch.
  * This function is not thread-safe with respect to both itself and all other libcardano-c functions
- * that work with the heap.
+ * that work with the heap, including in builds with atomic reference counts.
  *
  * \note The `realloc` implementation must correctly support `NULL` reallocation
  * (see [realloc documentation](http://en.cppreference.com/w/c/memory/realloc)).
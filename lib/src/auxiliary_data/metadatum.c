@@ -30,9 +30,11 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../config.h"
 #include "../string_safe.h"
 
 #include <assert.h>
+#include <cardano/json/json_reader.h>
 #include <cardano/json/json_writer.h>
 #include <string.h>
 
@@ -52,17 +54,15 @@ typedef struct cardano_metadatum_t
     cardano_metadatum_kind_t  kind;
 } cardano_metadatum_t;
 
-/* STATIC FUNCTIONS FORWARD DECLARATIONS *************************************/
-
 /**
- * \brief Converts a JSON object to a metadatum.
- *
- * \param[in] json_obj The JSON object to be converted.
- * \param[out] metadatum The metadatum object to be created.
- *
- * \@return The result of the operation.
+ * \brief A container being built while a JSON document is converted to metadatum.
  */
-static cardano_error_t convert_json_to_metadatum(cardano_json_object_t* json_obj, cardano_metadatum_t** metadatum);
+typedef struct
+{
+    cardano_metadatum_list_t* list; /**< The list being filled, or NULL if the container is a map. */
+    cardano_metadatum_map_t*  map;  /**< The map being filled, or NULL if the container is a list. */
+    cardano_metadatum_t*      key;  /**< The key of the map entry whose value is being read, if any. */
+} cardano_metadatum_json_frame_t;
 
 /* STATIC FUNCTIONS **********************************************************/
 
@@ -127,203 +127,192 @@ cardano_metadatum_new(void)
 }
 
 /**
- * \brief Handles the conversion from JSON array to metadatum.
+ * \brief Converts the current scalar token of a JSON reader to a metadatum.
  *
- * \param json_obj The JSON array to be converted.
- * \param metadatum The metadatum object to be created.
+ * \param[in] reader The JSON reader positioned on a string or number token.
+ * \param[in] token The type of the current token.
+ * \param[out] metadatum The metadatum object to be created.
  *
  * \return The result of the operation.
  */
 static cardano_error_t
-handle_json_array(cardano_json_object_t* json_obj, cardano_metadatum_t** metadatum)
+convert_json_scalar_to_metadatum(
+  const cardano_json_reader_t*    reader,
+  const cardano_json_token_type_t token,
+  cardano_metadatum_t**           metadatum)
 {
-  assert(json_obj != NULL);
-  assert(metadatum != NULL);
+  if (token == CARDANO_JSON_TOKEN_TYPE_STRING)
+  {
+    const char* str = cardano_json_reader_get_string(reader, NULL);
 
-  cardano_metadatum_list_t* list  = NULL;
-  cardano_error_t           error = cardano_metadatum_list_new(&list);
+    return cardano_metadatum_new_string(str, cardano_safe_strlen(str, 64), metadatum);
+  }
 
-  if (error != CARDANO_SUCCESS)
+  if ((token != CARDANO_JSON_TOKEN_TYPE_NUMBER) || cardano_json_reader_get_is_real_number(reader))
   {
-    return error;
+    return CARDANO_ERROR_INVALID_JSON;
   }
 
-  const size_t array_len = cardano_json_object_array_get_length(json_obj);
+  int64_t         value = 0;
+  cardano_error_t res   = cardano_json_reader_get_signed_int(reader, &value);
 
-  for (size_t i = 0U; i < array_len; ++i)
+  if (res != CARDANO_SUCCESS)
   {
-    cardano_json_object_t* elem = cardano_json_object_array_get_ex(json_obj, i);
+    uint64_t unsigned_value = 0U;
 
-    cardano_metadatum_t* elem_metadatum = NULL;
+    res = cardano_json_reader_get_uint(reader, &unsigned_value);
 
-    // cppcheck-suppress misra-c2012-17.2; Reason: Parsing the JSON object is a recursive operation. TODO: Create cardano_json_reader_t and cardano_json_writer_t to break the recursion.
-    error = convert_json_to_metadatum(elem, &elem_metadatum);
-
-    if (error != CARDANO_SUCCESS)
+    if (res != CARDANO_SUCCESS)
     {
-      cardano_metadatum_unref(&elem_metadatum);
-      cardano_metadatum_list_unref(&list);
-
-      return error;
+      return res;
     }
 
-    error = cardano_metadatum_list_add(list, elem_metadatum);
-    cardano_metadatum_unref(&elem_metadatum);
-
-    if (error != CARDANO_SUCCESS)
-    {
-      cardano_metadatum_unref(&elem_metadatum);
-      cardano_metadatum_list_unref(&list);
-
-      return error;
-    }
+    return cardano_metadatum_new_integer_from_uint(unsigned_value, metadatum);
   }
 
-  error = cardano_metadatum_new_list(list, metadatum);
-
-  cardano_metadatum_list_unref(&list);
-
-  return error;
+  return cardano_metadatum_new_integer_from_int(value, metadatum);
 }
 
 /**
- * \brief Handles the conversion from JSON object to metadatum.
+ * \brief Adds a converted value to the container being built.
  *
- * \param json_obj The JSON object to be converted.
- * \param metadatum The metadatum object to be created.
+ * \param[in,out] frame The container. If it is a map, its pending key is consumed.
+ * \param[in] value The value to add.
  *
  * \return The result of the operation.
  */
 static cardano_error_t
-handle_json_object(cardano_json_object_t* json_obj, cardano_metadatum_t** metadatum)
+add_to_json_frame(cardano_metadatum_json_frame_t* frame, cardano_metadatum_t* value)
 {
-  assert(json_obj != NULL);
-  assert(metadatum != NULL);
-
-  cardano_metadatum_map_t* map   = NULL;
-  cardano_error_t          error = cardano_metadatum_map_new(&map);
-
-  if (error != CARDANO_SUCCESS)
+  if (frame->list != NULL)
   {
-    return error;
+    return cardano_metadatum_list_add(frame->list, value);
   }
 
-  const size_t object_len = cardano_json_object_get_property_count(json_obj);
-
-  for (size_t i = 0U; i < object_len; ++i)
-  {
-    size_t                 key_size = 0U;
-    const char*            key      = cardano_json_object_get_key_at(json_obj, i, &key_size);
-    cardano_json_object_t* value    = cardano_json_object_get_value_at_ex(json_obj, i);
-
-    cardano_metadatum_t* metadatum_key   = NULL;
-    cardano_metadatum_t* metadatum_value = NULL;
-
-    error = cardano_metadatum_new_string(key, key_size, &metadatum_key);
-
-    if (error != CARDANO_SUCCESS)
-    {
-      cardano_metadatum_unref(&metadatum_key);
-      cardano_metadatum_unref(&metadatum_key);
-      cardano_metadatum_map_unref(&map);
-
-      return error;
-    }
-
-    // cppcheck-suppress misra-c2012-17.2; Reason: Parsing the JSON object is a recursive operation. TODO: Create cardano_json_reader_t and cardano_json_writer_t to break the recursion.
-    error = convert_json_to_metadatum(value, &metadatum_value);
-
-    if (error != CARDANO_SUCCESS)
-    {
-      cardano_metadatum_unref(&metadatum_key);
-      cardano_metadatum_unref(&metadatum_value);
-      cardano_metadatum_map_unref(&map);
-
-      return error;
-    }
+  cardano_error_t result = cardano_metadatum_map_insert(frame->map, frame->key, value);
+  cardano_metadatum_unref(&frame->key);
 
-    error = cardano_metadatum_map_insert(map, metadatum_key, metadatum_value);
-    cardano_metadatum_unref(&metadatum_key);
-    cardano_metadatum_unref(&metadatum_value);
-
-    if (error != CARDANO_SUCCESS)
-    {
-      cardano_metadatum_map_unref(&map);
+  return result;
+}
 
-      return error;
-    }
+/**
+ * \brief Releases the containers that are still open when a conversion stops.
+ *
+ * \param[in,out] frames The open containers.
+ * \param[in] count The number of open containers.
+ */
+static void
+release_json_frames(cardano_metadatum_json_frame_t* frames, const size_t count)
+{
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_metadatum_list_unref(&frames[i].list);
+    cardano_metadatum_map_unref(&frames[i].map);
+    cardano_metadatum_unref(&frames[i].key);
   }
-
-  error = cardano_metadatum_new_map(map, metadatum);
-  cardano_metadatum_map_unref(&map);
-
-  return error;
 }
 
 /**
- * \brief Converts a JSON object to a metadatum.
+ * \brief Converts the next value of a JSON reader to a metadatum.
+ *
+ * The JSON text is consumed token by token and the open arrays and objects are tracked on an explicit stack,
+ * so the conversion neither materializes a JSON tree nor recurses.
  *
- * \param[in] json_obj The JSON object to be converted.
+ * \param[in] reader The JSON reader, positioned before the value.
  * \param[out] metadatum The metadatum object to be created.
  *
- * \@return The result of the operation.
+ * \return The result of the operation.
  */
 static cardano_error_t
-convert_json_to_metadatum(cardano_json_object_t* json_obj, cardano_metadatum_t** metadatum)
+convert_json_to_metadatum(cardano_json_reader_t* reader, cardano_metadatum_t** metadatum)
 {
-  assert(json_obj != NULL);
+  assert(reader != NULL);
   assert(metadatum != NULL);
 
-  if (cardano_json_object_get_type(json_obj) == CARDANO_JSON_OBJECT_TYPE_OBJECT)
-  {
-    // cppcheck-suppress misra-c2012-17.2; Reason: Parsing the JSON object is a recursive operation. TODO: Create cardano_json_reader_t and cardano_json_writer_t to break the recursion.
-    return handle_json_object(json_obj, metadatum);
-  }
-  else if (cardano_json_object_get_type(json_obj) == CARDANO_JSON_OBJECT_TYPE_ARRAY)
+  cardano_metadatum_json_frame_t* frames = (cardano_metadatum_json_frame_t*)_cardano_malloc(sizeof(cardano_metadatum_json_frame_t) * (size_t)LIB_CARDANO_C_MAX_JSON_DEPTH);
+
+  if (frames == NULL)
   {
-    // cppcheck-suppress misra-c2012-17.2; Reason: Parsing the JSON object is a recursive operation. TODO: Create cardano_json_reader_t and cardano_json_writer_t to break the recursion.
-    return handle_json_array(json_obj, metadatum);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
-  else if (cardano_json_object_get_type(json_obj) == CARDANO_JSON_OBJECT_TYPE_STRING)
+
+  size_t          depth  = 0U;
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  while (result == CARDANO_SUCCESS)
   {
-    size_t      size = 0;
-    const char* str  = cardano_json_object_get_string(json_obj, &size);
+    cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
+    cardano_metadatum_t*      value = NULL;
 
-    cardano_error_t error = cardano_metadatum_new_string(str, cardano_safe_strlen(str, 64), metadatum);
+    result = cardano_json_reader_read(reader, &token);
 
-    if (error != CARDANO_SUCCESS)
+    if (result != CARDANO_SUCCESS)
     {
-      return error;
+      break;
     }
-  }
-  else if ((cardano_json_object_get_type(json_obj) == CARDANO_JSON_OBJECT_TYPE_NUMBER) && (!cardano_json_object_get_is_real_number(json_obj)))
-  {
-    int64_t value = 0;
-
-    cardano_error_t res = cardano_json_object_get_signed_int(json_obj, &value);
 
-    if ((value == 0) || (res != CARDANO_SUCCESS))
+    switch (token)
     {
-      uint64_t unsigned_value = 0U;
+      case CARDANO_JSON_TOKEN_TYPE_START_OBJECT:
+      case CARDANO_JSON_TOKEN_TYPE_START_ARRAY:
+      {
+        cardano_metadatum_json_frame_t* frame = &frames[depth];
+
+        frame->list = NULL;
+        frame->map  = NULL;
+        frame->key  = NULL;
+
+        ++depth;
 
-      res = cardano_json_object_get_uint(json_obj, &unsigned_value);
+        result = (token == CARDANO_JSON_TOKEN_TYPE_START_OBJECT) ? cardano_metadatum_map_new(&frame->map) : cardano_metadatum_list_new(&frame->list);
+        break;
+      }
+      case CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME:
+      {
+        size_t      key_size = 0U;
+        const char* key      = cardano_json_reader_get_string(reader, &key_size);
 
-      if (res != CARDANO_SUCCESS)
+        result = cardano_metadatum_new_string(key, key_size, &frames[depth - 1U].key);
+        break;
+      }
+      case CARDANO_JSON_TOKEN_TYPE_END_OBJECT:
+      case CARDANO_JSON_TOKEN_TYPE_END_ARRAY:
       {
-        return res;
+        --depth;
+
+        cardano_metadatum_json_frame_t* frame = &frames[depth];
+
+        result = (frame->map != NULL) ? cardano_metadatum_new_map(frame->map, &value) : cardano_metadatum_new_list(frame->list, &value);
+
+        cardano_metadatum_map_unref(&frame->map);
+        cardano_metadatum_list_unref(&frame->list);
+        break;
       }
+      default:
+        result = convert_json_scalar_to_metadatum(reader, token, &value);
+        break;
+    }
 
-      return cardano_metadatum_new_integer_from_uint(unsigned_value, metadatum);
+    if ((result != CARDANO_SUCCESS) || (value == NULL))
+    {
+      cardano_metadatum_unref(&value);
+      continue;
     }
 
-    return cardano_metadatum_new_integer_from_int(value, metadatum);
-  }
-  else
-  {
-    return CARDANO_ERROR_INVALID_JSON;
+    if (depth == 0U)
+    {
+      *metadatum = value;
+      break;
+    }
+
+    result = add_to_json_frame(&frames[depth - 1U], value);
+    cardano_metadatum_unref(&value);
   }
 
-  return CARDANO_SUCCESS;
+  release_json_frames(frames, depth);
+  _cardano_free(frames);
+
+  return result;
 }
 
 /**
@@ -1026,24 +1015,34 @@ cardano_metadatum_from_json(const char* json, size_t json_size, cardano_metadatu
     return CARDANO_ERROR_INVALID_JSON;
   }
 
-  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, json_size);
+  cardano_json_reader_t* reader = cardano_json_reader_new(json, json_size);
 
-  if (parsed_json == NULL)
+  if (reader == NULL)
   {
-    return CARDANO_ERROR_INVALID_JSON;
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  cardano_error_t error = convert_json_to_metadatum(parsed_json, metadatum);
+  cardano_metadatum_t* data  = NULL;
+  cardano_error_t      error = convert_json_to_metadatum(reader, &data);
 
-  cardano_json_object_unref(&parsed_json);
+  if (error == CARDANO_SUCCESS)
+  {
+    cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+    error = cardano_json_reader_read(reader, &token);
+  }
+
+  cardano_json_reader_unref(&reader);
 
   if (error != CARDANO_SUCCESS)
   {
-    cardano_metadatum_unref(metadatum);
+    cardano_metadatum_unref(&data);
 
     return error;
   }
 
+  *metadatum = data;
+
   return CARDANO_SUCCESS;
 }
 
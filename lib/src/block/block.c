@@ -0,0 +1,1144 @@
+/**
+ * \file block.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/auxiliary_data/auxiliary_data.h>
+#include <cardano/block/block.h>
+#include <cardano/buffer.h>
+#include <cardano/object.h>
+#include <cardano/transaction_body/transaction_body.h>
+#include <cardano/witness_set/witness_set.h>
+
+#include "../allocators.h"
+#include "../cbor/cbor_validation.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const byte_t   ERA_ENVELOPE_HEAD              = 0x82U;
+static const int64_t  ERA_ENVELOPE_SIZE              = 2;
+static const int64_t  SHELLEY_BLOCK_SIZE             = 4;
+static const int64_t  ALONZO_BLOCK_SIZE              = 5;
+static const int64_t  HEADER_SIZE                    = 2;
+static const int64_t  BABBAGE_HEADER_BODY_SIZE       = 10;
+static const int64_t  SHELLEY_HEADER_BODY_SIZE       = 15;
+static const uint64_t FIRST_SHELLEY_ERA              = 2U;
+static const size_t   INITIAL_TRANSACTION_CAPACITY   = 16U;
+static const uint32_t BLOCK_HASH_SIZE                = 32U;
+static const size_t   BABBAGE_SKIPPED_VRF_FIELDS     = 1U;
+static const size_t   SHELLEY_SKIPPED_VRF_FIELDS     = 2U;
+static const size_t   SHELLEY_OPERATIONAL_CERT_SIZE  = 4U;
+static const size_t   BABBAGE_OPERATIONAL_CERT_COUNT = 1U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Locates the parts of one transaction within the encoding of its block.
+ *
+ * Offsets are relative to the start of the block. An auxiliary data size of zero means the
+ * transaction has none.
+ */
+typedef struct block_transaction_t
+{
+    size_t body_offset;
+    size_t body_size;
+    size_t witness_set_offset;
+    size_t witness_set_size;
+    size_t auxiliary_data_offset;
+    size_t auxiliary_data_size;
+    bool   is_valid;
+} block_transaction_t;
+
+/**
+ * \brief Represents a Cardano block.
+ */
+typedef struct cardano_block_t
+{
+    cardano_object_t        base;
+    cardano_buffer_t*       cbor;
+    uint64_t                block_number;
+    uint64_t                slot;
+    uint64_t                body_size;
+    cardano_blake2b_hash_t* header_hash;
+    cardano_blake2b_hash_t* previous_hash;
+    cardano_blake2b_hash_t* body_hash;
+    uint64_t                protocol_major;
+    uint64_t                protocol_minor;
+    block_transaction_t*    transactions;
+    size_t                  transaction_count;
+    size_t                  transaction_capacity;
+} cardano_block_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a block object.
+ *
+ * This function is responsible for properly deallocating a block object (`cardano_block_t`)
+ * and its associated resources.
+ *
+ * \param object A void pointer to the block object to be deallocated. The function casts this
+ *               pointer to the appropriate type (`cardano_block_t*`).
+ *
+ * \note It is assumed that this function is called only when the reference count of the block
+ *       object reaches zero, as part of the reference counting mechanism implemented for managing the
+ *       lifecycle of these objects.
+ */
+static void
+cardano_block_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_block_t* block = (cardano_block_t*)object;
+
+  cardano_buffer_unref(&block->cbor);
+  cardano_blake2b_hash_unref(&block->header_hash);
+  cardano_blake2b_hash_unref(&block->previous_hash);
+  cardano_blake2b_hash_unref(&block->body_hash);
+
+  _cardano_free(block->transactions);
+  _cardano_free(object);
+}
+
+/**
+ * \brief Gets the position of the reader within the block being decoded.
+ *
+ * \param[in] reader The reader over the block.
+ * \param[in] block_size The size of the block encoding, in bytes.
+ *
+ * \return The offset of the next value, from the start of the block.
+ */
+static size_t
+get_offset(cardano_cbor_reader_t* reader, const size_t block_size)
+{
+  size_t remaining = 0U;
+
+  const cardano_error_t result = cardano_cbor_reader_get_bytes_remaining(reader, &remaining);
+
+  assert(result == CARDANO_SUCCESS);
+  CARDANO_UNUSED(result);
+
+  return block_size - remaining;
+}
+
+/**
+ * \brief Skips the next value and reports where its encoding lies.
+ *
+ * \param[in] reader The reader over the block.
+ * \param[in] block_size The size of the block encoding, in bytes.
+ * \param[out] offset The offset of the value, from the start of the block.
+ * \param[out] size The size of the value encoding, in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of the reader if the value is malformed.
+ */
+static cardano_error_t
+locate_value(cardano_cbor_reader_t* reader, const size_t block_size, size_t* offset, size_t* size)
+{
+  *offset = get_offset(reader, block_size);
+
+  const cardano_error_t result = cardano_cbor_reader_skip_value(reader);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *size = get_offset(reader, block_size) - *offset;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Skips a number of consecutive values.
+ *
+ * \param[in] reader The reader.
+ * \param[in] count The number of values to skip.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of the reader if a value is malformed.
+ */
+static cardano_error_t
+skip_values(cardano_cbor_reader_t* reader, const size_t count)
+{
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const cardano_error_t result = cardano_cbor_reader_skip_value(reader);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Tells whether a definite or indefinite length container has another element.
+ *
+ * \param[in] reader The reader, positioned within the container.
+ * \param[in] length The length of the container, or -1 if it is of indefinite length.
+ * \param[in] index The number of elements read so far.
+ * \param[in] end_state The state that marks the end of an indefinite length container.
+ * \param[out] has_next Whether another element follows.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of the reader.
+ */
+static cardano_error_t
+has_next_element(
+  cardano_cbor_reader_t*            reader,
+  const int64_t                     length,
+  const size_t                      index,
+  const cardano_cbor_reader_state_t end_state,
+  bool*                             has_next)
+{
+  if (length >= 0)
+  {
+    *has_next = index < (uint64_t)length;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+
+  const cardano_error_t result = cardano_cbor_reader_peek_state(reader, &state);
+
+  *has_next = state != end_state;
+
+  return result;
+}
+
+/**
+ * \brief Reads a 32 bytes hash.
+ *
+ * \param[in] reader The reader.
+ * \param[out] hash The hash.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the next value is not a 32 bytes byte string.
+ */
+static cardano_error_t
+read_hash(cardano_cbor_reader_t* reader, cardano_blake2b_hash_t** hash)
+{
+  cardano_buffer_t* bytes = NULL;
+
+  cardano_error_t result = cardano_cbor_validate_byte_string_of_size("block_header", reader, &bytes, BLOCK_HASH_SIZE);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_blake2b_hash_from_bytes(cardano_buffer_get_data(bytes), cardano_buffer_get_size(bytes), hash);
+
+  cardano_buffer_unref(&bytes);
+
+  return result;
+}
+
+/**
+ * \brief Reads the body of a block header.
+ *
+ * Babbage and later eras encode the header body as 10 fields, grouping the VRF output, the operational
+ * certificate and the protocol version; earlier eras spread them over 15 fields.
+ *
+ * \param[in] reader The reader, positioned at the header body.
+ * \param[in,out] block The block whose header fields are filled.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the header body is malformed.
+ */
+static cardano_error_t
+read_header_body(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  int64_t length = 0;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const bool is_babbage = length == BABBAGE_HEADER_BODY_SIZE;
+
+  if (!is_babbage && (length != SHELLEY_HEADER_BODY_SIZE))
+  {
+    cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'block_header', expected a header body of 10 or 15 elements.");
+
+    return CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+  }
+
+  result = cardano_cbor_reader_read_uint(reader, &block->block_number);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &block->slot);
+  }
+
+  cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_peek_state(reader, &state);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = (state == CARDANO_CBOR_READER_STATE_NULL) ? cardano_cbor_reader_read_null(reader) : read_hash(reader, &block->previous_hash);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    /* Issuer and VRF verification keys, then the VRF output(s). */
+    result = skip_values(reader, 2U + (is_babbage ? BABBAGE_SKIPPED_VRF_FIELDS : SHELLEY_SKIPPED_VRF_FIELDS));
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &block->body_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = read_hash(reader, &block->body_hash);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = skip_values(reader, is_babbage ? BABBAGE_OPERATIONAL_CERT_COUNT : SHELLEY_OPERATIONAL_CERT_SIZE);
+  }
+
+  if ((result == CARDANO_SUCCESS) && is_babbage)
+  {
+    result = cardano_cbor_validate_array_of_n_elements("protocol_version", reader, 2U);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &block->protocol_major);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &block->protocol_minor);
+  }
+
+  if ((result == CARDANO_SUCCESS) && is_babbage)
+  {
+    result = cardano_cbor_validate_end_array("protocol_version", reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("block_header_body", reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads a block header and hashes its encoding.
+ *
+ * \param[in] reader The reader, positioned at the header.
+ * \param[in,out] block The block whose header fields are filled.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the header is malformed.
+ */
+static cardano_error_t
+read_header(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  const size_t    block_size = cardano_buffer_get_size(block->cbor);
+  const size_t    start      = get_offset(reader, block_size);
+  cardano_error_t result     = cardano_cbor_validate_array_of_n_elements("block_header", reader, (uint32_t)HEADER_SIZE);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = read_header_body(reader, block);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    /* KES signature. */
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("block_header", reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    const byte_t* data = cardano_buffer_get_data(block->cbor);
+
+    result = cardano_blake2b_compute_hash(&data[start], get_offset(reader, block_size) - start, BLOCK_HASH_SIZE, &block->header_hash);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Appends a transaction, located by its body, to a block.
+ *
+ * \param[in,out] block The block.
+ * \param[in] body_offset The offset of the transaction body.
+ * \param[in] body_size The size of the transaction body encoding.
+ *
+ * \return \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+append_transaction(cardano_block_t* block, const size_t body_offset, const size_t body_size)
+{
+  if (block->transaction_count == block->transaction_capacity)
+  {
+    const size_t         capacity = (block->transaction_capacity == 0U) ? INITIAL_TRANSACTION_CAPACITY : (block->transaction_capacity * 2U);
+    block_transaction_t* grown    = (block_transaction_t*)_cardano_realloc(block->transactions, capacity * sizeof(block_transaction_t));
+
+    if (grown == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    block->transactions         = grown;
+    block->transaction_capacity = capacity;
+  }
+
+  block_transaction_t* transaction = &block->transactions[block->transaction_count];
+
+  CARDANO_UNUSED(memset(transaction, 0, sizeof(block_transaction_t)));
+
+  transaction->body_offset = body_offset;
+  transaction->body_size   = body_size;
+  transaction->is_valid    = true;
+
+  ++block->transaction_count;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Locates every transaction body of a block.
+ *
+ * \param[in] reader The reader, positioned at the transaction bodies.
+ * \param[in,out] block The block the transactions are appended to.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the sequence is malformed.
+ */
+static cardano_error_t
+read_transaction_bodies(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  const size_t block_size = cardano_buffer_get_size(block->cbor);
+  int64_t      length     = 0;
+
+  cardano_error_t result   = cardano_cbor_reader_read_start_array(reader, &length);
+  bool            has_next = false;
+
+  for (size_t i = 0U; result == CARDANO_SUCCESS; ++i)
+  {
+    result = has_next_element(reader, length, i, CARDANO_CBOR_READER_STATE_END_ARRAY, &has_next);
+
+    if ((result != CARDANO_SUCCESS) || !has_next)
+    {
+      break;
+    }
+
+    size_t offset = 0U;
+    size_t size   = 0U;
+
+    result = locate_value(reader, block_size, &offset, &size);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = append_transaction(block, offset, size);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("transaction_bodies", reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Locates the witness set of every transaction of a block.
+ *
+ * \param[in] reader The reader, positioned at the witness sets.
+ * \param[in,out] block The block, whose transaction bodies are already located.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the sequence is malformed or holds a different number
+ *         of elements than the transaction bodies.
+ */
+static cardano_error_t
+read_witness_sets(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  const size_t block_size = cardano_buffer_get_size(block->cbor);
+  int64_t      length     = 0;
+  size_t       count      = 0U;
+
+  cardano_error_t result   = cardano_cbor_reader_read_start_array(reader, &length);
+  bool            has_next = false;
+
+  while (result == CARDANO_SUCCESS)
+  {
+    result = has_next_element(reader, length, count, CARDANO_CBOR_READER_STATE_END_ARRAY, &has_next);
+
+    if ((result != CARDANO_SUCCESS) || !has_next)
+    {
+      break;
+    }
+
+    if (count == block->transaction_count)
+    {
+      result = CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+      break;
+    }
+
+    block_transaction_t* transaction = &block->transactions[count];
+
+    result = locate_value(reader, block_size, &transaction->witness_set_offset, &transaction->witness_set_size);
+
+    ++count;
+  }
+
+  if ((result == CARDANO_SUCCESS) && (count != block->transaction_count))
+  {
+    result = CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+  }
+
+  if (result == CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE)
+  {
+    cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'block', the number of witness sets doesn't match the number of transaction bodies.");
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("transaction_witness_sets", reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads the index of a transaction of a block.
+ *
+ * \param[in] reader The reader.
+ * \param[in] block The block, whose transaction bodies are already located.
+ * \param[in] validator_name The name of the sequence being decoded, for error messages.
+ * \param[out] index The transaction index.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the next value is not the index of a transaction of the block.
+ */
+static cardano_error_t
+read_transaction_index(cardano_cbor_reader_t* reader, const cardano_block_t* block, const char* validator_name, size_t* index)
+{
+  uint64_t value = 0U;
+
+  const cardano_error_t result = cardano_cbor_reader_read_uint(reader, &value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (value >= block->transaction_count)
+  {
+    char buffer[256] = { 0 };
+
+    const int32_t written = snprintf(
+      buffer,
+      sizeof(buffer),
+      "There was an error decoding '%s', transaction index %lu is out of bounds (%lu transactions).",
+      validator_name,
+      (unsigned long)value,
+      (unsigned long)block->transaction_count);
+
+    assert(written > 0);
+    CARDANO_UNUSED(written);
+
+    cardano_cbor_reader_set_last_error(reader, buffer);
+
+    return CARDANO_ERROR_INVALID_CBOR_VALUE;
+  }
+
+  *index = (size_t)value;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Locates the auxiliary data of the transactions of a block that carry any.
+ *
+ * \param[in] reader The reader, positioned at the auxiliary data map.
+ * \param[in,out] block The block, whose transaction bodies are already located.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the map is malformed.
+ */
+static cardano_error_t
+read_auxiliary_data(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  const size_t block_size = cardano_buffer_get_size(block->cbor);
+  int64_t      length     = 0;
+
+  cardano_error_t result   = cardano_cbor_reader_read_start_map(reader, &length);
+  bool            has_next = false;
+
+  for (size_t i = 0U; result == CARDANO_SUCCESS; ++i)
+  {
+    result = has_next_element(reader, length, i, CARDANO_CBOR_READER_STATE_END_MAP, &has_next);
+
+    if ((result != CARDANO_SUCCESS) || !has_next)
+    {
+      break;
+    }
+
+    size_t index = 0U;
+
+    result = read_transaction_index(reader, block, "auxiliary_data_set", &index);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    block_transaction_t* transaction = &block->transactions[index];
+
+    if (transaction->auxiliary_data_size != 0U)
+    {
+      cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'auxiliary_data_set', a transaction index appears twice.");
+      result = CARDANO_ERROR_DUPLICATED_CBOR_MAP_KEY;
+
+      break;
+    }
+
+    result = locate_value(reader, block_size, &transaction->auxiliary_data_offset, &transaction->auxiliary_data_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_map("auxiliary_data_set", reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Flags the transactions of a block that failed phase-2 validation.
+ *
+ * \param[in] reader The reader, positioned at the invalid transaction indices.
+ * \param[in,out] block The block, whose transaction bodies are already located.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the sequence is malformed.
+ */
+static cardano_error_t
+read_invalid_transactions(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  int64_t length = 0;
+
+  cardano_error_t result   = cardano_cbor_reader_read_start_array(reader, &length);
+  bool            has_next = false;
+
+  for (size_t i = 0U; result == CARDANO_SUCCESS; ++i)
+  {
+    result = has_next_element(reader, length, i, CARDANO_CBOR_READER_STATE_END_ARRAY, &has_next);
+
+    if ((result != CARDANO_SUCCESS) || !has_next)
+    {
+      break;
+    }
+
+    size_t index = 0U;
+
+    result = read_transaction_index(reader, block, "invalid_transactions", &index);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      block->transactions[index].is_valid = false;
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("invalid_transactions", reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Decodes a block from a reader over its encoding alone.
+ *
+ * \param[in] reader The reader over the block encoding.
+ * \param[in,out] block The block, holding the encoding the reader is over.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the block is malformed.
+ */
+static cardano_error_t
+read_block(cardano_cbor_reader_t* reader, cardano_block_t* block)
+{
+  int64_t length = 0;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((length != SHELLEY_BLOCK_SIZE) && (length != ALONZO_BLOCK_SIZE))
+  {
+    cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'block', expected an array of 4 or 5 elements.");
+
+    return CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+  }
+
+  result = read_header(reader, block);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = read_transaction_bodies(reader, block);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = read_witness_sets(reader, block);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = read_auxiliary_data(reader, block);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (length == ALONZO_BLOCK_SIZE))
+  {
+    result = read_invalid_transactions(reader, block);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("block", reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Extracts the encoding of a block, unwrapping the `[era, block]` envelope if present.
+ *
+ * Bare blocks are arrays of 4 or 5 elements, so an array of 2 elements can only be an envelope.
+ *
+ * \param[in] reader The reader, positioned at the block or its envelope.
+ * \param[out] cbor The encoding of the bare block.
+ *
+ * \return \ref CARDANO_SUCCESS, or an error if the value is malformed or holds a Byron block.
+ */
+static cardano_error_t
+read_block_cbor(cardano_cbor_reader_t* reader, cardano_buffer_t** cbor)
+{
+  cardano_buffer_t* encoded = NULL;
+
+  cardano_error_t result = cardano_cbor_reader_read_encoded_value(reader, &encoded);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (cardano_buffer_get_data(encoded)[0] != ERA_ENVELOPE_HEAD)
+  {
+    *cbor = encoded;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_t* envelope = cardano_cbor_reader_new(cardano_buffer_get_data(encoded), cardano_buffer_get_size(encoded));
+
+  cardano_buffer_unref(&encoded);
+
+  if (envelope == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  uint64_t era = 0U;
+
+  result = cardano_cbor_validate_array_of_n_elements("block", envelope, (uint32_t)ERA_ENVELOPE_SIZE);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(envelope, &era);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (era < FIRST_SHELLEY_ERA))
+  {
+    cardano_cbor_reader_set_last_error(envelope, "There was an error decoding 'block', Byron blocks are not supported.");
+    result = CARDANO_ERROR_DECODING;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_encoded_value(envelope, cbor);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array("block", envelope);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_set_last_error(reader, cardano_cbor_reader_get_last_error(envelope));
+    cardano_buffer_unref(cbor);
+    *cbor = NULL;
+  }
+
+  cardano_cbor_reader_unref(&envelope);
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_block_from_cbor(cardano_cbor_reader_t* reader, cardano_block_t** block)
+{
+  if (block == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader == NULL)
+  {
+    *block = NULL;
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_block_t* new_block = (cardano_block_t*)_cardano_malloc(sizeof(cardano_block_t));
+
+  if (new_block == NULL)
+  {
+    *block = NULL;
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(new_block, 0, sizeof(cardano_block_t)));
+
+  new_block->base.deallocator   = cardano_block_deallocate;
+  new_block->base.ref_count     = 1;
+  new_block->base.last_error[0] = '\0';
+
+  cardano_error_t result = read_block_cbor(reader, &new_block->cbor);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_block_unref(&new_block);
+    *block = NULL;
+
+    return result;
+  }
+
+  cardano_cbor_reader_t* block_reader = cardano_cbor_reader_new(cardano_buffer_get_data(new_block->cbor), cardano_buffer_get_size(new_block->cbor));
+
+  if (block_reader == NULL)
+  {
+    cardano_block_unref(&new_block);
+    *block = NULL;
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = read_block(block_reader, new_block);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_set_last_error(reader, cardano_cbor_reader_get_last_error(block_reader));
+    cardano_cbor_reader_unref(&block_reader);
+    cardano_block_unref(&new_block);
+    *block = NULL;
+
+    return result;
+  }
+
+  cardano_cbor_reader_unref(&block_reader);
+
+  *block = new_block;
+
+  return CARDANO_SUCCESS;
+}
+
+uint64_t
+cardano_block_get_block_number(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return 0U;
+  }
+
+  return block->block_number;
+}
+
+uint64_t
+cardano_block_get_slot(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return 0U;
+  }
+
+  return block->slot;
+}
+
+uint64_t
+cardano_block_get_body_size(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return 0U;
+  }
+
+  return block->body_size;
+}
+
+cardano_blake2b_hash_t*
+cardano_block_get_header_hash(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_ref(block->header_hash);
+
+  return block->header_hash;
+}
+
+cardano_blake2b_hash_t*
+cardano_block_get_previous_hash(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_ref(block->previous_hash);
+
+  return block->previous_hash;
+}
+
+cardano_blake2b_hash_t*
+cardano_block_get_body_hash(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_ref(block->body_hash);
+
+  return block->body_hash;
+}
+
+cardano_protocol_version_t*
+cardano_block_get_protocol_version(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_protocol_version_t* protocol_version = NULL;
+
+  if (cardano_protocol_version_new(block->protocol_major, block->protocol_minor, &protocol_version) != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  return protocol_version;
+}
+
+size_t
+cardano_block_get_transaction_count(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return 0U;
+  }
+
+  return block->transaction_count;
+}
+
+cardano_error_t
+cardano_block_get_transaction(
+  const cardano_block_t*  block,
+  const size_t            index,
+  cardano_transaction_t** transaction)
+{
+  if ((block == NULL) || (transaction == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *transaction = NULL;
+
+  if (index >= block->transaction_count)
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  const block_transaction_t* location = &block->transactions[index];
+  const byte_t*              data     = cardano_buffer_get_data(block->cbor);
+
+  cardano_transaction_body_t* body           = NULL;
+  cardano_witness_set_t*      witness_set    = NULL;
+  cardano_auxiliary_data_t*   auxiliary_data = NULL;
+
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_new(&data[location->body_offset], location->body_size);
+  cardano_error_t        result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_transaction_body_from_cbor(reader, &body);
+
+  cardano_cbor_reader_unref(&reader);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    reader = cardano_cbor_reader_new(&data[location->witness_set_offset], location->witness_set_size);
+    result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_witness_set_from_cbor(reader, &witness_set);
+
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (location->auxiliary_data_size != 0U))
+  {
+    reader = cardano_cbor_reader_new(&data[location->auxiliary_data_offset], location->auxiliary_data_size);
+    result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_auxiliary_data_from_cbor(reader, &auxiliary_data);
+
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_transaction_new(body, witness_set, auxiliary_data, transaction);
+  }
+
+  if ((result == CARDANO_SUCCESS) && !location->is_valid)
+  {
+    result = cardano_transaction_set_is_valid(*transaction, false);
+  }
+
+  cardano_transaction_body_unref(&body);
+  cardano_witness_set_unref(&witness_set);
+  cardano_auxiliary_data_unref(&auxiliary_data);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_unref(transaction);
+    *transaction = NULL;
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_block_get_transaction_id(
+  const cardano_block_t*   block,
+  const size_t             index,
+  cardano_blake2b_hash_t** id)
+{
+  if ((block == NULL) || (id == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (index >= block->transaction_count)
+  {
+    *id = NULL;
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  const block_transaction_t* location = &block->transactions[index];
+  const byte_t*              data     = cardano_buffer_get_data(block->cbor);
+
+  return cardano_blake2b_compute_hash(&data[location->body_offset], location->body_size, BLOCK_HASH_SIZE, id);
+}
+
+bool
+cardano_block_is_transaction_valid(const cardano_block_t* block, const size_t index)
+{
+  if ((block == NULL) || (index >= block->transaction_count))
+  {
+    return false;
+  }
+
+  return block->transactions[index].is_valid;
+}
+
+void
+cardano_block_unref(cardano_block_t** block)
+{
+  if ((block == NULL) || (*block == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*block)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *block = NULL;
+    return;
+  }
+}
+
+void
+cardano_block_ref(cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&block->base);
+}
+
+size_t
+cardano_block_refcount(const cardano_block_t* block)
+{
+  if (block == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&block->base);
+}
+
+void
+cardano_block_set_last_error(cardano_block_t* block, const char* message)
+{
+  cardano_object_set_last_error(&block->base, message);
+}
+
+const char*
+cardano_block_get_last_error(const cardano_block_t* block)
+{
+  return cardano_object_get_last_error(&block->base);
+}
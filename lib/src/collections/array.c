@@ -472,6 +472,60 @@ cardano_array_push(cardano_array_t* array, cardano_object_t* item)
   return array->size;
 }
 
+size_t
+cardano_array_insert_sorted(
+  cardano_array_t*                   array,
+  cardano_object_t*                  item,
+  const cardano_array_compare_item_t compare,
+  void*                              context)
+{
+  if (array == NULL)
+  {
+    return 0U;
+  }
+
+  if ((item == NULL) || (compare == NULL))
+  {
+    return array->size;
+  }
+
+  cardano_error_t error = grow_array_if_needed(array);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    cardano_array_set_last_error(array, cardano_error_to_string(error));
+    return array->size;
+  }
+
+  size_t low  = 0U;
+  size_t high = array->size;
+
+  while (low < high)
+  {
+    const size_t middle = low + ((high - low) / 2U);
+
+    if (compare(array->items[middle], item, context) > 0)
+    {
+      high = middle;
+    }
+    else
+    {
+      low = middle + 1U;
+    }
+  }
+
+  if (low < array->size)
+  {
+    CARDANO_UNUSED(memmove(&array->items[low + 1U], &array->items[low], (array->size - low) * sizeof(cardano_object_t*)));
+  }
+
+  cardano_object_ref(item);
+  array->items[low] = item;
+  ++array->size;
+
+  return array->size;
+}
+
 cardano_object_t*
 cardano_array_pop(cardano_array_t* array)
 {
@@ -243,6 +243,29 @@ CARDANO_EXPORT size_t cardano_array_get_size(const cardano_array_t* array);
  */
 CARDANO_EXPORT void cardano_array_clear(cardano_array_t* array);
 
+/**
+ * \brief Inserts an item into an array that is sorted according to the provided comparison function.
+ *
+ * The position of the item is found with a binary search, and the item is placed after any items that compare
+ * equal to it, so the array stays sorted and the relative order of equal items matches the order they were added
+ * in. This is cheaper than pushing the item and sorting the array again.
+ *
+ * \warning This function increases the reference count of item, caller must free its own reference by calling \ref cardano_array_unref.
+ *
+ * \param[in] array Target array to which the item will be added. Must already be sorted by \p compare.
+ * \param[in] item Pointer to the item to be added to the array.
+ * \param[in] compare The comparison function that defines the order of the array.
+ * \param[in] context An optional context pointer that will be passed to the compare function.
+ *
+ * \return The new size of the array after the item has been added.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_array_insert_sorted(
+  cardano_array_t*             array,
+  cardano_object_t*            item,
+  cardano_array_compare_item_t compare,
+  void*                        context);
+
 /**
  * Sorts the elements of the array according to the provided comparison function.
  *
@@ -0,0 +1,1169 @@
+/**
+ * \file utxo_snapshot.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/assets/asset_name.h>
+#include <cardano/assets/asset_name_map.h>
+#include <cardano/assets/multi_asset.h>
+#include <cardano/assets/policy_id_list.h>
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/common/datum.h>
+#include <cardano/common/utxo_snapshot.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/object.h>
+#include <cardano/scripts/script.h>
+#include <cardano/transaction_body/transaction_input.h>
+#include <cardano/transaction_body/transaction_output.h>
+#include <cardano/transaction_body/value.h>
+
+#include "../allocators.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/*
+ * Layout of format version 1. All integers are little-endian.
+ *
+ * header  (48 bytes): magic[8], version u32, header size u32, entry count u64, asset count u64,
+ *                     blob size u64, entry size u32, asset size u32.
+ * entries (96 bytes): tx id[32], output index u64, lovelace u64, first asset u64, asset count u32,
+ *                     address size u32, address offset u64, datum offset u64, datum size u32,
+ *                     script size u32, script offset u64.
+ * assets  (72 bytes): policy id[28], name size u32, name[32], quantity i64.
+ * blob:               address bytes, datum CBOR and script reference CBOR, addressed by offset.
+ */
+
+static const byte_t   SNAPSHOT_MAGIC[8]   = { 'C', 'U', 'T', 'X', 'O', 'S', 'N', 'P' };
+static const uint32_t SNAPSHOT_VERSION    = 1U;
+static const size_t   HEADER_SIZE         = 48U;
+static const size_t   ENTRY_SIZE          = 96U;
+static const size_t   ASSET_SIZE          = 72U;
+static const size_t   MAX_ASSET_NAME_SIZE = 32U;
+
+static const size_t HEADER_VERSION     = 8U;
+static const size_t HEADER_HEADER_SIZE = 12U;
+static const size_t HEADER_ENTRY_COUNT = 16U;
+static const size_t HEADER_ASSET_COUNT = 24U;
+static const size_t HEADER_BLOB_SIZE   = 32U;
+static const size_t HEADER_ENTRY_SIZE  = 40U;
+static const size_t HEADER_ASSET_SIZE  = 44U;
+
+static const size_t ENTRY_TX_ID          = 0U;
+static const size_t ENTRY_OUTPUT_INDEX   = 32U;
+static const size_t ENTRY_LOVELACE       = 40U;
+static const size_t ENTRY_FIRST_ASSET    = 48U;
+static const size_t ENTRY_ASSET_COUNT    = 56U;
+static const size_t ENTRY_ADDRESS_SIZE   = 60U;
+static const size_t ENTRY_ADDRESS_OFFSET = 64U;
+static const size_t ENTRY_DATUM_OFFSET   = 72U;
+static const size_t ENTRY_DATUM_SIZE     = 80U;
+static const size_t ENTRY_SCRIPT_SIZE    = 84U;
+static const size_t ENTRY_SCRIPT_OFFSET  = 88U;
+
+static const size_t ASSET_POLICY_ID = 0U;
+static const size_t ASSET_NAME_SIZE = 28U;
+static const size_t ASSET_NAME      = 32U;
+static const size_t ASSET_QUANTITY  = 64U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A read-only view over a binary UTxO set snapshot.
+ *
+ * The table pointers point into the borrowed snapshot bytes; the layout was validated when the
+ * snapshot was loaded, so readers only check the indices they are given.
+ */
+typedef struct cardano_utxo_snapshot_t
+{
+    cardano_object_t base;
+    const byte_t*    entries;
+    const byte_t*    assets;
+    const byte_t*    blob;
+    size_t           entry_count;
+    size_t           asset_count;
+    size_t           blob_size;
+} cardano_utxo_snapshot_t;
+
+/**
+ * \brief The tables a snapshot is encoded into before they are joined behind the header.
+ */
+typedef struct snapshot_tables_t
+{
+    cardano_buffer_t* entries;
+    cardano_buffer_t* assets;
+    cardano_buffer_t* blob;
+    size_t            asset_count;
+} snapshot_tables_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a snapshot object. The snapshot bytes are borrowed and left untouched.
+ *
+ * \param object A void pointer to the snapshot object to be deallocated.
+ */
+static void
+cardano_utxo_snapshot_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Reads a little-endian 32-bit unsigned integer.
+ *
+ * \param[in] data The first byte of the integer.
+ *
+ * \return The integer.
+ */
+static uint32_t
+read_u32(const byte_t* data)
+{
+  return (uint32_t)data[0] | ((uint32_t)data[1] << 8U) | ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U);
+}
+
+/**
+ * \brief Reads a little-endian 64-bit unsigned integer.
+ *
+ * \param[in] data The first byte of the integer.
+ *
+ * \return The integer.
+ */
+static uint64_t
+read_u64(const byte_t* data)
+{
+  return (uint64_t)read_u32(data) | ((uint64_t)read_u32(&data[4]) << 32U);
+}
+
+/**
+ * \brief Gets the encoding of an entry.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] index The index of the entry.
+ *
+ * \return The first byte of the entry, or NULL if \p snapshot is NULL or \p index is out of bounds.
+ */
+static const byte_t*
+get_entry(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  if ((snapshot == NULL) || (index >= snapshot->entry_count))
+  {
+    return NULL;
+  }
+
+  return &snapshot->entries[index * ENTRY_SIZE];
+}
+
+/**
+ * \brief Checks that a byte range lies within the blob.
+ *
+ * \param[in] offset The first byte of the range.
+ * \param[in] size The number of bytes in the range.
+ * \param[in] blob_size The size of the blob.
+ *
+ * \return \c true if the range is within the blob.
+ */
+static bool
+is_in_blob(const uint64_t offset, const uint64_t size, const uint64_t blob_size)
+{
+  return (offset <= blob_size) && (size <= (blob_size - offset));
+}
+
+/**
+ * \brief Appends a byte range to the blob.
+ *
+ * \param[in,out] blob The blob.
+ * \param[in] data The bytes to append.
+ * \param[in] size The number of bytes.
+ * \param[out] offset The offset of the bytes within the blob.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated buffer error.
+ */
+static cardano_error_t
+append_to_blob(cardano_buffer_t* blob, const byte_t* data, const size_t size, uint64_t* offset)
+{
+  *offset = cardano_buffer_get_size(blob);
+
+  if (size == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  return cardano_buffer_write(blob, data, size);
+}
+
+/**
+ * \brief Appends the CBOR encoding produced by a writer to the blob.
+ *
+ * \param[in,out] blob The blob.
+ * \param[in] writer The writer holding the encoding.
+ * \param[out] offset The offset of the encoding within the blob.
+ * \param[out] size The size of the encoding.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the encoding does not
+ *         fit the format, or a propagated error.
+ */
+static cardano_error_t
+append_cbor_to_blob(cardano_buffer_t* blob, cardano_cbor_writer_t* writer, uint64_t* offset, uint32_t* size)
+{
+  cardano_buffer_t* encoded = NULL;
+
+  cardano_error_t result = cardano_cbor_writer_encode_in_buffer(writer, &encoded);
+
+  if ((result == CARDANO_SUCCESS) && (cardano_buffer_get_size(encoded) > UINT32_MAX))
+  {
+    result = CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *size  = (uint32_t)cardano_buffer_get_size(encoded);
+    result = append_to_blob(blob, cardano_buffer_get_data(encoded), cardano_buffer_get_size(encoded), offset);
+  }
+
+  cardano_buffer_unref(&encoded);
+
+  return result;
+}
+
+/**
+ * \brief Encodes the native assets of a value into the asset table.
+ *
+ * \param[in,out] tables The tables being encoded.
+ * \param[in] value The value.
+ * \param[out] asset_count The number of assets encoded.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if a policy id or an
+ *         asset name does not fit the format, or a propagated error.
+ */
+static cardano_error_t
+encode_assets(snapshot_tables_t* tables, cardano_value_t* value, uint32_t* asset_count)
+{
+  cardano_multi_asset_t* multi_asset = cardano_value_get_multi_asset(value);
+
+  *asset_count = 0U;
+
+  if (multi_asset == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_policy_id_list_t* policies = NULL;
+
+  cardano_error_t result = cardano_multi_asset_get_keys(multi_asset, &policies);
+
+  const size_t policy_count = (result == CARDANO_SUCCESS) ? cardano_policy_id_list_get_length(policies) : 0U;
+
+  for (size_t i = 0U; (i < policy_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_blake2b_hash_t*   policy_id = NULL;
+    cardano_asset_name_map_t* assets    = NULL;
+
+    result = cardano_policy_id_list_get(policies, i, &policy_id);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_multi_asset_get_assets(multi_asset, policy_id, &assets);
+    }
+
+    if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_get_bytes_size(policy_id) != CARDANO_UTXO_SNAPSHOT_POLICY_ID_SIZE))
+    {
+      result = CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+
+    const size_t count = (result == CARDANO_SUCCESS) ? cardano_asset_name_map_get_length(assets) : 0U;
+
+    for (size_t j = 0U; (j < count) && (result == CARDANO_SUCCESS); ++j)
+    {
+      cardano_asset_name_t* asset_name = NULL;
+      int64_t               quantity   = 0;
+      byte_t                name[32]   = { 0 };
+
+      result = cardano_asset_name_map_get_key_value_at(assets, j, &asset_name, &quantity);
+
+      const size_t name_size = (result == CARDANO_SUCCESS) ? cardano_asset_name_get_bytes_size(asset_name) : 0U;
+
+      if ((result == CARDANO_SUCCESS) && (name_size > MAX_ASSET_NAME_SIZE))
+      {
+        result = CARDANO_ERROR_INVALID_ARGUMENT;
+      }
+
+      if ((result == CARDANO_SUCCESS) && (name_size > 0U))
+      {
+        cardano_safe_memcpy(name, sizeof(name), cardano_asset_name_get_bytes(asset_name), name_size);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_buffer_write(tables->assets, cardano_blake2b_hash_get_data(policy_id), CARDANO_UTXO_SNAPSHOT_POLICY_ID_SIZE);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_buffer_write_uint32_le(tables->assets, (uint32_t)name_size);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_buffer_write(tables->assets, name, sizeof(name));
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_buffer_write_int64_le(tables->assets, quantity);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        ++(*asset_count);
+      }
+
+      cardano_asset_name_unref(&asset_name);
+    }
+
+    cardano_asset_name_map_unref(&assets);
+    cardano_blake2b_hash_unref(&policy_id);
+  }
+
+  cardano_policy_id_list_unref(&policies);
+  cardano_multi_asset_unref(&multi_asset);
+
+  return result;
+}
+
+/**
+ * \brief Encodes the datum and script reference of an output into the blob.
+ *
+ * A missing datum or script reference is encoded with a size of zero.
+ *
+ * \param[in,out] tables The tables being encoded.
+ * \param[in] output The output.
+ * \param[out] datum_offset The offset of the datum CBOR within the blob.
+ * \param[out] datum_size The size of the datum CBOR.
+ * \param[out] script_offset The offset of the script reference CBOR within the blob.
+ * \param[out] script_size The size of the script reference CBOR.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated error.
+ */
+static cardano_error_t
+encode_datum_and_script(
+  snapshot_tables_t*            tables,
+  cardano_transaction_output_t* output,
+  uint64_t*                     datum_offset,
+  uint32_t*                     datum_size,
+  uint64_t*                     script_offset,
+  uint32_t*                     script_size)
+{
+  cardano_datum_t*  datum      = cardano_transaction_output_get_datum(output);
+  cardano_script_t* script_ref = cardano_transaction_output_get_script_ref(output);
+  cardano_error_t   result     = CARDANO_SUCCESS;
+
+  *datum_offset  = 0U;
+  *datum_size    = 0U;
+  *script_offset = 0U;
+  *script_size   = 0U;
+
+  if (datum != NULL)
+  {
+    cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+    result = (writer == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_datum_to_cbor(datum, writer);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = append_cbor_to_blob(tables->blob, writer, datum_offset, datum_size);
+    }
+
+    cardano_cbor_writer_unref(&writer);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (script_ref != NULL))
+  {
+    cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+    result = (writer == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_script_to_cbor(script_ref, writer);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = append_cbor_to_blob(tables->blob, writer, script_offset, script_size);
+    }
+
+    cardano_cbor_writer_unref(&writer);
+  }
+
+  cardano_datum_unref(&datum);
+  cardano_script_unref(&script_ref);
+
+  return result;
+}
+
+/**
+ * \brief Encodes one UTxO into the snapshot tables.
+ *
+ * \param[in,out] tables The tables being encoded.
+ * \param[in] utxo The UTxO.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the UTxO does not
+ *         fit the format, or a propagated error.
+ */
+static cardano_error_t
+encode_utxo(snapshot_tables_t* tables, cardano_utxo_t* utxo)
+{
+  cardano_transaction_input_t*  input   = cardano_utxo_get_input(utxo);
+  cardano_transaction_output_t* output  = cardano_utxo_get_output(utxo);
+  cardano_blake2b_hash_t*       tx_id   = (input != NULL) ? cardano_transaction_input_get_id(input) : NULL;
+  cardano_address_t*            address = (output != NULL) ? cardano_transaction_output_get_address(output) : NULL;
+  cardano_value_t*              value   = (output != NULL) ? cardano_transaction_output_get_value(output) : NULL;
+
+  uint32_t        asset_count    = 0U;
+  uint64_t        address_offset = 0U;
+  uint64_t        datum_offset   = 0U;
+  uint32_t        datum_size     = 0U;
+  uint64_t        script_offset  = 0U;
+  uint32_t        script_size    = 0U;
+  const uint64_t  first_asset    = tables->asset_count;
+  const int64_t   coin           = cardano_value_get_coin(value);
+  cardano_error_t result         = CARDANO_SUCCESS;
+
+  if ((tx_id == NULL) || (address == NULL) || (value == NULL))
+  {
+    result = CARDANO_ERROR_POINTER_IS_NULL;
+  }
+  else if ((cardano_blake2b_hash_get_bytes_size(tx_id) != CARDANO_UTXO_SNAPSHOT_TX_ID_SIZE) || (coin < 0))
+  {
+    result = CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+  else
+  {
+    result = encode_assets(tables, value, &asset_count);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    tables->asset_count += asset_count;
+
+    result = append_to_blob(tables->blob, cardano_address_get_bytes(address), cardano_address_get_bytes_size(address), &address_offset);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = encode_datum_and_script(tables, output, &datum_offset, &datum_size, &script_offset, &script_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write(tables->entries, cardano_blake2b_hash_get_data(tx_id), CARDANO_UTXO_SNAPSHOT_TX_ID_SIZE);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(tables->entries, cardano_transaction_input_get_index(input));
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(tables->entries, (uint64_t)coin);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(tables->entries, first_asset);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(tables->entries, asset_count);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(tables->entries, (uint32_t)cardano_address_get_bytes_size(address));
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(tables->entries, address_offset);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(tables->entries, datum_offset);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(tables->entries, datum_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(tables->entries, script_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(tables->entries, script_offset);
+  }
+
+  cardano_value_unref(&value);
+  cardano_address_unref(&address);
+  cardano_blake2b_hash_unref(&tx_id);
+  cardano_transaction_output_unref(&output);
+  cardano_transaction_input_unref(&input);
+
+  return result;
+}
+
+/**
+ * \brief Joins the snapshot header and tables into one buffer.
+ *
+ * \param[in] tables The encoded tables.
+ * \param[in] entry_count The number of entries.
+ * \param[out] snapshot On success, the snapshot.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated buffer error.
+ */
+static cardano_error_t
+join_tables(const snapshot_tables_t* tables, const size_t entry_count, cardano_buffer_t** snapshot)
+{
+  const size_t entries_size = cardano_buffer_get_size(tables->entries);
+  const size_t assets_size  = cardano_buffer_get_size(tables->assets);
+  const size_t blob_size    = cardano_buffer_get_size(tables->blob);
+
+  cardano_buffer_t* buffer = cardano_buffer_new(HEADER_SIZE + entries_size + assets_size + blob_size);
+
+  if (buffer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_buffer_write(buffer, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(buffer, SNAPSHOT_VERSION);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(buffer, (uint32_t)HEADER_SIZE);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(buffer, entry_count);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(buffer, tables->asset_count);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint64_le(buffer, blob_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(buffer, (uint32_t)ENTRY_SIZE);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write_uint32_le(buffer, (uint32_t)ASSET_SIZE);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (entries_size > 0U))
+  {
+    result = cardano_buffer_write(buffer, cardano_buffer_get_data(tables->entries), entries_size);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (assets_size > 0U))
+  {
+    result = cardano_buffer_write(buffer, cardano_buffer_get_data(tables->assets), assets_size);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (blob_size > 0U))
+  {
+    result = cardano_buffer_write(buffer, cardano_buffer_get_data(tables->blob), blob_size);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_buffer_unref(&buffer);
+
+    return result;
+  }
+
+  *snapshot = buffer;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks that every entry and asset of a snapshot stays within its tables.
+ *
+ * \param[in] snapshot The snapshot, whose table pointers and counts are set.
+ *
+ * \return \ref CARDANO_SUCCESS if the tables are consistent, or \ref CARDANO_ERROR_DECODING.
+ */
+static cardano_error_t
+validate_tables(const cardano_utxo_snapshot_t* snapshot)
+{
+  for (size_t i = 0U; i < snapshot->entry_count; ++i)
+  {
+    const byte_t*  entry       = &snapshot->entries[i * ENTRY_SIZE];
+    const uint64_t first_asset = read_u64(&entry[ENTRY_FIRST_ASSET]);
+    const uint64_t asset_count = read_u32(&entry[ENTRY_ASSET_COUNT]);
+
+    const bool is_valid = (read_u64(&entry[ENTRY_LOVELACE]) <= (uint64_t)INT64_MAX)
+      && (first_asset <= snapshot->asset_count) && (asset_count <= (snapshot->asset_count - first_asset))
+      && is_in_blob(read_u64(&entry[ENTRY_ADDRESS_OFFSET]), read_u32(&entry[ENTRY_ADDRESS_SIZE]), snapshot->blob_size)
+      && is_in_blob(read_u64(&entry[ENTRY_DATUM_OFFSET]), read_u32(&entry[ENTRY_DATUM_SIZE]), snapshot->blob_size)
+      && is_in_blob(read_u64(&entry[ENTRY_SCRIPT_OFFSET]), read_u32(&entry[ENTRY_SCRIPT_SIZE]), snapshot->blob_size);
+
+    if (!is_valid)
+    {
+      return CARDANO_ERROR_DECODING;
+    }
+  }
+
+  for (size_t i = 0U; i < snapshot->asset_count; ++i)
+  {
+    if (read_u32(&snapshot->assets[(i * ASSET_SIZE) + ASSET_NAME_SIZE]) > MAX_ASSET_NAME_SIZE)
+    {
+      return CARDANO_ERROR_DECODING;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Builds the value of an entry.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] entry The entry.
+ * \param[out] value On success, the value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated error.
+ */
+static cardano_error_t
+materialize_value(const cardano_utxo_snapshot_t* snapshot, const byte_t* entry, cardano_value_t** value)
+{
+  const size_t first_asset = (size_t)read_u64(&entry[ENTRY_FIRST_ASSET]);
+  const size_t asset_count = read_u32(&entry[ENTRY_ASSET_COUNT]);
+
+  cardano_multi_asset_t* multi_asset = NULL;
+  cardano_error_t        result      = cardano_multi_asset_new(&multi_asset);
+
+  for (size_t i = 0U; (i < asset_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    const byte_t*           asset      = &snapshot->assets[(first_asset + i) * ASSET_SIZE];
+    cardano_blake2b_hash_t* policy_id  = NULL;
+    cardano_asset_name_t*   asset_name = NULL;
+
+    result = cardano_blake2b_hash_from_bytes(&asset[ASSET_POLICY_ID], CARDANO_UTXO_SNAPSHOT_POLICY_ID_SIZE, &policy_id);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_asset_name_from_bytes(&asset[ASSET_NAME], read_u32(&asset[ASSET_NAME_SIZE]), &asset_name);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_multi_asset_set(multi_asset, policy_id, asset_name, (int64_t)read_u64(&asset[ASSET_QUANTITY]));
+    }
+
+    cardano_asset_name_unref(&asset_name);
+    cardano_blake2b_hash_unref(&policy_id);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_value_new((int64_t)read_u64(&entry[ENTRY_LOVELACE]), multi_asset, value);
+  }
+
+  cardano_multi_asset_unref(&multi_asset);
+
+  return result;
+}
+
+/**
+ * \brief Sets the datum and script reference of an entry on its output.
+ *
+ * \param[in] snapshot The snapshot.
+ * \param[in] entry The entry.
+ * \param[in,out] output The output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated error.
+ */
+static cardano_error_t
+materialize_datum_and_script(const cardano_utxo_snapshot_t* snapshot, const byte_t* entry, cardano_transaction_output_t* output)
+{
+  const uint32_t  datum_size  = read_u32(&entry[ENTRY_DATUM_SIZE]);
+  const uint32_t  script_size = read_u32(&entry[ENTRY_SCRIPT_SIZE]);
+  cardano_error_t result      = CARDANO_SUCCESS;
+
+  if (datum_size > 0U)
+  {
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(&snapshot->blob[read_u64(&entry[ENTRY_DATUM_OFFSET])], datum_size);
+    cardano_datum_t*       datum  = NULL;
+
+    result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_datum_from_cbor(reader, &datum);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_set_datum(output, datum);
+    }
+
+    cardano_datum_unref(&datum);
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (script_size > 0U))
+  {
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(&snapshot->blob[read_u64(&entry[ENTRY_SCRIPT_OFFSET])], script_size);
+    cardano_script_t*      script = NULL;
+
+    result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_script_from_cbor(reader, &script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_set_script_ref(output, script);
+    }
+
+    cardano_script_unref(&script);
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_utxo_snapshot_encode(const cardano_utxo_list_t* utxos, cardano_buffer_t** snapshot)
+{
+  if ((utxos == NULL) || (snapshot == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t      count  = cardano_utxo_list_get_length(utxos);
+  snapshot_tables_t tables = { 0 };
+
+  tables.entries = cardano_buffer_new((count > 0U) ? (count * ENTRY_SIZE) : 1U);
+  tables.assets  = cardano_buffer_new(ASSET_SIZE);
+  tables.blob    = cardano_buffer_new(128U);
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if ((tables.entries == NULL) || (tables.assets == NULL) || (tables.blob == NULL))
+  {
+    result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  for (size_t i = 0U; (i < count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+
+    result = cardano_utxo_list_get(utxos, i, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = encode_utxo(&tables, utxo);
+    }
+
+    cardano_utxo_unref(&utxo);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = join_tables(&tables, count, snapshot);
+  }
+
+  cardano_buffer_unref(&tables.blob);
+  cardano_buffer_unref(&tables.assets);
+  cardano_buffer_unref(&tables.entries);
+
+  return result;
+}
+
+cardano_error_t
+cardano_utxo_snapshot_load(const byte_t* data, const size_t size, cardano_utxo_snapshot_t** snapshot)
+{
+  if ((data == NULL) || (snapshot == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((size < sizeof(SNAPSHOT_MAGIC)) || (memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0))
+  {
+    return CARDANO_ERROR_INVALID_MAGIC;
+  }
+
+  if (size < HEADER_SIZE)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  if (read_u32(&data[HEADER_VERSION]) != SNAPSHOT_VERSION)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  const uint64_t entry_count = read_u64(&data[HEADER_ENTRY_COUNT]);
+  const uint64_t asset_count = read_u64(&data[HEADER_ASSET_COUNT]);
+  const uint64_t blob_size   = read_u64(&data[HEADER_BLOB_SIZE]);
+  const uint64_t available   = size - HEADER_SIZE;
+
+  const bool has_known_layout = (read_u32(&data[HEADER_HEADER_SIZE]) == HEADER_SIZE)
+    && (read_u32(&data[HEADER_ENTRY_SIZE]) == ENTRY_SIZE)
+    && (read_u32(&data[HEADER_ASSET_SIZE]) == ASSET_SIZE);
+
+  if (!has_known_layout
+    || (entry_count > (available / ENTRY_SIZE))
+    || (asset_count > ((available - (entry_count * ENTRY_SIZE)) / ASSET_SIZE))
+    || (blob_size != (available - (entry_count * ENTRY_SIZE) - (asset_count * ASSET_SIZE))))
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  cardano_utxo_snapshot_t* new_snapshot = (cardano_utxo_snapshot_t*)_cardano_malloc(sizeof(cardano_utxo_snapshot_t));
+
+  if (new_snapshot == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  new_snapshot->base.deallocator   = cardano_utxo_snapshot_deallocate;
+  new_snapshot->base.ref_count     = 1;
+  new_snapshot->base.last_error[0] = '\0';
+  new_snapshot->entry_count        = (size_t)entry_count;
+  new_snapshot->asset_count        = (size_t)asset_count;
+  new_snapshot->blob_size          = (size_t)blob_size;
+  new_snapshot->entries            = &data[HEADER_SIZE];
+  new_snapshot->assets             = &new_snapshot->entries[new_snapshot->entry_count * ENTRY_SIZE];
+  new_snapshot->blob               = &new_snapshot->assets[new_snapshot->asset_count * ASSET_SIZE];
+
+  const cardano_error_t result = validate_tables(new_snapshot);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_snapshot_unref(&new_snapshot);
+
+    return result;
+  }
+
+  *snapshot = new_snapshot;
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+cardano_utxo_snapshot_get_count(const cardano_utxo_snapshot_t* snapshot)
+{
+  if (snapshot == NULL)
+  {
+    return 0U;
+  }
+
+  return snapshot->entry_count;
+}
+
+const byte_t*
+cardano_utxo_snapshot_get_tx_id(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  const byte_t* entry = get_entry(snapshot, index);
+
+  return (entry != NULL) ? &entry[ENTRY_TX_ID] : NULL;
+}
+
+uint64_t
+cardano_utxo_snapshot_get_output_index(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  const byte_t* entry = get_entry(snapshot, index);
+
+  return (entry != NULL) ? read_u64(&entry[ENTRY_OUTPUT_INDEX]) : 0U;
+}
+
+uint64_t
+cardano_utxo_snapshot_get_lovelace(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  const byte_t* entry = get_entry(snapshot, index);
+
+  return (entry != NULL) ? read_u64(&entry[ENTRY_LOVELACE]) : 0U;
+}
+
+cardano_error_t
+cardano_utxo_snapshot_get_address(
+  const cardano_utxo_snapshot_t* snapshot,
+  const size_t                   index,
+  const byte_t**                 address,
+  size_t*                        address_size)
+{
+  if ((snapshot == NULL) || (address == NULL) || (address_size == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const byte_t* entry = get_entry(snapshot, index);
+
+  if (entry == NULL)
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  *address      = &snapshot->blob[read_u64(&entry[ENTRY_ADDRESS_OFFSET])];
+  *address_size = read_u32(&entry[ENTRY_ADDRESS_SIZE]);
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+cardano_utxo_snapshot_get_asset_count(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  const byte_t* entry = get_entry(snapshot, index);
+
+  return (entry != NULL) ? read_u32(&entry[ENTRY_ASSET_COUNT]) : 0U;
+}
+
+cardano_error_t
+cardano_utxo_snapshot_get_asset(
+  const cardano_utxo_snapshot_t* snapshot,
+  const size_t                   index,
+  const size_t                   asset_index,
+  const byte_t**                 policy_id,
+  const byte_t**                 asset_name,
+  size_t*                        asset_name_size,
+  int64_t*                       quantity)
+{
+  if ((snapshot == NULL) || (policy_id == NULL) || (asset_name == NULL) || (asset_name_size == NULL) || (quantity == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const byte_t* entry = get_entry(snapshot, index);
+
+  if ((entry == NULL) || (asset_index >= read_u32(&entry[ENTRY_ASSET_COUNT])))
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  const byte_t* asset = &snapshot->assets[((size_t)read_u64(&entry[ENTRY_FIRST_ASSET]) + asset_index) * ASSET_SIZE];
+
+  *policy_id       = &asset[ASSET_POLICY_ID];
+  *asset_name      = &asset[ASSET_NAME];
+  *asset_name_size = read_u32(&asset[ASSET_NAME_SIZE]);
+  *quantity        = (int64_t)read_u64(&asset[ASSET_QUANTITY]);
+
+  return CARDANO_SUCCESS;
+}
+
+bool
+cardano_utxo_snapshot_has_datum(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  const byte_t* entry = get_entry(snapshot, index);
+
+  return (entry != NULL) && (read_u32(&entry[ENTRY_DATUM_SIZE]) > 0U);
+}
+
+bool
+cardano_utxo_snapshot_has_script_ref(const cardano_utxo_snapshot_t* snapshot, const size_t index)
+{
+  const byte_t* entry = get_entry(snapshot, index);
+
+  return (entry != NULL) && (read_u32(&entry[ENTRY_SCRIPT_SIZE]) > 0U);
+}
+
+cardano_error_t
+cardano_utxo_snapshot_get_utxo(const cardano_utxo_snapshot_t* snapshot, const size_t index, cardano_utxo_t** utxo)
+{
+  if ((snapshot == NULL) || (utxo == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const byte_t* entry = get_entry(snapshot, index);
+
+  if (entry == NULL)
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  cardano_blake2b_hash_t*       tx_id   = NULL;
+  cardano_transaction_input_t*  input   = NULL;
+  cardano_address_t*            address = NULL;
+  cardano_value_t*              value   = NULL;
+  cardano_transaction_output_t* output  = NULL;
+
+  cardano_error_t result = cardano_blake2b_hash_from_bytes(&entry[ENTRY_TX_ID], CARDANO_UTXO_SNAPSHOT_TX_ID_SIZE, &tx_id);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_transaction_input_new(tx_id, read_u64(&entry[ENTRY_OUTPUT_INDEX]), &input);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_address_from_bytes(
+      &snapshot->blob[read_u64(&entry[ENTRY_ADDRESS_OFFSET])],
+      read_u32(&entry[ENTRY_ADDRESS_SIZE]),
+      &address);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_transaction_output_new(address, read_u64(&entry[ENTRY_LOVELACE]), &output);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (read_u32(&entry[ENTRY_ASSET_COUNT]) > 0U))
+  {
+    result = materialize_value(snapshot, entry, &value);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_set_value(output, value);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = materialize_datum_and_script(snapshot, entry, output);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_new(input, output, utxo);
+  }
+
+  cardano_transaction_output_unref(&output);
+  cardano_value_unref(&value);
+  cardano_address_unref(&address);
+  cardano_transaction_input_unref(&input);
+  cardano_blake2b_hash_unref(&tx_id);
+
+  return result;
+}
+
+cardano_error_t
+cardano_utxo_snapshot_get_utxos(
+  const cardano_utxo_snapshot_t* snapshot,
+  const size_t*                  indices,
+  const size_t                   count,
+  cardano_utxo_list_t**          utxos)
+{
+  if ((snapshot == NULL) || (utxos == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t         total = (indices != NULL) ? count : snapshot->entry_count;
+  cardano_utxo_list_t* list  = NULL;
+
+  cardano_error_t result = cardano_utxo_list_new(&list);
+
+  for (size_t i = 0U; (i < total) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+
+    result = cardano_utxo_snapshot_get_utxo(snapshot, (indices != NULL) ? indices[i] : i, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_utxo_list_add(list, utxo);
+    }
+
+    cardano_utxo_unref(&utxo);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(&list);
+
+    return result;
+  }
+
+  *utxos = list;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_utxo_snapshot_unref(cardano_utxo_snapshot_t** snapshot)
+{
+  if ((snapshot == NULL) || (*snapshot == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*snapshot)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *snapshot = NULL;
+    return;
+  }
+}
+
+void
+cardano_utxo_snapshot_ref(cardano_utxo_snapshot_t* snapshot)
+{
+  if (snapshot == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&snapshot->base);
+}
+
+size_t
+cardano_utxo_snapshot_refcount(const cardano_utxo_snapshot_t* snapshot)
+{
+  if (snapshot == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&snapshot->base);
+}
+
+void
+cardano_utxo_snapshot_set_last_error(cardano_utxo_snapshot_t* snapshot, const char* message)
+{
+  cardano_object_set_last_error(&snapshot->base, message);
+}
+
+const char*
+cardano_utxo_snapshot_get_last_error(const cardano_utxo_snapshot_t* snapshot)
+{
+  return cardano_object_get_last_error(&snapshot->base);
+}
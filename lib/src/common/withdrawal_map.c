@@ -420,10 +420,17 @@ cardano_withdrawal_map_to_cip116_json(
 
     cardano_withdrawal_map_kvp_t* kvp_data = (cardano_withdrawal_map_kvp_t*)((void*)kvp);
 
+    const char* address = cardano_reward_address_get_string(kvp_data->key);
+
+    if (address == NULL)
+    {
+      cardano_object_unref(&kvp);
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
     cardano_json_writer_write_start_object(writer);
     cardano_json_writer_write_property_name(writer, "key", 3);
 
-    const char*  address                      = cardano_reward_address_get_string(kvp_data->key);
     const size_t addres_size                  = cardano_reward_address_get_bech32_size(kvp_data->key);
     const size_t size_without_null_terminator = cardano_safe_strlen(address, addres_size);
 
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <cardano/crypto/blake2b_hash_size.h>
+#include <sodium.h>
 #include <string.h>
 
 /* CONSTANTS *****************************************************************/
@@ -303,6 +304,68 @@ cardano_bip32_public_key_derive(
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_bip32_public_key_derive_key_hashes(
+  const cardano_bip32_public_key_t* account_key,
+  const uint32_t                    role,
+  const uint32_t                    start_index,
+  const size_t                      count,
+  byte_t*                           key_hashes,
+  const size_t                      key_hashes_size)
+{
+  static const size_t ed25519_public_key_length = 32;
+
+  if ((account_key == NULL) || (key_hashes == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (_cardano_crypto_is_hardened_derivation(role) || ((size_t)start_index + count - 1U > 0x7FFFFFFFU))
+  {
+    return CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX;
+  }
+
+  if (key_hashes_size / (size_t)CARDANO_BLAKE2B_HASH_SIZE_224 < count)
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  byte_t role_key[64U]    = { 0 };
+  byte_t derived_key[64U] = { 0 };
+
+  cardano_error_t error = _cardano_crypto_derive_public(cardano_buffer_get_data(account_key->key_material), (int32_t)role, &role_key[0], sizeof(role_key));
+
+  for (size_t i = 0U; (i < count) && (error == CARDANO_SUCCESS); ++i)
+  {
+    error = _cardano_crypto_derive_public(&role_key[0], (int32_t)(start_index + (uint32_t)i), &derived_key[0], sizeof(derived_key));
+
+    if (error == CARDANO_SUCCESS)
+    {
+      const int hashing_result = crypto_generichash(
+        &key_hashes[i * (size_t)CARDANO_BLAKE2B_HASH_SIZE_224],
+        CARDANO_BLAKE2B_HASH_SIZE_224,
+        &derived_key[0],
+        ed25519_public_key_length,
+        NULL,
+        0U);
+
+      error = (hashing_result == 0) ? CARDANO_SUCCESS : CARDANO_ERROR_GENERIC;
+    }
+  }
+
+  return error;
+}
+
 cardano_error_t
 cardano_bip32_public_key_to_ed25519_key(
   const cardano_bip32_public_key_t* public_key,
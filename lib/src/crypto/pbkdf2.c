@@ -54,13 +54,18 @@ cardano_crypto_pbkdf2_hmac_sha512(
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
+  crypto_auth_hmacsha512_state keyed_hmac_state     = { 0 };
   crypto_auth_hmacsha512_state initial_hmac_state   = { 0 };
   crypto_auth_hmacsha512_state loop_hHmac_state     = { 0 };
   byte_t                       iteration_vector[4U] = { 0 };
   byte_t                       temp_digest[64U]     = { 0 };
   byte_t                       block_digest[64U]    = { 0 };
 
-  crypto_auth_hmacsha512_init(&initial_hmac_state, password, password_length);
+  // The inner and outer pads only depend on the password, so they are hashed once here and the keyed state is
+  // copied for every iteration instead of keying a new HMAC each time.
+  crypto_auth_hmacsha512_init(&keyed_hmac_state, password, password_length);
+
+  cardano_safe_memcpy(&initial_hmac_state, sizeof(crypto_auth_hmacsha512_state), &keyed_hmac_state, sizeof(crypto_auth_hmacsha512_state));
   crypto_auth_hmacsha512_update(&initial_hmac_state, salt, salt_length);
 
   for (size_t i = 0; (i * crypto_auth_hmacsha512_BYTES) < derived_key_length; ++i)
@@ -78,7 +83,7 @@ cardano_crypto_pbkdf2_hmac_sha512(
 
     for (size_t j = 2; j <= iterations; ++j)
     {
-      crypto_auth_hmacsha512_init(&loop_hHmac_state, password, password_length);
+      cardano_safe_memcpy(&loop_hHmac_state, sizeof(crypto_auth_hmacsha512_state), &keyed_hmac_state, sizeof(crypto_auth_hmacsha512_state));
       crypto_auth_hmacsha512_update(&loop_hHmac_state, temp_digest, crypto_auth_hmacsha512_BYTES);
       crypto_auth_hmacsha512_final(&loop_hHmac_state, temp_digest);
 
@@ -102,6 +107,7 @@ cardano_crypto_pbkdf2_hmac_sha512(
       current_block_length);
   }
 
+  sodium_memzero((void*)&keyed_hmac_state, sizeof(keyed_hmac_state));
   sodium_memzero((void*)&initial_hmac_state, sizeof(initial_hmac_state));
   sodium_memzero((void*)&loop_hHmac_state, sizeof(loop_hHmac_state));
   sodium_memzero((void*)iteration_vector, sizeof(iteration_vector));
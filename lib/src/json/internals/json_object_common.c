@@ -31,8 +31,68 @@
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+static const size_t KEY_INDEX_MIN_PROPERTIES = 16U;
+
 /* STATIC FUNCTIONS **********************************************************/
 
+/**
+ * \brief Computes the FNV-1a hash of a key.
+ *
+ * \param[in] key The key bytes.
+ * \param[in] size The number of bytes in the key.
+ *
+ * \return The hash of the key.
+ */
+static uint64_t
+hash_key(const char* key, const size_t size)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)(byte_t)key[i];
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Checks whether a key-value pair has the given key.
+ *
+ * \param[in] kvp The key-value pair.
+ * \param[in] key The key to compare against.
+ * \param[in] size The size of the key in bytes.
+ *
+ * \return \c true if the keys are equal, \c false otherwise.
+ */
+static bool
+key_equals(const cardano_json_kvp_t* kvp, const char* key, const size_t size)
+{
+  const size_t key_size = cardano_buffer_get_size(kvp->key) - 1U;
+
+  return (key_size == size) && (memcmp(cardano_buffer_get_data(kvp->key), key, size) == 0);
+}
+
+/**
+ * \brief Retrieves a key-value pair of a JSON object without taking a reference.
+ *
+ * \param[in] object The JSON object.
+ * \param[in] index The position of the pair.
+ *
+ * \return The key-value pair.
+ */
+static cardano_json_kvp_t*
+get_pair(const cardano_json_object_t* object, const size_t index)
+{
+  cardano_json_kvp_t* kvp = (cardano_json_kvp_t*)((void*)cardano_array_get(object->pairs, index));
+  cardano_object_unref((cardano_object_t**)((void*)&kvp));
+
+  return kvp;
+}
+
 /**
  * \brief Deallocates a JSON object and its associated resources.
  *
@@ -54,6 +114,11 @@ cardano_json_object_deallocate(void* object)
   cardano_array_unref(&json_object->pairs);
   cardano_array_unref(&json_object->array);
 
+  if (json_object->key_index != NULL)
+  {
+    _cardano_free(json_object->key_index);
+  }
+
   if (json_object->json_string != NULL)
   {
     _cardano_free(json_object->json_string);
@@ -108,6 +173,8 @@ cardano_json_object_new(void)
     object->is_negative        = false;
     object->json_string        = NULL;
     object->json_string_length = 0U;
+    object->key_index          = NULL;
+    object->key_index_capacity = 0U;
   }
 
   return object;
@@ -127,4 +194,94 @@ cardano_json_kvp_new(void)
   }
 
   return kvp;
-}
\ No newline at end of file
+}
+
+void
+cardano_json_object_index_keys(cardano_json_object_t* object)
+{
+  assert(object != NULL);
+  assert(object->type == CARDANO_JSON_OBJECT_TYPE_OBJECT);
+
+  const size_t count = cardano_array_get_size(object->pairs);
+
+  if ((count < KEY_INDEX_MIN_PROPERTIES) || (object->key_index != NULL))
+  {
+    return;
+  }
+
+  size_t capacity = KEY_INDEX_MIN_PROPERTIES;
+
+  while (capacity < (count * 2U))
+  {
+    capacity *= 2U;
+  }
+
+  size_t* slots = (size_t*)_cardano_malloc(capacity * sizeof(size_t));
+
+  if (slots == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(memset(slots, 0, capacity * sizeof(size_t)));
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const cardano_json_kvp_t* kvp  = get_pair(object, i);
+    const char*               key  = (const char*)((const void*)cardano_buffer_get_data(kvp->key));
+    const size_t              size = cardano_buffer_get_size(kvp->key) - 1U;
+    size_t                    slot = (size_t)hash_key(key, size) & (capacity - 1U);
+
+    while ((slots[slot] != 0U) && !key_equals(get_pair(object, slots[slot] - 1U), key, size))
+    {
+      slot = (slot + 1U) & (capacity - 1U);
+    }
+
+    if (slots[slot] == 0U)
+    {
+      slots[slot] = i + 1U;
+    }
+  }
+
+  object->key_index          = slots;
+  object->key_index_capacity = capacity;
+}
+
+cardano_json_kvp_t*
+cardano_json_object_find_pair(const cardano_json_object_t* object, const char* key, const size_t size)
+{
+  assert(object != NULL);
+  assert(key != NULL);
+
+  if (object->key_index == NULL)
+  {
+    for (size_t i = 0U; i < cardano_array_get_size(object->pairs); ++i)
+    {
+      cardano_json_kvp_t* kvp = get_pair(object, i);
+
+      if (key_equals(kvp, key, size))
+      {
+        return kvp;
+      }
+    }
+
+    return NULL;
+  }
+
+  const size_t mask = object->key_index_capacity - 1U;
+  size_t       slot = (size_t)hash_key(key, size) & mask;
+
+  while (object->key_index[slot] != 0U)
+  {
+    cardano_json_kvp_t* kvp = get_pair(object, object->key_index[slot] - 1U);
+
+    if (key_equals(kvp, key, size))
+    {
+      return kvp;
+    }
+
+    slot = (slot + 1U) & mask;
+  }
+
+  return NULL;
+}
@@ -62,6 +62,8 @@ typedef struct cardano_json_object_t
     bool                       bool_value;         /**< Boolean value for JSON booleans. */
     char*                      json_string;        /**< String representation of the JSON value. */
     size_t                     json_string_length; /**< Length of the string representation. */
+    size_t*                    key_index;          /**< Open-addressing hash table of pair positions plus one, or NULL. */
+    size_t                     key_index_capacity; /**< Number of slots in \c key_index; always a power of two. */
 
 } cardano_json_object_t;
 
@@ -106,4 +108,28 @@ cardano_json_object_t* cardano_json_object_new(void);
  */
 cardano_json_kvp_t* cardano_json_kvp_new(void);
 
+/**
+ * \brief Builds a hashed index over the keys of a JSON object.
+ *
+ * Property lookups scan the key-value pairs of an object linearly. For objects with many properties this
+ * function builds an open-addressing hash table of the keys, which \ref cardano_json_object_find_pair
+ * then uses instead. Objects with few properties are left without an index, since scanning them is cheaper.
+ * If the index cannot be allocated the object is left without one; lookups still work.
+ *
+ * \param[in,out] object The JSON object to index. Must be of type \c CARDANO_JSON_OBJECT_TYPE_OBJECT.
+ */
+void cardano_json_object_index_keys(cardano_json_object_t* object);
+
+/**
+ * \brief Finds the first key-value pair of a JSON object with the given key.
+ *
+ * \param[in] object The JSON object to search. Must be of type \c CARDANO_JSON_OBJECT_TYPE_OBJECT.
+ * \param[in] key The key to look for. It does not need to be null-terminated.
+ * \param[in] size The size of the key in bytes.
+ *
+ * \return The key-value pair, or \c NULL if the object has no property with the given key. The pair is owned
+ *         by the object; the caller must not release it.
+ */
+cardano_json_kvp_t* cardano_json_object_find_pair(const cardano_json_object_t* object, const char* key, size_t size);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_JSON_OBJECT_COMMON_H
\ No newline at end of file
@@ -687,6 +687,8 @@ cardano_parse_object_value(cardano_json_parse_context_t* ctx)
   obj->type  = CARDANO_JSON_OBJECT_TYPE_OBJECT;
   obj->pairs = pairs;
 
+  cardano_json_object_index_keys(obj);
+
   return obj;
 }
 
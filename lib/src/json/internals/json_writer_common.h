@@ -29,6 +29,7 @@
 #include <cardano/json/json_context.h>
 #include <cardano/json/json_format.h>
 #include <cardano/json/json_object_type.h>
+#include <cardano/json/json_writer.h>
 #include <cardano/object.h>
 #include <cardano/typedefs.h>
 
@@ -67,12 +68,16 @@ typedef struct
  */
 typedef struct cardano_json_writer_t
 {
-    cardano_object_t           base;
-    cardano_buffer_t*          buffer;
-    cardano_error_t            last_error;
-    size_t                     depth;
-    cardano_json_format_t      format;
-    cardano_json_stack_frame_t current_frame[LIB_CARDANO_C_MAX_JSON_DEPTH];
+    cardano_object_t                base;
+    cardano_buffer_t*               buffer;
+    cardano_error_t                 last_error;
+    size_t                          depth;
+    cardano_json_format_t           format;
+    cardano_json_writer_sink_func_t sink;            /**< Receives the output as it is written, or NULL to keep it in \c buffer. */
+    void*                           sink_context;    /**< Opaque pointer passed back to \c sink. */
+    size_t                          flush_threshold; /**< Number of pending bytes that triggers a flush to \c sink. */
+    size_t                          flushed_size;    /**< Number of bytes already handed to \c sink. */
+    cardano_json_stack_frame_t      current_frame[LIB_CARDANO_C_MAX_JSON_DEPTH];
 } cardano_json_writer_t;
 
 /* FUNCTIONS *****************************************************************/
@@ -164,25 +164,7 @@ cardano_json_object_has_property(
     return false;
   }
 
-  for (size_t i = 0U; i < cardano_array_get_size(json_object->pairs); ++i)
-  {
-    cardano_json_kvp_t* kvp = (cardano_json_kvp_t*)((void*)cardano_array_get(json_object->pairs, i));
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-    const size_t key_size = cardano_buffer_get_size(kvp->key) - 1U;
-
-    if (key_size != size)
-    {
-      continue;
-    }
-
-    if (strncmp((const char*)cardano_buffer_get_data(kvp->key), key, key_size) == 0)
-    {
-      return true;
-    }
-  }
-
-  return false;
+  return cardano_json_object_find_pair(json_object, key, size) != NULL;
 }
 
 size_t
@@ -270,29 +252,18 @@ cardano_json_object_get(
     return false;
   }
 
-  for (size_t i = 0U; i < cardano_array_get_size(json_object->pairs); ++i)
-  {
-    cardano_json_kvp_t* kvp = (cardano_json_kvp_t*)((void*)cardano_array_get(json_object->pairs, i));
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
+  cardano_json_kvp_t* kvp = cardano_json_object_find_pair(json_object, key, size);
 
-    const size_t key_size = cardano_buffer_get_size(kvp->key) - 1U;
-
-    if (key_size != size)
-    {
-      continue;
-    }
-
-    if (strncmp((const char*)cardano_buffer_get_data(kvp->key), key, key_size) == 0)
-    {
-      cardano_json_object_ref(kvp->value);
+  if (kvp == NULL)
+  {
+    return false;
+  }
 
-      *value = kvp->value;
+  cardano_json_object_ref(kvp->value);
 
-      return true;
-    }
-  }
+  *value = kvp->value;
 
-  return false;
+  return true;
 }
 
 bool
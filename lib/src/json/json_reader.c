@@ -0,0 +1,863 @@
+/**
+ * \file json_reader.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/json/json_context.h>
+#include <cardano/json/json_reader.h>
+#include <cardano/object.h>
+
+#include "../allocators.h"
+#include "../config.h"
+#include "../string_safe.h"
+#include "internals/json_parser.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The state of one open container while reading.
+ */
+typedef struct
+{
+    cardano_json_context_t context;      /**< The kind of container (root, object or array). */
+    size_t                 item_count;   /**< Number of values (or properties) read in the container so far. */
+    bool                   expect_value; /**< Whether a property name has been read and its value is next. */
+} cardano_json_reader_frame_t;
+
+/**
+ * \brief Provides a API for forward-only, pull-style reading of UTF-8 encoded JSON text.
+ */
+typedef struct cardano_json_reader_t
+{
+    cardano_object_t             base;
+    cardano_json_parse_context_t ctx;
+    cardano_buffer_t*            scratch;
+    cardano_error_t              error;
+    cardano_json_token_type_t    token;
+    size_t                       number_offset;
+    size_t                       number_size;
+    bool                         bool_value;
+    size_t                       depth;
+    cardano_json_reader_frame_t  frames[LIB_CARDANO_C_MAX_JSON_DEPTH];
+} cardano_json_reader_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a JSON reader object.
+ *
+ * \param object A void pointer to the JSON reader object to be deallocated.
+ */
+static void
+cardano_json_reader_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_json_reader_t* reader = (cardano_json_reader_t*)object;
+
+  cardano_buffer_unref(&reader->scratch);
+
+  _cardano_free(reader);
+}
+
+/**
+ * \brief Records a malformed-document error on the reader.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ * \param[in] error The error code every later read will return.
+ * \param[in] message The error message.
+ *
+ * \return \p error.
+ */
+static cardano_error_t
+fail(cardano_json_reader_t* reader, const cardano_error_t error, const char* message)
+{
+  reader->error = error;
+  reader->token = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  cardano_object_set_last_error(&reader->base, message);
+
+  return error;
+}
+
+/**
+ * \brief Marks a value as read in the current container.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ */
+static void
+complete_value(cardano_json_reader_t* reader)
+{
+  cardano_json_reader_frame_t* frame = &reader->frames[reader->depth];
+
+  ++frame->item_count;
+  frame->expect_value = false;
+}
+
+/**
+ * \brief Opens a container and makes it the current one.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ * \param[in] context The kind of container being opened.
+ *
+ * \return CARDANO_SUCCESS on success, or CARDANO_ERROR_INVALID_JSON if the nesting depth limit is exceeded.
+ */
+static cardano_error_t
+push_frame(cardano_json_reader_t* reader, const cardano_json_context_t context)
+{
+  if (reader->depth >= ((size_t)LIB_CARDANO_C_MAX_JSON_DEPTH - 1U))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Maximum object depth exceeded");
+  }
+
+  complete_value(reader);
+
+  ++reader->depth;
+
+  reader->frames[reader->depth] = (cardano_json_reader_frame_t) {
+    .context      = context,
+    .item_count   = 0U,
+    .expect_value = false
+  };
+
+  ++reader->ctx.offset;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Decodes the string starting at the current offset into the scratch buffer.
+ *
+ * \param[in,out] reader The JSON reader instance. The current character must be a quote.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+read_string(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  if ((ctx->offset >= ctx->length) || (ctx->input[ctx->offset] != '\"'))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON string start");
+  }
+
+  ++ctx->offset;
+
+  cardano_error_t result = cardano_buffer_set_size(reader->scratch, 0U);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return fail(reader, result, "Failed to reset the string buffer");
+  }
+
+  while (ctx->offset < ctx->length)
+  {
+    const char c = ctx->input[ctx->offset];
+
+    if (c == '\"')
+    {
+      ++ctx->offset;
+
+      result = cardano_buffer_write(reader->scratch, (const byte_t*)"\0", 1U);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return fail(reader, result, "Failed to decode JSON string");
+      }
+
+      return CARDANO_SUCCESS;
+    }
+
+    bool is_valid = false;
+
+    if (c == '\\')
+    {
+      ++ctx->offset;
+      is_valid = cardano_handle_escape_sequence(ctx, reader->scratch);
+    }
+    else
+    {
+      is_valid = cardano_handle_utf8_sequence(ctx, reader->scratch);
+    }
+
+    if (!is_valid)
+    {
+      return fail(reader, CARDANO_ERROR_INVALID_JSON, ctx->last_error);
+    }
+  }
+
+  return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unterminated JSON string");
+}
+
+/**
+ * \brief Skips a run of decimal digits.
+ *
+ * \param[in,out] ctx The parse context.
+ *
+ * \return The number of digits skipped.
+ */
+static size_t
+skip_digits(cardano_json_parse_context_t* ctx)
+{
+  size_t count = 0U;
+
+  while ((ctx->offset < ctx->length) && (ctx->input[ctx->offset] >= '0') && (ctx->input[ctx->offset] <= '9'))
+  {
+    ++ctx->offset;
+    ++count;
+  }
+
+  return count;
+}
+
+/**
+ * \brief Scans a number starting at the current offset and records where its text is.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ *
+ * \return CARDANO_SUCCESS on success, or CARDANO_ERROR_INVALID_JSON if the number is malformed.
+ */
+static cardano_error_t
+read_number(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx   = &reader->ctx;
+  const size_t                  start = ctx->offset;
+
+  if (ctx->input[ctx->offset] == '-')
+  {
+    ++ctx->offset;
+  }
+
+  const size_t digits_start = ctx->offset;
+  const size_t digits       = skip_digits(ctx);
+
+  if ((digits == 0U) || ((digits > 1U) && (ctx->input[digits_start] == '0')))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON number");
+  }
+
+  if ((ctx->offset < ctx->length) && (ctx->input[ctx->offset] == '.'))
+  {
+    ++ctx->offset;
+
+    if (skip_digits(ctx) == 0U)
+    {
+      return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON number");
+    }
+  }
+
+  if ((ctx->offset < ctx->length) && ((ctx->input[ctx->offset] == 'e') || (ctx->input[ctx->offset] == 'E')))
+  {
+    ++ctx->offset;
+
+    if ((ctx->offset < ctx->length) && ((ctx->input[ctx->offset] == '+') || (ctx->input[ctx->offset] == '-')))
+    {
+      ++ctx->offset;
+    }
+
+    if (skip_digits(ctx) == 0U)
+    {
+      return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON number");
+    }
+  }
+
+  reader->number_offset = start;
+  reader->number_size   = ctx->offset - start;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Matches a literal (true, false or null) at the current offset.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ * \param[in] literal The literal to match.
+ * \param[in] literal_size The length of the literal.
+ *
+ * \return CARDANO_SUCCESS on success, or CARDANO_ERROR_INVALID_JSON if the literal does not match.
+ */
+static cardano_error_t
+read_literal(cardano_json_reader_t* reader, const char* literal, const size_t literal_size)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  if (((ctx->offset + literal_size) > ctx->length) || (strncmp(&ctx->input[ctx->offset], literal, literal_size) != 0))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON literal");
+  }
+
+  ctx->offset += literal_size;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads the value starting at the current offset.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+read_value(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  if (ctx->offset >= ctx->length)
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unexpected end of input");
+  }
+
+  const char      c      = ctx->input[ctx->offset];
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  switch (c)
+  {
+    case '{':
+      reader->token = CARDANO_JSON_TOKEN_TYPE_START_OBJECT;
+      return push_frame(reader, CARDANO_JSON_CONTEXT_OBJECT);
+    case '[':
+      reader->token = CARDANO_JSON_TOKEN_TYPE_START_ARRAY;
+      return push_frame(reader, CARDANO_JSON_CONTEXT_ARRAY);
+    case '\"':
+      reader->token = CARDANO_JSON_TOKEN_TYPE_STRING;
+      result        = read_string(reader);
+      break;
+    case 't':
+      reader->token      = CARDANO_JSON_TOKEN_TYPE_BOOLEAN;
+      reader->bool_value = true;
+      result             = read_literal(reader, "true", 4U);
+      break;
+    case 'f':
+      reader->token      = CARDANO_JSON_TOKEN_TYPE_BOOLEAN;
+      reader->bool_value = false;
+      result             = read_literal(reader, "false", 5U);
+      break;
+    case 'n':
+      reader->token = CARDANO_JSON_TOKEN_TYPE_NULL;
+      result        = read_literal(reader, "null", 4U);
+      break;
+    default:
+      if ((c == '-') || ((c >= '0') && (c <= '9')))
+      {
+        reader->token = CARDANO_JSON_TOKEN_TYPE_NUMBER;
+        result        = read_number(reader);
+      }
+      else
+      {
+        result = fail(reader, CARDANO_ERROR_INVALID_JSON, "Unexpected character");
+      }
+      break;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    complete_value(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads the next token inside an object.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+read_in_object(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx   = &reader->ctx;
+  cardano_json_reader_frame_t*  frame = &reader->frames[reader->depth];
+
+  if (frame->expect_value)
+  {
+    return read_value(reader);
+  }
+
+  // Like the DOM parser, a trailing comma before the closing brace is accepted.
+  if ((frame->item_count > 0U) && (ctx->offset < ctx->length) && (ctx->input[ctx->offset] == ','))
+  {
+    ++ctx->offset;
+    cardano_skip_whitespace(ctx);
+  }
+  else if ((frame->item_count > 0U) && ((ctx->offset >= ctx->length) || (ctx->input[ctx->offset] != '}')))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Expected ',' or '}'");
+  }
+  else
+  {
+    // Do nothing.
+  }
+
+  if ((ctx->offset < ctx->length) && (ctx->input[ctx->offset] == '}'))
+  {
+    ++ctx->offset;
+    --reader->depth;
+
+    reader->token = CARDANO_JSON_TOKEN_TYPE_END_OBJECT;
+
+    return CARDANO_SUCCESS;
+  }
+
+  reader->token = CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME;
+
+  cardano_error_t result = read_string(reader);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return fail(reader, result, "Invalid JSON object key");
+  }
+
+  cardano_skip_whitespace(ctx);
+
+  if ((ctx->offset >= ctx->length) || (ctx->input[ctx->offset] != ':'))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON object key-value separator");
+  }
+
+  ++ctx->offset;
+
+  frame->expect_value = true;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads the next token inside an array.
+ *
+ * \param[in,out] reader The JSON reader instance.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+read_in_array(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  const bool has_items = reader->frames[reader->depth].item_count > 0U;
+
+  // Like the DOM parser, a trailing comma before the closing bracket is accepted.
+  if (has_items && (ctx->offset < ctx->length) && (ctx->input[ctx->offset] == ','))
+  {
+    ++ctx->offset;
+    cardano_skip_whitespace(ctx);
+  }
+  else if (has_items && ((ctx->offset >= ctx->length) || (ctx->input[ctx->offset] != ']')))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Expected ',' or ']'");
+  }
+  else
+  {
+    // Do nothing.
+  }
+
+  if ((ctx->offset < ctx->length) && (ctx->input[ctx->offset] == ']'))
+  {
+    ++ctx->offset;
+    --reader->depth;
+
+    reader->token = CARDANO_JSON_TOKEN_TYPE_END_ARRAY;
+
+    return CARDANO_SUCCESS;
+  }
+
+  return read_value(reader);
+}
+
+/**
+ * \brief Retrieves the text of the current number or string token.
+ *
+ * \param[in] reader The JSON reader instance.
+ * \param[out] size Receives the length of the text.
+ *
+ * \return A pointer to the text, or NULL if the current token is neither a number nor a string.
+ */
+static const char*
+get_scalar_text(const cardano_json_reader_t* reader, size_t* size)
+{
+  if (reader->token == CARDANO_JSON_TOKEN_TYPE_NUMBER)
+  {
+    *size = reader->number_size;
+
+    return &reader->ctx.input[reader->number_offset];
+  }
+
+  if (reader->token == CARDANO_JSON_TOKEN_TYPE_STRING)
+  {
+    *size = cardano_buffer_get_size(reader->scratch) - 1U;
+
+    return (const char*)((const void*)cardano_buffer_get_data(reader->scratch));
+  }
+
+  return NULL;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_json_reader_t*
+cardano_json_reader_new(const char* json, const size_t size)
+{
+  if (json == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_json_reader_t* reader = (cardano_json_reader_t*)_cardano_malloc(sizeof(cardano_json_reader_t));
+
+  if (reader == NULL)
+  {
+    return NULL;
+  }
+
+  reader->scratch = cardano_buffer_new(128U);
+
+  if (reader->scratch == NULL)
+  {
+    _cardano_free(reader);
+    return NULL;
+  }
+
+  reader->base.ref_count     = 1U;
+  reader->base.deallocator   = cardano_json_reader_deallocate;
+  reader->base.last_error[0] = '\0';
+  reader->error              = CARDANO_SUCCESS;
+  reader->token              = CARDANO_JSON_TOKEN_TYPE_NONE;
+  reader->number_offset      = 0U;
+  reader->number_size        = 0U;
+  reader->bool_value         = false;
+  reader->depth              = 0U;
+
+  CARDANO_UNUSED(memset(&reader->ctx, 0, sizeof(reader->ctx)));
+
+  reader->ctx.input  = json;
+  reader->ctx.length = size;
+
+  reader->frames[0] = (cardano_json_reader_frame_t) {
+    .context      = CARDANO_JSON_CONTEXT_ROOT,
+    .item_count   = 0U,
+    .expect_value = false
+  };
+
+  return reader;
+}
+
+cardano_error_t
+cardano_json_reader_read(cardano_json_reader_t* reader, cardano_json_token_type_t* token)
+{
+  if ((reader == NULL) || (token == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader->error != CARDANO_SUCCESS)
+  {
+    *token = CARDANO_JSON_TOKEN_TYPE_NONE;
+    return reader->error;
+  }
+
+  cardano_skip_whitespace(&reader->ctx);
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  switch (reader->frames[reader->depth].context)
+  {
+    case CARDANO_JSON_CONTEXT_OBJECT:
+      result = read_in_object(reader);
+      break;
+    case CARDANO_JSON_CONTEXT_ARRAY:
+      result = read_in_array(reader);
+      break;
+    default:
+      if (reader->frames[0].item_count == 0U)
+      {
+        result = read_value(reader);
+      }
+      else if (reader->ctx.offset < reader->ctx.length)
+      {
+        result = fail(reader, CARDANO_ERROR_INVALID_JSON, "Unexpected data after the root value");
+      }
+      else
+      {
+        reader->token = CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT;
+      }
+      break;
+  }
+
+  *token = reader->token;
+
+  return result;
+}
+
+cardano_error_t
+cardano_json_reader_skip(cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_json_token_type_t token  = reader->token;
+  cardano_error_t           result = CARDANO_SUCCESS;
+
+  if (token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME)
+  {
+    result = cardano_json_reader_read(reader, &token);
+  }
+
+  if ((result != CARDANO_SUCCESS) || ((token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT) && (token != CARDANO_JSON_TOKEN_TYPE_START_ARRAY)))
+  {
+    return result;
+  }
+
+  const size_t target_depth = reader->depth - 1U;
+
+  while ((result == CARDANO_SUCCESS) && (reader->depth > target_depth))
+  {
+    result = cardano_json_reader_read(reader, &token);
+  }
+
+  return result;
+}
+
+cardano_json_token_type_t
+cardano_json_reader_get_token_type(const cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return CARDANO_JSON_TOKEN_TYPE_NONE;
+  }
+
+  return reader->token;
+}
+
+size_t
+cardano_json_reader_get_depth(const cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return 0U;
+  }
+
+  const bool opened = (reader->token == CARDANO_JSON_TOKEN_TYPE_START_OBJECT) || (reader->token == CARDANO_JSON_TOKEN_TYPE_START_ARRAY);
+
+  return opened ? (reader->depth - 1U) : reader->depth;
+}
+
+size_t
+cardano_json_reader_get_offset(const cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return 0U;
+  }
+
+  return reader->ctx.offset;
+}
+
+const char*
+cardano_json_reader_get_string(const cardano_json_reader_t* reader, size_t* size)
+{
+  if ((reader == NULL) || ((reader->token != CARDANO_JSON_TOKEN_TYPE_STRING) && (reader->token != CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME)))
+  {
+    return NULL;
+  }
+
+  if (size != NULL)
+  {
+    *size = cardano_buffer_get_size(reader->scratch) - 1U;
+  }
+
+  return (const char*)((const void*)cardano_buffer_get_data(reader->scratch));
+}
+
+cardano_error_t
+cardano_json_reader_get_uint(const cardano_json_reader_t* reader, uint64_t* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  size_t      size = 0U;
+  const char* text = get_scalar_text(reader, &size);
+
+  if (text == NULL)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  if ((size == 0U) || (text[0] == '-'))
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_safe_string_to_uint64(text, size, value);
+}
+
+cardano_error_t
+cardano_json_reader_get_signed_int(const cardano_json_reader_t* reader, int64_t* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  size_t      size = 0U;
+  const char* text = get_scalar_text(reader, &size);
+
+  if (text == NULL)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  if (size == 0U)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_safe_string_to_int64(text, size, value);
+}
+
+cardano_error_t
+cardano_json_reader_get_double(const cardano_json_reader_t* reader, double* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader->token != CARDANO_JSON_TOKEN_TYPE_NUMBER)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  char         temp[65] = { 0 };
+  const size_t size     = (reader->number_size > 64U) ? 64U : reader->number_size;
+
+  cardano_safe_memcpy(temp, sizeof(temp), &reader->ctx.input[reader->number_offset], size);
+
+  errno = 0;
+
+  const double result = strtod(temp, NULL);
+
+  // cppcheck-suppress misra-c2012-22.10; Reason: False positive, strtod sets errno.
+  if (errno != 0)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  *value = result;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_json_reader_get_boolean(const cardano_json_reader_t* reader, bool* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader->token != CARDANO_JSON_TOKEN_TYPE_BOOLEAN)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  *value = reader->bool_value;
+
+  return CARDANO_SUCCESS;
+}
+
+bool
+cardano_json_reader_get_is_real_number(const cardano_json_reader_t* reader)
+{
+  if ((reader == NULL) || (reader->token != CARDANO_JSON_TOKEN_TYPE_NUMBER))
+  {
+    return false;
+  }
+
+  const char* start = &reader->ctx.input[reader->number_offset];
+  const char* end   = &start[reader->number_size];
+
+  return cardano_has_char('.', start, end) || cardano_has_char('e', start, end) || cardano_has_char('E', start, end);
+}
+
+void
+cardano_json_reader_unref(cardano_json_reader_t** json_reader)
+{
+  if ((json_reader == NULL) || (*json_reader == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*json_reader)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *json_reader = NULL;
+    return;
+  }
+}
+
+void
+cardano_json_reader_ref(cardano_json_reader_t* json_reader)
+{
+  if (json_reader == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&json_reader->base);
+}
+
+size_t
+cardano_json_reader_refcount(const cardano_json_reader_t* json_reader)
+{
+  if (json_reader == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&json_reader->base);
+}
+
+void
+cardano_json_reader_set_last_error(cardano_json_reader_t* reader, const char* message)
+{
+  cardano_object_set_last_error(&reader->base, message);
+}
+
+const char*
+cardano_json_reader_get_last_error(const cardano_json_reader_t* reader)
+{
+  return cardano_object_get_last_error(&reader->base);
+}
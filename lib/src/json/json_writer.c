@@ -130,6 +130,86 @@ pop_context(cardano_json_writer_t* writer)
   --writer->depth;
 }
 
+/**
+ * \brief Hands the pending output of a sink-backed writer to its sink.
+ *
+ * \param[in,out] writer The JSON writer instance. Must have a sink.
+ * \return CARDANO_SUCCESS on success, or the error returned by the sink.
+ */
+static cardano_error_t
+flush_to_sink(cardano_json_writer_t* writer)
+{
+  assert(writer->sink != NULL);
+
+  const size_t pending = cardano_buffer_get_size(writer->buffer);
+
+  if (pending == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = writer->sink(writer->sink_context, cardano_buffer_get_data(writer->buffer), pending);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  writer->flushed_size += pending;
+
+  return cardano_buffer_set_size(writer->buffer, 0U);
+}
+
+/**
+ * \brief Appends bytes to the writer's output.
+ *
+ * Writers without a sink accumulate the whole document in their buffer. Writers with a sink
+ * hand the buffer to the sink whenever it reaches the flush threshold, and pass writes that
+ * are larger than the threshold straight through, so the buffer never grows past the threshold.
+ *
+ * \param[in,out] writer The JSON writer instance.
+ * \param[in] data The bytes to write.
+ * \param[in] size The number of bytes to write.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+write_bytes(cardano_json_writer_t* writer, const byte_t* data, const size_t size)
+{
+  if (writer->sink == NULL)
+  {
+    return cardano_buffer_write(writer->buffer, data, size);
+  }
+
+  if (size >= writer->flush_threshold)
+  {
+    cardano_error_t result = flush_to_sink(writer);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    result = writer->sink(writer->sink_context, data, size);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      writer->flushed_size += size;
+    }
+
+    return result;
+  }
+
+  cardano_error_t result = cardano_buffer_write(writer->buffer, data, size);
+
+  if ((result == CARDANO_SUCCESS) && (cardano_buffer_get_size(writer->buffer) >= writer->flush_threshold))
+  {
+    result = flush_to_sink(writer);
+  }
+
+  return result;
+}
+
 /**
  * \brief Writes indentation based on the current depth.
  *
@@ -151,7 +231,7 @@ write_indentation(cardano_json_writer_t* writer)
 
   CARDANO_UNUSED(memset((void*)buffer, ' ', indent_size));
 
-  return cardano_buffer_write(writer->buffer, (byte_t*)buffer, indent_size);
+  return write_bytes(writer, (byte_t*)buffer, indent_size);
 }
 
 /**
@@ -207,6 +287,10 @@ cardano_json_writer_new(const cardano_json_format_t format)
   obj->last_error         = CARDANO_SUCCESS;
   obj->depth              = 0;
   obj->format             = format;
+  obj->sink               = NULL;
+  obj->sink_context       = NULL;
+  obj->flush_threshold    = 0U;
+  obj->flushed_size       = 0U;
   obj->current_frame[0]   = (cardano_json_stack_frame_t) {
       .context      = CARDANO_JSON_CONTEXT_ROOT,
       .item_count   = 0,
@@ -222,6 +306,42 @@ cardano_json_writer_new(const cardano_json_format_t format)
   return obj;
 }
 
+cardano_json_writer_t*
+cardano_json_writer_new_with_sink(
+  const cardano_json_format_t     format,
+  cardano_json_writer_sink_func_t sink,
+  void*                           context,
+  const size_t                    flush_threshold)
+{
+  if ((sink == NULL) || (flush_threshold == 0U))
+  {
+    return NULL;
+  }
+
+  cardano_json_writer_t* obj = cardano_json_writer_new(format);
+
+  if (obj == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_buffer_unref(&obj->buffer);
+
+  obj->buffer = cardano_buffer_new(flush_threshold);
+
+  if (obj->buffer == NULL)
+  {
+    _cardano_free(obj);
+    return NULL;
+  }
+
+  obj->sink            = sink;
+  obj->sink_context    = context;
+  obj->flush_threshold = flush_threshold;
+
+  return obj;
+}
+
 void
 cardano_json_writer_write_property_name(
   cardano_json_writer_t* writer,
@@ -251,20 +371,20 @@ cardano_json_writer_write_property_name(
 
   if (writer->current_frame[writer->depth].item_count > 0U)
   {
-    result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before property name.");
   }
 
   if (writer->format == CARDANO_JSON_FORMAT_PRETTY)
   {
-    result = cardano_buffer_write(writer->buffer, &NEW_LINE[0], 1);
+    result = write_bytes(writer, &NEW_LINE[0], 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before property name.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before property name.");
   }
 
-  result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  result = write_bytes(writer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes before property name.");
 
   for (size_t i = 0; i < name_size; ++i)
@@ -273,28 +393,28 @@ cardano_json_writer_write_property_name(
 
     if (esc != 0)
     {
-      result = cardano_buffer_write(writer->buffer, ESCAPE, 1);
+      result = write_bytes(writer, ESCAPE, 1);
       cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character before string value.");
 
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&esc, 1);
+      result = write_bytes(writer, (const byte_t*)&esc, 1);
       cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character value.");
     }
     else
     {
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&name[i], 1);
+      result = write_bytes(writer, (const byte_t*)&name[i], 1);
       cardano_json_writer_set_message_if_error(writer, result, "Failed to write string value.");
     }
   }
 
-  result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  result = write_bytes(writer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after property name.");
 
-  result = cardano_buffer_write(writer->buffer, COLON, 1);
+  result = write_bytes(writer, COLON, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write colon after property name.");
 
   if (writer->format == CARDANO_JSON_FORMAT_PRETTY)
   {
-    result = cardano_buffer_write(writer->buffer, &SPACE[0], 1);
+    result = write_bytes(writer, &SPACE[0], 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write space after colon.");
   }
 
@@ -327,20 +447,20 @@ cardano_json_writer_write_bool(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before boolean value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before boolean value.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before boolean value.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, value ? TRUE : FALSE, value ? 4 : 5);
+  cardano_error_t result = write_bytes(writer, value ? TRUE : FALSE, value ? 4 : 5);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write boolean value.");
 
   current_context->item_count++;
@@ -370,20 +490,20 @@ cardano_json_writer_write_null(cardano_json_writer_t* writer)
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before null value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before null value.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before null value.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, NULL_VALUE, 4);
+  cardano_error_t result = write_bytes(writer, NULL_VALUE, 4);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write null value.");
 
   current_context->item_count++;
@@ -422,13 +542,13 @@ cardano_json_writer_write_bigint(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before bigint value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before bigint value.");
 
     result = write_indentation(writer);
@@ -453,15 +573,15 @@ cardano_json_writer_write_bigint(
     return;
   }
 
-  result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  result = write_bytes(writer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes before bigint value.");
 
-  result = cardano_buffer_write(writer->buffer, data, size - 1U);
+  result = write_bytes(writer, data, size - 1U);
   _cardano_free(data);
 
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write bigint value.");
 
-  result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  result = write_bytes(writer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after bigint value.");
 
   current_context->item_count++;
@@ -492,20 +612,20 @@ cardano_json_writer_write_start_array(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before starting array.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before starting array.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before starting array.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, OPEN_ARRAY, 1);
+  cardano_error_t result = write_bytes(writer, OPEN_ARRAY, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write opening array.");
 
   push_context(writer, CARDANO_JSON_CONTEXT_ARRAY);
@@ -531,14 +651,14 @@ cardano_json_writer_write_end_array(cardano_json_writer_t* writer)
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (item_count > 0U))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before closing array.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before closing array.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, CLOSE_ARRAY, 1);
+  cardano_error_t result = write_bytes(writer, CLOSE_ARRAY, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write closing array.");
 
   writer->current_frame[writer->depth].item_count++;
@@ -563,20 +683,20 @@ cardano_json_writer_write_start_object(cardano_json_writer_t* writer)
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before starting object.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before starting object.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before starting object.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, OPEN_OBJECT, 1);
+  cardano_error_t result = write_bytes(writer, OPEN_OBJECT, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write opening object.");
 
   push_context(writer, CARDANO_JSON_CONTEXT_OBJECT);
@@ -602,14 +722,14 @@ cardano_json_writer_write_end_object(cardano_json_writer_t* writer)
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (item_count > 0U))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before closing object.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before closing object.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, CLOSE_OBJECT, 1);
+  cardano_error_t result = write_bytes(writer, CLOSE_OBJECT, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write closing object.");
 
   writer->current_frame[writer->depth].item_count++;
@@ -655,20 +775,20 @@ cardano_json_writer_write_raw_value(
 
   if (current_context->item_count > 0U)
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before raw value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before raw value.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before raw value.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, (const byte_t*)data, size);
+  cardano_error_t result = write_bytes(writer, (const byte_t*)data, size);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write raw value.");
 
   current_context->item_count++;
@@ -707,13 +827,13 @@ cardano_json_writer_write_object(
 
   if (current_context->item_count > 0U)
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before object value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before object value.");
 
     result = write_indentation(writer);
@@ -752,13 +872,13 @@ cardano_json_writer_write_uint(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before unsigned integer value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before unsigned integer value.");
 
     result = write_indentation(writer);
@@ -774,7 +894,7 @@ cardano_json_writer_write_uint(
     return;
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, (const byte_t*)buffer, buffer_size);
+  cardano_error_t result = write_bytes(writer, (const byte_t*)buffer, buffer_size);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write unsigned integer value.");
 
   current_context->item_count++;
@@ -817,13 +937,13 @@ cardano_json_writer_write_signed_int(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     CARDANO_UNUSED(result);
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before signed integer value.");
 
     result = write_indentation(writer);
@@ -839,7 +959,7 @@ cardano_json_writer_write_signed_int(
     return;
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, (const byte_t*)buffer, buffer_size);
+  cardano_error_t result = write_bytes(writer, (const byte_t*)buffer, buffer_size);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write signed integer value.");
 
   current_context->item_count++;
@@ -881,13 +1001,13 @@ cardano_json_writer_write_double(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before double value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before double value.");
 
     result = write_indentation(writer);
@@ -903,7 +1023,7 @@ cardano_json_writer_write_double(
     return;
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, (const byte_t*)buffer, buffer_size);
+  cardano_error_t result = write_bytes(writer, (const byte_t*)buffer, buffer_size);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write double value.");
 
   current_context->item_count++;
@@ -1088,20 +1208,20 @@ cardano_json_writer_write_string(
 
   if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_error_t result = write_bytes(writer, COMMA, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before string value.");
   }
 
   if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
   {
-    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_error_t result = write_bytes(writer, NEW_LINE, 1);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before string value.");
 
     result = write_indentation(writer);
     cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before string value.");
   }
 
-  cardano_error_t result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  cardano_error_t result = write_bytes(writer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes before string value.");
 
   for (size_t i = 0; i < value_size; ++i)
@@ -1110,20 +1230,20 @@ cardano_json_writer_write_string(
 
     if (esc != 0)
     {
-      result = cardano_buffer_write(writer->buffer, ESCAPE, 1);
+      result = write_bytes(writer, ESCAPE, 1);
       cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character before string value.");
 
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&esc, 1);
+      result = write_bytes(writer, (const byte_t*)&esc, 1);
       cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character value.");
     }
     else
     {
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&value[i], 1);
+      result = write_bytes(writer, (const byte_t*)&value[i], 1);
       cardano_json_writer_set_message_if_error(writer, result, "Failed to write string value.");
     }
   }
 
-  result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  result = write_bytes(writer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after string value.");
 
   current_context->item_count++;
@@ -1154,7 +1274,7 @@ cardano_json_writer_get_encoded_size(cardano_json_writer_t* writer)
     return 0U;
   }
 
-  return cardano_buffer_get_size(writer->buffer) + 1U;
+  return writer->flushed_size + cardano_buffer_get_size(writer->buffer) + 1U;
 }
 
 cardano_error_t
@@ -1174,6 +1294,12 @@ cardano_json_writer_encode(cardano_json_writer_t* writer, char* data, const size
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (writer->sink != NULL)
+  {
+    cardano_json_writer_set_last_error(writer, "JSON writer output is streamed to a sink.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
   if ((writer->current_frame[writer->depth].context != CARDANO_JSON_CONTEXT_ROOT) || (writer->current_frame[writer->depth].expect_value))
   {
     cardano_json_writer_set_last_error(writer, "JSON document is incomplete.");
@@ -1211,6 +1337,12 @@ cardano_json_writer_encode_in_buffer(cardano_json_writer_t* writer, cardano_buff
     return writer->last_error;
   }
 
+  if (writer->sink != NULL)
+  {
+    cardano_json_writer_set_last_error(writer, "JSON writer output is streamed to a sink.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
   const size_t buffer_size = cardano_buffer_get_size(writer->buffer);
 
   if (buffer_size == 0U)
@@ -1236,6 +1368,30 @@ cardano_json_writer_encode_in_buffer(cardano_json_writer_t* writer, cardano_buff
   return result;
 }
 
+cardano_error_t
+cardano_json_writer_flush(cardano_json_writer_t* writer)
+{
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (writer->last_error != CARDANO_SUCCESS)
+  {
+    return writer->last_error;
+  }
+
+  if (writer->sink == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = flush_to_sink(writer);
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to flush JSON output to the sink.");
+
+  return result;
+}
+
 cardano_error_t
 cardano_json_writer_reset(cardano_json_writer_t* writer)
 {
@@ -1246,7 +1402,8 @@ cardano_json_writer_reset(cardano_json_writer_t* writer)
 
   cardano_buffer_unref(&writer->buffer);
 
-  writer->buffer                        = cardano_buffer_new(128);
+  writer->buffer                        = cardano_buffer_new((writer->sink != NULL) ? writer->flush_threshold : 128U);
+  writer->flushed_size                  = 0U;
   writer->depth                         = 0U;
   writer->last_error                    = CARDANO_SUCCESS;
   writer->current_frame[0].context      = CARDANO_JSON_CONTEXT_ROOT;
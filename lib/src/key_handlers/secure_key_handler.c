@@ -144,6 +144,60 @@ cardano_secure_key_handler_bip32_sign_transaction(
   return result;
 }
 
+cardano_error_t
+cardano_secure_key_handler_bip32_sign_transactions(
+  cardano_secure_key_handler_t*          secure_key_handler,
+  const cardano_bip32_signing_request_t* requests,
+  const size_t                           num_requests,
+  cardano_vkey_witness_set_t**           vkey_witness_sets)
+{
+  if ((secure_key_handler == NULL) || (requests == NULL) || (vkey_witness_sets == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < num_requests; ++i)
+  {
+    vkey_witness_sets[i] = NULL;
+
+    if ((requests[i].tx == NULL) || (requests[i].derivation_paths == NULL))
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+  }
+
+  cardano_secure_key_handler_impl_t* impl   = &secure_key_handler->impl;
+  cardano_error_t                    result = CARDANO_SUCCESS;
+
+  if (impl->bip32_sign_transactions != NULL)
+  {
+    result = impl->bip32_sign_transactions(impl, requests, num_requests, vkey_witness_sets);
+  }
+  else if (impl->bip32_sign_transaction != NULL)
+  {
+    for (size_t i = 0U; (i < num_requests) && (result == CARDANO_SUCCESS); ++i)
+    {
+      result = impl->bip32_sign_transaction(impl, requests[i].tx, requests[i].derivation_paths, requests[i].num_paths, &vkey_witness_sets[i]);
+    }
+  }
+  else
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    for (size_t i = 0U; i < num_requests; ++i)
+    {
+      cardano_vkey_witness_set_unref(&vkey_witness_sets[i]);
+    }
+
+    cardano_secure_key_handler_set_last_error(secure_key_handler, impl->error_message);
+  }
+
+  return result;
+}
+
 cardano_error_t
 cardano_secure_key_handler_bip32_get_extended_account_public_key(
   cardano_secure_key_handler_t*           secure_key_handler,
@@ -63,6 +63,18 @@ typedef struct software_secure_key_handler_context_t
     cardano_get_passphrase_func_t get_passphrase;
 } software_secure_key_handler_context_t;
 
+/**
+ * \brief A signing key derived while signing a batch of transactions.
+ *
+ * Each distinct derivation path of a batch is derived once and its key reused for every transaction that needs it.
+ */
+typedef struct software_secure_key_handler_derived_key_t
+{
+    cardano_derivation_path_t      path;
+    cardano_ed25519_private_key_t* private_key;
+    cardano_ed25519_public_key_t*  public_key;
+} software_secure_key_handler_derived_key_t;
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -342,50 +354,18 @@ bip32_get_extended_account_public_key(
 }
 
 /**
- * \brief Signs a transaction using BIP32 Hierarchical Deterministic (HD) keys.
- *
- * The `bip32_sign_transaction` function is responsible for signing a transaction by deriving the appropriate
- * BIP32 private keys using the provided derivation paths. It generates a verification key witness set that contains
- * the necessary signatures for the transaction.
- *
- * This function uses the secure key handler to access and manage the cryptographic operations necessary for deriving
- * private keys and signing the transaction.
+ * \brief Decrypts the key material of the handler and restores the BIP32 root private key.
  *
- * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation that securely manages cryptographic operations.
- * \param[in]  tx The transaction object to be signed.
- * \param[in]  derivation_paths An array of derivation paths specifying the private keys used to sign the transaction.
- * \param[in]  num_paths The number of derivation paths provided in the `derivation_paths` array.
- * \param[out] vkey_witness_set A pointer to the verification key witness set, which will be populated with the
- *                              signatures generated during the signing process. The caller is responsible for managing
- *                              the lifecycle of the witness set by calling `cardano_vkey_witness_set_unref` when it is no longer needed.
+ * \param[in]  context The software secure key handler context.
+ * \param[out] root_private_key On success, receives the root private key. The caller must release it.
  *
- * \returns `cardano_error_t` indicating success or the type of error encountered during the signing process.
- *
- * \note The function assumes that the necessary private keys are securely stored and managed by the key handler.
- *       The caller is responsible for ensuring that the `vkey_witness_set` is unreferenced properly to prevent memory leaks.
- *
- * \see cardano_vkey_witness_set_unref for proper memory cleanup of the witness set.
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
  */
 static cardano_error_t
-bip32_sign_transaction(
-  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
-  cardano_transaction_t*             tx,
-  const cardano_derivation_path_t*   derivation_paths,
-  const size_t                       num_paths,
-  cardano_vkey_witness_set_t**       vkey_witness_set)
+get_root_private_key(
+  const software_secure_key_handler_context_t* context,
+  cardano_bip32_private_key_t**                root_private_key)
 {
-  if ((secure_key_handler_impl == NULL) || (tx == NULL) || (derivation_paths == NULL) || (vkey_witness_set == NULL))
-  {
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
-  software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
-
-  if (context == NULL)
-  {
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
   cardano_buffer_t* decrypted_data = NULL;
 
   byte_t passphrase[128] = { 0 };
@@ -416,137 +396,290 @@ bip32_sign_transaction(
     return result;
   }
 
-  cardano_bip32_private_key_t* root_private_key = NULL;
-
-  result = cardano_bip32_private_key_from_bip39_entropy(NULL, 0, cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &root_private_key);
+  result = cardano_bip32_private_key_from_bip39_entropy(NULL, 0, cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), root_private_key);
 
   cardano_buffer_memzero(decrypted_data);
   cardano_buffer_unref(&decrypted_data);
 
+  return result;
+}
+
+/**
+ * \brief Finds the signing key of a derivation path, deriving it on first use.
+ *
+ * \param[in]     root_private_key The BIP32 root private key.
+ * \param[in]     derivation_path The derivation path of the key.
+ * \param[in,out] keys The keys derived so far. Must have room for one more key.
+ * \param[in,out] key_count The number of keys derived so far.
+ * \param[out]    key Receives the key, owned by \p keys.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during derivation.
+ */
+static cardano_error_t
+get_signing_key(
+  cardano_bip32_private_key_t*                root_private_key,
+  const cardano_derivation_path_t*            derivation_path,
+  software_secure_key_handler_derived_key_t*  keys,
+  size_t*                                     key_count,
+  software_secure_key_handler_derived_key_t** key)
+{
+  for (size_t i = 0U; i < *key_count; ++i)
+  {
+    const cardano_derivation_path_t* cached = &keys[i].path;
+
+    if ((cached->purpose == derivation_path->purpose) && (cached->coin_type == derivation_path->coin_type) && (cached->account == derivation_path->account) && (cached->role == derivation_path->role) && (cached->index == derivation_path->index))
+    {
+      *key = &keys[i];
+
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  cardano_bip32_private_key_t*               bip32_private_key = NULL;
+  software_secure_key_handler_derived_key_t* derived           = &keys[*key_count];
+
+  const uint32_t path[5] = {
+    cardano_bip32_harden((uint32_t)derivation_path->purpose),
+    cardano_bip32_harden((uint32_t)derivation_path->coin_type),
+    cardano_bip32_harden((uint32_t)derivation_path->account),
+    (uint32_t)derivation_path->role,
+    (uint32_t)derivation_path->index
+  };
+
+  derived->path        = *derivation_path;
+  derived->private_key = NULL;
+  derived->public_key  = NULL;
+
+  cardano_error_t result = cardano_bip32_private_key_derive(root_private_key, &path[0], 5, &bip32_private_key);
+
   if (result != CARDANO_SUCCESS)
   {
     return result;
   }
 
-  cardano_blake2b_hash_t* hash = cardano_transaction_get_id(tx);
+  result = cardano_bip32_private_key_to_ed25519_key(bip32_private_key, &derived->private_key);
 
-  if (hash == NULL)
-  {
-    cardano_bip32_private_key_unref(&root_private_key);
+  cardano_bip32_private_key_unref(&bip32_private_key);
 
-    return CARDANO_ERROR_POINTER_IS_NULL;
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_ed25519_private_key_get_public_key(derived->private_key, &derived->public_key);
   }
 
-  result = cardano_vkey_witness_set_new(vkey_witness_set);
-
   if (result != CARDANO_SUCCESS)
   {
-    cardano_blake2b_hash_unref(&hash);
-    cardano_bip32_private_key_unref(&root_private_key);
+    cardano_ed25519_private_key_unref(&derived->private_key);
 
     return result;
   }
 
-  for (size_t i = 0U; i < num_paths; ++i)
+  ++(*key_count);
+  *key = derived;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Signs one transaction of a batch with previously derived keys.
+ *
+ * \param[in]     root_private_key The BIP32 root private key.
+ * \param[in]     request The transaction and the derivation paths of the keys that must sign it.
+ * \param[in,out] keys The keys derived so far in the batch.
+ * \param[in,out] key_count The number of keys derived so far in the batch.
+ * \param[out]    vkey_witness_set Receives the witness set of the transaction.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during signing.
+ */
+static cardano_error_t
+sign_request(
+  cardano_bip32_private_key_t*               root_private_key,
+  const cardano_bip32_signing_request_t*     request,
+  software_secure_key_handler_derived_key_t* keys,
+  size_t*                                    key_count,
+  cardano_vkey_witness_set_t**               vkey_witness_set)
+{
+  cardano_blake2b_hash_t* hash = cardano_transaction_get_id(request->tx);
+
+  if (hash == NULL)
   {
-    cardano_ed25519_private_key_t* ed25519_private_key = NULL;
-    cardano_bip32_private_key_t*   bip32_private_key   = NULL;
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_vkey_witness_set_new(vkey_witness_set);
 
-    const uint32_t path[5] = {
-      cardano_bip32_harden((uint32_t)derivation_paths[i].purpose),
-      cardano_bip32_harden((uint32_t)derivation_paths[i].coin_type),
-      cardano_bip32_harden((uint32_t)derivation_paths[i].account),
-      (uint32_t)derivation_paths[i].role,
-      (uint32_t)derivation_paths[i].index
-    };
+  for (size_t i = 0U; (i < request->num_paths) && (result == CARDANO_SUCCESS); ++i)
+  {
+    software_secure_key_handler_derived_key_t* key       = NULL;
+    cardano_ed25519_signature_t*               signature = NULL;
+    cardano_vkey_witness_t*                    witness   = NULL;
 
-    result = cardano_bip32_private_key_derive(root_private_key, &path[0], 5, &bip32_private_key);
+    result = get_signing_key(root_private_key, &request->derivation_paths[i], keys, key_count, &key);
 
-    if (result != CARDANO_SUCCESS)
+    if (result == CARDANO_SUCCESS)
     {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+      result = cardano_ed25519_private_key_sign(key->private_key, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
+    }
 
-      return result;
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_vkey_witness_new(key->public_key, signature, &witness);
     }
 
-    result = cardano_bip32_private_key_to_ed25519_key(bip32_private_key, &ed25519_private_key);
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_vkey_witness_set_add(*vkey_witness_set, witness);
+    }
 
-    cardano_bip32_private_key_unref(&bip32_private_key);
+    cardano_ed25519_signature_unref(&signature);
+    cardano_vkey_witness_unref(&witness);
+  }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+  cardano_blake2b_hash_unref(&hash);
 
-      return result;
-    }
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_vkey_witness_set_unref(vkey_witness_set);
+  }
 
-    cardano_ed25519_signature_t*  signature  = NULL;
-    cardano_ed25519_public_key_t* public_key = NULL;
-    cardano_vkey_witness_t*       witness    = NULL;
+  return result;
+}
 
-    result = cardano_ed25519_private_key_sign(ed25519_private_key, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
+/**
+ * \brief Signs a batch of transactions using BIP32 Hierarchical Deterministic (HD) keys.
+ *
+ * The passphrase is requested and the key material decrypted once for the whole batch, and each distinct derivation
+ * path is derived once, however many transactions it signs. The derived keys are wiped when the batch completes.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation that securely manages cryptographic operations.
+ * \param[in]  requests The transactions to sign, each with the derivation paths of the keys that must sign it.
+ * \param[in]  num_requests The number of requests in the `requests` array.
+ * \param[out] vkey_witness_sets An array of `num_requests` pointers that receives the witness set of each request.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during the signing process.
+ */
+static cardano_error_t
+bip32_sign_transactions(
+  cardano_secure_key_handler_impl_t*     secure_key_handler_impl,
+  const cardano_bip32_signing_request_t* requests,
+  const size_t                           num_requests,
+  cardano_vkey_witness_set_t**           vkey_witness_sets)
+{
+  if ((secure_key_handler_impl == NULL) || (requests == NULL) || (vkey_witness_sets == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_ed25519_private_key_unref(&ed25519_private_key);
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+  software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
 
-      return result;
-    }
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-    result = cardano_ed25519_private_key_get_public_key(ed25519_private_key, &public_key);
+  size_t total_paths = 0U;
 
-    cardano_ed25519_private_key_unref(&ed25519_private_key);
+  for (size_t i = 0U; i < num_requests; ++i)
+  {
+    vkey_witness_sets[i] = NULL;
 
-    if (result != CARDANO_SUCCESS)
+    if ((requests[i].tx == NULL) || (requests[i].derivation_paths == NULL))
     {
-      cardano_ed25519_signature_unref(&signature);
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
-
-      return result;
+      return CARDANO_ERROR_POINTER_IS_NULL;
     }
 
-    result = cardano_vkey_witness_new(public_key, signature, &witness);
+    total_paths += requests[i].num_paths;
+  }
 
-    cardano_ed25519_public_key_unref(&public_key);
-    cardano_ed25519_signature_unref(&signature);
+  cardano_bip32_private_key_t* root_private_key = NULL;
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_unref(&witness);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+  cardano_error_t result = get_root_private_key(context, &root_private_key);
 
-      return result;
-    }
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  software_secure_key_handler_derived_key_t* keys      = NULL;
+  size_t                                     key_count = 0U;
 
-    result = cardano_vkey_witness_set_add(*vkey_witness_set, witness);
+  if (total_paths > 0U)
+  {
+    keys = (software_secure_key_handler_derived_key_t*)_cardano_malloc(total_paths * sizeof(software_secure_key_handler_derived_key_t));
 
-    if (result != CARDANO_SUCCESS)
+    if (keys == NULL)
     {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
       cardano_bip32_private_key_unref(&root_private_key);
 
-      return result;
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
     }
+  }
 
-    cardano_vkey_witness_unref(&witness);
+  for (size_t i = 0U; (i < num_requests) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = sign_request(root_private_key, &requests[i], keys, &key_count, &vkey_witness_sets[i]);
   }
 
-  cardano_blake2b_hash_unref(&hash);
+  for (size_t i = 0U; i < key_count; ++i)
+  {
+    cardano_ed25519_private_key_unref(&keys[i].private_key);
+    cardano_ed25519_public_key_unref(&keys[i].public_key);
+  }
+
+  _cardano_free(keys);
   cardano_bip32_private_key_unref(&root_private_key);
 
-  return CARDANO_SUCCESS;
+  if (result != CARDANO_SUCCESS)
+  {
+    for (size_t i = 0U; i < num_requests; ++i)
+    {
+      cardano_vkey_witness_set_unref(&vkey_witness_sets[i]);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Signs a transaction using BIP32 Hierarchical Deterministic (HD) keys.
+ *
+ * The `bip32_sign_transaction` function is responsible for signing a transaction by deriving the appropriate
+ * BIP32 private keys using the provided derivation paths. It generates a verification key witness set that contains
+ * the necessary signatures for the transaction.
+ *
+ * This function uses the secure key handler to access and manage the cryptographic operations necessary for deriving
+ * private keys and signing the transaction.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation that securely manages cryptographic operations.
+ * \param[in]  tx The transaction object to be signed.
+ * \param[in]  derivation_paths An array of derivation paths specifying the private keys used to sign the transaction.
+ * \param[in]  num_paths The number of derivation paths provided in the `derivation_paths` array.
+ * \param[out] vkey_witness_set A pointer to the verification key witness set, which will be populated with the
+ *                              signatures generated during the signing process. The caller is responsible for managing
+ *                              the lifecycle of the witness set by calling `cardano_vkey_witness_set_unref` when it is no longer needed.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during the signing process.
+ *
+ * \note The function assumes that the necessary private keys are securely stored and managed by the key handler.
+ *       The caller is responsible for ensuring that the `vkey_witness_set` is unreferenced properly to prevent memory leaks.
+ *
+ * \see cardano_vkey_witness_set_unref for proper memory cleanup of the witness set.
+ */
+static cardano_error_t
+bip32_sign_transaction(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_transaction_t*             tx,
+  const cardano_derivation_path_t*   derivation_paths,
+  const size_t                       num_paths,
+  cardano_vkey_witness_set_t**       vkey_witness_set)
+{
+  if ((secure_key_handler_impl == NULL) || (tx == NULL) || (derivation_paths == NULL) || (vkey_witness_set == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const cardano_bip32_signing_request_t request = { tx, derivation_paths, num_paths };
+
+  return bip32_sign_transactions(secure_key_handler_impl, &request, 1U, vkey_witness_set);
 }
 
 /**
@@ -873,6 +1006,7 @@ cardano_software_secure_key_handler_new(
 
   impl.bip32_get_extended_account_public_key = bip32_get_extended_account_public_key;
   impl.bip32_sign_transaction                = bip32_sign_transaction;
+  impl.bip32_sign_transactions               = bip32_sign_transactions;
   impl.ed25519_get_public_key                = NULL;
   impl.ed25519_sign_transaction              = NULL;
   impl.serialize                             = serialize;
@@ -1152,6 +1286,7 @@ cardano_software_secure_key_handler_deserialize(
 
       impl.bip32_get_extended_account_public_key = bip32_get_extended_account_public_key;
       impl.bip32_sign_transaction                = bip32_sign_transaction;
+      impl.bip32_sign_transactions               = bip32_sign_transactions;
       impl.ed25519_get_public_key                = NULL;
       impl.ed25519_sign_transaction              = NULL;
       impl.serialize                             = serialize;
@@ -24,11 +24,22 @@
 #include <cardano/object.h>
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "./config.h"
 #include "./string_safe.h"
 
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+#if !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 201112L) || defined(__STDC_NO_ATOMICS__)
+#error "ATOMIC_REFCOUNT_ENABLED requires a C11 compiler that provides <stdatomic.h>."
+#endif
+
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#endif
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -53,6 +64,93 @@ safe_string_copy(char* dest, const char* src, const size_t max_dest_size)
   dest[copy_size] = '\0';
 }
 
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+
+/*
+ * The public header declares the counter as a plain size_t, so viewing it as an
+ * _Atomic size_t is only sound when both types share size and alignment and the
+ * atomic operations do not fall back to a hidden lock. C11 has no
+ * ATOMIC_SIZE_T_LOCK_FREE, so the check goes through the standard integer type
+ * that size_t matches.
+ */
+_Static_assert(
+  (sizeof(_Atomic size_t) == sizeof(size_t)) && (_Alignof(_Atomic size_t) == _Alignof(size_t)),
+  "ATOMIC_REFCOUNT_ENABLED requires _Atomic size_t to have the layout of size_t.");
+
+#if SIZE_MAX == ULONG_MAX
+#define CARDANO_SIZE_T_LOCK_FREE ATOMIC_LONG_LOCK_FREE
+#elif SIZE_MAX == ULLONG_MAX
+#define CARDANO_SIZE_T_LOCK_FREE ATOMIC_LLONG_LOCK_FREE
+#elif SIZE_MAX == UINT_MAX
+#define CARDANO_SIZE_T_LOCK_FREE ATOMIC_INT_LOCK_FREE
+#else
+#error "ATOMIC_REFCOUNT_ENABLED could not determine the width of size_t."
+#endif
+
+#if CARDANO_SIZE_T_LOCK_FREE != 2
+#error "ATOMIC_REFCOUNT_ENABLED requires lock-free atomic operations on size_t."
+#endif
+
+/**
+ * \brief Views the reference count of an object as an atomic counter.
+ *
+ * The field is declared as a plain `size_t` in the public header so the layout of
+ * \ref cardano_object_t does not depend on the build option; every access made by this
+ * file goes through this view instead. The assertions above guarantee the view is valid.
+ *
+ * \param object The object whose counter is accessed.
+ *
+ * \return The reference count as an atomic object.
+ */
+static _Atomic size_t*
+atomic_ref_count(const cardano_object_t* object)
+{
+  return (_Atomic size_t*)(void*)(size_t*)&object->ref_count;
+}
+
+#endif
+
+/**
+ * \brief Drops one reference from an object.
+ *
+ * The count never goes below zero. In the atomic build the decrement is a compare-and-swap
+ * with release ordering, and the caller that drops the last reference issues an acquire
+ * fence, so every write made through other references happens before the deallocator runs.
+ *
+ * \param object The object to release.
+ *
+ * \return true if no references are left and the object must be deallocated.
+ */
+static bool
+release_reference(cardano_object_t* object)
+{
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+  _Atomic size_t* ref_count = atomic_ref_count(object);
+  size_t          previous  = atomic_load_explicit(ref_count, memory_order_relaxed);
+
+  while ((previous > 0U) && !atomic_compare_exchange_weak_explicit(ref_count, &previous, previous - 1U, memory_order_release, memory_order_relaxed))
+  {
+    // previous was reloaded by the failed exchange, try again.
+  }
+
+  if (previous > 1U)
+  {
+    return false;
+  }
+
+  atomic_thread_fence(memory_order_acquire);
+
+  return true;
+#else
+  if (object->ref_count > 0U)
+  {
+    object->ref_count -= 1U;
+  }
+
+  return object->ref_count == 0U;
+#endif
+}
+
 /* DEFINITIONS ****************************************************************/
 
 void
@@ -65,12 +163,7 @@ cardano_object_unref(cardano_object_t** object)
 
   cardano_object_t* reference = *object;
 
-  if (reference->ref_count > 0U)
-  {
-    reference->ref_count -= 1U;
-  }
-
-  if (reference->ref_count == 0U)
+  if (release_reference(reference))
   {
     assert(reference->deallocator != NULL);
     reference->deallocator(reference);
@@ -86,7 +179,11 @@ cardano_object_ref(cardano_object_t* object)
     return;
   }
 
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+  (void)atomic_fetch_add_explicit(atomic_ref_count(object), 1U, memory_order_relaxed);
+#else
   object->ref_count += 1U;
+#endif
 }
 
 size_t
@@ -97,7 +194,11 @@ cardano_object_refcount(const cardano_object_t* object)
     return 0;
   }
 
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+  return atomic_load_explicit(atomic_ref_count(object), memory_order_relaxed);
+#else
   return object->ref_count;
+#endif
 }
 
 void
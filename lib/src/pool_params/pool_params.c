@@ -501,8 +501,15 @@ cardano_pool_params_to_cip116_json(
 
   assert((params->reward_account != NULL));
 
+  const char* reward_account = cardano_reward_address_get_string(params->reward_account);
+
+  if (reward_account == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   cardano_json_writer_write_property_name(writer, "reward_account", 14);
-  cardano_json_writer_write_string(writer, cardano_reward_address_get_string(params->reward_account), cardano_reward_address_get_bech32_size(params->reward_account) - 1U);
+  cardano_json_writer_write_string(writer, reward_account, cardano_reward_address_get_bech32_size(params->reward_account) - 1U);
 
   assert((params->owners != NULL));
 
@@ -943,13 +943,19 @@ cardano_proposal_procedure_to_cip116_json(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  const char* address = cardano_reward_address_get_string(procedure->reward_address);
+
+  if (address == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   cardano_json_writer_write_start_object(writer);
   cardano_error_t error = CARDANO_SUCCESS;
 
   cardano_json_writer_write_property_name(writer, "deposit", 7);
   cardano_json_writer_write_uint_as_string(writer, procedure->deposit);
 
-  const char*  address           = cardano_reward_address_get_string(procedure->reward_address);
   const size_t addr_len          = cardano_reward_address_get_bech32_size(procedure->reward_address);
   const size_t size_with_no_null = cardano_safe_strlen(address, addr_len);
 
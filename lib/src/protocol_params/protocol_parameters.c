@@ -1408,6 +1408,45 @@ cardano_protocol_parameters_set_ref_script_cost_multiplier(
   return CARDANO_SUCCESS;
 }
 
+cardano_protocol_parameters_t*
+cardano_protocol_parameters_clone(cardano_protocol_parameters_t* protocol_parameters)
+{
+  if (protocol_parameters == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_protocol_parameters_t* clone = _cardano_malloc(sizeof(cardano_protocol_parameters_t));
+
+  if (clone == NULL)
+  {
+    return NULL;
+  }
+
+  CARDANO_UNUSED(memcpy(clone, protocol_parameters, sizeof(cardano_protocol_parameters_t)));
+
+  clone->base.deallocator   = cardano_protocol_parameters_deallocate;
+  clone->base.ref_count     = 1;
+  clone->base.last_error[0] = '\0';
+
+  cardano_unit_interval_ref(clone->pool_pledge_influence);
+  cardano_unit_interval_ref(clone->expansion_rate);
+  cardano_unit_interval_ref(clone->treasury_growth_rate);
+  cardano_unit_interval_ref(clone->d);
+  cardano_buffer_ref(clone->extra_entropy);
+  cardano_protocol_version_ref(clone->protocol_version);
+  cardano_costmdls_ref(clone->cost_models);
+  cardano_ex_unit_prices_ref(clone->execution_costs);
+  cardano_ex_units_ref(clone->max_tx_ex_units);
+  cardano_ex_units_ref(clone->max_block_ex_units);
+  cardano_pool_voting_thresholds_ref(clone->pool_voting_thresholds);
+  cardano_drep_voting_thresholds_ref(clone->drep_voting_thresholds);
+  cardano_unit_interval_ref(clone->ref_script_cost_per_byte);
+  cardano_unit_interval_ref(clone->ref_script_cost_multiplier);
+
+  return clone;
+}
+
 void
 cardano_protocol_parameters_unref(cardano_protocol_parameters_t** protocol_parameters)
 {
@@ -0,0 +1,1254 @@
+/**
+ * \file caching_provider.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/object.h>
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/providers/caching_provider.h>
+#include <cardano/slot_config.h>
+#include <cardano/transaction_body/transaction_body.h>
+
+#include "../allocators.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The largest cache key: a Shelley address. Longer keys (Byron addresses) bypass the cache.
+ */
+#define CACHE_KEY_MAX_SIZE 64U
+
+/**
+ * \brief The size of a transaction input key: the 32-byte transaction id followed by the big-endian output index.
+ */
+#define INPUT_KEY_SIZE 40U
+
+/**
+ * \brief The number of slots in an epoch on mainnet and preprod.
+ */
+static const uint64_t LONG_EPOCH_SLOTS = 432000U;
+
+/**
+ * \brief The number of slots in an epoch on preview.
+ */
+static const uint64_t SHORT_EPOCH_SLOTS = 86400U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief One slot of a cache table.
+ *
+ * A slot is free when it holds no value and has never held one, and a tombstone when it held a
+ * value that was removed; probing continues past tombstones.
+ */
+typedef struct cache_slot_t
+{
+    byte_t            key[CACHE_KEY_MAX_SIZE];
+    size_t            key_size;
+    uint64_t          expires_at;
+    cardano_object_t* value;
+    bool              tombstone;
+} cache_slot_t;
+
+/**
+ * \brief An open-addressed table of reference-counted objects with per-entry expiry.
+ */
+typedef struct cache_t
+{
+    cache_slot_t* slots;
+    size_t        slot_count;
+    size_t        used;
+    size_t        max_entries;
+} cache_t;
+
+/**
+ * \brief State of a caching provider: the backend it forwards to and its caches.
+ */
+typedef struct caching_provider_context_t
+{
+    cardano_object_t                   base;
+    cardano_provider_t*                backend;
+    cardano_caching_provider_options_t options;
+    cardano_protocol_parameters_t*     parameters;
+    uint64_t                           parameters_expires_at;
+    uint64_t                           parameters_epoch;
+    cache_t                            addresses;
+    cache_t                            inputs;
+    cache_t                            datums;
+} caching_provider_context_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads the system wall clock.
+ *
+ * \param[in] context Unused.
+ *
+ * \return The Unix time, in milliseconds.
+ */
+static uint64_t
+wall_clock_now(void* context)
+{
+  CARDANO_UNUSED(context);
+
+  return (uint64_t)time(NULL) * 1000U;
+}
+
+/**
+ * \brief Reads the clock of a caching provider.
+ *
+ * \param[in] context The caching provider state.
+ *
+ * \return The current time, in milliseconds.
+ */
+static uint64_t
+now_ms(const caching_provider_context_t* context)
+{
+  return context->options.clock(context->options.clock_context);
+}
+
+/**
+ * \brief Computes the expiry time of an entry stored now, saturating instead of wrapping.
+ *
+ * \param[in] now The current time, in milliseconds.
+ * \param[in] ttl The time to live, in milliseconds.
+ *
+ * \return The time at which the entry expires.
+ */
+static uint64_t
+expiry(const uint64_t now, const uint64_t ttl)
+{
+  return (ttl > (UINT64_MAX - now)) ? UINT64_MAX : (now + ttl);
+}
+
+/**
+ * \brief Computes the epoch a point in time falls in, for networks with a known epoch schedule.
+ *
+ * Epochs are counted from the first Shelley epoch of the network's slot configuration; only
+ * boundaries matter here, not the absolute epoch number.
+ *
+ * \param[in]  magic The network magic.
+ * \param[in]  now   The Unix time, in milliseconds.
+ * \param[out] epoch The epoch index.
+ *
+ * \return True if the network's epoch schedule is known and \p now falls after its start.
+ */
+static bool
+epoch_at(const cardano_network_magic_t magic, const uint64_t now, uint64_t* epoch)
+{
+  const cardano_slot_config_t* config      = NULL;
+  uint64_t                     epoch_slots = 0U;
+
+  switch (magic)
+  {
+    case CARDANO_NETWORK_MAGIC_MAINNET:
+      config      = &CARDANO_MAINNET_SLOT_CONFIG;
+      epoch_slots = LONG_EPOCH_SLOTS;
+      break;
+    case CARDANO_NETWORK_MAGIC_PREPROD:
+      config      = &CARDANO_PREPROD_SLOT_CONFIG;
+      epoch_slots = LONG_EPOCH_SLOTS;
+      break;
+    case CARDANO_NETWORK_MAGIC_PREVIEW:
+      config      = &CARDANO_PREVIEW_SLOT_CONFIG;
+      epoch_slots = SHORT_EPOCH_SLOTS;
+      break;
+    default:
+      return false;
+  }
+
+  if (now < config->zero_time)
+  {
+    return false;
+  }
+
+  *epoch = (now - config->zero_time) / (epoch_slots * config->slot_length);
+
+  return true;
+}
+
+/**
+ * \brief Computes the FNV-1a hash of a cache key.
+ *
+ * \param[in] key The key bytes.
+ * \param[in] size The number of bytes in the key.
+ *
+ * \return The hash of the key.
+ */
+static uint64_t
+hash_key(const byte_t* key, const size_t size)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)key[i];
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Initializes an empty cache. Its table is allocated on first insertion.
+ *
+ * \param[out] cache       The cache to initialize.
+ * \param[in]  max_entries The maximum number of entries the cache holds.
+ */
+static void
+cache_init(cache_t* cache, const size_t max_entries)
+{
+  cache->slots       = NULL;
+  cache->slot_count  = 0U;
+  cache->used        = 0U;
+  cache->max_entries = max_entries;
+}
+
+/**
+ * \brief Drops every entry of a cache, keeping its table.
+ *
+ * \param[in,out] cache The cache to clear.
+ */
+static void
+cache_clear(cache_t* cache)
+{
+  for (size_t i = 0U; i < cache->slot_count; ++i)
+  {
+    cardano_object_unref(&cache->slots[i].value);
+
+    cache->slots[i].value     = NULL;
+    cache->slots[i].key_size  = 0U;
+    cache->slots[i].tombstone = false;
+  }
+
+  cache->used = 0U;
+}
+
+/**
+ * \brief Drops every entry of a cache and releases its table.
+ *
+ * \param[in,out] cache The cache to free.
+ */
+static void
+cache_free(cache_t* cache)
+{
+  cache_clear(cache);
+
+  _cardano_free(cache->slots);
+
+  cache->slots      = NULL;
+  cache->slot_count = 0U;
+}
+
+/**
+ * \brief Finds the slot holding a key.
+ *
+ * \param[in] cache    The cache to search.
+ * \param[in] key      The key bytes.
+ * \param[in] key_size The number of bytes in the key; at most \ref CACHE_KEY_MAX_SIZE.
+ *
+ * \return The slot holding the key, or NULL if the cache does not hold it.
+ */
+static cache_slot_t*
+cache_find(const cache_t* cache, const byte_t* key, const size_t key_size)
+{
+  if (cache->slot_count == 0U)
+  {
+    return NULL;
+  }
+
+  const size_t mask = cache->slot_count - 1U;
+
+  for (size_t probe = 0U, i = (size_t)hash_key(key, key_size) & mask; probe < cache->slot_count; ++probe, i = (i + 1U) & mask)
+  {
+    cache_slot_t* slot = &cache->slots[i];
+
+    if ((slot->value == NULL) && !slot->tombstone)
+    {
+      return NULL;
+    }
+
+    if ((slot->value != NULL) && (slot->key_size == key_size) && (memcmp(slot->key, key, key_size) == 0))
+    {
+      return slot;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Looks up a live entry.
+ *
+ * \param[in] cache    The cache to search.
+ * \param[in] key      The key bytes.
+ * \param[in] key_size The number of bytes in the key.
+ * \param[in] now      The current time, in milliseconds.
+ *
+ * \return The cached object (not referenced), or NULL if the key is absent, expired or too long.
+ */
+static cardano_object_t*
+cache_get(const cache_t* cache, const byte_t* key, const size_t key_size, const uint64_t now)
+{
+  if (key_size > CACHE_KEY_MAX_SIZE)
+  {
+    return NULL;
+  }
+
+  const cache_slot_t* slot = cache_find(cache, key, key_size);
+
+  if ((slot == NULL) || (now >= slot->expires_at))
+  {
+    return NULL;
+  }
+
+  return slot->value;
+}
+
+/**
+ * \brief Removes an entry, if present.
+ *
+ * \param[in,out] cache    The cache to remove from.
+ * \param[in]     key      The key bytes.
+ * \param[in]     key_size The number of bytes in the key.
+ */
+static void
+cache_remove(cache_t* cache, const byte_t* key, const size_t key_size)
+{
+  if (key_size > CACHE_KEY_MAX_SIZE)
+  {
+    return;
+  }
+
+  cache_slot_t* slot = cache_find(cache, key, key_size);
+
+  if (slot != NULL)
+  {
+    cardano_object_unref(&slot->value);
+
+    slot->value     = NULL;
+    slot->key_size  = 0U;
+    slot->tombstone = true;
+  }
+}
+
+/**
+ * \brief Stores an object under a key, replacing any previous entry.
+ *
+ * A cache that has used up its entries (tombstones included) is emptied first. Keys longer than
+ * \ref CACHE_KEY_MAX_SIZE are not cached.
+ *
+ * \param[in,out] cache      The cache to store in.
+ * \param[in]     key        The key bytes.
+ * \param[in]     key_size   The number of bytes in the key.
+ * \param[in]     value      The object to store. The cache takes a new reference to it.
+ * \param[in]     expires_at The time at which the entry expires, in milliseconds.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the
+ *         table cannot be allocated.
+ */
+static cardano_error_t
+cache_put(cache_t* cache, const byte_t* key, const size_t key_size, cardano_object_t* value, const uint64_t expires_at)
+{
+  if ((key_size > CACHE_KEY_MAX_SIZE) || (cache->max_entries == 0U))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (cache->slots == NULL)
+  {
+    // Keep the table at most half full so probe sequences stay short.
+    size_t slot_count = 2U;
+
+    while (slot_count < (cache->max_entries * 2U))
+    {
+      slot_count *= 2U;
+    }
+
+    cache->slots = (cache_slot_t*)_cardano_malloc(slot_count * sizeof(cache_slot_t));
+
+    if (cache->slots == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    CARDANO_UNUSED(memset(cache->slots, 0, slot_count * sizeof(cache_slot_t)));
+
+    cache->slot_count = slot_count;
+  }
+
+  cache_slot_t* slot = cache_find(cache, key, key_size);
+
+  if (slot == NULL)
+  {
+    if (cache->used >= cache->max_entries)
+    {
+      cache_clear(cache);
+    }
+
+    const size_t mask = cache->slot_count - 1U;
+    size_t       i    = (size_t)hash_key(key, key_size) & mask;
+
+    while (cache->slots[i].value != NULL)
+    {
+      i = (i + 1U) & mask;
+    }
+
+    slot = &cache->slots[i];
+
+    // Reusing a tombstone does not change the number of used slots.
+    if (!slot->tombstone)
+    {
+      ++cache->used;
+    }
+
+    CARDANO_UNUSED(memcpy(slot->key, key, key_size));
+
+    slot->key_size  = key_size;
+    slot->tombstone = false;
+  }
+
+  cardano_object_ref(value);
+  cardano_object_unref(&slot->value);
+
+  slot->value      = value;
+  slot->expires_at = expires_at;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Builds the cache key of a transaction input.
+ *
+ * \param[in]  input The transaction input.
+ * \param[out] key   The key; must hold \ref INPUT_KEY_SIZE bytes.
+ *
+ * \return The key size, or 0 if the input's id is not a 32-byte hash.
+ */
+static size_t
+input_key(cardano_transaction_input_t* input, byte_t* key)
+{
+  cardano_blake2b_hash_t* id = cardano_transaction_input_get_id(input);
+
+  if ((id == NULL) || (cardano_blake2b_hash_get_bytes_size(id) != (INPUT_KEY_SIZE - 8U)))
+  {
+    cardano_blake2b_hash_unref(&id);
+
+    return 0U;
+  }
+
+  CARDANO_UNUSED(memcpy(key, cardano_blake2b_hash_get_data(id), INPUT_KEY_SIZE - 8U));
+
+  cardano_blake2b_hash_unref(&id);
+
+  const uint64_t index = cardano_transaction_input_get_index(input);
+
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    key[INPUT_KEY_SIZE - 1U - i] = (byte_t)(index >> (8U * i));
+  }
+
+  return INPUT_KEY_SIZE;
+}
+
+/**
+ * \brief Stores every output of a list in the by-input cache.
+ *
+ * \param[in,out] context The caching provider state.
+ * \param[in]     utxos   The outputs to store.
+ * \param[in]     now     The current time, in milliseconds.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+cache_utxos(caching_provider_context_t* context, const cardano_utxo_list_t* utxos, const uint64_t now)
+{
+  const size_t    length = cardano_utxo_list_get_length(utxos);
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+
+    result = cardano_utxo_list_get(utxos, i, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      cardano_transaction_input_t* input = cardano_utxo_get_input(utxo);
+      byte_t                       key[INPUT_KEY_SIZE];
+      const size_t                 key_size = (input == NULL) ? 0U : input_key(input, key);
+
+      if (key_size > 0U)
+      {
+        result = cache_put(&context->inputs, key, key_size, (cardano_object_t*)((void*)utxo), expiry(now, context->options.utxo_ttl_ms));
+      }
+
+      cardano_transaction_input_unref(&input);
+      cardano_utxo_unref(&utxo);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Creates a reader over the bytes a writer has produced.
+ *
+ * \param[in]  writer The writer holding the encoded value.
+ * \param[out] reader On success, a reader over a copy of those bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+reader_from_writer(cardano_cbor_writer_t* writer, cardano_cbor_reader_t** reader)
+{
+  cardano_buffer_t* buffer = NULL;
+  cardano_error_t   result = cardano_cbor_writer_encode_in_buffer(writer, &buffer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *reader = cardano_cbor_reader_new(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer));
+
+  cardano_buffer_unref(&buffer);
+
+  return (*reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Deep-copies an unspent output through its CBOR encoding.
+ *
+ * \param[in]  utxo The output to copy.
+ * \param[out] copy On success, a copy that shares no object with \p utxo.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+copy_utxo(const cardano_utxo_t* utxo, cardano_utxo_t** copy)
+{
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+  cardano_cbor_reader_t* reader = NULL;
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_utxo_to_cbor(utxo, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = reader_from_writer(writer, &reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_from_cbor(reader, copy);
+  }
+
+  cardano_cbor_reader_unref(&reader);
+  cardano_cbor_writer_unref(&writer);
+
+  return result;
+}
+
+/**
+ * \brief Deep-copies every output of a list.
+ *
+ * \param[in]  utxos The outputs to copy.
+ * \param[out] copy  On success, a new list of copies in the same order.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+copy_utxo_list(const cardano_utxo_list_t* utxos, cardano_utxo_list_t** copy)
+{
+  const size_t    length = cardano_utxo_list_get_length(utxos);
+  cardano_error_t result = cardano_utxo_list_new(copy);
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_utxo_t* utxo      = NULL;
+    cardano_utxo_t* utxo_copy = NULL;
+
+    result = cardano_utxo_list_get(utxos, i, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = copy_utxo(utxo, &utxo_copy);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_utxo_list_add(*copy, utxo_copy);
+    }
+
+    cardano_utxo_unref(&utxo_copy);
+    cardano_utxo_unref(&utxo);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(copy);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Deep-copies a datum through its CBOR encoding.
+ *
+ * \param[in]  datum The datum to copy.
+ * \param[out] copy  On success, a copy that shares no object with \p datum.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+copy_datum(const cardano_plutus_data_t* datum, cardano_plutus_data_t** copy)
+{
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+  cardano_cbor_reader_t* reader = NULL;
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_plutus_data_to_cbor(datum, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = reader_from_writer(writer, &reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_plutus_data_from_cbor(reader, copy);
+  }
+
+  cardano_cbor_reader_unref(&reader);
+  cardano_cbor_writer_unref(&writer);
+
+  return result;
+}
+
+/**
+ * \brief Copies the last error of the backend into the caching provider's error message.
+ *
+ * \param[in,out] provider_impl The caching provider implementation.
+ * \param[in]     backend       The backend that failed.
+ */
+static void
+forward_error(cardano_provider_impl_t* provider_impl, const cardano_provider_t* backend)
+{
+  const char* message = cardano_provider_get_last_error(backend);
+
+  CARDANO_UNUSED(memset(provider_impl->error_message, 0, sizeof(provider_impl->error_message)));
+  cardano_safe_memcpy(
+    provider_impl->error_message,
+    sizeof(provider_impl->error_message),
+    message,
+    cardano_safe_strlen(message, sizeof(provider_impl->error_message) - 1U));
+}
+
+/**
+ * \brief Gets the caching provider state of a provider implementation.
+ *
+ * \param[in] provider_impl The caching provider implementation.
+ *
+ * \return The caching provider state.
+ */
+static caching_provider_context_t*
+get_context(const cardano_provider_impl_t* provider_impl)
+{
+  assert(provider_impl != NULL);
+  assert(provider_impl->context != NULL);
+
+  return (caching_provider_context_t*)((void*)provider_impl->context);
+}
+
+/**
+ * \brief Deallocates the caching provider state.
+ *
+ * \param[in] object The caching provider state.
+ */
+static void
+caching_provider_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  caching_provider_context_t* context = (caching_provider_context_t*)object;
+
+  cache_free(&context->addresses);
+  cache_free(&context->inputs);
+  cache_free(&context->datums);
+
+  cardano_protocol_parameters_unref(&context->parameters);
+  cardano_provider_unref(&context->backend);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Serves protocol parameters from the cache while they are fresh and their epoch lasts.
+ *
+ * Every caller gets its own shallow clone, so setting a parameter on the result does not leak into
+ * the cached copy other callers are served.
+ *
+ * \see cardano_get_parameters_func_t
+ */
+static cardano_error_t
+get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_parameters_t** parameters)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  const uint64_t now        = now_ms(context);
+  uint64_t       epoch      = 0U;
+  const bool     has_epoch  = epoch_at(provider_impl->network_magic, now, &epoch);
+  const bool     same_epoch = !has_epoch || (epoch == context->parameters_epoch);
+
+  if ((context->parameters != NULL) && (now < context->parameters_expires_at) && same_epoch)
+  {
+    *parameters = cardano_protocol_parameters_clone(context->parameters);
+
+    return (*parameters == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
+  }
+
+  cardano_protocol_parameters_unref(&context->parameters);
+
+  cardano_protocol_parameters_t* fetched = NULL;
+
+  cardano_error_t result = cardano_provider_get_parameters(context->backend, &fetched);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+
+    return result;
+  }
+
+  context->parameters            = fetched;
+  context->parameters_expires_at = expiry(now, context->options.parameters_ttl_ms);
+  context->parameters_epoch      = epoch;
+
+  *parameters = cardano_protocol_parameters_clone(fetched);
+
+  return (*parameters == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Serves the unspent outputs of an address from the cache, and seeds the by-input cache on a miss.
+ *
+ * Every caller gets its own deep copy, so editing an output on the result does not leak into the
+ * cached outputs other callers are served.
+ *
+ * \see cardano_get_unspent_outputs_func_t
+ */
+static cardano_error_t
+get_unspent_outputs(cardano_provider_impl_t* provider_impl, cardano_address_t* address, cardano_utxo_list_t** utxo_list)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  const uint64_t now      = now_ms(context);
+  const byte_t*  key      = cardano_address_get_bytes(address);
+  const size_t   key_size = cardano_address_get_bytes_size(address);
+
+  cardano_utxo_list_t* cached = (cardano_utxo_list_t*)((void*)cache_get(&context->addresses, key, key_size, now));
+
+  if (cached != NULL)
+  {
+    return copy_utxo_list(cached, utxo_list);
+  }
+
+  cardano_utxo_list_t* fetched = NULL;
+
+  cardano_error_t result = cardano_provider_get_unspent_outputs(context->backend, address, &fetched);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+
+    return result;
+  }
+
+  result = cache_put(&context->addresses, key, key_size, (cardano_object_t*)((void*)fetched), expiry(now, context->options.utxo_ttl_ms));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cache_utxos(context, fetched, now);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = copy_utxo_list(fetched, utxo_list);
+  }
+
+  cardano_utxo_list_unref(&fetched);
+
+  return result;
+}
+
+/**
+ * \brief Forwards a rewards balance request.
+ *
+ * \see cardano_get_rewards_balance_func_t
+ */
+static cardano_error_t
+get_rewards_balance(cardano_provider_impl_t* provider_impl, cardano_reward_address_t* address, uint64_t* rewards)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  cardano_error_t result = cardano_provider_get_rewards_available(context->backend, address, rewards);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Forwards an unspent outputs by address and asset request.
+ *
+ * \see cardano_get_unspent_outputs_with_asset_func_t
+ */
+static cardano_error_t
+get_unspent_outputs_with_asset(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_list_t**    utxo_list)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  cardano_error_t result = cardano_provider_get_unspent_outputs_with_asset(context->backend, address, asset_id, utxo_list);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Forwards an unspent output by NFT request.
+ *
+ * \see cardano_get_unspent_output_by_nft_func_t
+ */
+static cardano_error_t
+get_unspent_output_by_nft(cardano_provider_impl_t* provider_impl, cardano_asset_id_t* asset_id, cardano_utxo_t** utxo)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  cardano_error_t result = cardano_provider_get_unspent_output_by_nft(context->backend, asset_id, utxo);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Resolves every cached input locally and the rest with a single backend call.
+ *
+ * The returned outputs are deep copies of the cached ones.
+ *
+ * \see cardano_resolve_unspent_outputs_func_t
+ */
+static cardano_error_t
+resolve_unspent_outputs(
+  cardano_provider_impl_t*         provider_impl,
+  cardano_transaction_input_set_t* tx_ins,
+  cardano_utxo_list_t**            utxo_list)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  const uint64_t now    = now_ms(context);
+  const size_t   length = cardano_transaction_input_set_get_length(tx_ins);
+
+  // One slot per input, so the outputs come back in input order whatever order the backend uses.
+  cardano_utxo_t** resolved = (cardano_utxo_t**)_cardano_malloc((length + 1U) * sizeof(cardano_utxo_t*));
+
+  if (resolved == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)resolved, 0, (length + 1U) * sizeof(cardano_utxo_t*)));
+
+  cardano_transaction_input_set_t* missing = NULL;
+  cardano_error_t                  result  = cardano_transaction_input_set_new(&missing);
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_transaction_input_t* input = NULL;
+
+    result = cardano_transaction_input_set_get(tx_ins, i, &input);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      byte_t       key[INPUT_KEY_SIZE];
+      const size_t key_size = input_key(input, key);
+
+      resolved[i] = (key_size == 0U) ? NULL : (cardano_utxo_t*)((void*)cache_get(&context->inputs, key, key_size, now));
+
+      if (resolved[i] != NULL)
+      {
+        cardano_utxo_ref(resolved[i]);
+      }
+      else
+      {
+        result = cardano_transaction_input_set_add(missing, input);
+      }
+
+      cardano_transaction_input_unref(&input);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_transaction_input_set_get_length(missing) > 0U))
+  {
+    cardano_utxo_list_t* fetched = NULL;
+
+    result = cardano_provider_resolve_unspent_outputs(context->backend, missing, &fetched);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      forward_error(provider_impl, context->backend);
+    }
+    else
+    {
+      result = cache_utxos(context, fetched, now);
+    }
+
+    const size_t fetched_length = (result == CARDANO_SUCCESS) ? cardano_utxo_list_get_length(fetched) : 0U;
+
+    for (size_t i = 0U; (i < fetched_length) && (result == CARDANO_SUCCESS); ++i)
+    {
+      cardano_utxo_t* utxo = NULL;
+
+      result = cardano_utxo_list_get(fetched, i, &utxo);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        cardano_transaction_input_t* input = cardano_utxo_get_input(utxo);
+        cardano_blake2b_hash_t*      id    = cardano_transaction_input_get_id(input);
+        size_t                       index = 0U;
+
+        // Outputs for inputs that were not asked for are ignored.
+        if ((cardano_transaction_input_set_find_index(tx_ins, id, cardano_transaction_input_get_index(input), &index) == CARDANO_SUCCESS) && (resolved[index] == NULL))
+        {
+          resolved[index] = utxo;
+          utxo            = NULL;
+        }
+
+        cardano_blake2b_hash_unref(&id);
+        cardano_transaction_input_unref(&input);
+        cardano_utxo_unref(&utxo);
+      }
+    }
+
+    cardano_utxo_list_unref(&fetched);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_list_new(utxo_list);
+  }
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    if (resolved[i] != NULL)
+    {
+      cardano_utxo_t* copy = NULL;
+
+      result = copy_utxo(resolved[i], &copy);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_utxo_list_add(*utxo_list, copy);
+      }
+
+      cardano_utxo_unref(&copy);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(utxo_list);
+  }
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_utxo_unref(&resolved[i]);
+  }
+
+  _cardano_free((void*)resolved);
+  cardano_transaction_input_set_unref(&missing);
+
+  return result;
+}
+
+/**
+ * \brief Serves datums from the cache by hash.
+ *
+ * Every caller gets its own deep copy of the cached datum.
+ *
+ * \see cardano_resolve_datum_func_t
+ */
+static cardano_error_t
+resolve_datum(cardano_provider_impl_t* provider_impl, cardano_blake2b_hash_t* datum_hash, cardano_plutus_data_t** datum)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  const uint64_t now      = now_ms(context);
+  const byte_t*  key      = cardano_blake2b_hash_get_data(datum_hash);
+  const size_t   key_size = cardano_blake2b_hash_get_bytes_size(datum_hash);
+
+  cardano_plutus_data_t* cached = (cardano_plutus_data_t*)((void*)cache_get(&context->datums, key, key_size, now));
+
+  if (cached != NULL)
+  {
+    return copy_datum(cached, datum);
+  }
+
+  cardano_plutus_data_t* fetched = NULL;
+
+  cardano_error_t result = cardano_provider_resolve_datum(context->backend, datum_hash, &fetched);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+
+    return result;
+  }
+
+  result = cache_put(&context->datums, key, key_size, (cardano_object_t*)((void*)fetched), expiry(now, context->options.datum_ttl_ms));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = copy_datum(fetched, datum);
+  }
+
+  cardano_plutus_data_unref(&fetched);
+
+  return result;
+}
+
+/**
+ * \brief Forwards a transaction confirmation request.
+ *
+ * \see cardano_confirm_transaction_func_t
+ */
+static cardano_error_t
+await_transaction_confirmation(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  tx_id,
+  const uint64_t           timeout_ms,
+  bool*                    confirmed)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  cardano_error_t result = cardano_provider_confirm_transaction(context->backend, tx_id, timeout_ms, confirmed);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Submits a transaction and drops the cached outputs it invalidates.
+ *
+ * Every address listing is dropped, since the transaction's outputs may belong to any of them,
+ * along with every input the transaction spends.
+ *
+ * \see cardano_submit_transaction_func_t
+ */
+static cardano_error_t
+post_transaction_to_chain(cardano_provider_impl_t* provider_impl, cardano_transaction_t* tx, cardano_blake2b_hash_t** tx_id)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  cardano_error_t result = cardano_provider_submit_transaction(context->backend, tx, tx_id);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+
+    return result;
+  }
+
+  cache_clear(&context->addresses);
+
+  cardano_transaction_body_t*      body   = cardano_transaction_get_body(tx);
+  cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(body);
+  const size_t                     length = cardano_transaction_input_set_get_length(inputs);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_transaction_input_t* input = NULL;
+
+    if (cardano_transaction_input_set_get(inputs, i, &input) == CARDANO_SUCCESS)
+    {
+      byte_t       key[INPUT_KEY_SIZE];
+      const size_t key_size = input_key(input, key);
+
+      if (key_size > 0U)
+      {
+        cache_remove(&context->inputs, key, key_size);
+      }
+
+      cardano_transaction_input_unref(&input);
+    }
+  }
+
+  cardano_transaction_input_set_unref(&inputs);
+  cardano_transaction_body_unref(&body);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Forwards a transaction evaluation request.
+ *
+ * \see cardano_evaluate_transaction_func_t
+ */
+static cardano_error_t
+evaluate_transaction(
+  cardano_provider_impl_t*  provider_impl,
+  cardano_transaction_t*    tx,
+  cardano_utxo_list_t*      additional_utxos,
+  cardano_redeemer_list_t** redeemers)
+{
+  caching_provider_context_t* context = get_context(provider_impl);
+
+  cardano_error_t result = cardano_provider_evaluate_transaction(context->backend, tx, additional_utxos, redeemers);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    forward_error(provider_impl, context->backend);
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_caching_provider_options_t
+cardano_caching_provider_options_default(void)
+{
+  cardano_caching_provider_options_t options;
+
+  options.parameters_ttl_ms = 10U * 60U * 1000U;
+  options.utxo_ttl_ms       = 20U * 1000U;
+  options.datum_ttl_ms      = 60U * 60U * 1000U;
+  options.max_entries       = 1024U;
+  options.clock             = NULL;
+  options.clock_context     = NULL;
+
+  return options;
+}
+
+cardano_error_t
+cardano_caching_provider_new(
+  cardano_provider_t*                       backend,
+  const cardano_caching_provider_options_t* options,
+  cardano_provider_t**                      provider)
+{
+  if ((backend == NULL) || (provider == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  caching_provider_context_t* context = (caching_provider_context_t*)_cardano_malloc(sizeof(caching_provider_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  context->base.ref_count     = 1U;
+  context->base.deallocator   = caching_provider_context_deallocate;
+  context->base.last_error[0] = '\0';
+
+  context->options               = (options == NULL) ? cardano_caching_provider_options_default() : *options;
+  context->parameters            = NULL;
+  context->parameters_expires_at = 0U;
+  context->parameters_epoch      = 0U;
+
+  if (context->options.clock == NULL)
+  {
+    context->options.clock = wall_clock_now;
+  }
+
+  cache_init(&context->addresses, context->options.max_entries);
+  cache_init(&context->inputs, context->options.max_entries);
+  cache_init(&context->datums, context->options.max_entries);
+
+  cardano_provider_ref(backend);
+  context->backend = backend;
+
+  cardano_provider_impl_t impl = { 0 };
+
+  static const char* provider_name = "Caching provider";
+  cardano_safe_memcpy(impl.name, sizeof(impl.name), provider_name, cardano_safe_strlen(provider_name, sizeof(impl.name)));
+
+  impl.network_magic                  = cardano_provider_get_network_magic(backend);
+  impl.context                        = (cardano_object_t*)((void*)context);
+  impl.get_parameters                 = get_parameters;
+  impl.get_unspent_outputs            = get_unspent_outputs;
+  impl.get_rewards_balance            = get_rewards_balance;
+  impl.get_unspent_outputs_with_asset = get_unspent_outputs_with_asset;
+  impl.get_unspent_output_by_nft      = get_unspent_output_by_nft;
+  impl.resolve_unspent_outputs        = resolve_unspent_outputs;
+  impl.resolve_datum                  = resolve_datum;
+  impl.await_transaction_confirmation = await_transaction_confirmation;
+  impl.post_transaction_to_chain      = post_transaction_to_chain;
+  impl.evaluate_transaction           = evaluate_transaction;
+
+  cardano_error_t result = cardano_provider_new(impl, provider);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_t* object = (cardano_object_t*)((void*)context);
+    cardano_object_unref(&object);
+  }
+
+  return result;
+}
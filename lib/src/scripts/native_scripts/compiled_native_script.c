@@ -0,0 +1,1003 @@
+/**
+ * \file compiled_native_script.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/object.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
+#include <cardano/scripts/native_scripts/native_script_list.h>
+#include <cardano/scripts/native_scripts/script_all.h>
+#include <cardano/scripts/native_scripts/script_any.h>
+#include <cardano/scripts/native_scripts/script_invalid_after.h>
+#include <cardano/scripts/native_scripts/script_invalid_before.h>
+#include <cardano/scripts/native_scripts/script_n_of_k.h>
+#include <cardano/scripts/native_scripts/script_pubkey.h>
+#include <cardano/scripts/native_scripts/script_require_guard.h>
+
+#include "../../allocators.h"
+#include "../../string_safe.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const byte_t ENTRY_KIND_SIGNER       = 0U;
+static const byte_t ENTRY_KIND_KEY_GUARD    = 1U;
+static const byte_t ENTRY_KIND_SCRIPT_GUARD = 2U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A key hash or guard credential mentioned by the script.
+ *
+ * Entries sort by kind first, so the signer entries occupy the front of the table and their indices
+ * double as bit positions in a signer set.
+ */
+typedef struct compiled_entry_t
+{
+    byte_t kind;
+    byte_t hash[CARDANO_BLAKE2B_HASH_SIZE_224];
+} compiled_entry_t;
+
+/**
+ * \brief One predicate of the flattened script.
+ *
+ * Composite nodes follow their \c count children in the post-order array; \c entry indexes the entry table
+ * for \c sig and \c require_guard nodes and \c slot holds the bound of the time predicates.
+ */
+typedef struct compiled_node_t
+{
+    cardano_native_script_type_t type;
+    size_t                       count;
+    size_t                       required;
+    size_t                       entry;
+    uint64_t                     slot;
+} compiled_node_t;
+
+/**
+ * \brief A native script flattened into a post-order predicate array.
+ */
+typedef struct cardano_compiled_native_script_t
+{
+    cardano_object_t  base;
+    compiled_node_t*  nodes;
+    size_t            node_count;
+    compiled_entry_t* entries;
+    size_t            entry_count;
+    size_t            signer_count;
+    size_t            max_depth;
+} cardano_compiled_native_script_t;
+
+/**
+ * \brief The state threaded through the flattening pass.
+ */
+typedef struct flatten_state_t
+{
+    cardano_compiled_native_script_t* compiled;
+    size_t                            entry_count;
+    size_t                            depth;
+} flatten_state_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a compiled native script object.
+ *
+ * \param object A void pointer to the compiled native script to be deallocated.
+ */
+static void
+cardano_compiled_native_script_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_compiled_native_script_t* data = (cardano_compiled_native_script_t*)object;
+
+  _cardano_free(data->nodes);
+  _cardano_free(data->entries);
+  _cardano_free(data);
+}
+
+/**
+ * \brief Orders two entries by kind, then by hash bytes.
+ *
+ * \param[in] lhs The first entry.
+ * \param[in] rhs The second entry.
+ *
+ * \return A negative value, zero or a positive value as \p lhs sorts before, with or after \p rhs.
+ */
+static int
+compare_entries(const void* lhs, const void* rhs)
+{
+  return memcmp(lhs, rhs, sizeof(compiled_entry_t));
+}
+
+/**
+ * \brief Retrieves the sub-scripts of a composite script.
+ *
+ * \param[in] native_script The script.
+ * \param[in] type The type of \p native_script.
+ * \param[out] scripts Receives the sub-scripts, or NULL if the script is not composite.
+ * \param[out] required Receives the number of sub-scripts that must hold.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the script could not be read.
+ */
+static cardano_error_t
+get_children(
+  cardano_native_script_t*           native_script,
+  const cardano_native_script_type_t type,
+  cardano_native_script_list_t**     scripts,
+  size_t*                            required)
+{
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  *scripts = NULL;
+
+  switch (type)
+  {
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ALL_OF:
+    {
+      cardano_script_all_t* all = NULL;
+
+      result = cardano_native_script_to_all(native_script, &all);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result    = cardano_script_all_get_scripts(all, scripts);
+        *required = cardano_native_script_list_get_length(*scripts);
+      }
+
+      cardano_script_all_unref(&all);
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ANY_OF:
+    {
+      cardano_script_any_t* any = NULL;
+
+      result = cardano_native_script_to_any(native_script, &any);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result    = cardano_script_any_get_scripts(any, scripts);
+        *required = 1U;
+      }
+
+      cardano_script_any_unref(&any);
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_N_OF_K:
+    {
+      cardano_script_n_of_k_t* n_of_k = NULL;
+
+      result = cardano_native_script_to_n_of_k(native_script, &n_of_k);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result    = cardano_script_n_of_k_get_scripts(n_of_k, scripts);
+        *required = cardano_script_n_of_k_get_required(n_of_k);
+      }
+
+      cardano_script_n_of_k_unref(&n_of_k);
+      break;
+    }
+    default:
+      break;
+  }
+
+  return result;
+}
+
+/**
+ * \brief Counts the nodes of a script tree and the entries its leaves mention.
+ *
+ * \param[in] native_script The script.
+ * \param[in,out] node_count Incremented by the number of nodes.
+ * \param[in,out] entry_count Incremented by the number of \c sig and \c require_guard leaves.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the script could not be read.
+ */
+static cardano_error_t
+count_nodes(cardano_native_script_t* native_script, size_t* node_count, size_t* entry_count)
+{
+  cardano_native_script_type_t  type     = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY;
+  cardano_native_script_list_t* children = NULL;
+  size_t                        required = 0U;
+
+  cardano_error_t result = cardano_native_script_get_type(native_script, &type);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  ++(*node_count);
+
+  if ((type == CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY) || (type == CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_GUARD))
+  {
+    ++(*entry_count);
+  }
+
+  result = get_children(native_script, type, &children, &required);
+
+  const size_t length = cardano_native_script_list_get_length(children);
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_native_script_t* child = NULL;
+
+    result = cardano_native_script_list_get(children, i, &child);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = count_nodes(child, node_count, entry_count);
+    }
+
+    cardano_native_script_unref(&child);
+  }
+
+  cardano_native_script_list_unref(&children);
+
+  return result;
+}
+
+/**
+ * \brief Records the entry a \c sig or \c require_guard leaf mentions.
+ *
+ * \param[in,out] state The flattening state.
+ * \param[in] kind The entry kind.
+ * \param[in] hash The hash bytes.
+ * \param[in] size The number of hash bytes.
+ * \param[out] node The leaf node, which receives the entry's index.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE if the hash is not
+ *         a 28 byte hash.
+ */
+static cardano_error_t
+add_entry(flatten_state_t* state, const byte_t kind, const byte_t* hash, const size_t size, compiled_node_t* node)
+{
+  compiled_entry_t* entry = &state->compiled->entries[state->entry_count];
+
+  if ((hash == NULL) || (size != (size_t)CARDANO_BLAKE2B_HASH_SIZE_224))
+  {
+    return CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE;
+  }
+
+  entry->kind = kind;
+  cardano_safe_memcpy(entry->hash, sizeof(entry->hash), hash, size);
+
+  node->entry = state->entry_count;
+  ++state->entry_count;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Fills the leaf-specific fields of a node.
+ *
+ * \param[in] native_script The leaf script.
+ * \param[in,out] state The flattening state.
+ * \param[out] node The node to fill.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the script could not be read.
+ */
+static cardano_error_t
+compile_leaf(cardano_native_script_t* native_script, flatten_state_t* state, compiled_node_t* node)
+{
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  switch (node->type)
+  {
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY:
+    {
+      cardano_script_pubkey_t* pubkey   = NULL;
+      cardano_blake2b_hash_t*  key_hash = NULL;
+
+      result = cardano_native_script_to_pubkey(native_script, &pubkey);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_script_pubkey_get_key_hash(pubkey, &key_hash);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = add_entry(state, ENTRY_KIND_SIGNER, cardano_blake2b_hash_get_data(key_hash), cardano_blake2b_hash_get_bytes_size(key_hash), node);
+      }
+
+      cardano_blake2b_hash_unref(&key_hash);
+      cardano_script_pubkey_unref(&pubkey);
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_GUARD:
+    {
+      cardano_script_require_guard_t* guard      = NULL;
+      cardano_credential_t*           credential = NULL;
+      cardano_credential_type_t       type       = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+
+      result = cardano_native_script_to_require_guard(native_script, &guard);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_script_require_guard_get_credential(guard, &credential);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_credential_get_type(credential, &type);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        const byte_t kind = (type == CARDANO_CREDENTIAL_TYPE_KEY_HASH) ? ENTRY_KIND_KEY_GUARD : ENTRY_KIND_SCRIPT_GUARD;
+
+        result = add_entry(state, kind, cardano_credential_get_hash_bytes(credential), cardano_credential_get_hash_bytes_size(credential), node);
+      }
+
+      cardano_credential_unref(&credential);
+      cardano_script_require_guard_unref(&guard);
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_BEFORE:
+    {
+      cardano_script_invalid_before_t* before = NULL;
+
+      result = cardano_native_script_to_invalid_before(native_script, &before);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_script_invalid_before_get_slot(before, &node->slot);
+      }
+
+      cardano_script_invalid_before_unref(&before);
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_AFTER:
+    {
+      cardano_script_invalid_after_t* after = NULL;
+
+      result = cardano_native_script_to_invalid_after(native_script, &after);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_script_invalid_after_get_slot(after, &node->slot);
+      }
+
+      cardano_script_invalid_after_unref(&after);
+      break;
+    }
+    default:
+      break;
+  }
+
+  return result;
+}
+
+/**
+ * \brief Appends a script tree to the node array in post-order.
+ *
+ * \param[in] native_script The script.
+ * \param[in,out] state The flattening state.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the script could not be read.
+ */
+static cardano_error_t
+flatten(cardano_native_script_t* native_script, flatten_state_t* state)
+{
+  cardano_native_script_type_t  type     = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY;
+  cardano_native_script_list_t* children = NULL;
+  size_t                        required = 0U;
+
+  cardano_error_t result = cardano_native_script_get_type(native_script, &type);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = get_children(native_script, type, &children, &required);
+  }
+
+  const size_t length = cardano_native_script_list_get_length(children);
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_native_script_t* child = NULL;
+
+    result = cardano_native_script_list_get(children, i, &child);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = flatten(child, state);
+    }
+
+    cardano_native_script_unref(&child);
+  }
+
+  cardano_native_script_list_unref(&children);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_compiled_native_script_t* compiled = state->compiled;
+  compiled_node_t*                  node     = &compiled->nodes[compiled->node_count];
+
+  CARDANO_UNUSED(memset(node, 0, sizeof(compiled_node_t)));
+
+  node->type     = type;
+  node->count    = length;
+  node->required = required;
+
+  result = compile_leaf(native_script, state, node);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  ++compiled->node_count;
+
+  // The children's results collapse into one.
+  state->depth = state->depth - length + 1U;
+
+  if (state->depth > compiled->max_depth)
+  {
+    compiled->max_depth = state->depth;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Sorts and deduplicates the entry table and points the leaves at their sorted entries.
+ *
+ * \param[in,out] compiled The compiled script, with one unsorted entry per leaf.
+ * \param[in] entry_count The number of unsorted entries.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+intern_entries(cardano_compiled_native_script_t* compiled, const size_t entry_count)
+{
+  if (entry_count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  compiled_entry_t* sorted = (compiled_entry_t*)_cardano_malloc(entry_count * sizeof(compiled_entry_t));
+
+  if (sorted == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_safe_memcpy(sorted, entry_count * sizeof(compiled_entry_t), compiled->entries, entry_count * sizeof(compiled_entry_t));
+  qsort(sorted, entry_count, sizeof(compiled_entry_t), compare_entries);
+
+  size_t unique = 1U;
+
+  for (size_t i = 1U; i < entry_count; ++i)
+  {
+    if (compare_entries(&sorted[unique - 1U], &sorted[i]) != 0)
+    {
+      sorted[unique] = sorted[i];
+      ++unique;
+    }
+  }
+
+  for (size_t i = 0U; i < compiled->node_count; ++i)
+  {
+    compiled_node_t* node = &compiled->nodes[i];
+
+    if ((node->type == CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY) || (node->type == CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_GUARD))
+    {
+      const compiled_entry_t* found = (const compiled_entry_t*)bsearch(&compiled->entries[node->entry], sorted, unique, sizeof(compiled_entry_t), compare_entries);
+
+      assert(found != NULL);
+
+      node->entry = (size_t)(found - sorted);
+    }
+  }
+
+  compiled->signer_count = 0U;
+
+  while ((compiled->signer_count < unique) && (sorted[compiled->signer_count].kind == ENTRY_KIND_SIGNER))
+  {
+    ++compiled->signer_count;
+  }
+
+  _cardano_free(compiled->entries);
+
+  compiled->entries     = sorted;
+  compiled->entry_count = unique;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Marks the entry matching a hash as present.
+ *
+ * \param[in] compiled The compiled script.
+ * \param[in] kind The entry kind.
+ * \param[in] hash The hash bytes.
+ * \param[in] size The number of hash bytes.
+ * \param[in,out] present One flag per entry.
+ */
+static void
+mark_present(const cardano_compiled_native_script_t* compiled, const byte_t kind, const byte_t* hash, const size_t size, bool* present)
+{
+  compiled_entry_t key = { 0 };
+
+  if ((hash == NULL) || (size != (size_t)CARDANO_BLAKE2B_HASH_SIZE_224) || (compiled->entry_count == 0U))
+  {
+    return;
+  }
+
+  key.kind = kind;
+  cardano_safe_memcpy(key.hash, sizeof(key.hash), hash, size);
+
+  const compiled_entry_t* found = (const compiled_entry_t*)bsearch(&key, compiled->entries, compiled->entry_count, sizeof(compiled_entry_t), compare_entries);
+
+  if (found != NULL)
+  {
+    present[found - compiled->entries] = true;
+  }
+}
+
+/**
+ * \brief Counts the signers in a signer bit set.
+ *
+ * \param[in] set The bit set.
+ * \param[in] words The number of words in \p set.
+ *
+ * \return The number of bits set.
+ */
+static size_t
+count_signers(const uint64_t* set, const size_t words)
+{
+  size_t count = 0U;
+
+  for (size_t i = 0U; i < words; ++i)
+  {
+    uint64_t word = set[i];
+
+    while (word != 0U)
+    {
+      word &= word - 1U;
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * \brief Builds a hash set from the signer entries in a bit set.
+ *
+ * \param[in] compiled The compiled script.
+ * \param[in] set The signer bit set, or NULL for an empty set.
+ * \param[out] signers Receives the hash set.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the set could not be built.
+ */
+static cardano_error_t
+to_hash_set(const cardano_compiled_native_script_t* compiled, const uint64_t* set, cardano_blake2b_hash_set_t** signers)
+{
+  cardano_error_t result = cardano_blake2b_hash_set_new(signers);
+
+  for (size_t i = 0U; (set != NULL) && (i < compiled->signer_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    if ((set[i / 64U] & ((uint64_t)1U << (i % 64U))) != 0U)
+    {
+      cardano_blake2b_hash_t* hash = NULL;
+
+      result = cardano_blake2b_hash_from_bytes(compiled->entries[i].hash, sizeof(compiled->entries[i].hash), &hash);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_blake2b_hash_set_add(*signers, hash);
+      }
+
+      cardano_blake2b_hash_unref(&hash);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_set_unref(signers);
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+cardano_compiled_native_script_new(
+  cardano_native_script_t*           native_script,
+  cardano_compiled_native_script_t** compiled_native_script)
+{
+  if ((native_script == NULL) || (compiled_native_script == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  size_t node_count  = 0U;
+  size_t entry_count = 0U;
+
+  cardano_error_t result = count_nodes(native_script, &node_count, &entry_count);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_compiled_native_script_t* data = _cardano_malloc(sizeof(cardano_compiled_native_script_t));
+
+  if (data == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  data->base.ref_count     = 1;
+  data->base.last_error[0] = '\0';
+  data->base.deallocator   = cardano_compiled_native_script_deallocate;
+  data->nodes              = (compiled_node_t*)_cardano_malloc(node_count * sizeof(compiled_node_t));
+  data->node_count         = 0U;
+  data->entries            = NULL;
+  data->entry_count        = 0U;
+  data->signer_count       = 0U;
+  data->max_depth          = 0U;
+
+  if (entry_count > 0U)
+  {
+    data->entries = (compiled_entry_t*)_cardano_malloc(entry_count * sizeof(compiled_entry_t));
+  }
+
+  if ((data->nodes == NULL) || ((entry_count > 0U) && (data->entries == NULL)))
+  {
+    cardano_compiled_native_script_deallocate(data);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  flatten_state_t state = { data, 0U, 0U };
+
+  result = flatten(native_script, &state);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = intern_entries(data, state.entry_count);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_compiled_native_script_deallocate(data);
+
+    return result;
+  }
+
+  *compiled_native_script = data;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_compiled_native_script_evaluate(
+  const cardano_compiled_native_script_t* compiled_native_script,
+  const cardano_blake2b_hash_set_t*       signers,
+  const uint64_t*                         invalid_before,
+  const uint64_t*                         invalid_after,
+  const cardano_guard_set_t*              guards,
+  bool*                                   satisfied,
+  cardano_blake2b_hash_set_t**            minimal_signers)
+{
+  if ((compiled_native_script == NULL) || (satisfied == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const cardano_compiled_native_script_t* compiled = compiled_native_script;
+
+  const size_t words = (compiled->signer_count / 64U) + 1U;
+  const size_t depth = compiled->max_depth;
+
+  // One block holds the per-depth signer sets plus a scratch set, the per-depth
+  // signer counts, and the per-depth and per-entry flags.
+  const size_t sets_size  = (depth + 1U) * words * sizeof(uint64_t);
+  const size_t costs_size = depth * sizeof(size_t);
+  const size_t flags_size = (2U * depth) + compiled->entry_count;
+
+  byte_t* block = (byte_t*)_cardano_malloc(sets_size + costs_size + flags_size);
+
+  if (block == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(block, 0, sets_size + costs_size + flags_size));
+
+  uint64_t* sets    = (uint64_t*)((void*)block);
+  uint64_t* scratch = &sets[depth * words];
+  size_t*   costs   = (size_t*)((void*)&block[sets_size]);
+  bool*     ok      = (bool*)((void*)&block[sets_size + costs_size]);
+  bool*     chosen  = &ok[depth];
+  bool*     present = &chosen[depth];
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  const size_t signer_count = cardano_blake2b_hash_set_get_length(signers);
+
+  for (size_t i = 0U; (i < signer_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_blake2b_hash_t* hash = NULL;
+
+    result = cardano_blake2b_hash_set_get(signers, i, &hash);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      mark_present(compiled, ENTRY_KIND_SIGNER, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), present);
+    }
+
+    cardano_blake2b_hash_unref(&hash);
+  }
+
+  const size_t guard_count = cardano_guard_set_get_length(guards);
+
+  for (size_t i = 0U; (i < guard_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_credential_t*     credential = NULL;
+    cardano_credential_type_t type       = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+
+    result = cardano_guard_set_get(guards, i, &credential);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_credential_get_type(credential, &type);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      const byte_t kind = (type == CARDANO_CREDENTIAL_TYPE_KEY_HASH) ? ENTRY_KIND_KEY_GUARD : ENTRY_KIND_SCRIPT_GUARD;
+
+      mark_present(compiled, kind, cardano_credential_get_hash_bytes(credential), cardano_credential_get_hash_bytes_size(credential), present);
+    }
+
+    cardano_credential_unref(&credential);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_free(block);
+
+    return result;
+  }
+
+  size_t top = 0U;
+
+  for (size_t n = 0U; n < compiled->node_count; ++n)
+  {
+    const compiled_node_t* node = &compiled->nodes[n];
+    const size_t           base = top - node->count;
+    uint64_t*              set  = &sets[base * words];
+    bool                   holds;
+
+    CARDANO_UNUSED(memset(scratch, 0, words * sizeof(uint64_t)));
+
+    switch (node->type)
+    {
+      case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY:
+      {
+        holds = present[node->entry];
+
+        if (holds)
+        {
+          scratch[node->entry / 64U] = (uint64_t)1U << (node->entry % 64U);
+        }
+
+        break;
+      }
+      case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_GUARD:
+      {
+        holds = present[node->entry];
+        break;
+      }
+      case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_BEFORE:
+      {
+        holds = (invalid_before != NULL) && (node->slot <= *invalid_before);
+        break;
+      }
+      case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_AFTER:
+      {
+        holds = (invalid_after != NULL) && (*invalid_after <= node->slot);
+        break;
+      }
+      default:
+      {
+        size_t picked = 0U;
+
+        CARDANO_UNUSED(memset(&chosen[base], 0, node->count * sizeof(bool)));
+
+        // Take the satisfied children that need the fewest signers until enough hold.
+        while (picked < node->required)
+        {
+          size_t best = node->count;
+
+          for (size_t c = 0U; c < node->count; ++c)
+          {
+            if (ok[base + c] && !chosen[base + c] && ((best == node->count) || (costs[base + c] < costs[base + best])))
+            {
+              best = c;
+            }
+          }
+
+          if (best == node->count)
+          {
+            break;
+          }
+
+          chosen[base + best] = true;
+          ++picked;
+
+          for (size_t w = 0U; w < words; ++w)
+          {
+            scratch[w] |= sets[((base + best) * words) + w];
+          }
+        }
+
+        holds = picked >= node->required;
+        break;
+      }
+    }
+
+    if (!holds)
+    {
+      CARDANO_UNUSED(memset(scratch, 0, words * sizeof(uint64_t)));
+    }
+
+    cardano_safe_memcpy(set, words * sizeof(uint64_t), scratch, words * sizeof(uint64_t));
+
+    ok[base]    = holds;
+    costs[base] = count_signers(set, words);
+    top         = base + 1U;
+  }
+
+  *satisfied = ok[0];
+
+  if (minimal_signers != NULL)
+  {
+    result = to_hash_set(compiled, *satisfied ? sets : NULL, minimal_signers);
+  }
+
+  _cardano_free(block);
+
+  return result;
+}
+
+cardano_error_t
+cardano_compiled_native_script_get_key_hashes(
+  const cardano_compiled_native_script_t* compiled_native_script,
+  cardano_blake2b_hash_set_t**            key_hashes)
+{
+  if ((compiled_native_script == NULL) || (key_hashes == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t words = (compiled_native_script->signer_count / 64U) + 1U;
+  uint64_t*    all   = (uint64_t*)_cardano_malloc(words * sizeof(uint64_t));
+
+  if (all == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(all, 0xFF, words * sizeof(uint64_t)));
+
+  cardano_error_t result = to_hash_set(compiled_native_script, all, key_hashes);
+
+  _cardano_free(all);
+
+  return result;
+}
+
+cardano_error_t
+cardano_native_script_evaluate(
+  cardano_native_script_t*          native_script,
+  const cardano_blake2b_hash_set_t* signers,
+  const uint64_t*                   invalid_before,
+  const uint64_t*                   invalid_after,
+  const cardano_guard_set_t*        guards,
+  bool*                             satisfied,
+  cardano_blake2b_hash_set_t**      minimal_signers)
+{
+  cardano_compiled_native_script_t* compiled = NULL;
+
+  if (satisfied == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_compiled_native_script_new(native_script, &compiled);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_compiled_native_script_evaluate(compiled, signers, invalid_before, invalid_after, guards, satisfied, minimal_signers);
+
+  cardano_compiled_native_script_unref(&compiled);
+
+  return result;
+}
+
+void
+cardano_compiled_native_script_unref(cardano_compiled_native_script_t** compiled_native_script)
+{
+  if ((compiled_native_script == NULL) || (*compiled_native_script == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*compiled_native_script)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *compiled_native_script = NULL;
+    return;
+  }
+}
+
+void
+cardano_compiled_native_script_ref(cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&compiled_native_script->base);
+}
+
+size_t
+cardano_compiled_native_script_refcount(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&compiled_native_script->base);
+}
+
+void
+cardano_compiled_native_script_set_last_error(cardano_compiled_native_script_t* compiled_native_script, const char* message)
+{
+  cardano_object_set_last_error(&compiled_native_script->base, message);
+}
+
+const char*
+cardano_compiled_native_script_get_last_error(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  return cardano_object_get_last_error(&compiled_native_script->base);
+}
@@ -24,6 +24,7 @@
 #include <cardano/crypto/blake2b_hash_size.h>
 #include <cardano/error.h>
 #include <cardano/scripts/native_scripts/native_script.h>
+#include <cardano/scripts/native_scripts/native_script_list.h>
 #include <cardano/scripts/native_scripts/native_script_type.h>
 #include <cardano/scripts/native_scripts/script_all.h>
 #include <cardano/scripts/native_scripts/script_any.h>
@@ -40,7 +41,7 @@
 #include "../../string_safe.h"
 
 #include <assert.h>
-#include <cardano/json/json_object.h>
+#include <cardano/json/json_reader.h>
 #include <string.h>
 
 /* STRUCTURES ****************************************************************/
@@ -62,6 +63,21 @@ typedef struct cardano_native_script_t
 
 } cardano_native_script_t;
 
+/**
+ * \brief The properties of a native script JSON object that only composite scripts need.
+ *
+ * Leaf scripts are parsed from the text of their object by their own from_json functions, so only the
+ * properties that hold nested scripts, and the threshold that goes with them, are read here.
+ */
+typedef struct
+{
+    bool                          has_required;    /**< Whether a "required" property was found. */
+    uint64_t                      required;        /**< The "required" value. */
+    cardano_error_t               required_result; /**< The result of reading the "required" value. */
+    bool                          has_scripts;     /**< Whether a "scripts" property was found. */
+    cardano_native_script_list_t* scripts;         /**< The nested scripts, or NULL if "scripts" is not an array. */
+} cardano_native_script_json_fields_t;
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -126,6 +142,315 @@ cardano_native_script_new(void)
   return data;
 }
 
+/**
+ * \brief Reads an unsigned integer property value.
+ *
+ * \param[in] reader The JSON reader, positioned on the property name.
+ * \param[out] value Receives the value.
+ * \param[out] value_result Receives the result of converting the value to an unsigned integer.
+ *
+ * \return The result of reading the value from the JSON text.
+ */
+static cardano_error_t
+read_uint_property(cardano_json_reader_t* reader, uint64_t* value, cardano_error_t* value_result)
+{
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  cardano_error_t           result = cardano_json_reader_read(reader, &token);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *value_result = cardano_json_reader_get_uint(reader, value);
+
+  return cardano_json_reader_skip(reader);
+}
+
+/**
+ * \brief Builds a native script from its JSON object.
+ *
+ * Leaf scripts are handed to the from_json function of their type, which parses the text of the object.
+ * Composite scripts are built from the nested scripts already read from the same reader, so their children are
+ * never parsed twice.
+ *
+ * \param[in] json The text of the JSON object.
+ * \param[in] json_size The size of \p json, in bytes.
+ * \param[in] type The value of the "type" property, or NULL if it is missing or not a string.
+ * \param[in] fields The nested scripts and threshold of the object.
+ * \param[out] native_script Receives the native script.
+ *
+ * \return The result of the operation.
+ */
+static cardano_error_t
+build_native_script(
+  const char*                                json,
+  const size_t                               json_size,
+  const char*                                type,
+  const cardano_native_script_json_fields_t* fields,
+  cardano_native_script_t**                  native_script)
+{
+  if (type == NULL)
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (strcmp(type, "atLeast") == 0)
+  {
+    if (!fields->has_required || (fields->scripts == NULL))
+    {
+      return CARDANO_ERROR_INVALID_JSON;
+    }
+
+    if (fields->required_result != CARDANO_SUCCESS)
+    {
+      return fields->required_result;
+    }
+
+    cardano_script_n_of_k_t* n_of_k = NULL;
+
+    result = cardano_script_n_of_k_new(fields->scripts, (size_t)fields->required, &n_of_k);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_n_of_k(n_of_k, native_script);
+    }
+
+    cardano_script_n_of_k_unref(&n_of_k);
+  }
+  else if (strcmp(type, "all") == 0)
+  {
+    if (fields->scripts == NULL)
+    {
+      return CARDANO_ERROR_INVALID_JSON;
+    }
+
+    cardano_script_all_t* all = NULL;
+
+    result = cardano_script_all_new(fields->scripts, &all);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_all(all, native_script);
+    }
+
+    cardano_script_all_unref(&all);
+  }
+  else if (strcmp(type, "any") == 0)
+  {
+    if (fields->scripts == NULL)
+    {
+      return CARDANO_ERROR_INVALID_JSON;
+    }
+
+    cardano_script_any_t* any = NULL;
+
+    result = cardano_script_any_new(fields->scripts, &any);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_any(any, native_script);
+    }
+
+    cardano_script_any_unref(&any);
+  }
+  else if (strcmp(type, "sig") == 0)
+  {
+    cardano_script_pubkey_t* pubkey = NULL;
+
+    result = cardano_script_pubkey_from_json(json, json_size, &pubkey);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_pubkey(pubkey, native_script);
+    }
+
+    cardano_script_pubkey_unref(&pubkey);
+  }
+  else if (strcmp(type, "before") == 0)
+  {
+    cardano_script_invalid_after_t* invalid_after = NULL;
+
+    result = cardano_script_invalid_after_from_json(json, json_size, &invalid_after);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_invalid_after(invalid_after, native_script);
+    }
+
+    cardano_script_invalid_after_unref(&invalid_after);
+  }
+  else if (strcmp(type, "after") == 0)
+  {
+    cardano_script_invalid_before_t* invalid_before = NULL;
+
+    result = cardano_script_invalid_before_from_json(json, json_size, &invalid_before);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_invalid_before(invalid_before, native_script);
+    }
+
+    cardano_script_invalid_before_unref(&invalid_before);
+  }
+  else if (strcmp(type, "guard") == 0)
+  {
+    cardano_script_require_guard_t* guard = NULL;
+
+    result = cardano_script_require_guard_from_json(json, json_size, &guard);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_new_require_guard(guard, native_script);
+    }
+
+    cardano_script_require_guard_unref(&guard);
+  }
+  else
+  {
+    result = CARDANO_ERROR_INVALID_NATIVE_SCRIPT_TYPE;
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads a native script JSON object in a single pass.
+ *
+ * Nested scripts are read from the same reader, so the JSON text is neither materialized as a tree nor
+ * parsed again for every level of the script. When a property appears more than once, the first occurrence wins.
+ *
+ * \param[in] reader The JSON reader, positioned on the start of the object.
+ * \param[in] json The document the reader walks.
+ * \param[out] native_script Receives the native script.
+ *
+ * \return The result of the operation.
+ */
+static cardano_error_t
+read_native_script(cardano_json_reader_t* reader, const char* json, cardano_native_script_t** native_script)
+{
+  cardano_native_script_json_fields_t fields   = { 0 };
+  cardano_json_token_type_t           token    = CARDANO_JSON_TOKEN_TYPE_NONE;
+  cardano_error_t                     result   = CARDANO_SUCCESS;
+  char                                type[16] = { 0 };
+  bool                                has_type = false;
+  bool                                is_type  = false;
+
+  // The reader is just past the opening brace.
+  const size_t start = cardano_json_reader_get_offset(reader) - 1U;
+
+  fields.required_result = CARDANO_SUCCESS;
+
+  while (result == CARDANO_SUCCESS)
+  {
+    result = cardano_json_reader_read(reader, &token);
+
+    if ((result != CARDANO_SUCCESS) || (token == CARDANO_JSON_TOKEN_TYPE_END_OBJECT))
+    {
+      break;
+    }
+
+    size_t      name_size = 0U;
+    const char* name      = cardano_json_reader_get_string(reader, &name_size);
+
+    if (!has_type && (name_size == 4U) && (memcmp(name, "type", 4U) == 0))
+    {
+      has_type = true;
+      result   = cardano_json_reader_read(reader, &token);
+
+      if ((result == CARDANO_SUCCESS) && (token == CARDANO_JSON_TOKEN_TYPE_STRING))
+      {
+        size_t      type_size  = 0U;
+        const char* type_value = cardano_json_reader_get_string(reader, &type_size);
+
+        is_type = true;
+
+        // Longer values cannot name a script type; they are left empty and rejected as an unknown type.
+        if (type_size < sizeof(type))
+        {
+          cardano_safe_memcpy(type, sizeof(type), type_value, type_size);
+        }
+      }
+      else if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_json_reader_skip(reader);
+      }
+      else
+      {
+        // Do nothing.
+      }
+    }
+    else if (!fields.has_required && (name_size == 8U) && (memcmp(name, "required", 8U) == 0))
+    {
+      fields.has_required = true;
+      result              = read_uint_property(reader, &fields.required, &fields.required_result);
+    }
+    else if (!fields.has_scripts && (name_size == 7U) && (memcmp(name, "scripts", 7U) == 0))
+    {
+      fields.has_scripts = true;
+      result             = cardano_json_reader_read(reader, &token);
+
+      if ((result == CARDANO_SUCCESS) && (token == CARDANO_JSON_TOKEN_TYPE_START_ARRAY))
+      {
+        result = cardano_native_script_list_new(&fields.scripts);
+
+        while (result == CARDANO_SUCCESS)
+        {
+          result = cardano_json_reader_read(reader, &token);
+
+          if ((result != CARDANO_SUCCESS) || (token == CARDANO_JSON_TOKEN_TYPE_END_ARRAY))
+          {
+            break;
+          }
+
+          if (token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT)
+          {
+            result = CARDANO_ERROR_INVALID_JSON;
+            break;
+          }
+
+          cardano_native_script_t* script = NULL;
+
+          // cppcheck-suppress misra-c2012-17.2; Reason: Native scripts nest by definition; the depth is bounded by the reader.
+          result = read_native_script(reader, json, &script);
+
+          if (result == CARDANO_SUCCESS)
+          {
+            result = cardano_native_script_list_add(fields.scripts, script);
+          }
+
+          cardano_native_script_unref(&script);
+        }
+      }
+      else if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_json_reader_skip(reader);
+      }
+      else
+      {
+        // Do nothing.
+      }
+    }
+    else
+    {
+      result = cardano_json_reader_skip(reader);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    const size_t end = cardano_json_reader_get_offset(reader);
+
+    result = build_native_script(&json[start], end - start, is_type ? type : NULL, &fields, native_script);
+  }
+
+  cardano_native_script_list_unref(&fields.scripts);
+
+  return result;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -624,149 +949,42 @@ cardano_native_script_from_json(const char* json, const size_t json_size, cardan
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_json_object_t* json_object = cardano_json_object_parse(json, json_size);
+  cardano_json_reader_t* reader = cardano_json_reader_new(json, json_size);
 
-  if (json_object == NULL)
-  {
-    return CARDANO_ERROR_INVALID_JSON;
-  }
-
-  cardano_error_t          result = CARDANO_SUCCESS;
-  cardano_native_script_t* data   = NULL;
-
-  cardano_json_object_t* type = NULL;
-
-  if (!cardano_json_object_get_ex(json_object, "type", 4, &type))
-  {
-    cardano_json_object_unref(&json_object);
-    cardano_native_script_unref(&data);
-
-    return CARDANO_ERROR_INVALID_JSON;
-  }
-
-  const char* type_string = cardano_json_object_get_string(type, NULL);
-
-  if (type_string == NULL)
+  if (reader == NULL)
   {
-    cardano_json_object_unref(&json_object);
-    cardano_native_script_unref(&data);
-
-    return CARDANO_ERROR_INVALID_JSON;
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  if (strcmp(type_string, "all") == 0)
-  {
-    cardano_script_all_t* script_all = NULL;
-    result                           = cardano_script_all_from_json(json, json_size, &script_all);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
-    }
+  cardano_native_script_t*  data   = NULL;
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  cardano_error_t           result = cardano_json_reader_read(reader, &token);
 
-    result = cardano_native_script_new_all(script_all, &data);
-    cardano_script_all_unref(&script_all);
-  }
-  else if (strcmp(type_string, "any") == 0)
+  if ((result == CARDANO_SUCCESS) && (token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT))
   {
-    cardano_script_any_t* script_any = NULL;
-    result                           = cardano_script_any_from_json(json, json_size, &script_any);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
-    }
-
-    result = cardano_native_script_new_any(script_any, &data);
-    cardano_script_any_unref(&script_any);
+    result = CARDANO_ERROR_INVALID_JSON;
   }
-  else if (strcmp(type_string, "atLeast") == 0)
-  {
-    cardano_script_n_of_k_t* script_n_of_k = NULL;
-    result                                 = cardano_script_n_of_k_from_json(json, json_size, &script_n_of_k);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
-    }
-
-    result = cardano_native_script_new_n_of_k(script_n_of_k, &data);
-    cardano_script_n_of_k_unref(&script_n_of_k);
-  }
-  else if (strcmp(type_string, "sig") == 0)
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_script_pubkey_t* script_pubkey = NULL;
-    result                                 = cardano_script_pubkey_from_json(json, json_size, &script_pubkey);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
-    }
-
-    result = cardano_native_script_new_pubkey(script_pubkey, &data);
-    cardano_script_pubkey_unref(&script_pubkey);
+    result = read_native_script(reader, json, &data);
   }
-  else if (strcmp(type_string, "before") == 0)
-  {
-    cardano_script_invalid_after_t* invalid_after = NULL;
-    result                                        = cardano_script_invalid_after_from_json(json, json_size, &invalid_after);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
-    }
-
-    result = cardano_native_script_new_invalid_after(invalid_after, &data);
-    cardano_script_invalid_after_unref(&invalid_after);
-  }
-  else if (strcmp(type_string, "after") == 0)
+  // Malformed JSON takes precedence over an invalid script, so the rest of the document is still checked.
+  while ((token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT) && (cardano_json_reader_read(reader, &token) == CARDANO_SUCCESS))
   {
-    cardano_script_invalid_before_t* invalid_before = NULL;
-    result                                          = cardano_script_invalid_before_from_json(json, json_size, &invalid_before);
-
-    if (result != CARDANO_SUCCESS)
+    if ((token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT) && (result == CARDANO_SUCCESS))
     {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
+      result = CARDANO_ERROR_INVALID_JSON;
     }
-
-    result = cardano_native_script_new_invalid_before(invalid_before, &data);
-    cardano_script_invalid_before_unref(&invalid_before);
   }
-  else if (strcmp(type_string, "guard") == 0)
-  {
-    cardano_script_require_guard_t* require_guard = NULL;
-    result                                        = cardano_script_require_guard_from_json(json, json_size, &require_guard);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_json_object_unref(&json_object);
-      cardano_native_script_unref(&data);
-      return result;
-    }
-
-    result = cardano_native_script_new_require_guard(require_guard, &data);
-    cardano_script_require_guard_unref(&require_guard);
-  }
-  else
+  if (token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT)
   {
-    cardano_json_object_unref(&json_object);
-    cardano_native_script_unref(&data);
-    return CARDANO_ERROR_INVALID_NATIVE_SCRIPT_TYPE;
+    result = CARDANO_ERROR_INVALID_JSON;
   }
 
-  cardano_json_object_unref(&json_object);
+  cardano_json_reader_unref(&reader);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -0,0 +1,968 @@
+/**
+ * \file phase1_validation.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
+#include <cardano/transaction/phase1_validation.h>
+#include <cardano/transaction_builder/balancing/transaction_balancing.h>
+#include <cardano/transaction_builder/fee.h>
+
+#include "../allocators.h"
+#include "../transaction_builder/balancing/internals/unique_signers.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A resolved UTxO and the input that spends it.
+ */
+typedef struct utxo_index_entry_t
+{
+    cardano_transaction_input_t* input;
+    cardano_utxo_t*              utxo;
+} utxo_index_entry_t;
+
+/**
+ * \brief The resolved UTxOs of a transaction, sorted by input for binary search.
+ *
+ * The entries borrow the inputs and UTxOs of the list the index was built from, which must
+ * outlive it.
+ */
+typedef struct utxo_index_t
+{
+    utxo_index_entry_t* entries;
+    size_t              count;
+} utxo_index_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Orders two index entries by their input.
+ *
+ * \param[in] lhs The first entry.
+ * \param[in] rhs The second entry.
+ *
+ * \return A negative value, zero or a positive value as \p lhs sorts before, with or after \p rhs.
+ */
+static int
+compare_index_entries(const void* lhs, const void* rhs)
+{
+  const utxo_index_entry_t* lhs_entry = (const utxo_index_entry_t*)lhs;
+  const utxo_index_entry_t* rhs_entry = (const utxo_index_entry_t*)rhs;
+
+  return (int)cardano_transaction_input_compare(lhs_entry->input, rhs_entry->input);
+}
+
+/**
+ * \brief Indexes the resolved UTxOs by the input that spends them.
+ *
+ * Every input set of the transaction is looked up in the same UTxOs, so sorting them once
+ * turns each lookup into a binary search instead of a scan of the whole list.
+ *
+ * \param[in] resolved_inputs The UTxOs the transaction may refer to.
+ * \param[out] index Receives the index. Release it with \ref free_utxo_index.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the index could not be built.
+ */
+static cardano_error_t
+build_utxo_index(cardano_utxo_list_t* resolved_inputs, utxo_index_t* index)
+{
+  const size_t length = cardano_utxo_list_get_length(resolved_inputs);
+
+  index->entries = NULL;
+  index->count   = 0U;
+
+  if (length == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  index->entries = (utxo_index_entry_t*)_cardano_malloc(length * sizeof(utxo_index_entry_t));
+
+  if (index->entries == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+
+    cardano_error_t result = cardano_utxo_list_get(resolved_inputs, i, &utxo);
+    cardano_utxo_unref(&utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      _cardano_free(index->entries);
+      index->entries = NULL;
+
+      return result;
+    }
+
+    cardano_transaction_input_t* input = cardano_utxo_get_input(utxo);
+    cardano_transaction_input_unref(&input);
+
+    index->entries[i].input = input;
+    index->entries[i].utxo  = utxo;
+  }
+
+  index->count = length;
+
+  qsort(index->entries, index->count, sizeof(utxo_index_entry_t), compare_index_entries);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Releases the memory held by a UTxO index.
+ *
+ * \param[in,out] index The index to release.
+ */
+static void
+free_utxo_index(utxo_index_t* index)
+{
+  _cardano_free(index->entries);
+
+  index->entries = NULL;
+  index->count   = 0U;
+}
+
+/**
+ * \brief Finds the UTxO spent by a transaction input.
+ *
+ * \param[in] index The resolved UTxOs.
+ * \param[in] input The input to look for.
+ *
+ * \return The UTxO, borrowed from the index, or NULL if the input does not resolve.
+ */
+static cardano_utxo_t*
+find_utxo(const utxo_index_t* index, const cardano_transaction_input_t* input)
+{
+  size_t low  = 0U;
+  size_t high = index->count;
+
+  while (low < high)
+  {
+    const size_t  middle = low + ((high - low) / 2U);
+    const int32_t order  = cardano_transaction_input_compare(index->entries[middle].input, input);
+
+    if (order == 0)
+    {
+      return index->entries[middle].utxo;
+    }
+
+    if (order < 0)
+    {
+      low = middle + 1U;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Resolves every input of a set against the resolved UTxOs.
+ *
+ * \param[in] inputs The input set. May be NULL, in which case there is nothing to resolve.
+ * \param[in] index The UTxOs the transaction may refer to.
+ * \param[in,out] collected If not NULL, receives every UTxO that resolves.
+ * \param[out] lovelace If not NULL, receives the lovelace held by the UTxOs that resolve.
+ * \param[out] all_resolved Set to \c false if an input is missing; left untouched otherwise.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if a UTxO could not be collected.
+ */
+static cardano_error_t
+resolve_inputs(
+  cardano_transaction_input_set_t* inputs,
+  const utxo_index_t*              index,
+  cardano_utxo_list_t*             collected,
+  uint64_t*                        lovelace,
+  bool*                            all_resolved)
+{
+  const size_t length = cardano_transaction_input_set_get_length(inputs);
+
+  if (lovelace != NULL)
+  {
+    *lovelace = 0U;
+  }
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_transaction_input_t* input = NULL;
+
+    cardano_error_t result = cardano_transaction_input_set_get(inputs, i, &input);
+    cardano_transaction_input_unref(&input);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    cardano_utxo_t* utxo = find_utxo(index, input);
+
+    if (utxo == NULL)
+    {
+      *all_resolved = false;
+
+      continue;
+    }
+
+    if (lovelace != NULL)
+    {
+      cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+      cardano_transaction_output_unref(&output);
+
+      cardano_value_t* value = cardano_transaction_output_get_value(output);
+      cardano_value_unref(&value);
+
+      *lovelace += (uint64_t)cardano_value_get_coin(value);
+    }
+
+    if (collected != NULL)
+    {
+      result = cardano_utxo_list_add(collected, utxo);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks the minimum ADA and the maximum value size of an output.
+ *
+ * \param[in] output The output to check.
+ * \param[in] protocol_params The protocol parameters in effect.
+ * \param[in,out] report The validation result to update.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the output could not be measured.
+ */
+static cardano_error_t
+check_output(
+  cardano_transaction_output_t*       output,
+  cardano_protocol_parameters_t*      protocol_params,
+  cardano_phase1_validation_result_t* report)
+{
+  uint64_t               min_ada     = 0U;
+  cardano_cbor_writer_t* writer      = NULL;
+  size_t                 value_bytes = 0U;
+
+  cardano_error_t result = cardano_compute_min_ada_required(output, cardano_protocol_parameters_get_ada_per_utxo_byte(protocol_params), &min_ada);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_value_t* value = cardano_transaction_output_get_value(output);
+  cardano_value_unref(&value);
+
+  if ((uint64_t)cardano_value_get_coin(value) < min_ada)
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_OUTPUT_TOO_SMALL;
+    ++report->undersized_output_count;
+  }
+
+  writer = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result      = cardano_value_to_cbor(value, writer);
+  value_bytes = cardano_cbor_writer_get_encode_size(writer);
+
+  cardano_cbor_writer_unref(&writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((uint64_t)value_bytes > cardano_protocol_parameters_get_max_value_size(protocol_params))
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_OUTPUT_VALUE_TOO_LARGE;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks the minimum ADA and the maximum value size of every output.
+ *
+ * \param[in] outputs The transaction outputs.
+ * \param[in] protocol_params The protocol parameters in effect.
+ * \param[in,out] report The validation result to update.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if an output could not be measured.
+ */
+static cardano_error_t
+check_outputs(
+  cardano_transaction_output_list_t*  outputs,
+  cardano_protocol_parameters_t*      protocol_params,
+  cardano_phase1_validation_result_t* report)
+{
+  const size_t length = cardano_transaction_output_list_get_length(outputs);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_transaction_output_t* output = NULL;
+
+    cardano_error_t result = cardano_transaction_output_list_get(outputs, i, &output);
+    cardano_transaction_output_unref(&output);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = check_output(output, protocol_params, report);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks that collateral only takes ADA.
+ *
+ * The collateral inputs minus the collateral return must hold no native assets, so without a
+ * collateral return every collateral input must be ADA-only, and with one the return must give
+ * back exactly the assets the collateral inputs hold.
+ *
+ * \param[in] collateral_utxos The UTxOs spent as collateral.
+ * \param[in] collateral_return The collateral return output, or NULL if there is none.
+ * \param[out] ada_only Set to \c true if the collateral balance holds only ADA.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the values could not be added.
+ */
+static cardano_error_t
+is_collateral_ada_only(
+  cardano_utxo_list_t*          collateral_utxos,
+  cardano_transaction_output_t* collateral_return,
+  bool*                         ada_only)
+{
+  const size_t     length   = cardano_utxo_list_get_length(collateral_utxos);
+  cardano_value_t* spent    = NULL;
+  cardano_value_t* returned = NULL;
+
+  cardano_error_t result = cardano_value_new(0, NULL, &spent);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < length); ++i)
+  {
+    cardano_utxo_t*  utxo  = NULL;
+    cardano_value_t* total = NULL;
+
+    result = cardano_utxo_list_get(collateral_utxos, i, &utxo);
+    cardano_utxo_unref(&utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+    cardano_transaction_output_unref(&output);
+
+    cardano_value_t* value = cardano_transaction_output_get_value(output);
+    cardano_value_unref(&value);
+
+    cardano_multi_asset_t* assets = cardano_value_get_multi_asset(value);
+    cardano_value_t*       tokens = NULL;
+
+    result = cardano_value_new(0, assets, &tokens);
+    cardano_multi_asset_unref(&assets);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_value_add(spent, tokens, &total);
+    }
+
+    cardano_value_unref(&tokens);
+    cardano_value_unref(&spent);
+
+    spent = total;
+  }
+
+  if ((result == CARDANO_SUCCESS) && (collateral_return != NULL))
+  {
+    cardano_value_t* value = cardano_transaction_output_get_value(collateral_return);
+    cardano_value_unref(&value);
+
+    cardano_multi_asset_t* assets = cardano_value_get_multi_asset(value);
+
+    result = cardano_value_new(0, assets, &returned);
+    cardano_multi_asset_unref(&assets);
+  }
+  else if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_value_new(0, NULL, &returned);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *ada_only = cardano_value_equals(spent, returned);
+  }
+
+  cardano_value_unref(&spent);
+  cardano_value_unref(&returned);
+
+  return result;
+}
+
+/**
+ * \brief Checks the execution unit limit and the collateral of a transaction that runs scripts.
+ *
+ * \param[in] body The transaction body.
+ * \param[in] redeemers The transaction redeemers.
+ * \param[in] index The UTxOs the transaction may refer to.
+ * \param[in] protocol_params The protocol parameters in effect.
+ * \param[in,out] report The validation result to update.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if a rule could not be evaluated.
+ */
+static cardano_error_t
+check_scripts(
+  cardano_transaction_body_t*         body,
+  cardano_redeemer_list_t*            redeemers,
+  const utxo_index_t*                 index,
+  cardano_protocol_parameters_t*      protocol_params,
+  cardano_phase1_validation_result_t* report)
+{
+  cardano_ex_units_t*  total            = NULL;
+  cardano_utxo_list_t* collateral_utxos = NULL;
+  uint64_t             collected        = 0U;
+  bool                 resolved         = true;
+  bool                 ada_only         = true;
+
+  cardano_error_t result = cardano_get_total_ex_units_in_redeemers(redeemers, &total);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_ex_units_t* max_units = cardano_protocol_parameters_get_max_tx_ex_units(protocol_params);
+  cardano_ex_units_unref(&max_units);
+
+  if ((max_units != NULL) && ((cardano_ex_units_get_memory(total) > cardano_ex_units_get_memory(max_units)) || (cardano_ex_units_get_cpu_steps(total) > cardano_ex_units_get_cpu_steps(max_units))))
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_EX_UNITS_TOO_BIG;
+  }
+
+  cardano_ex_units_unref(&total);
+
+  cardano_transaction_input_set_t* collateral = cardano_transaction_body_get_collateral(body);
+  cardano_transaction_input_set_unref(&collateral);
+
+  const size_t collateral_count = cardano_transaction_input_set_get_length(collateral);
+
+  if (collateral_count == 0U)
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_NO_COLLATERAL_INPUTS;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if ((uint64_t)collateral_count > cardano_protocol_parameters_get_max_collateral_inputs(protocol_params))
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_TOO_MANY_COLLATERAL_INPUTS;
+  }
+
+  cardano_transaction_output_t* collateral_return = cardano_transaction_body_get_collateral_return(body);
+  cardano_transaction_output_unref(&collateral_return);
+
+  if (collateral_return != NULL)
+  {
+    result = check_output(collateral_return, protocol_params, report);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  result = cardano_utxo_list_new(&collateral_utxos);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = resolve_inputs(collateral, index, collateral_utxos, &collected, &resolved);
+  }
+
+  if ((result == CARDANO_SUCCESS) && resolved)
+  {
+    result = is_collateral_ada_only(collateral_utxos, collateral_return, &ada_only);
+  }
+
+  cardano_utxo_list_unref(&collateral_utxos);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (!resolved)
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_BAD_INPUTS;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (!ada_only)
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_COLLATERAL_CONTAINS_NON_ADA;
+  }
+
+  if (collateral_return != NULL)
+  {
+    cardano_value_t* value = cardano_transaction_output_get_value(collateral_return);
+    cardano_value_unref(&value);
+
+    const uint64_t returned = (uint64_t)cardano_value_get_coin(value);
+
+    collected = (returned > collected) ? 0U : (collected - returned);
+  }
+
+  const uint64_t fee        = cardano_transaction_body_get_fee(body);
+  const uint64_t percentage = cardano_protocol_parameters_get_collateral_percentage(protocol_params);
+
+  if ((collected * 100U) < (fee * percentage))
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_INSUFFICIENT_COLLATERAL;
+  }
+
+  const uint64_t* total_collateral = cardano_transaction_body_get_total_collateral(body);
+
+  if ((total_collateral != NULL) && (*total_collateral != collected))
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_INCORRECT_TOTAL_COLLATERAL;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Collects the key hashes of the vkey witnesses of a transaction.
+ *
+ * \param[in] transaction The transaction.
+ * \param[out] provided Receives the key hashes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if a key could not be hashed.
+ */
+static cardano_error_t
+collect_vkey_hashes(cardano_transaction_t* transaction, cardano_blake2b_hash_set_t** provided)
+{
+  cardano_error_t result = cardano_blake2b_hash_set_new(provided);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(transaction);
+  cardano_witness_set_unref(&witness_set);
+
+  cardano_vkey_witness_set_t* vkeys = cardano_witness_set_get_vkeys(witness_set);
+  cardano_vkey_witness_set_unref(&vkeys);
+
+  const size_t vkey_count = cardano_vkey_witness_set_get_length(vkeys);
+
+  for (size_t i = 0U; (i < vkey_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_vkey_witness_t* witness = NULL;
+    cardano_blake2b_hash_t* hash    = NULL;
+
+    result = cardano_vkey_witness_set_get(vkeys, i, &witness);
+    cardano_vkey_witness_unref(&witness);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    cardano_ed25519_public_key_t* vkey = cardano_vkey_witness_get_vkey(witness);
+    cardano_ed25519_public_key_unref(&vkey);
+
+    result = cardano_ed25519_public_key_to_hash(vkey, &hash);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_blake2b_hash_set_add(*provided, hash);
+    }
+
+    cardano_blake2b_hash_unref(&hash);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_set_unref(provided);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Checks that every native script in the witness set is satisfied.
+ *
+ * \param[in] transaction The transaction.
+ * \param[in] provided The key hashes of the vkey witnesses.
+ * \param[in,out] report The validation result to update.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if a script could not be evaluated.
+ */
+static cardano_error_t
+check_native_scripts(
+  cardano_transaction_t*              transaction,
+  cardano_blake2b_hash_set_t*         provided,
+  cardano_phase1_validation_result_t* report)
+{
+  cardano_transaction_body_t* body = cardano_transaction_get_body(transaction);
+  cardano_transaction_body_unref(&body);
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(transaction);
+  cardano_witness_set_unref(&witness_set);
+
+  cardano_native_script_set_t* scripts = cardano_witness_set_get_native_scripts(witness_set);
+  cardano_native_script_set_unref(&scripts);
+
+  cardano_guard_set_t* guards = cardano_transaction_body_get_guards(body);
+  cardano_guard_set_unref(&guards);
+
+  const uint64_t* invalid_before = cardano_transaction_body_get_invalid_before(body);
+  const uint64_t* invalid_after  = cardano_transaction_body_get_invalid_after(body);
+  const size_t    length         = cardano_native_script_set_get_length(scripts);
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_native_script_t* script    = NULL;
+    bool                     satisfied = false;
+
+    result = cardano_native_script_set_get(scripts, i, &script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_native_script_evaluate(script, provided, invalid_before, invalid_after, guards, &satisfied, NULL);
+    }
+
+    if ((result == CARDANO_SUCCESS) && !satisfied)
+    {
+      report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_NATIVE_SCRIPT_FAILED;
+    }
+
+    cardano_native_script_unref(&script);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Counts the required signers that have no vkey witness.
+ *
+ * \param[in] transaction The transaction.
+ * \param[in] resolved_inputs The UTxOs the transaction may refer to.
+ * \param[in] provided The key hashes of the vkey witnesses.
+ * \param[in,out] report The validation result to update.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the signers could not be collected.
+ */
+static cardano_error_t
+check_signers(
+  cardano_transaction_t*              transaction,
+  cardano_utxo_list_t*                resolved_inputs,
+  cardano_blake2b_hash_set_t*         provided,
+  cardano_phase1_validation_result_t* report)
+{
+  cardano_blake2b_hash_set_t* signers = NULL;
+
+  cardano_error_t result = _cardano_get_unique_signers(transaction, resolved_inputs, &signers);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const size_t signer_count = cardano_blake2b_hash_set_get_length(signers);
+
+  for (size_t i = 0U; (i < signer_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_blake2b_hash_t* signer = NULL;
+
+    result = cardano_blake2b_hash_set_get(signers, i, &signer);
+    cardano_blake2b_hash_unref(&signer);
+
+    if ((result == CARDANO_SUCCESS) && !_cardano_blake2b_hash_set_has(provided, signer))
+    {
+      ++report->missing_signer_count;
+    }
+  }
+
+  if (report->missing_signer_count > 0U)
+  {
+    report->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_MISSING_VKEY_WITNESSES;
+  }
+
+  cardano_blake2b_hash_set_unref(&signers);
+
+  return result;
+}
+
+/* DEFINITIONS ***************************************************************/
+
+const char*
+cardano_phase1_violation_to_string(const cardano_phase1_violation_t violation)
+{
+  const char* message;
+
+  switch (violation)
+  {
+    case CARDANO_PHASE1_VIOLATION_INPUT_SET_EMPTY:
+      message = "Phase-1 Violation: Input Set Empty";
+      break;
+    case CARDANO_PHASE1_VIOLATION_BAD_INPUTS:
+      message = "Phase-1 Violation: Bad Inputs";
+      break;
+    case CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL:
+      message = "Phase-1 Violation: Fee Too Small";
+      break;
+    case CARDANO_PHASE1_VIOLATION_VALUE_NOT_CONSERVED:
+      message = "Phase-1 Violation: Value Not Conserved";
+      break;
+    case CARDANO_PHASE1_VIOLATION_OUTPUT_TOO_SMALL:
+      message = "Phase-1 Violation: Output Too Small";
+      break;
+    case CARDANO_PHASE1_VIOLATION_OUTPUT_VALUE_TOO_LARGE:
+      message = "Phase-1 Violation: Output Value Too Large";
+      break;
+    case CARDANO_PHASE1_VIOLATION_MAX_TX_SIZE_EXCEEDED:
+      message = "Phase-1 Violation: Max Transaction Size Exceeded";
+      break;
+    case CARDANO_PHASE1_VIOLATION_EX_UNITS_TOO_BIG:
+      message = "Phase-1 Violation: Execution Units Too Big";
+      break;
+    case CARDANO_PHASE1_VIOLATION_OUTSIDE_VALIDITY_INTERVAL:
+      message = "Phase-1 Violation: Outside Validity Interval";
+      break;
+    case CARDANO_PHASE1_VIOLATION_NO_COLLATERAL_INPUTS:
+      message = "Phase-1 Violation: No Collateral Inputs";
+      break;
+    case CARDANO_PHASE1_VIOLATION_TOO_MANY_COLLATERAL_INPUTS:
+      message = "Phase-1 Violation: Too Many Collateral Inputs";
+      break;
+    case CARDANO_PHASE1_VIOLATION_INSUFFICIENT_COLLATERAL:
+      message = "Phase-1 Violation: Insufficient Collateral";
+      break;
+    case CARDANO_PHASE1_VIOLATION_INCORRECT_TOTAL_COLLATERAL:
+      message = "Phase-1 Violation: Incorrect Total Collateral";
+      break;
+    case CARDANO_PHASE1_VIOLATION_MISSING_VKEY_WITNESSES:
+      message = "Phase-1 Violation: Missing VKey Witnesses";
+      break;
+    case CARDANO_PHASE1_VIOLATION_NATIVE_SCRIPT_FAILED:
+      message = "Phase-1 Violation: Native Script Failed";
+      break;
+    case CARDANO_PHASE1_VIOLATION_COLLATERAL_CONTAINS_NON_ADA:
+      message = "Phase-1 Violation: Collateral Contains Non-ADA";
+      break;
+    default:
+      message = "Phase-1 Violation: Unknown";
+      break;
+  }
+
+  return message;
+}
+
+cardano_error_t
+cardano_transaction_validate_phase1(
+  cardano_transaction_t*              transaction,
+  cardano_utxo_list_t*                resolved_inputs,
+  cardano_protocol_parameters_t*      protocol_params,
+  const uint64_t                      current_slot,
+  cardano_phase1_validation_result_t* result)
+{
+  if ((transaction == NULL) || (resolved_inputs == NULL) || (protocol_params == NULL) || (result == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  CARDANO_UNUSED(memset(result, 0, sizeof(cardano_phase1_validation_result_t)));
+
+  cardano_utxo_list_t* fee_inputs = NULL;
+  utxo_index_t         index      = { NULL, 0U };
+  bool                 resolved   = true;
+
+  cardano_error_t error = build_utxo_index(resolved_inputs, &index);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  error = cardano_utxo_list_new(&fee_inputs);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    free_utxo_index(&index);
+
+    return error;
+  }
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(transaction);
+  cardano_transaction_body_unref(&body);
+
+  cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(body);
+  cardano_transaction_input_set_unref(&inputs);
+
+  cardano_transaction_input_set_t* reference_inputs = cardano_transaction_body_get_reference_inputs(body);
+  cardano_transaction_input_set_unref(&reference_inputs);
+
+  if (cardano_transaction_input_set_get_length(inputs) == 0U)
+  {
+    result->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_INPUT_SET_EMPTY;
+  }
+
+  error = resolve_inputs(inputs, &index, fee_inputs, NULL, &resolved);
+
+  if (error == CARDANO_SUCCESS)
+  {
+    error = resolve_inputs(reference_inputs, &index, fee_inputs, NULL, &resolved);
+  }
+
+  if (!resolved)
+  {
+    result->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_BAD_INPUTS;
+  }
+
+  if (error == CARDANO_SUCCESS)
+  {
+    error = cardano_get_serialized_transaction_size(transaction, &result->tx_size);
+  }
+
+  if ((error == CARDANO_SUCCESS) && ((uint64_t)result->tx_size > cardano_protocol_parameters_get_max_tx_size(protocol_params)))
+  {
+    result->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_MAX_TX_SIZE_EXCEEDED;
+  }
+
+  if ((error == CARDANO_SUCCESS) && resolved)
+  {
+    bool is_balanced = false;
+
+    error = cardano_compute_transaction_fee(transaction, fee_inputs, protocol_params, &result->min_fee);
+
+    if ((error == CARDANO_SUCCESS) && (cardano_transaction_body_get_fee(body) < result->min_fee))
+    {
+      result->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL;
+    }
+
+    if (error == CARDANO_SUCCESS)
+    {
+      error = cardano_is_transaction_balanced(transaction, resolved_inputs, protocol_params, &is_balanced);
+    }
+
+    if ((error == CARDANO_SUCCESS) && !is_balanced)
+    {
+      result->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_VALUE_NOT_CONSERVED;
+    }
+  }
+
+  cardano_utxo_list_unref(&fee_inputs);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    free_utxo_index(&index);
+
+    return error;
+  }
+
+  cardano_transaction_output_list_t* outputs = cardano_transaction_body_get_outputs(body);
+  cardano_transaction_output_list_unref(&outputs);
+
+  error = check_outputs(outputs, protocol_params, result);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    free_utxo_index(&index);
+
+    return error;
+  }
+
+  const uint64_t* invalid_before = cardano_transaction_body_get_invalid_before(body);
+  const uint64_t* invalid_after  = cardano_transaction_body_get_invalid_after(body);
+
+  if (((invalid_before != NULL) && (current_slot < *invalid_before)) || ((invalid_after != NULL) && (current_slot >= *invalid_after)))
+  {
+    result->violations |= (uint32_t)CARDANO_PHASE1_VIOLATION_OUTSIDE_VALIDITY_INTERVAL;
+  }
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(transaction);
+  cardano_witness_set_unref(&witness_set);
+
+  cardano_redeemer_list_t* redeemers = cardano_witness_set_get_redeemers(witness_set);
+  cardano_redeemer_list_unref(&redeemers);
+
+  if (cardano_redeemer_list_get_length(redeemers) > 0U)
+  {
+    error = check_scripts(body, redeemers, &index, protocol_params, result);
+  }
+
+  free_utxo_index(&index);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  cardano_blake2b_hash_set_t* provided = NULL;
+
+  error = collect_vkey_hashes(transaction, &provided);
+
+  if (error == CARDANO_SUCCESS)
+  {
+    error = check_native_scripts(transaction, provided, result);
+  }
+
+  if ((error == CARDANO_SUCCESS) && ((result->violations & (uint32_t)CARDANO_PHASE1_VIOLATION_BAD_INPUTS) == 0U))
+  {
+    error = check_signers(transaction, resolved_inputs, provided, result);
+  }
+
+  cardano_blake2b_hash_set_unref(&provided);
+
+  return error;
+}
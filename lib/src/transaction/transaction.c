@@ -22,6 +22,8 @@
 /* INCLUDES ******************************************************************/
 
 #include <cardano/certs/certificate_set.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signature.h>
 #include <cardano/object.h>
 #include <cardano/transaction/transaction.h>
 #include <cardano/voting_procedures/voter_list.h>
@@ -684,51 +686,193 @@ cardano_transaction_get_last_error(const cardano_transaction_t* transaction)
 }
 
 /**
- * \brief Finds the position of an input matching the given id and index within an input set.
+ * \brief Verifies one witness signature over the transaction id and releases the key and signature.
  *
- * \param[in]  inputs     The input set to search.
- * \param[in]  id         The transaction id to match.
- * \param[in]  utxo_index The output index to match.
- * \param[out] index      The position of the matching input.
+ * \param[in] vkey The witness verification key, or NULL. Released by this function.
+ * \param[in] signature The witness signature, or NULL. Released by this function.
+ * \param[in] tx_id The transaction id the signature must cover.
  *
- * \return \ref CARDANO_SUCCESS if found, or \ref CARDANO_ERROR_ELEMENT_NOT_FOUND.
+ * \return \c true if both parts are present and the signature verifies; otherwise \c false.
  */
-static cardano_error_t
-find_in_input_set(
-  cardano_transaction_input_set_t* inputs,
-  cardano_blake2b_hash_t*          id,
-  const uint64_t                   utxo_index,
-  uint64_t*                        index)
+static bool
+verify_witness_signature(
+  cardano_ed25519_public_key_t* vkey,
+  cardano_ed25519_signature_t*  signature,
+  const cardano_blake2b_hash_t* tx_id)
 {
-  const size_t length = cardano_transaction_input_set_get_length(inputs);
+  bool is_valid = false;
 
-  for (size_t i = 0U; i < length; ++i)
+  if ((vkey != NULL) && (signature != NULL))
+  {
+    is_valid = cardano_ed25519_public_verify(
+      vkey,
+      signature,
+      cardano_blake2b_hash_get_data(tx_id),
+      cardano_blake2b_hash_get_bytes_size(tx_id));
+  }
+
+  cardano_ed25519_public_key_unref(&vkey);
+  cardano_ed25519_signature_unref(&signature);
+
+  return is_valid;
+}
+
+cardano_error_t
+cardano_transaction_verify_vkey_witnesses(
+  cardano_transaction_t* transaction,
+  bool*                  vkey_valid,
+  const size_t           vkey_valid_size,
+  bool*                  bootstrap_valid,
+  const size_t           bootstrap_valid_size,
+  size_t*                invalid_count)
+{
+  if ((transaction == NULL) || (invalid_count == NULL))
   {
-    cardano_transaction_input_t* input = NULL;
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_vkey_witness_set_t*      vkeys      = cardano_witness_set_get_vkeys(transaction->witness_set);
+  cardano_bootstrap_witness_set_t* bootstraps = cardano_witness_set_get_bootstrap(transaction->witness_set);
 
-    cardano_error_t result = cardano_transaction_input_set_get(inputs, i, &input);
+  cardano_vkey_witness_set_unref(&vkeys);
+  cardano_bootstrap_witness_set_unref(&bootstraps);
+
+  const size_t vkey_count      = cardano_vkey_witness_set_get_length(vkeys);
+  const size_t bootstrap_count = cardano_bootstrap_witness_set_get_length(bootstraps);
+
+  if (((vkey_valid != NULL) && (vkey_valid_size < vkey_count)) || ((bootstrap_valid != NULL) && (bootstrap_valid_size < bootstrap_count)))
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  if ((vkey_count == 0U) && (bootstrap_count == 0U))
+  {
+    *invalid_count = 0U;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_blake2b_hash_t* tx_id = cardano_transaction_get_id(transaction);
+
+  if (tx_id == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  size_t invalid = 0U;
+
+  for (size_t i = 0U; i < vkey_count; ++i)
+  {
+    cardano_vkey_witness_t* witness = NULL;
+
+    cardano_error_t result = cardano_vkey_witness_set_get(vkeys, i, &witness);
 
     if (result != CARDANO_SUCCESS)
     {
+      cardano_blake2b_hash_unref(&tx_id);
+
       return result;
     }
 
-    cardano_blake2b_hash_t* input_id = cardano_transaction_input_get_id(input);
+    const bool is_valid = verify_witness_signature(cardano_vkey_witness_get_vkey(witness), cardano_vkey_witness_get_signature(witness), tx_id);
 
-    const bool matches = cardano_blake2b_hash_equals(input_id, id) && (cardano_transaction_input_get_index(input) == utxo_index);
+    cardano_vkey_witness_unref(&witness);
 
-    cardano_blake2b_hash_unref(&input_id);
-    cardano_transaction_input_unref(&input);
+    if (vkey_valid != NULL)
+    {
+      vkey_valid[i] = is_valid;
+    }
 
-    if (matches)
+    invalid += is_valid ? 0U : 1U;
+  }
+
+  for (size_t i = 0U; i < bootstrap_count; ++i)
+  {
+    cardano_bootstrap_witness_t* witness = NULL;
+
+    cardano_error_t result = cardano_bootstrap_witness_set_get(bootstraps, i, &witness);
+
+    if (result != CARDANO_SUCCESS)
     {
-      *index = i;
+      cardano_blake2b_hash_unref(&tx_id);
 
-      return CARDANO_SUCCESS;
+      return result;
     }
+
+    const bool is_valid = verify_witness_signature(cardano_bootstrap_witness_get_vkey(witness), cardano_bootstrap_witness_get_signature(witness), tx_id);
+
+    cardano_bootstrap_witness_unref(&witness);
+
+    if (bootstrap_valid != NULL)
+    {
+      bootstrap_valid[i] = is_valid;
+    }
+
+    invalid += is_valid ? 0U : 1U;
   }
 
-  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  cardano_blake2b_hash_unref(&tx_id);
+
+  *invalid_count = invalid;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_transaction_verify_vkey_witnesses_many(
+  cardano_transaction_t* const* transactions,
+  const size_t                  count,
+  bool*                         valid)
+{
+  if ((transactions == NULL) || (valid == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    size_t invalid = 0U;
+
+    cardano_error_t result = cardano_transaction_verify_vkey_witnesses(transactions[i], NULL, 0U, NULL, 0U, &invalid);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    valid[i] = (invalid == 0U);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Finds the position of an input matching the given id and index within an input set.
+ *
+ * \param[in]  inputs     The input set to search.
+ * \param[in]  id         The transaction id to match.
+ * \param[in]  utxo_index The output index to match.
+ * \param[out] index      The position of the matching input.
+ *
+ * \return \ref CARDANO_SUCCESS if found, or \ref CARDANO_ERROR_ELEMENT_NOT_FOUND.
+ */
+static cardano_error_t
+find_in_input_set(
+  cardano_transaction_input_set_t* inputs,
+  cardano_blake2b_hash_t*          id,
+  const uint64_t                   utxo_index,
+  uint64_t*                        index)
+{
+  size_t position = 0U;
+
+  const cardano_error_t result = cardano_transaction_input_set_find_index(inputs, id, utxo_index, &position);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *index = (uint64_t)position;
+  }
+
+  return result;
 }
 
 cardano_error_t
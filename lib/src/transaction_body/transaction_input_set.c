@@ -100,6 +100,57 @@ compare_by_input(const cardano_object_t* lhs, const cardano_object_t* rhs, void*
   return cardano_transaction_input_compare(lhs_input, rhs_input);
 }
 
+/**
+ * \brief Compares the input at a position of the set with the input identified by a transaction id and output index.
+ *
+ * \param[in] transaction_input_set The set that holds the input.
+ * \param[in] position The position of the input in the set. Must be in range.
+ * \param[in] id The transaction id to compare against.
+ * \param[in] output_index The output index to compare against.
+ *
+ * \return A negative value if the input sorts before the given one, zero if they are equal,
+ *         and a positive value if it sorts after it.
+ */
+static int32_t
+compare_input_at(
+  const cardano_transaction_input_set_t* transaction_input_set,
+  const size_t                           position,
+  const cardano_blake2b_hash_t*          id,
+  const uint64_t                         output_index)
+{
+  cardano_object_t* object = cardano_array_get(transaction_input_set->array, position);
+
+  assert(object != NULL);
+
+  cardano_transaction_input_t* input    = (cardano_transaction_input_t*)((void*)object);
+  cardano_blake2b_hash_t*      input_id = cardano_transaction_input_get_id(input);
+
+  int32_t comparison = cardano_blake2b_hash_compare(input_id, id);
+
+  if (comparison == 0)
+  {
+    const uint64_t input_index = cardano_transaction_input_get_index(input);
+
+    if (input_index < output_index)
+    {
+      comparison = -1;
+    }
+    else if (input_index > output_index)
+    {
+      comparison = 1;
+    }
+    else
+    {
+      // Do nothing.
+    }
+  }
+
+  cardano_blake2b_hash_unref(&input_id);
+  cardano_object_unref(&object);
+
+  return comparison;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -386,16 +437,55 @@ cardano_transaction_input_set_add(cardano_transaction_input_set_t* transaction_i
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
   const size_t original_size = cardano_array_get_size(transaction_input_set->array);
-  const size_t new_size      = cardano_array_push(transaction_input_set->array, (cardano_object_t*)((void*)element));
+  const size_t new_size      = cardano_array_insert_sorted(transaction_input_set->array, (cardano_object_t*)((void*)element), compare_by_input, NULL);
 
-  assert((original_size + 1U) == new_size);
+  if ((original_size + 1U) != new_size)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
-  CARDANO_UNUSED(original_size);
-  CARDANO_UNUSED(new_size);
+  return CARDANO_SUCCESS;
+}
 
-  cardano_array_sort(transaction_input_set->array, compare_by_input, NULL);
+cardano_error_t
+cardano_transaction_input_set_find_index(
+  const cardano_transaction_input_set_t* transaction_input_set,
+  const cardano_blake2b_hash_t*          id,
+  const uint64_t                         output_index,
+  size_t*                                index)
+{
+  if ((transaction_input_set == NULL) || (id == NULL) || (index == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-  return CARDANO_SUCCESS;
+  const size_t size = cardano_array_get_size(transaction_input_set->array);
+
+  size_t low  = 0U;
+  size_t high = size;
+
+  while (low < high)
+  {
+    const size_t middle = low + ((high - low) / 2U);
+
+    if (compare_input_at(transaction_input_set, middle, id, output_index) < 0)
+    {
+      low = middle + 1U;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  if ((low < size) && (compare_input_at(transaction_input_set, low, id, output_index) == 0))
+  {
+    *index = low;
+
+    return CARDANO_SUCCESS;
+  }
+
+  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
 }
 
 bool
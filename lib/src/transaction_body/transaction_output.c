@@ -676,13 +676,19 @@ cardano_transaction_output_to_cip116_json(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  const char* address = cardano_address_get_string(output->address);
+
+  if (address == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   cardano_json_writer_write_start_object(writer);
   cardano_error_t error = CARDANO_SUCCESS;
 
   cardano_json_writer_write_property_name(writer, "address", 7);
 
-  size_t      addr_len = cardano_address_get_string_size(output->address);
-  const char* address  = cardano_address_get_string(output->address);
+  size_t addr_len = cardano_address_get_string_size(output->address);
 
   cardano_json_writer_write_string(writer, address, cardano_safe_strlen(address, addr_len));
 
@@ -43,6 +43,7 @@
 #include <cardano/certs/vote_delegation_cert.h>
 #include <cardano/certs/vote_registration_delegation_cert.h>
 #include <cardano/common/utxo.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
 
 /* STATIC FUNCTIONS **********************************************************/
 
@@ -1116,4 +1117,82 @@ _cardano_get_unique_signers(
   }
 
   return CARDANO_SUCCESS;
-}
\ No newline at end of file
+}
+
+cardano_error_t
+_cardano_add_native_script_signers(
+  cardano_blake2b_hash_set_t* unique_signers,
+  cardano_transaction_t*      tx)
+{
+  if ((unique_signers == NULL) || (tx == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  cardano_transaction_body_unref(&body);
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(tx);
+  cardano_witness_set_unref(&witness_set);
+
+  cardano_native_script_set_t* scripts = cardano_witness_set_get_native_scripts(witness_set);
+  cardano_native_script_set_unref(&scripts);
+
+  cardano_guard_set_t* guards = cardano_transaction_body_get_guards(body);
+  cardano_guard_set_unref(&guards);
+
+  const uint64_t* invalid_before = cardano_transaction_body_get_invalid_before(body);
+  const uint64_t* invalid_after  = cardano_transaction_body_get_invalid_after(body);
+  const size_t    length         = cardano_native_script_set_get_length(scripts);
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (i < length) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_native_script_t*          script     = NULL;
+    cardano_compiled_native_script_t* compiled   = NULL;
+    cardano_blake2b_hash_set_t*       key_hashes = NULL;
+    cardano_blake2b_hash_set_t*       minimal    = NULL;
+    bool                              satisfied  = false;
+
+    result = cardano_native_script_set_get(scripts, i, &script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_compiled_native_script_new(script, &compiled);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_compiled_native_script_get_key_hashes(compiled, &key_hashes);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_compiled_native_script_evaluate(compiled, key_hashes, invalid_before, invalid_after, guards, &satisfied, &minimal);
+    }
+
+    const size_t minimal_count = cardano_blake2b_hash_set_get_length(minimal);
+
+    for (size_t j = 0U; (j < minimal_count) && (result == CARDANO_SUCCESS); ++j)
+    {
+      cardano_blake2b_hash_t* hash = NULL;
+
+      result = cardano_blake2b_hash_set_get(minimal, j, &hash);
+
+      if ((result == CARDANO_SUCCESS) && !_cardano_blake2b_hash_set_has(unique_signers, hash))
+      {
+        result = cardano_blake2b_hash_set_add(unique_signers, hash);
+      }
+
+      cardano_blake2b_hash_unref(&hash);
+    }
+
+    cardano_blake2b_hash_set_unref(&minimal);
+    cardano_blake2b_hash_set_unref(&key_hashes);
+    cardano_compiled_native_script_unref(&compiled);
+    cardano_native_script_unref(&script);
+  }
+
+  return result;
+}
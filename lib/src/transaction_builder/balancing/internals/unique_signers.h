@@ -318,4 +318,24 @@ _cardano_get_unique_signers(
   cardano_utxo_list_t*         resolved_inputs,
   cardano_blake2b_hash_set_t** unique_signers);
 
+/**
+ * \brief Adds the key hashes needed to satisfy the native scripts in a transaction's witness set.
+ *
+ * Each native script is evaluated as if every key it mentions signed the transaction, against the transaction's
+ * validity interval and guards, and the minimal satisfying signers are added to `unique_signers`. This gives the
+ * exact number of witnesses a native-script input needs instead of one per key the script mentions. Scripts that
+ * cannot be satisfied add no signers.
+ *
+ * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the key
+ *                               hashes will be added. This parameter must not be NULL.
+ * \param[in] tx A pointer to an initialized \ref cardano_transaction_t object. This parameter must not be NULL.
+ *
+ * \return \ref CARDANO_SUCCESS if the key hashes were added, or an appropriate error code indicating the failure reason,
+ *         such as \ref CARDANO_ERROR_POINTER_IS_NULL if `unique_signers` or `tx` is NULL.
+ */
+cardano_error_t
+_cardano_add_native_script_signers(
+  cardano_blake2b_hash_set_t* unique_signers,
+  cardano_transaction_t*      tx);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_SIGNERS_COUNT_H
\ No newline at end of file
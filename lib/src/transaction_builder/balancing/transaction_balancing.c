@@ -246,29 +246,51 @@ set_transaction_inputs(
     }
   }
 
-  if (input_to_redeemer_map != NULL)
+  // Each redeemer points at its input by the position of the input in the sorted set, so a single pass over the
+  // redeemers with a binary search per input is enough to fix up every index.
+  const size_t num_redeemers = cardano_input_to_redeemer_map_get_length(input_to_redeemer_map);
+
+  for (size_t i = 0U; i < num_redeemers; ++i)
   {
-    for (size_t i = 0U; i < num_inputs; ++i)
+    cardano_transaction_input_t* input    = NULL;
+    cardano_redeemer_t*          redeemer = NULL;
+
+    result = cardano_input_to_redeemer_map_get_key_value_at(input_to_redeemer_map, i, &input, &redeemer);
+
+    if (result != CARDANO_SUCCESS)
     {
-      cardano_transaction_input_t* input = NULL;
+      cardano_transaction_input_set_unref(&inputs);
 
-      result = cardano_transaction_input_set_get(inputs, i, &input);
-      cardano_transaction_input_unref(&input);
+      return result;
+    }
 
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_transaction_input_set_unref(&inputs);
-        return result;
-      }
+    cardano_blake2b_hash_t* id       = cardano_transaction_input_get_id(input);
+    size_t                  position = 0U;
 
-      result = cardano_input_to_redeemer_map_update_redeemer_index(input_to_redeemer_map, input, i);
+    result = cardano_transaction_input_set_find_index(inputs, id, cardano_transaction_input_get_index(input), &position);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_transaction_input_set_unref(&inputs);
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_redeemer_set_index(redeemer, position);
+    }
+    else if (result == CARDANO_ERROR_ELEMENT_NOT_FOUND)
+    {
+      result = CARDANO_SUCCESS;
+    }
+    else
+    {
+      // Do nothing.
+    }
 
-        return result;
-      }
+    cardano_blake2b_hash_unref(&id);
+    cardano_transaction_input_unref(&input);
+    cardano_redeemer_unref(&redeemer);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_transaction_input_set_unref(&inputs);
+
+      return result;
     }
   }
 
@@ -765,8 +787,14 @@ cardano_balance_transaction(
 
     result = _cardano_get_unique_signers(unbalanced_tx, resolved_inputs, &unique_signers);
 
+    if (result == CARDANO_SUCCESS)
+    {
+      result = _cardano_add_native_script_signers(unique_signers, unbalanced_tx);
+    }
+
     if (result != CARDANO_SUCCESS)
     {
+      cardano_blake2b_hash_set_unref(&unique_signers);
       cardano_transaction_output_list_unref(&shallow_cloned_outputs);
       cardano_utxo_list_unref(&resolved_inputs);
       cardano_utxo_list_unref(&selection);
@@ -290,6 +290,11 @@ select(
   const char*    change_address_str  = cardano_address_get_string(change_address);
   const uint64_t coins_per_utxo_byte = cardano_protocol_parameters_get_ada_per_utxo_byte(protocol_params);
 
+  if (change_address_str == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   *change_outputs = NULL;
 
   cardano_error_t result = cardano_coin_selector_bridge_select(
@@ -23,7 +23,11 @@
 
 #include <cardano/assets/asset_id.h>
 #include <cardano/assets/asset_id_map.h>
-#include <cardano/cbor/cbor_writer.h>
+#include <cardano/assets/asset_name.h>
+#include <cardano/assets/asset_name_map.h>
+#include <cardano/assets/multi_asset.h>
+#include <cardano/assets/policy_id_list.h>
+#include <cardano/crypto/blake2b_hash.h>
 
 #include "./value_splitting.h"
 
@@ -31,8 +35,267 @@
 
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+// The largest ada quantity that can appear in a transaction output: the total lovelace
+// supply (45 billion ada). Used to assess sizes conservatively before the final ada
+// quantity of a change output is known.
+static const uint64_t MAX_OUTPUT_ADA_QUANTITY = 45000000000000000U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The size-relevant shape of one asset of a flattened asset map.
+ */
+typedef struct value_asset_t
+{
+    size_t  index;
+    size_t  policy_id_size;
+    size_t  asset_name_size;
+    int64_t quantity;
+    bool    new_policy;
+} value_asset_t;
+
+/**
+ * \brief A half-open range of flattened assets awaiting assessment.
+ */
+typedef struct asset_range_t
+{
+    size_t start;
+    size_t end;
+} asset_range_t;
+
 /* STATIC FUNCTIONS **********************************************************/
 
+/**
+ * \brief Gets the size of the CBOR head (initial byte plus argument) that encodes the given argument.
+ *
+ * \param[in] argument The argument of the head: an unsigned value, a length or an element count.
+ *
+ * \return The size of the head, in bytes.
+ */
+static size_t
+cbor_head_size(const uint64_t argument)
+{
+  if (argument < 24U)
+  {
+    return 1U;
+  }
+
+  if (argument <= 0xFFU)
+  {
+    return 2U;
+  }
+
+  if (argument <= 0xFFFFU)
+  {
+    return 3U;
+  }
+
+  if (argument <= 0xFFFFFFFFU)
+  {
+    return 5U;
+  }
+
+  return 9U;
+}
+
+/**
+ * \brief Gets the size of a CBOR signed integer.
+ *
+ * \param[in] value The integer.
+ *
+ * \return The size of the encoded integer, in bytes.
+ */
+static size_t
+cbor_signed_int_size(const int64_t value)
+{
+  if (value >= 0)
+  {
+    return cbor_head_size((uint64_t)value);
+  }
+
+  return cbor_head_size((uint64_t)(-(value + 1)));
+}
+
+/**
+ * \brief Computes the serialized size of a value, as if its coin were the given quantity.
+ *
+ * \param[in]  value The value to measure.
+ * \param[in]  coin  The coin quantity to measure the value with.
+ * \param[out] size  The serialized size, in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+compute_value_size(cardano_value_t* value, const uint64_t coin, size_t* size)
+{
+  cardano_value_size_t value_size;
+
+  _cardano_coin_selection_value_size_init(&value_size, coin);
+
+  cardano_multi_asset_t* multi_asset = cardano_value_get_multi_asset(value);
+
+  if (multi_asset == NULL)
+  {
+    *size = _cardano_coin_selection_value_size_get(&value_size);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_policy_id_list_t* policies = NULL;
+
+  cardano_error_t result = cardano_multi_asset_get_keys(multi_asset, &policies);
+
+  const size_t policy_count = (result == CARDANO_SUCCESS) ? cardano_policy_id_list_get_length(policies) : 0U;
+
+  for (size_t i = 0U; (i < policy_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_blake2b_hash_t*   policy_id = NULL;
+    cardano_asset_name_map_t* assets    = NULL;
+
+    result = cardano_policy_id_list_get(policies, i, &policy_id);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_multi_asset_get_assets(multi_asset, policy_id, &assets);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      const size_t policy_id_size = cardano_blake2b_hash_get_bytes_size(policy_id);
+      const size_t asset_count    = cardano_asset_name_map_get_length(assets);
+
+      for (size_t j = 0U; (j < asset_count) && (result == CARDANO_SUCCESS); ++j)
+      {
+        cardano_asset_name_t* asset_name = NULL;
+        int64_t               quantity   = 0;
+
+        result = cardano_asset_name_map_get_key_value_at(assets, j, &asset_name, &quantity);
+
+        if (result == CARDANO_SUCCESS)
+        {
+          _cardano_coin_selection_value_size_add_asset(
+            &value_size,
+            j == 0U,
+            policy_id_size,
+            cardano_asset_name_get_bytes_size(asset_name),
+            quantity);
+
+          cardano_asset_name_unref(&asset_name);
+        }
+      }
+    }
+
+    cardano_asset_name_map_unref(&assets);
+    cardano_blake2b_hash_unref(&policy_id);
+  }
+
+  cardano_policy_id_list_unref(&policies);
+  cardano_multi_asset_unref(&multi_asset);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *size = _cardano_coin_selection_value_size_get(&value_size);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Flattens the non-lovelace, non-zero assets of an asset map into their size-relevant shapes.
+ *
+ * The asset map is ordered by asset id, so the assets of each policy are contiguous, and any
+ * contiguous range of the result serializes with its policies in the same order.
+ *
+ * \param[in]  assets The flattened asset map of the source value.
+ * \param[out] items  The flattened assets. Must hold as many entries as \p assets.
+ * \param[out] count  The number of flattened assets written.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+flatten_assets(cardano_asset_id_map_t* assets, value_asset_t* items, size_t* count)
+{
+  const size_t asset_count = cardano_asset_id_map_get_length(assets);
+
+  cardano_blake2b_hash_t* previous_policy = NULL;
+  cardano_error_t         result          = CARDANO_SUCCESS;
+
+  *count = 0U;
+
+  for (size_t i = 0U; (i < asset_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_asset_id_t* asset_id = NULL;
+    int64_t             quantity = 0;
+
+    result = cardano_asset_id_map_get_key_value_at(assets, i, &asset_id, &quantity);
+
+    if ((result == CARDANO_SUCCESS) && !cardano_asset_id_is_lovelace(asset_id) && (quantity != 0))
+    {
+      cardano_blake2b_hash_t* policy_id  = cardano_asset_id_get_policy_id(asset_id);
+      cardano_asset_name_t*   asset_name = cardano_asset_id_get_asset_name(asset_id);
+
+      if ((policy_id == NULL) || (asset_name == NULL))
+      {
+        result = CARDANO_ERROR_POINTER_IS_NULL;
+      }
+      else
+      {
+        value_asset_t* item = &items[*count];
+
+        item->index           = i;
+        item->policy_id_size  = cardano_blake2b_hash_get_bytes_size(policy_id);
+        item->asset_name_size = cardano_asset_name_get_bytes_size(asset_name);
+        item->quantity        = quantity;
+        item->new_policy      = (previous_policy == NULL) || !cardano_blake2b_hash_equals(previous_policy, policy_id);
+
+        ++(*count);
+
+        cardano_blake2b_hash_unref(&previous_policy);
+        previous_policy = policy_id;
+        policy_id       = NULL;
+      }
+
+      cardano_asset_name_unref(&asset_name);
+      cardano_blake2b_hash_unref(&policy_id);
+    }
+
+    cardano_asset_id_unref(&asset_id);
+  }
+
+  cardano_blake2b_hash_unref(&previous_policy);
+
+  return result;
+}
+
+/**
+ * \brief Indicates whether a value holding a range of flattened assets would be oversized.
+ *
+ * \param[in] items          The flattened assets.
+ * \param[in] range          The range of assets the value would hold.
+ * \param[in] max_value_size The maximum serialized size of an output value, in bytes.
+ *
+ * \return True if the value, measured with the largest possible ada quantity, exceeds the maximum.
+ */
+static bool
+range_is_oversized(const value_asset_t* items, const asset_range_t range, const uint64_t max_value_size)
+{
+  cardano_value_size_t size;
+
+  _cardano_coin_selection_value_size_init(&size, MAX_OUTPUT_ADA_QUANTITY);
+
+  for (size_t i = range.start; i < range.end; ++i)
+  {
+    // The first asset of a range always opens a policy, even when it continues the previous one's.
+    const bool new_policy = (i == range.start) || items[i].new_policy;
+
+    _cardano_coin_selection_value_size_add_asset(&size, new_policy, items[i].policy_id_size, items[i].asset_name_size, items[i].quantity);
+  }
+
+  return _cardano_coin_selection_value_size_get(&size) > max_value_size;
+}
+
 /**
  * \brief Appends a value to a part list, taking ownership of the reference.
  *
@@ -72,21 +335,6 @@ part_list_append(cardano_value_part_list_t* parts, cardano_value_t* value)
   return CARDANO_SUCCESS;
 }
 
-/**
- * \brief Removes and returns the last value of a part list.
- *
- * \param[in,out] parts The list to pop from. Must not be empty.
- *
- * \return The removed value. Ownership passes to the caller.
- */
-static cardano_value_t*
-part_list_pop(cardano_value_part_list_t* parts)
-{
-  --parts->size;
-
-  return parts->items[parts->size];
-}
-
 /**
  * \brief Builds a value holding the given slice of another value's assets, with a zero coin.
  *
@@ -145,86 +393,69 @@ build_asset_slice(
   return result;
 }
 
-/**
- * \brief Splits an asset-only value in half, appending both halves to the pending list.
- *
- * \param[in]     value   The asset-only value to split. Released by this function.
- * \param[in,out] pending The list receiving the two halves.
- *
- * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
- */
-static cardano_error_t
-split_in_half(cardano_value_t* value, cardano_value_part_list_t* pending)
-{
-  cardano_asset_id_map_t* assets = cardano_value_as_assets_map(value);
+/* DEFINITIONS ****************************************************************/
 
-  if (assets == NULL)
+void
+_cardano_coin_selection_value_parts_free(cardano_value_part_list_t* parts)
+{
+  for (size_t i = 0U; i < parts->size; ++i)
   {
-    cardano_value_unref(&value);
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    cardano_value_unref(&parts->items[i]);
   }
 
-  const size_t asset_count = cardano_asset_id_map_get_length(assets);
-  const size_t half        = asset_count / 2U;
-
-  cardano_value_t* first_half  = NULL;
-  cardano_value_t* second_half = NULL;
-
-  cardano_error_t result = build_asset_slice(assets, 0U, half, &first_half);
+  _cardano_free(parts->items);
 
-  if (result == CARDANO_SUCCESS)
-  {
-    result = build_asset_slice(assets, half, asset_count, &second_half);
-  }
+  parts->items    = NULL;
+  parts->size     = 0U;
+  parts->capacity = 0U;
+}
 
-  cardano_asset_id_map_unref(&assets);
-  cardano_value_unref(&value);
+void
+_cardano_coin_selection_value_size_init(cardano_value_size_t* size, const uint64_t coin)
+{
+  size->coin          = coin;
+  size->policy_count  = 0U;
+  size->policy_assets = 0U;
+  size->asset_bytes   = 0U;
+}
 
-  if (result == CARDANO_SUCCESS)
+void
+_cardano_coin_selection_value_size_add_asset(
+  cardano_value_size_t* size,
+  const bool            new_policy,
+  const size_t          policy_id_size,
+  const size_t          asset_name_size,
+  const int64_t         quantity)
+{
+  if (new_policy || (size->policy_count == 0U))
   {
-    result = part_list_append(pending, first_half);
-
-    if (result != CARDANO_SUCCESS)
+    // Close the asset name map of the previous policy, then open a new one.
+    if (size->policy_count > 0U)
     {
-      cardano_value_unref(&first_half);
+      size->asset_bytes += cbor_head_size(size->policy_assets);
     }
-  }
 
-  if (result == CARDANO_SUCCESS)
-  {
-    result = part_list_append(pending, second_half);
+    size->asset_bytes += cbor_head_size(policy_id_size) + policy_id_size;
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_value_unref(&second_half);
-      second_half = NULL;
-    }
+    ++size->policy_count;
+    size->policy_assets = 0U;
   }
 
-  if ((result != CARDANO_SUCCESS) && (second_half != NULL) && (first_half != NULL))
-  {
-    cardano_value_unref(&second_half);
-  }
+  size->asset_bytes += cbor_head_size(asset_name_size) + asset_name_size + cbor_signed_int_size(quantity);
 
-  return result;
+  ++size->policy_assets;
 }
 
-/* DEFINITIONS ****************************************************************/
-
-void
-_cardano_coin_selection_value_parts_free(cardano_value_part_list_t* parts)
+size_t
+_cardano_coin_selection_value_size_get(const cardano_value_size_t* size)
 {
-  for (size_t i = 0U; i < parts->size; ++i)
+  // A value without assets is encoded as its bare coin; otherwise as [coin, { policy => { name => quantity } }].
+  if (size->policy_count == 0U)
   {
-    cardano_value_unref(&parts->items[i]);
+    return cbor_head_size(size->coin);
   }
 
-  _cardano_free(parts->items);
-
-  parts->items    = NULL;
-  parts->size     = 0U;
-  parts->capacity = 0U;
+  return 1U + cbor_head_size(size->coin) + cbor_head_size(size->policy_count) + size->asset_bytes + cbor_head_size(size->policy_assets);
 }
 
 cardano_error_t
@@ -233,11 +464,6 @@ _cardano_coin_selection_value_is_oversized(
   const uint64_t   max_value_size,
   bool*            is_oversized)
 {
-  // The largest ada quantity that can appear in a transaction output: the total lovelace
-  // supply (45 billion ada). Used to assess sizes conservatively before the final ada
-  // quantity of a change output is known.
-  static const int64_t max_output_ada_quantity = 45000000000000000;
-
   if ((value == NULL) || (is_oversized == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -250,39 +476,13 @@ _cardano_coin_selection_value_is_oversized(
     return CARDANO_SUCCESS;
   }
 
-  const int64_t original_coin = cardano_value_get_coin(value);
-
-  cardano_error_t result = cardano_value_set_coin(value, max_output_ada_quantity);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    return result;
-  }
-
-  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
-
-  if (writer == NULL)
-  {
-    const cardano_error_t rollback_result = cardano_value_set_coin(value, original_coin);
-    CARDANO_UNUSED(rollback_result);
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
-  result = cardano_value_to_cbor(value, writer);
-
-  if (result == CARDANO_SUCCESS)
-  {
-    *is_oversized = cardano_cbor_writer_get_encode_size(writer) > max_value_size;
-  }
-
-  cardano_cbor_writer_unref(&writer);
+  size_t size = 0U;
 
-  const cardano_error_t restore_result = cardano_value_set_coin(value, original_coin);
+  const cardano_error_t result = compute_value_size(value, MAX_OUTPUT_ADA_QUANTITY, &size);
 
   if (result == CARDANO_SUCCESS)
   {
-    result = restore_result;
+    *is_oversized = size > max_value_size;
   }
 
   return result;
@@ -306,84 +506,74 @@ _cardano_coin_selection_split_value_assets(
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  const size_t asset_count = cardano_asset_id_map_get_length(assets);
-
-  cardano_value_t* asset_only = NULL;
+  const size_t map_length = cardano_asset_id_map_get_length(assets);
 
-  cardano_error_t result = build_asset_slice(assets, 0U, asset_count, &asset_only);
+  // Every split yields at least one more final part, so the pending stack never holds more
+  // ranges than there are assets, plus the initial one.
+  value_asset_t* items   = (value_asset_t*)_cardano_malloc((map_length + 1U) * sizeof(value_asset_t));
+  asset_range_t* pending = (asset_range_t*)_cardano_malloc((map_length + 1U) * sizeof(asset_range_t));
 
-  cardano_asset_id_map_unref(&assets);
+  size_t          item_count = 0U;
+  cardano_error_t result     = ((items == NULL) || (pending == NULL)) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
 
-  if (result != CARDANO_SUCCESS)
+  if (result == CARDANO_SUCCESS)
   {
-    return result;
+    result = flatten_assets(assets, items, &item_count);
   }
 
-  // Work through a pending stack instead of recursing: pop a candidate, and either accept it
-  // as a final part or split it in half and push both halves back for re-assessment.
-  cardano_value_part_list_t pending = { NULL, 0U, 0U };
+  // Work through a pending stack of asset ranges instead of recursing: pop a candidate, and either
+  // accept it as a final part or split it in half and push both halves back for re-assessment.
+  size_t pending_count = 0U;
 
-  result = part_list_append(&pending, asset_only);
-
-  if (result != CARDANO_SUCCESS)
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_value_unref(&asset_only);
+    pending[0].start = 0U;
+    pending[0].end   = item_count;
+    pending_count    = 1U;
   }
 
-  while ((result == CARDANO_SUCCESS) && (pending.size > 0U))
+  while ((result == CARDANO_SUCCESS) && (pending_count > 0U))
   {
-    cardano_value_t* candidate = part_list_pop(&pending);
-
-    bool is_oversized = false;
+    --pending_count;
 
-    result = _cardano_coin_selection_value_is_oversized(candidate, max_value_size, &is_oversized);
+    const asset_range_t candidate       = pending[pending_count];
+    const size_t        candidate_count = candidate.end - candidate.start;
 
-    if (result == CARDANO_SUCCESS)
+    if ((max_value_size != 0U) && (candidate_count >= 2U) && range_is_oversized(items, candidate, max_value_size))
     {
-      size_t candidate_assets = 0U;
+      const size_t half = candidate.start + (candidate_count / 2U);
 
-      if (is_oversized)
-      {
-        cardano_asset_id_map_t* candidate_map = cardano_value_as_assets_map(candidate);
+      pending[pending_count].start      = candidate.start;
+      pending[pending_count].end        = half;
+      pending[pending_count + 1U].start = half;
+      pending[pending_count + 1U].end   = candidate.end;
 
-        if (candidate_map == NULL)
-        {
-          result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-        }
-        else
-        {
-          candidate_assets = cardano_asset_id_map_get_length(candidate_map);
+      pending_count += 2U;
+    }
+    else
+    {
+      const size_t start = (candidate_count == 0U) ? 0U : items[candidate.start].index;
+      const size_t end   = (candidate_count == 0U) ? 0U : (items[candidate.end - 1U].index + 1U);
 
-          cardano_asset_id_map_unref(&candidate_map);
-        }
-      }
+      cardano_value_t* part = NULL;
+
+      result = build_asset_slice(assets, start, end, &part);
 
       if (result == CARDANO_SUCCESS)
       {
-        if (is_oversized && (candidate_assets >= 2U))
-        {
-          result    = split_in_half(candidate, &pending);
-          candidate = NULL;
-        }
-        else
-        {
-          result = part_list_append(parts, candidate);
+        result = part_list_append(parts, part);
 
-          if (result == CARDANO_SUCCESS)
-          {
-            candidate = NULL;
-          }
+        if (result != CARDANO_SUCCESS)
+        {
+          cardano_value_unref(&part);
         }
       }
     }
-
-    if (candidate != NULL)
-    {
-      cardano_value_unref(&candidate);
-    }
   }
 
-  _cardano_coin_selection_value_parts_free(&pending);
+  _cardano_free(pending);
+  _cardano_free(items);
+  cardano_asset_id_map_unref(&assets);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -40,6 +40,20 @@ typedef struct cardano_value_part_list_t
     size_t            capacity;
 } cardano_value_part_list_t;
 
+/**
+ * \brief Running CBOR size of a value, built up one asset at a time.
+ *
+ * Assets must be added grouped by policy, in the order they are serialized. The size is computed
+ * from the widths of the CBOR heads alone, so no value or writer is ever materialized.
+ */
+typedef struct cardano_value_size_t
+{
+    uint64_t coin;
+    size_t   policy_count;
+    size_t   policy_assets;
+    size_t   asset_bytes;
+} cardano_value_size_t;
+
 /* DECLARATIONS **************************************************************/
 
 /**
@@ -50,6 +64,42 @@ typedef struct cardano_value_part_list_t
 void
 _cardano_coin_selection_value_parts_free(cardano_value_part_list_t* parts);
 
+/**
+ * \brief Starts the size of a value that holds only the given coin quantity.
+ *
+ * \param[out] size The size to initialize.
+ * \param[in]  coin The coin quantity of the value.
+ */
+void
+_cardano_coin_selection_value_size_init(cardano_value_size_t* size, uint64_t coin);
+
+/**
+ * \brief Adds one asset to a value size.
+ *
+ * \param[in,out] size            The size to grow.
+ * \param[in]     new_policy      True if the asset is the first one of its policy.
+ * \param[in]     policy_id_size  The size of the asset's policy id, in bytes.
+ * \param[in]     asset_name_size The size of the asset's name, in bytes.
+ * \param[in]     quantity        The quantity of the asset.
+ */
+void
+_cardano_coin_selection_value_size_add_asset(
+  cardano_value_size_t* size,
+  bool                  new_policy,
+  size_t                policy_id_size,
+  size_t                asset_name_size,
+  int64_t               quantity);
+
+/**
+ * \brief Gets the serialized size of a value.
+ *
+ * \param[in] size The size of the value.
+ *
+ * \return The number of bytes \ref cardano_value_to_cbor would write for the value.
+ */
+size_t
+_cardano_coin_selection_value_size_get(const cardano_value_size_t* size);
+
 /**
  * \brief Indicates whether a value would exceed the maximum serialized size of a transaction
  * output value.
@@ -59,6 +109,9 @@ _cardano_coin_selection_value_parts_free(cardano_value_part_list_t* parts);
  * not known until coins are assigned. This mirrors the reference implementation, which prefers
  * over-splitting to producing an output that is marginally over the limit.
  *
+ * The size is computed from the widths of the value's policy ids, asset names and quantities;
+ * the value is never serialized.
+ *
  * \param[in]  value          The value to assess.
  * \param[in]  max_value_size The protocol maximum serialized size of an output value, in bytes.
  *                            A value of zero means "no limit" and always assesses as within limits.
@@ -84,6 +137,9 @@ _cardano_coin_selection_value_is_oversized(
  *
  * The concatenation of the parts' assets is always exactly equal to the assets of the input value.
  *
+ * The bisection runs over index ranges of the flattened assets and sizes each candidate range
+ * analytically, so only the final parts are ever built as values.
+ *
  * \param[in]     value          The value whose assets to split.
  * \param[in]     max_value_size The protocol maximum serialized size of an output value, in bytes.
  *                               A value of zero means "no limit"; a single part is returned.
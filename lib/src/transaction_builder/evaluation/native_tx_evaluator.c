@@ -22,6 +22,7 @@
 /* INCLUDES ******************************************************************/
 
 #include "../../uplc/ast/uplc_term.h"
+#include "../../uplc/builtins/uplc_sig_cache.h"
 #include "../../uplc/cost/uplc_selected_cost_model.h"
 #include "../../uplc/machine/uplc_machine.h"
 #include <cardano/address/address.h>
@@ -127,6 +128,12 @@ static const int64_t PRV_MAX_CPU = (int64_t)100000000000;
 // cppcheck-suppress misra-c2012-8.9; Reason: file-scope constant data grouped with the module
 static const int64_t PRV_MAX_MEM = (int64_t)100000000;
 
+/**
+ * \brief The number of signature verification outcomes one evaluation remembers.
+ */
+// cppcheck-suppress misra-c2012-8.9; Reason: file-scope constant data grouped with the module
+static const size_t PRV_SIG_CACHE_CAPACITY = 256U;
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -136,6 +143,10 @@ static const int64_t PRV_MAX_MEM = (int64_t)100000000;
  * by casting the \c cardano_object_t base. Holds the inputs the evaluate
  * signature does not carry: the slot config (copied by value), the ledger cost
  * models (referenced) and the protocol major version.
+ *
+ * The context is read-only once built, so one evaluator may serve concurrent
+ * evaluations; per-run state such as the signature cache lives in
+ * \ref evaluate_transaction.
  */
 typedef struct native_context_t
 {
@@ -1240,32 +1251,9 @@ select_cost_model(
   }
   else
   {
-    cardano_uplc_cost_model_version_t cm_version = cardano_uplc_cost_model_version_for_language(uplc_lang_version(version));
-
-    out->model.machine = cardano_uplc_machine_costs_default(cm_version);
-
-    switch (cm_version)
-    {
-      case CARDANO_UPLC_COST_MODEL_VERSION_V1:
-      {
-        out->model.builtins = cardano_uplc_builtin_costs_v1();
-        break;
-      }
-      case CARDANO_UPLC_COST_MODEL_VERSION_V2:
-      {
-        out->model.builtins = cardano_uplc_builtin_costs_v2();
-        break;
-      }
-      case CARDANO_UPLC_COST_MODEL_VERSION_V3:
-      default:
-      {
-        out->model.builtins = cardano_uplc_builtin_costs_v3();
-        break;
-      }
-    }
+    cardano_uplc_select_default_cost_model(uplc_lang_version(version), ctx->protocol_major, out);
 
-    out->semantics = cardano_uplc_builtin_semantics_for_language_and_protocol(uplc_lang_version(version), ctx->protocol_major);
-    result         = CARDANO_SUCCESS;
+    result = CARDANO_SUCCESS;
   }
 
   return result;
@@ -1380,20 +1368,22 @@ apply_arguments(
  * The CEK machine is bounded by \p remaining, the budget left for the whole
  * transaction; on a successful evaluation the script's spent units are deducted
  * from it so the next redeemer sees a smaller ceiling, matching the reference.
+ * Signature checks consult \p sig_cache, which belongs to the current run.
  *
  * \return \ref CARDANO_SUCCESS when the host ran the redeemer (whatever the script
  *         outcome), or a \ref cardano_error_t when the host could not run it.
  */
 static cardano_error_t
 eval_redeemer(
-  native_context_t*      ctx,
-  cardano_transaction_t* tx,
-  cardano_witness_set_t* witness_set,
-  cardano_utxo_list_t*   resolved_inputs,
-  cardano_redeemer_t*    redeemer,
-  cardano_uplc_budget_t* remaining,
-  cardano_redeemer_t**   out_redeemer,
-  bool*                  out_failed)
+  native_context_t*         ctx,
+  cardano_uplc_sig_cache_t* sig_cache,
+  cardano_transaction_t*    tx,
+  cardano_witness_set_t*    witness_set,
+  cardano_utxo_list_t*      resolved_inputs,
+  cardano_redeemer_t*       redeemer,
+  cardano_uplc_budget_t*    remaining,
+  cardano_redeemer_t**      out_redeemer,
+  bool*                     out_failed)
 {
   cardano_blake2b_hash_t*       script_hash    = NULL;
   cardano_plutus_data_t*        datum          = NULL;
@@ -1453,7 +1443,7 @@ eval_redeemer(
 
     if (result == CARDANO_SUCCESS)
     {
-      result = cardano_uplc_int_evaluate_with_costs(arena, applied, &selected.model, selected.semantics, uplc_lang_version(version), ctx->protocol_major, *remaining, &eval_result);
+      result = cardano_uplc_int_evaluate_with_costs(arena, applied, &selected.model, selected.semantics, uplc_lang_version(version), ctx->protocol_major, *remaining, sig_cache, &eval_result);
     }
   }
 
@@ -1504,6 +1494,10 @@ eval_redeemer(
  * and returns a redeemer list whose entries carry the computed ex-units. A script
  * that fails phase-2 validation is reported as \ref CARDANO_ERROR_SCRIPT_EVALUATION_FAILURE,
  * naming the failing redeemer in the error message.
+ *
+ * The signature cache is created for this call and freed before it returns, so
+ * redeemers of the same transaction share verified signatures while concurrent
+ * calls on one evaluator never touch the same cache.
  */
 static cardano_error_t
 evaluate_transaction(
@@ -1512,12 +1506,13 @@ evaluate_transaction(
   cardano_utxo_list_t*         additional_utxos,
   cardano_redeemer_list_t**    redeemers)
 {
-  native_context_t*        ctx         = NULL;
-  cardano_witness_set_t*   witness_set = NULL;
-  cardano_redeemer_list_t* in_list     = NULL;
-  cardano_redeemer_list_t* out_list    = NULL;
-  cardano_uplc_budget_t    remaining;
-  cardano_error_t          result = CARDANO_SUCCESS;
+  native_context_t*         ctx         = NULL;
+  cardano_witness_set_t*    witness_set = NULL;
+  cardano_redeemer_list_t*  in_list     = NULL;
+  cardano_redeemer_list_t*  out_list    = NULL;
+  cardano_uplc_sig_cache_t* sig_cache   = NULL;
+  cardano_uplc_budget_t     remaining;
+  cardano_error_t           result = CARDANO_SUCCESS;
 
   if ((impl == NULL) || (tx == NULL) || (redeemers == NULL))
   {
@@ -1537,6 +1532,11 @@ evaluate_transaction(
 
   result = cardano_redeemer_list_new(&out_list);
 
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_sig_cache_new(PRV_SIG_CACHE_CAPACITY, &sig_cache);
+  }
+
   remaining.cpu = PRV_MAX_CPU;
   remaining.mem = PRV_MAX_MEM;
 
@@ -1550,7 +1550,7 @@ evaluate_transaction(
 
     if (result == CARDANO_SUCCESS)
     {
-      result = eval_redeemer(ctx, tx, witness_set, additional_utxos, redeemer, &remaining, &new_redeemer, &failed);
+      result = eval_redeemer(ctx, sig_cache, tx, witness_set, additional_utxos, redeemer, &remaining, &new_redeemer, &failed);
     }
 
     if ((result == CARDANO_SUCCESS) && failed)
@@ -1569,6 +1569,7 @@ evaluate_transaction(
     cardano_redeemer_unref(&redeemer);
   }
 
+  cardano_uplc_sig_cache_free(&sig_cache);
   cardano_redeemer_list_unref(&in_list);
   cardano_witness_set_unref(&witness_set);
 
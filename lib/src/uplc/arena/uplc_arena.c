@@ -101,7 +101,9 @@ typedef struct cardano_uplc_arena_unref_node_t
  * \brief Region allocator state.
  *
  * \c blocks heads the live list and only its first block is bumped; \c spares
- * holds the blocks parked by \ref cardano_uplc_arena_reset for reuse.
+ * holds the blocks parked by \ref cardano_uplc_arena_reset for reuse. \c low and
+ * \c high bound the payloads of the live blocks so \ref cardano_uplc_arena_owns
+ * can reject foreign pointers without walking the list.
  */
 struct cardano_uplc_arena_t
 {
@@ -111,6 +113,8 @@ struct cardano_uplc_arena_t
     size_t                           block_size;
     size_t                           bytes_used;
     size_t                           byte_ceiling;
+    uintptr_t                        low;
+    uintptr_t                        high;
 };
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -180,6 +184,29 @@ charge_bytes(cardano_uplc_arena_t* arena, const size_t amount)
   return true;
 }
 
+/**
+ * \brief Widens the live address bounds of an arena to cover a block payload.
+ *
+ * \param[in,out] arena The arena whose bounds are updated.
+ * \param[in] block The block joining the live list.
+ */
+static void
+track_block_bounds(cardano_uplc_arena_t* arena, const cardano_uplc_arena_block_t* block)
+{
+  // cppcheck-suppress misra-c2012-11.4; Reason: integer-pointer conversion for an address range check
+  const uintptr_t start = (uintptr_t)block->payload;
+
+  if (start < arena->low)
+  {
+    arena->low = start;
+  }
+
+  if ((start + (uintptr_t)block->capacity) > arena->high)
+  {
+    arena->high = start + (uintptr_t)block->capacity;
+  }
+}
+
 /**
  * \brief Allocates and links a new block with at least \p min_capacity payload
  *        bytes.
@@ -205,6 +232,8 @@ grow_arena(cardano_uplc_arena_t* arena, const size_t min_capacity)
       spare->next   = arena->blocks;
       arena->blocks = spare;
 
+      track_block_bounds(arena, spare);
+
       return spare;
     }
 
@@ -237,6 +266,8 @@ grow_arena(cardano_uplc_arena_t* arena, const size_t min_capacity)
   block->next    = arena->blocks;
   arena->blocks  = block;
 
+  track_block_bounds(arena, block);
+
   return block;
 }
 
@@ -269,6 +300,8 @@ cardano_uplc_int_arena_new_with_ceiling(const size_t block_size, const size_t by
   result->bytes_used   = 0U;
   result->block_size   = (block_size == 0U) ? ARENA_DEFAULT_BLOCK_SIZE : block_size;
   result->byte_ceiling = byte_ceiling;
+  result->low          = UINTPTR_MAX;
+  result->high         = 0U;
 
   *arena = result;
 
@@ -418,6 +451,57 @@ cardano_uplc_arena_bytes_used(const cardano_uplc_arena_t* arena)
   return arena->bytes_used;
 }
 
+size_t
+cardano_uplc_arena_block_count(const cardano_uplc_arena_t* arena)
+{
+  size_t count = 0U;
+
+  if (arena == NULL)
+  {
+    return 0U;
+  }
+
+  for (const cardano_uplc_arena_block_t* block = arena->blocks; block != NULL; block = block->next)
+  {
+    ++count;
+  }
+
+  return count;
+}
+
+bool
+cardano_uplc_arena_owns(const cardano_uplc_arena_t* arena, const void* ptr)
+{
+  if ((arena == NULL) || (ptr == NULL))
+  {
+    return false;
+  }
+
+  // cppcheck-suppress misra-c2012-11.4; Reason: integer-pointer conversion for an address range check
+  const uintptr_t address = (uintptr_t)ptr;
+
+  // Pointers from other arenas usually fall outside the span of the live blocks, so the
+  // common negative answer costs two compares; the walk only runs inside that span and
+  // starts with the head block, where the most recent allocations live.
+  if ((address < arena->low) || (address >= arena->high))
+  {
+    return false;
+  }
+
+  for (const cardano_uplc_arena_block_t* block = arena->blocks; block != NULL; block = block->next)
+  {
+    // cppcheck-suppress misra-c2012-11.4; Reason: integer-pointer conversion for an address range check
+    const uintptr_t start = (uintptr_t)block->payload;
+
+    if ((address >= start) && ((address - start) < (uintptr_t)block->offset))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 void
 cardano_uplc_arena_free(cardano_uplc_arena_t** arena)
 {
@@ -502,4 +586,6 @@ cardano_uplc_arena_reset(cardano_uplc_arena_t* arena)
 
   arena->blocks     = NULL;
   arena->bytes_used = 0U;
+  arena->low        = UINTPTR_MAX;
+  arena->high       = 0U;
 }
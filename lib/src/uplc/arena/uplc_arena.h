@@ -133,6 +133,40 @@ cardano_uplc_arena_register_unref(cardano_uplc_arena_t* arena, void* object, car
 size_t
 cardano_uplc_arena_bytes_used(const cardano_uplc_arena_t* arena);
 
+/**
+ * \brief Returns the number of blocks holding the arena's current allocations.
+ *
+ * Counts the blocks allocated from since creation or the last
+ * \ref cardano_uplc_arena_reset, including oversized dedicated blocks; blocks
+ * parked for reuse by a reset are not counted. Walks the block list, so it is
+ * meant for diagnostics and sizing rather than hot paths.
+ *
+ * \param[in] arena The arena to query.
+ *
+ * \return The number of live blocks, or 0 if \p arena is NULL.
+ */
+size_t
+cardano_uplc_arena_block_count(const cardano_uplc_arena_t* arena);
+
+/**
+ * \brief Reports whether a pointer was served by the arena.
+ *
+ * Checks \p ptr against the payload of every live block. Lazy caches use it to
+ * decide whether an object registered with an arena may be stored in a node: a
+ * node that outlives the arena (for example a program constant evaluated in a
+ * separate run arena) must not keep a pointer the arena frees on reset. Pointers
+ * outside the address span of the live blocks are rejected in constant time;
+ * inside it the block list is walked from the most recent block.
+ *
+ * \param[in] arena The arena to query.
+ * \param[in] ptr The pointer to look up.
+ *
+ * \return \c true if \p ptr lies inside one of the arena's live blocks, \c false
+ *         otherwise or if either argument is NULL.
+ */
+bool
+cardano_uplc_arena_owns(const cardano_uplc_arena_t* arena, const void* ptr);
+
 /**
  * \brief Releases every block owned by the arena, runs all registered unref
  *        callbacks, and frees the arena itself.
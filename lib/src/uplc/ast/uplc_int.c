@@ -183,8 +183,12 @@ cardano_uplc_constant_int_materialize(
     return error;
   }
 
-  mutable_constant->as.integer.big = built;
-  *out                             = built;
+  if (cardano_uplc_arena_owns(arena, constant))
+  {
+    mutable_constant->as.integer.big = built;
+  }
+
+  *out = built;
 
   return CARDANO_SUCCESS;
 }
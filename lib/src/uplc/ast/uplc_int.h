@@ -215,8 +215,10 @@ cardano_uplc_constant_int_small(const cardano_uplc_constant_t* constant);
  * For a big constant this returns the stored bigint directly. For an inline
  * constant it builds a bigint equal to the inline value, registers it with \p arena
  * so the arena releases it, caches it in the node, and returns it; later calls
- * return the cached pointer with no further allocation. The returned bigint is owned
- * by the arena; the caller must not unref it.
+ * return the cached pointer with no further allocation. The bigint is only cached
+ * when the constant was allocated from \p arena: shared constants and constants of a
+ * program kept in another arena get a fresh bigint on every call. The returned bigint
+ * is owned by the arena; the caller must not unref it.
  *
  * \param[in] arena The arena the lazily built bigint is registered with.
  * \param[in] constant An integer constant. Must not be NULL.
@@ -31,7 +31,7 @@
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Allocates a zero-initialized term from the arena.
+ * \brief Allocates a term from the arena with no pre-wrapped value.
  *
  * \param[in] arena The arena to allocate from.
  *
@@ -42,6 +42,11 @@ alloc_term(cardano_uplc_arena_t* arena)
 {
   cardano_uplc_term_t* term = (cardano_uplc_term_t*)cardano_uplc_arena_alloc(arena, sizeof(cardano_uplc_term_t), 0U);
 
+  if (term != NULL)
+  {
+    term->value = NULL;
+  }
+
   return term;
 }
 
@@ -32,6 +32,13 @@
 #include <cardano/export.h>
 #include <cardano/typedefs.h>
 
+/* FORWARD DECLARATIONS ******************************************************/
+
+#ifndef CARDANO_UPLC_VALUE_T_FORWARD_DECLARED
+#define CARDANO_UPLC_VALUE_T_FORWARD_DECLARED
+typedef struct cardano_uplc_value_t cardano_uplc_value_t;
+#endif /* CARDANO_UPLC_VALUE_T_FORWARD_DECLARED */
+
 /* DECLARATIONS **************************************************************/
 
 #ifdef __cplusplus
@@ -45,10 +52,16 @@ extern "C" {
  * stores only its body and introduces one de Bruijn level. The \c kind selects
  * the active union arm; never read an arm the kind does not select. Terms are
  * allocated from an arena and are immutable after construction.
+ *
+ * \c value is the machine value a constant or builtin term computes to, wrapped
+ * ahead of time by \ref cardano_uplc_int_lower_program so the machine can return it
+ * without allocating. It is NULL on every term the constructors below build, in
+ * which case the machine wraps the constant or builtin itself.
  */
 typedef struct cardano_uplc_term_t
 {
-    cardano_uplc_term_kind_t kind;
+    cardano_uplc_term_kind_t    kind;
+    const cardano_uplc_value_t* value;
 
     // cppcheck-suppress misra-c2012-19.2; Reason: tagged union is the VM value and cost-shape representation
     union
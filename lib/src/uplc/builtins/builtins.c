@@ -284,7 +284,8 @@ spend_builtin_cost(
  * Builds an integer constant that borrows \p value (the constructor takes its own
  * reference and registers the arena unref hook), wraps it in a constant value, and
  * always releases the reference \p value held on entry. On failure \p value is
- * still released so the helper never leaks.
+ * still released so the helper never leaks. A result in the shared small-integer
+ * range is served by its shared value with no arena allocation.
  *
  * \param[in] arena The arena the result is allocated from.
  * \param[in,out] value The owned bigint to publish; released before return.
@@ -310,6 +311,17 @@ result_integer(
 
   if (cardano_uplc_int_bigint_fits_int64(value, &small))
   {
+    const cardano_uplc_value_t* shared = cardano_uplc_value_shared_int(small);
+
+    if (shared != NULL)
+    {
+      cardano_bigint_unref(&value);
+
+      *out = shared;
+
+      return CARDANO_SUCCESS;
+    }
+
     error = cardano_uplc_constant_new_integer_small(arena, small, &constant);
   }
   else
@@ -341,6 +353,9 @@ result_integer(
 /**
  * \brief Builds an integer result value from a host \c int64_t.
  *
+ * A value in the shared small-integer range is served by its shared value with
+ * no arena allocation.
+ *
  * \param[in] arena The arena the result is allocated from.
  * \param[in] n The integer value.
  * \param[out] out On success, the constant value; left untouched on failure.
@@ -353,9 +368,19 @@ result_integer_from_int(
   int64_t                      n,
   const cardano_uplc_value_t** out)
 {
-  cardano_uplc_constant_t* constant = NULL;
-  cardano_uplc_value_t*    result   = NULL;
-  cardano_error_t          error    = cardano_uplc_constant_new_integer_small(arena, n, &constant);
+  cardano_uplc_constant_t*    constant = NULL;
+  cardano_uplc_value_t*       result   = NULL;
+  const cardano_uplc_value_t* shared   = cardano_uplc_value_shared_int(n);
+  cardano_error_t             error    = CARDANO_SUCCESS;
+
+  if (shared != NULL)
+  {
+    *out = shared;
+
+    return CARDANO_SUCCESS;
+  }
+
+  error = cardano_uplc_constant_new_integer_small(arena, n, &constant);
 
   if (error != CARDANO_SUCCESS)
   {
@@ -418,14 +443,37 @@ as_int_view(const cardano_uplc_value_t* value, int_view_t* view)
   return true;
 }
 
+/**
+ * \brief Materializes the bigint of an integer constant.
+ *
+ * Delegates to \ref cardano_uplc_constant_int_materialize, which only caches the
+ * bigint in constants allocated from \p arena. Shared constants and the constants
+ * of a program loaded into a longer-lived arena get a fresh bigint registered with
+ * \p arena on every call.
+ *
+ * \param[in] arena The arena the materialized bigint is registered with.
+ * \param[in] constant An integer constant.
+ * \param[out] out On success, the bigint, owned by the arena or the constant.
+ *
+ * \return \ref CARDANO_SUCCESS on success or a propagated allocation error.
+ */
+static cardano_error_t
+materialize_integer(
+  struct cardano_uplc_arena_t*   arena,
+  const cardano_uplc_constant_t* constant,
+  const cardano_bigint_t**       out)
+{
+  return cardano_uplc_constant_int_materialize(arena, constant, out);
+}
+
 /**
  * \brief Reads a value as a \ref cardano_bigint_t, materializing inline values.
  *
  * The cold-path accessor for builtins that genuinely need a bigint (modular
  * exponentiation, the integer/bytestring conversions, scalar reduction, and the
- * data and multi-asset boundaries). For an inline integer it builds a bigint once
- * and caches it in the arena-owned constant; the returned pointer is owned by the
- * arena and must not be unref'd by the caller.
+ * data and multi-asset boundaries). For an inline integer it builds a bigint and
+ * caches it in the constant when \p arena owns it; the returned pointer is owned by
+ * the arena and must not be unref'd by the caller.
  *
  * \param[in] arena The arena the materialized bigint is registered with.
  * \param[in] value The value to read.
@@ -452,7 +500,7 @@ as_integer_big(
     return false;
   }
 
-  return cardano_uplc_constant_int_materialize(arena, constant, out) == CARDANO_SUCCESS;
+  return materialize_integer(arena, constant, out) == CARDANO_SUCCESS;
 }
 
 /**
@@ -480,7 +528,7 @@ constant_integer_big(
     return false;
   }
 
-  return cardano_uplc_constant_int_materialize(arena, constant, out) == CARDANO_SUCCESS;
+  return materialize_integer(arena, constant, out) == CARDANO_SUCCESS;
 }
 
 /**
@@ -630,11 +678,14 @@ result_bytes_take(
 /**
  * \brief Builds a boolean result value.
  *
- * \param[in] arena The arena the result is allocated from.
+ * Booleans are served by the shared \c True and \c False values, so this never
+ * allocates and never fails.
+ *
+ * \param[in] arena The arena the result would be allocated from; unused.
  * \param[in] value The boolean value.
- * \param[out] out On success, the constant value; left untouched on failure.
+ * \param[out] out The shared constant value.
  *
- * \return \ref CARDANO_SUCCESS on success or a propagated allocation error.
+ * \return \ref CARDANO_SUCCESS.
  */
 static cardano_error_t
 result_bool(
@@ -642,23 +693,9 @@ result_bool(
   bool                         value,
   const cardano_uplc_value_t** out)
 {
-  cardano_uplc_constant_t* constant = NULL;
-  cardano_uplc_value_t*    result   = NULL;
-  cardano_error_t          error    = cardano_uplc_constant_new_bool(arena, value, &constant);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    return error;
-  }
+  CARDANO_UNUSED(arena);
 
-  error = cardano_uplc_value_new_constant(arena, constant, &result);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    return error;
-  }
-
-  *out = result;
+  *out = cardano_uplc_value_shared_bool(value);
 
   return CARDANO_SUCCESS;
 }
@@ -4368,23 +4405,13 @@ body_un_i_data(
 
   if (data->as.integer.is_small)
   {
-    cardano_uplc_constant_t* constant = NULL;
-    cardano_uplc_value_t*    result   = NULL;
-
-    *host_error = cardano_uplc_constant_new_integer_small(arena, data->as.integer.small, &constant);
-
-    if (*host_error == CARDANO_SUCCESS)
-    {
-      *host_error = cardano_uplc_value_new_constant(arena, constant, &result);
-    }
+    *host_error = result_integer_from_int(arena, data->as.integer.small, out_result);
 
     if (*host_error != CARDANO_SUCCESS)
     {
       return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
     }
 
-    *out_result = result;
-
     return CARDANO_UPLC_BUILTIN_OUTCOME_OK;
   }
 
@@ -4870,6 +4897,40 @@ body_ripemd_160(
   return (*host_error == CARDANO_SUCCESS) ? CARDANO_UPLC_BUILTIN_OUTCOME_OK : CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
 }
 
+/**
+ * \brief Looks a signature check up in the optional verification cache.
+ *
+ * Called by the verification bodies once their arguments have passed every
+ * script-error check, so a cached outcome never hides a malformed call.
+ *
+ * \param[in] sig_cache The verification cache, or NULL when caching is off.
+ * \param[in] func The verification builtin.
+ * \param[in] key The public key bytes.
+ * \param[in] msg The message bytes.
+ * \param[in] sig The signature bytes.
+ * \param[out] digest Receives the digest keying the check when \p sig_cache is set.
+ * \param[out] valid On a hit, the remembered outcome.
+ *
+ * \return \c true on a hit, \c false on a miss or when \p sig_cache is NULL.
+ */
+static bool
+sig_cache_lookup(
+  cardano_uplc_sig_cache_t*       sig_cache,
+  cardano_uplc_builtin_t          func,
+  const cardano_uplc_byte_view_t* key,
+  const cardano_uplc_byte_view_t* msg,
+  const cardano_uplc_byte_view_t* sig,
+  byte_t*                         digest,
+  bool*                           valid)
+{
+  if (sig_cache == NULL)
+  {
+    return false;
+  }
+
+  return cardano_uplc_sig_cache_lookup(sig_cache, func, key->data, key->size, msg->data, msg->size, sig->data, sig->size, digest, valid);
+}
+
 /**
  * \brief Runs \c verifyEd25519Signature: checks an Ed25519 signature.
  *
@@ -4878,6 +4939,7 @@ body_ripemd_160(
  * outcome; a verification failure is a \c false result, not an error.
  *
  * \param[in] arena The arena the result is allocated from.
+ * \param[in,out] sig_cache The verification cache, or NULL when caching is off.
  * \param[in] args The three saturated argument values (public key, message, signature).
  * \param[out] out_result On success, the boolean result value.
  * \param[out] host_error Set to a host error on allocation failure.
@@ -4887,6 +4949,7 @@ body_ripemd_160(
 static cardano_uplc_int_builtin_outcome_t
 body_verify_ed25519(
   struct cardano_uplc_arena_t*       arena,
+  cardano_uplc_sig_cache_t*          sig_cache,
   const cardano_uplc_value_t* const* args,
   const cardano_uplc_value_t**       out_result,
   cardano_error_t*                   host_error)
@@ -4899,6 +4962,7 @@ body_verify_ed25519(
   cardano_error_t               key_error = CARDANO_SUCCESS;
   cardano_error_t               sig_error = CARDANO_SUCCESS;
   bool                          valid     = false;
+  byte_t                        digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE];
 
   if (!cardano_uplc_builtin_as_byte_string(args[0], &key_bytes) || !cardano_uplc_builtin_as_byte_string(args[1], &msg_bytes) || !cardano_uplc_builtin_as_byte_string(args[2], &sig_bytes))
   {
@@ -4915,6 +4979,13 @@ body_verify_ed25519(
     return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
   }
 
+  if (sig_cache_lookup(sig_cache, CARDANO_UPLC_BUILTIN_VERIFY_ED25519_SIGNATURE, &key_bytes, &msg_bytes, &sig_bytes, digest, &valid))
+  {
+    *host_error = result_bool(arena, valid, out_result);
+
+    return (*host_error == CARDANO_SUCCESS) ? CARDANO_UPLC_BUILTIN_OUTCOME_OK : CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
+  }
+
   key_error = cardano_ed25519_public_key_from_bytes(
     key_bytes.data,
     key_bytes.size,
@@ -4945,6 +5016,11 @@ body_verify_ed25519(
   cardano_ed25519_public_key_unref(&key);
   cardano_ed25519_signature_unref(&signature);
 
+  if (sig_cache != NULL)
+  {
+    cardano_uplc_sig_cache_store(sig_cache, digest, valid);
+  }
+
   *host_error = result_bool(arena, valid, out_result);
 
   return (*host_error == CARDANO_SUCCESS) ? CARDANO_UPLC_BUILTIN_OUTCOME_OK : CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
@@ -4961,6 +5037,7 @@ body_verify_ed25519(
  * \c false result rather than \c true.
  *
  * \param[in] arena The arena the result is allocated from.
+ * \param[in,out] sig_cache The verification cache, or NULL when caching is off.
  * \param[in] args The three saturated argument values (public key, message, signature).
  * \param[out] out_result On success, the boolean result value.
  * \param[out] host_error Set to a host error on allocation failure.
@@ -4970,6 +5047,7 @@ body_verify_ed25519(
 static cardano_uplc_int_builtin_outcome_t
 body_verify_ecdsa(
   struct cardano_uplc_arena_t*       arena,
+  cardano_uplc_sig_cache_t*          sig_cache,
   const cardano_uplc_value_t* const* args,
   const cardano_uplc_value_t**       out_result,
   cardano_error_t*                   host_error)
@@ -4980,6 +5058,7 @@ body_verify_ecdsa(
   secp256k1_pubkey          pubkey;
   secp256k1_ecdsa_signature signature;
   bool                      valid = false;
+  byte_t                    digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE];
 
   if (!cardano_uplc_builtin_as_byte_string(args[0], &key_bytes) || !cardano_uplc_builtin_as_byte_string(args[1], &msg_bytes) || !cardano_uplc_builtin_as_byte_string(args[2], &sig_bytes))
   {
@@ -5001,7 +5080,15 @@ body_verify_ecdsa(
     return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
   }
 
-  valid = (secp256k1_ecdsa_verify(secp256k1_context_static, &signature, msg_bytes.data, &pubkey) == 1);
+  if (!sig_cache_lookup(sig_cache, CARDANO_UPLC_BUILTIN_VERIFY_ECDSA_SECP256K1_SIGNATURE, &key_bytes, &msg_bytes, &sig_bytes, digest, &valid))
+  {
+    valid = (secp256k1_ecdsa_verify(secp256k1_context_static, &signature, msg_bytes.data, &pubkey) == 1);
+
+    if (sig_cache != NULL)
+    {
+      cardano_uplc_sig_cache_store(sig_cache, digest, valid);
+    }
+  }
 
   *host_error = result_bool(arena, valid, out_result);
 
@@ -5017,6 +5104,7 @@ body_verify_ecdsa(
  * well-formed key and signature the result is the boolean verification outcome.
  *
  * \param[in] arena The arena the result is allocated from.
+ * \param[in,out] sig_cache The verification cache, or NULL when caching is off.
  * \param[in] args The three saturated argument values (public key, message, signature).
  * \param[out] out_result On success, the boolean result value.
  * \param[out] host_error Set to a host error on allocation failure.
@@ -5026,6 +5114,7 @@ body_verify_ecdsa(
 static cardano_uplc_int_builtin_outcome_t
 body_verify_schnorr(
   struct cardano_uplc_arena_t*       arena,
+  cardano_uplc_sig_cache_t*          sig_cache,
   const cardano_uplc_value_t* const* args,
   const cardano_uplc_value_t**       out_result,
   cardano_error_t*                   host_error)
@@ -5038,6 +5127,7 @@ body_verify_schnorr(
   size_t                   msg_size  = 0U;
   const unsigned char      msg_empty = 0U;
   bool                     valid     = false;
+  byte_t                   digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE];
 
   if (!cardano_uplc_builtin_as_byte_string(args[0], &key_bytes) || !cardano_uplc_builtin_as_byte_string(args[1], &msg_bytes) || !cardano_uplc_builtin_as_byte_string(args[2], &sig_bytes))
   {
@@ -5057,7 +5147,15 @@ body_verify_schnorr(
   msg_size = msg_bytes.size;
   msg_data = (msg_size == 0U) ? &msg_empty : msg_bytes.data;
 
-  valid = (secp256k1_schnorrsig_verify(secp256k1_context_static, sig_bytes.data, msg_data, msg_size, &pubkey) == 1);
+  if (!sig_cache_lookup(sig_cache, CARDANO_UPLC_BUILTIN_VERIFY_SCHNORR_SECP256K1_SIGNATURE, &key_bytes, &msg_bytes, &sig_bytes, digest, &valid))
+  {
+    valid = (secp256k1_schnorrsig_verify(secp256k1_context_static, sig_bytes.data, msg_data, msg_size, &pubkey) == 1);
+
+    if (sig_cache != NULL)
+    {
+      cardano_uplc_sig_cache_store(sig_cache, digest, valid);
+    }
+  }
 
   *host_error = result_bool(arena, valid, out_result);
 
@@ -8058,53 +8156,38 @@ body_bls_multi_scalar_mul(
   return (*host_error == CARDANO_SUCCESS) ? CARDANO_UPLC_BUILTIN_OUTCOME_OK : CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
 }
 
-/* DISPATCH *****************************************************************/
-
-cardano_uplc_int_builtin_outcome_t
-cardano_uplc_int_builtin_run(
-  struct cardano_uplc_arena_t*        arena,
-  cardano_uplc_step_accumulator_t*    acc,
-  const cardano_uplc_builtin_costs_t* costs,
-  cardano_uplc_builtin_semantics_t    semantics,
-  cardano_uplc_builtin_t              func,
-  const cardano_uplc_value_t* const*  args,
-  size_t                              arg_count,
-  const cardano_uplc_value_t**        out_result,
-  cardano_error_t*                    host_error)
+/**
+ * \brief Runs the body of a saturated builtin whose cost has already been spent.
+ *
+ * The switch is exhaustive over \ref cardano_uplc_builtin_t so -Wswitch-enum makes a
+ * forgotten builtin a build error; only an out-of-range tag reaches the default.
+ *
+ * \param[in] arena The arena every result value is allocated from.
+ * \param[in,out] sig_cache The signature verification cache, or NULL.
+ * \param[in] semantics The builtin semantics variant.
+ * \param[in] func The saturated builtin to run.
+ * \param[in] args The saturated argument values, in application order.
+ * \param[out] out_result On \ref CARDANO_UPLC_BUILTIN_OUTCOME_OK, the result value.
+ * \param[out] host_error On a host failure, the error code.
+ *
+ * \return The script-visible outcome of the body.
+ */
+static cardano_uplc_int_builtin_outcome_t
+run_body(
+  struct cardano_uplc_arena_t*       arena,
+  cardano_uplc_sig_cache_t*          sig_cache,
+  cardano_uplc_builtin_semantics_t   semantics,
+  cardano_uplc_builtin_t             func,
+  const cardano_uplc_value_t* const* args,
+  const cardano_uplc_value_t**       out_result,
+  cardano_error_t*                   host_error)
 {
-  if ((arena == NULL) || (acc == NULL) || (costs == NULL) || (out_result == NULL) || (host_error == NULL))
-  {
-    if (host_error != NULL)
-    {
-      *host_error = CARDANO_ERROR_POINTER_IS_NULL;
-    }
-
-    return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-  }
-
-  *host_error = CARDANO_SUCCESS;
-
-  /*
-   * Each arm spends its cost before its body runs (cost-before-execute). Budget
-   * exhaustion is detected by the caller after the step and takes precedence over
-   * any script error this body returns, so spending first is safe. An unsupported
-   * builtin falls to the default and reports the unsupported outcome WITHOUT
-   * spending. The switch is exhaustive over cardano_uplc_builtin_t so
-   * -Wswitch-enum makes a forgotten builtin a build error.
-   */
   switch (func)
   {
     case CARDANO_UPLC_BUILTIN_ADD_INTEGER:
     case CARDANO_UPLC_BUILTIN_SUBTRACT_INTEGER:
     case CARDANO_UPLC_BUILTIN_MULTIPLY_INTEGER:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_int_arith(arena, func, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_DIVIDE_INTEGER:
@@ -8112,987 +8195,364 @@ cardano_uplc_int_builtin_run(
     case CARDANO_UPLC_BUILTIN_REMAINDER_INTEGER:
     case CARDANO_UPLC_BUILTIN_MOD_INTEGER:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_int_div(arena, func, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_EQUALS_INTEGER:
     case CARDANO_UPLC_BUILTIN_LESS_THAN_INTEGER:
     case CARDANO_UPLC_BUILTIN_LESS_THAN_EQUALS_INTEGER:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_int_compare(arena, func, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_EXP_MOD_INTEGER:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_exp_mod_integer(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_APPEND_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_append_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_CONS_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_cons_byte_string(arena, semantics, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SLICE_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_slice_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_LENGTH_OF_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_length_of_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_INDEX_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_index_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_EQUALS_BYTE_STRING:
     case CARDANO_UPLC_BUILTIN_LESS_THAN_BYTE_STRING:
     case CARDANO_UPLC_BUILTIN_LESS_THAN_EQUALS_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_byte_string_compare(arena, func, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_AND_BYTE_STRING:
     case CARDANO_UPLC_BUILTIN_OR_BYTE_STRING:
     case CARDANO_UPLC_BUILTIN_XOR_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_logical_byte_string(arena, func, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_COMPLEMENT_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_complement_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_READ_BIT:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_read_bit(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_WRITE_BITS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_write_bits(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_REPLICATE_BYTE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_replicate_byte(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SHIFT_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_shift_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_ROTATE_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_rotate_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_COUNT_SET_BITS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_count_set_bits(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_FIND_FIRST_SET_BIT:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_find_first_set_bit(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_INTEGER_TO_BYTE_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_integer_to_byte_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BYTE_STRING_TO_INTEGER:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_byte_string_to_integer(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_APPEND_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_append_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_EQUALS_STRING:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_equals_string(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_ENCODE_UTF8:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_encode_utf8(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_DECODE_UTF8:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_decode_utf8(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_IF_THEN_ELSE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_if_then_else(args, out_result);
     }
     case CARDANO_UPLC_BUILTIN_CHOOSE_UNIT:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_choose_unit(args, out_result);
     }
     case CARDANO_UPLC_BUILTIN_TRACE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_trace(args, out_result);
     }
     case CARDANO_UPLC_BUILTIN_FST_PAIR:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_pair_component(arena, true, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SND_PAIR:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_pair_component(arena, false, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_CHOOSE_LIST:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_choose_list(args, out_result);
     }
     case CARDANO_UPLC_BUILTIN_MK_CONS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_mk_cons(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_HEAD_LIST:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_head_list(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_TAIL_LIST:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_tail_list(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_NULL_LIST:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_null_list(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_CHOOSE_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_choose_data(args, out_result);
     }
     case CARDANO_UPLC_BUILTIN_CONSTR_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_constr_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_MAP_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_map_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_LIST_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_list_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_I_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_i_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_B_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_b_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UN_CONSTR_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_un_constr_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UN_MAP_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_un_map_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UN_LIST_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_un_list_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UN_I_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_un_i_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UN_B_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_un_b_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_EQUALS_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_equals_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_MK_PAIR_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_mk_pair_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_MK_NIL_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_mk_nil_data(arena, false, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_MK_NIL_PAIR_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_mk_nil_data(arena, true, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SERIALISE_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_serialise_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SHA2_256:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_sha2_256(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLAKE2B_224:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_blake2b(arena, CARDANO_UPLC_BUILTIN_BLAKE2B_224_SIZE, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLAKE2B_256:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_blake2b(arena, CARDANO_UPLC_BUILTIN_BLAKE2B_256_SIZE, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_VERIFY_ED25519_SIGNATURE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
-      return body_verify_ed25519(arena, args, out_result, host_error);
+      return body_verify_ed25519(arena, sig_cache, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SHA3_256:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_sha3_keccak(arena, CARDANO_UPLC_BUILTIN_SHA3_PAD, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_KECCAK_256:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_sha3_keccak(arena, CARDANO_UPLC_BUILTIN_KECCAK_PAD, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_RIPEMD_160:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_ripemd_160(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_VERIFY_ECDSA_SECP256K1_SIGNATURE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
-      return body_verify_ecdsa(arena, args, out_result, host_error);
+      return body_verify_ecdsa(arena, sig_cache, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_VERIFY_SCHNORR_SECP256K1_SIGNATURE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
-      return body_verify_schnorr(arena, args, out_result, host_error);
+      return body_verify_schnorr(arena, sig_cache, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_ADD:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_add(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_NEG:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_neg(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_SCALAR_MUL:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_scalar_mul(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_EQUAL:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_equal(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_COMPRESS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_compress(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_UNCOMPRESS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_uncompress(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_HASH_TO_GROUP:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g1_hash_to_group(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_ADD:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_add(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_NEG:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_neg(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_SCALAR_MUL:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_scalar_mul(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_EQUAL:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_equal(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_COMPRESS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_compress(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_UNCOMPRESS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_uncompress(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_HASH_TO_GROUP:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_g2_hash_to_group(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_MILLER_LOOP:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_miller_loop(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_MUL_ML_RESULT:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_mul_ml_result(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_FINAL_VERIFY:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_final_verify(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_DROP_LIST:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_drop_list(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_LENGTH_OF_ARRAY:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_length_of_array(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_LIST_TO_ARRAY:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_list_to_array(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_INDEX_ARRAY:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_index_array(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G1_MULTI_SCALAR_MUL:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_multi_scalar_mul(arena, CARDANO_UPLC_TYPE_BLS_G1, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_BLS12_381_G2_MULTI_SCALAR_MUL:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_bls_multi_scalar_mul(arena, CARDANO_UPLC_TYPE_BLS_G2, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_INSERT_COIN:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_insert_coin(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_LOOKUP_COIN:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_lookup_coin(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UNION_VALUE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_union_value(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_VALUE_CONTAINS:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_value_contains(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_VALUE_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_value_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_UN_VALUE_DATA:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_un_value_data(arena, args, out_result, host_error);
     }
     case CARDANO_UPLC_BUILTIN_SCALE_VALUE:
     {
-      *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
-      }
-
       return body_scale_value(arena, args, out_result, host_error);
     }
     default:
@@ -9101,3 +8561,84 @@ cardano_uplc_int_builtin_run(
     }
   }
 }
+
+/* DISPATCH *****************************************************************/
+
+cardano_uplc_int_builtin_outcome_t
+cardano_uplc_int_builtin_run(
+  struct cardano_uplc_arena_t*        arena,
+  cardano_uplc_step_accumulator_t*    acc,
+  const cardano_uplc_builtin_costs_t* costs,
+  cardano_uplc_builtin_semantics_t    semantics,
+  cardano_uplc_builtin_t              func,
+  const cardano_uplc_value_t* const*  args,
+  size_t                              arg_count,
+  const cardano_uplc_value_t**        out_result,
+  cardano_error_t*                    host_error)
+{
+  if ((arena == NULL) || (acc == NULL) || (costs == NULL) || (out_result == NULL) || (host_error == NULL))
+  {
+    if (host_error != NULL)
+    {
+      *host_error = CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
+  }
+
+  *host_error = CARDANO_SUCCESS;
+
+  /*
+   * Every builtin spends its cost before its body runs (cost-before-execute). Budget
+   * exhaustion is detected by the caller after the step and takes precedence over
+   * any script error the body returns, so spending first is safe. An out-of-range
+   * tag reports the unsupported outcome WITHOUT spending.
+   */
+  if ((size_t)func >= (size_t)CARDANO_UPLC_BUILTIN_COUNT)
+  {
+    return CARDANO_UPLC_BUILTIN_OUTCOME_UNSUPPORTED;
+  }
+
+  *host_error = spend_builtin_cost(acc, costs, semantics, func, args, arg_count);
+
+  if (*host_error != CARDANO_SUCCESS)
+  {
+    return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
+  }
+
+  return run_body(arena, NULL, semantics, func, args, out_result, host_error);
+}
+
+cardano_uplc_int_builtin_outcome_t
+cardano_uplc_int_builtin_run_site(
+  struct cardano_uplc_arena_t*       arena,
+  cardano_uplc_step_accumulator_t*   acc,
+  const cardano_uplc_builtin_site_t* site,
+  cardano_uplc_sig_cache_t*          sig_cache,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  const cardano_uplc_value_t**       out_result,
+  cardano_error_t*                   host_error)
+{
+  cardano_uplc_budget_t cost = { 0, 0 };
+
+  if ((arena == NULL) || (acc == NULL) || (site == NULL) || (out_result == NULL) || (host_error == NULL))
+  {
+    if (host_error != NULL)
+    {
+      *host_error = CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
+  }
+
+  cost        = site->cost_fn(site->cost, site->func, args, arg_count, site->costs_strings_by_utf8_bytes);
+  *host_error = cardano_uplc_step_accumulator_charge(acc, cost);
+
+  if (*host_error != CARDANO_SUCCESS)
+  {
+    return CARDANO_UPLC_BUILTIN_OUTCOME_SCRIPT_ERROR;
+  }
+
+  return run_body(arena, sig_cache, site->semantics, site->func, args, out_result, host_error);
+}
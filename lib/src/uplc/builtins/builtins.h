@@ -30,6 +30,8 @@
 #include "../machine/uplc_value.h"
 #include "uplc_builtin_outcome.h"
 #include "uplc_builtin_semantics.h"
+#include "uplc_builtin_site.h"
+#include "uplc_sig_cache.h"
 #include "uplc_byte_view.h"
 
 #include "../arena/uplc_arena.h"
@@ -56,9 +58,9 @@ extern "C" {
  * \ref CARDANO_UPLC_BUILTIN_OUTCOME_UNSUPPORTED (its case is skipped, so leaving
  * the budget untouched cannot corrupt the run).
  *
- * The dispatch is an exhaustive switch over \ref cardano_uplc_builtin_t; every
- * arm currently returns the unsupported outcome. As bodies land they replace
- * their arm with compute-cost, spend, run.
+ * This entry re-derives the string measure and the cost shape on every call; the
+ * machine calls \ref cardano_uplc_int_builtin_run_site with a pre-resolved site
+ * instead.
  *
  * \param[in] arena The arena every result value is allocated from. Must not be NULL.
  * \param[in,out] acc The step accumulator the builtin cost is spent on. Must not
@@ -89,6 +91,46 @@ cardano_uplc_int_builtin_run(
   const cardano_uplc_value_t**        out_result,
   cardano_error_t*                    host_error);
 
+/**
+ * \brief Runs a saturated builtin through its pre-resolved call site.
+ *
+ * Identical in outcome and budget to \ref cardano_uplc_int_builtin_run for the
+ * site's builtin, semantics and cost table, but spends the cost through the
+ * site's specialized costing function and reads the semantics from the site, so
+ * nothing about the builtin is re-decided per call. Availability is not checked
+ * here; the caller gates on \c site->available first.
+ *
+ * When \p sig_cache is set, the signature verification builtins consult it before
+ * running their crypto and remember the outcome after; the cost is spent exactly
+ * as without it.
+ *
+ * \param[in] arena The arena every result value is allocated from. Must not be NULL.
+ * \param[in,out] acc The step accumulator the builtin cost is spent on. Must not
+ *            be NULL.
+ * \param[in] site The resolved site of the builtin being run. Must not be NULL.
+ * \param[in,out] sig_cache The signature verification cache, or NULL to verify
+ *                every signature from scratch.
+ * \param[in] args The saturated argument values, in application order. May be NULL
+ *            only when \p arg_count is 0.
+ * \param[in] arg_count The number of arguments applied.
+ * \param[out] out_result On \ref CARDANO_UPLC_BUILTIN_OUTCOME_OK, the result value;
+ *             left untouched otherwise.
+ * \param[out] host_error On a host failure (allocation), the error code; set to
+ *             \ref CARDANO_SUCCESS otherwise.
+ *
+ * \return The script-visible outcome of the run.
+ */
+cardano_uplc_int_builtin_outcome_t
+cardano_uplc_int_builtin_run_site(
+  struct cardano_uplc_arena_t*       arena,
+  cardano_uplc_step_accumulator_t*   acc,
+  const cardano_uplc_builtin_site_t* site,
+  cardano_uplc_sig_cache_t*          sig_cache,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  const cardano_uplc_value_t**       out_result,
+  cardano_error_t*                   host_error);
+
 /* ARGUMENT-UNWRAP HELPERS **************************************************/
 
 /**
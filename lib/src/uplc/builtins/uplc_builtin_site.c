@@ -0,0 +1,65 @@
+/**
+ * \file uplc_builtin_site.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "uplc_builtin_site.h"
+
+#include <stddef.h>
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+cardano_uplc_builtin_sites_init(
+  const cardano_uplc_builtin_costs_t* costs,
+  cardano_uplc_builtin_semantics_t    semantics,
+  cardano_uplc_lang_version_t         language,
+  uint64_t                            protocol_major,
+  cardano_uplc_builtin_sites_t*       out)
+{
+  const bool by_utf8 = cardano_uplc_semantics_costs_strings_by_utf8_bytes(semantics);
+
+  if ((costs == NULL) || (out == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < (size_t)CARDANO_UPLC_BUILTIN_COUNT; ++i)
+  {
+    cardano_uplc_builtin_site_t* site = &out->entries[i];
+    const cardano_uplc_builtin_t func = (cardano_uplc_builtin_t)i;
+
+    site->func                        = func;
+    site->arity                       = 0U;
+    site->force_count                 = 0U;
+    site->semantics                   = semantics;
+    site->costs_strings_by_utf8_bytes = by_utf8;
+    site->cost                        = &costs->entries[i];
+    site->cost_fn                     = cardano_uplc_builtin_cost_resolve(costs, func);
+    site->available                   = cardano_uplc_builtin_available(func, language, protocol_major);
+
+    // Every tag below the count is valid, so the table lookups cannot fail here.
+    (void)cardano_uplc_builtin_arity(func, &site->arity);
+    (void)cardano_uplc_builtin_force_count(func, &site->force_count);
+  }
+
+  return CARDANO_SUCCESS;
+}
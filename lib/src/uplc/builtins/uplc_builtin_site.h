@@ -0,0 +1,120 @@
+/**
+ * \file uplc_builtin_site.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UPLC_BUILTINS_UPLC_BUILTIN_SITE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UPLC_BUILTINS_UPLC_BUILTIN_SITE_H
+
+/* INCLUDES ******************************************************************/
+
+#include "../ast/uplc_lang_version.h"
+#include "../cost/uplc_builtin_cost.h"
+#include "../cost/uplc_builtin_costs.h"
+#include "uplc_builtin.h"
+#include "uplc_builtin_semantics.h"
+
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Everything the machine needs to call one builtin, decided once.
+ *
+ * A saturated call otherwise re-derives the builtin's arity and force count, its
+ * availability for the language and protocol, the semantics' string measure and
+ * the cost entry's shape on every application. None of these change during an
+ * evaluation, so they are resolved once per builtin when the machine is set up and
+ * read back by tag. \c cost points into the cost table the site was resolved
+ * against, which must outlive the site.
+ */
+typedef struct cardano_uplc_builtin_site_t
+{
+    cardano_uplc_builtin_t             func;
+    size_t                             arity;
+    size_t                             force_count;
+    bool                               available;
+    cardano_uplc_builtin_semantics_t   semantics;
+    bool                               costs_strings_by_utf8_bytes;
+    const cardano_uplc_builtin_cost_t* cost;
+    cardano_uplc_builtin_cost_fn_t     cost_fn;
+} cardano_uplc_builtin_site_t;
+
+/**
+ * \brief The resolved call sites of every builtin, indexed by builtin tag.
+ */
+typedef struct cardano_uplc_builtin_sites_t
+{
+    cardano_uplc_builtin_site_t entries[CARDANO_UPLC_BUILTIN_COUNT];
+} cardano_uplc_builtin_sites_t;
+
+/**
+ * \brief Resolves the call site of every builtin for one cost model and semantics.
+ *
+ * \param[in] costs The per-builtin costs the sites charge against. Must not be NULL
+ *            and must outlive \p out.
+ * \param[in] semantics The builtin semantics variant.
+ * \param[in] language The language version gating availability.
+ * \param[in] protocol_major The protocol major version gating availability.
+ * \param[out] out On success, the resolved sites; left untouched on failure.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p costs or \p out is NULL.
+ */
+cardano_error_t
+cardano_uplc_builtin_sites_init(
+  const cardano_uplc_builtin_costs_t* costs,
+  cardano_uplc_builtin_semantics_t    semantics,
+  cardano_uplc_lang_version_t         language,
+  uint64_t                            protocol_major,
+  cardano_uplc_builtin_sites_t*       out);
+
+/**
+ * \brief Returns the resolved site of a builtin tag.
+ *
+ * \param[in] sites The resolved sites. Must not be NULL.
+ * \param[in] func The builtin tag.
+ *
+ * \return The site, or NULL when \p func is not a valid builtin tag.
+ */
+static inline const cardano_uplc_builtin_site_t*
+cardano_uplc_builtin_sites_get(const cardano_uplc_builtin_sites_t* sites, cardano_uplc_builtin_t func)
+{
+  if ((size_t)func >= (size_t)CARDANO_UPLC_BUILTIN_COUNT)
+  {
+    return NULL;
+  }
+
+  return &sites->entries[(size_t)func];
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BIGLUP_LABS_INCLUDE_CARDANO_UPLC_BUILTINS_UPLC_BUILTIN_SITE_H */
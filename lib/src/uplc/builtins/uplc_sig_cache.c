@@ -0,0 +1,240 @@
+/**
+ * \file uplc_sig_cache.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "uplc_sig_cache.h"
+
+#include "../../allocators.h"
+
+#include <cardano/export.h>
+
+#include <sodium/crypto_generichash.h>
+
+#include <src/string_safe.h>
+
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief One remembered verification outcome.
+ */
+typedef struct sig_cache_entry_t
+{
+    byte_t digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE];
+    bool   used;
+    bool   valid;
+} sig_cache_entry_t;
+
+/**
+ * \brief The direct-mapped outcome table and its counters.
+ *
+ * \c mask is the capacity minus one; the capacity is a power of two so the low
+ * bits of a digest pick its slot.
+ */
+struct cardano_uplc_sig_cache_t
+{
+    sig_cache_entry_t* entries;
+    size_t             mask;
+    uint64_t           hits;
+    uint64_t           misses;
+};
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Absorbs a length-prefixed byte string into the digest state.
+ *
+ * The length prefix keeps two different argument splits of the same bytes from
+ * producing the same digest.
+ *
+ * \param[in,out] state The BLAKE2b state.
+ * \param[in] data The bytes. May be NULL only when \p size is 0.
+ * \param[in] size The number of bytes.
+ */
+static void
+absorb_bytes(crypto_generichash_state* state, const byte_t* data, size_t size)
+{
+  byte_t   prefix[8];
+  uint64_t length = (uint64_t)size;
+
+  for (size_t i = 0U; i < sizeof(prefix); ++i)
+  {
+    prefix[i] = (byte_t)(length >> (8U * i));
+  }
+
+  (void)crypto_generichash_update(state, prefix, sizeof(prefix));
+
+  if (size > 0U)
+  {
+    (void)crypto_generichash_update(state, data, size);
+  }
+}
+
+/**
+ * \brief Returns the slot a digest maps to.
+ *
+ * \param[in] cache The cache.
+ * \param[in] digest The check digest.
+ *
+ * \return The slot index.
+ */
+static size_t
+slot_of(const cardano_uplc_sig_cache_t* cache, const byte_t* digest)
+{
+  size_t index = 0U;
+
+  for (size_t i = 0U; i < sizeof(size_t); ++i)
+  {
+    index |= (size_t)digest[i] << (8U * i);
+  }
+
+  return index & cache->mask;
+}
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+cardano_uplc_sig_cache_new(size_t capacity, cardano_uplc_sig_cache_t** out)
+{
+  cardano_uplc_sig_cache_t* cache = NULL;
+  size_t                    slots = 1U;
+
+  if (out == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((capacity == 0U) || (capacity > (SIZE_MAX / 2U / sizeof(sig_cache_entry_t))))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  while (slots < capacity)
+  {
+    slots *= 2U;
+  }
+
+  cache = (cardano_uplc_sig_cache_t*)_cardano_malloc(sizeof(cardano_uplc_sig_cache_t));
+
+  if (cache == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cache->entries = (sig_cache_entry_t*)_cardano_malloc(slots * sizeof(sig_cache_entry_t));
+
+  if (cache->entries == NULL)
+  {
+    _cardano_free(cache);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(cache->entries, 0, slots * sizeof(sig_cache_entry_t)));
+
+  cache->mask   = slots - 1U;
+  cache->hits   = 0U;
+  cache->misses = 0U;
+
+  *out = cache;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_uplc_sig_cache_free(cardano_uplc_sig_cache_t** cache)
+{
+  if ((cache == NULL) || (*cache == NULL))
+  {
+    return;
+  }
+
+  _cardano_free((*cache)->entries);
+  _cardano_free(*cache);
+
+  *cache = NULL;
+}
+
+bool
+cardano_uplc_sig_cache_lookup(
+  cardano_uplc_sig_cache_t* cache,
+  cardano_uplc_builtin_t    func,
+  const byte_t*             key,
+  size_t                    key_size,
+  const byte_t*             msg,
+  size_t                    msg_size,
+  const byte_t*             sig,
+  size_t                    sig_size,
+  byte_t                    digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE],
+  bool*                     valid)
+{
+  crypto_generichash_state state;
+  const byte_t             tag = (byte_t)func;
+  const sig_cache_entry_t* entry;
+
+  (void)crypto_generichash_init(&state, NULL, 0U, CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE);
+  (void)crypto_generichash_update(&state, &tag, 1U);
+
+  absorb_bytes(&state, key, key_size);
+  absorb_bytes(&state, sig, sig_size);
+  absorb_bytes(&state, msg, msg_size);
+
+  (void)crypto_generichash_final(&state, digest, CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE);
+
+  entry = &cache->entries[slot_of(cache, digest)];
+
+  if (entry->used && (memcmp(entry->digest, digest, CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE) == 0))
+  {
+    ++cache->hits;
+    *valid = entry->valid;
+
+    return true;
+  }
+
+  ++cache->misses;
+
+  return false;
+}
+
+void
+cardano_uplc_sig_cache_store(cardano_uplc_sig_cache_t* cache, const byte_t digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE], bool valid)
+{
+  sig_cache_entry_t* entry = &cache->entries[slot_of(cache, digest)];
+
+  cardano_safe_memcpy(entry->digest, sizeof(entry->digest), digest, CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE);
+
+  entry->used  = true;
+  entry->valid = valid;
+}
+
+uint64_t
+cardano_uplc_sig_cache_get_hits(const cardano_uplc_sig_cache_t* cache)
+{
+  return (cache == NULL) ? 0U : cache->hits;
+}
+
+uint64_t
+cardano_uplc_sig_cache_get_misses(const cardano_uplc_sig_cache_t* cache)
+{
+  return (cache == NULL) ? 0U : cache->misses;
+}
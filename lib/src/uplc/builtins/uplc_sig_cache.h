@@ -0,0 +1,156 @@
+/**
+ * \file uplc_sig_cache.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UPLC_BUILTINS_UPLC_SIG_CACHE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UPLC_BUILTINS_UPLC_SIG_CACHE_H
+
+/* INCLUDES ******************************************************************/
+
+#include "uplc_builtin.h"
+
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The size of the digest that keys one signature check, in bytes.
+ */
+#define CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE 32U
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A cache of signature verification outcomes shared across script runs.
+ *
+ * Multisig-style validators often check the same (key, message, signature) triple
+ * in several redeemers of one transaction. The cache remembers the boolean outcome of each
+ * \c verifyEd25519Signature, \c verifyEcdsaSecp256k1Signature and
+ * \c verifySchnorrSecp256k1Signature call, keyed by a BLAKE2b-256 digest of the
+ * builtin and its three arguments, so a repeated check skips the host crypto.
+ *
+ * Only the crypto is skipped: the builtin's cost is charged before its body runs,
+ * and the argument checks that make a call a script error still run on every
+ * call, so an evaluation spends the same budget and reaches the same outcome with
+ * or without a cache. The table is direct-mapped: a colliding entry replaces the
+ * older one. A cache is not safe for concurrent use: an owner that may be
+ * called from several threads creates one per call rather than sharing it.
+ */
+typedef struct cardano_uplc_sig_cache_t cardano_uplc_sig_cache_t;
+
+/**
+ * \brief Creates an empty signature verification cache.
+ *
+ * \param[in] capacity The number of outcomes the cache holds, rounded up to a power
+ *            of two. Must be greater than zero.
+ * \param[out] out On success, the new cache; left untouched on failure. Release it
+ *             with \ref cardano_uplc_sig_cache_free.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p out is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT if \p capacity is 0,
+ *         or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the table cannot be
+ *         allocated.
+ */
+cardano_error_t
+cardano_uplc_sig_cache_new(size_t capacity, cardano_uplc_sig_cache_t** out);
+
+/**
+ * \brief Releases a signature verification cache and sets the pointer to NULL.
+ *
+ * \param[in,out] cache The cache to release. NULL and a pointer to NULL are
+ *                ignored.
+ */
+void
+cardano_uplc_sig_cache_free(cardano_uplc_sig_cache_t** cache);
+
+/**
+ * \brief Looks up the remembered outcome of a signature check.
+ *
+ * \param[in] cache The cache. Must not be NULL.
+ * \param[in] func The verification builtin, which names the algorithm.
+ * \param[in] key The public key bytes.
+ * \param[in] key_size The public key size.
+ * \param[in] msg The message bytes. May be NULL only when \p msg_size is 0.
+ * \param[in] msg_size The message size.
+ * \param[in] sig The signature bytes.
+ * \param[in] sig_size The signature size.
+ * \param[out] digest Receives the digest keying the check, to hand to
+ *             \ref cardano_uplc_sig_cache_store on a miss.
+ * \param[out] valid On a hit, the remembered outcome; left untouched on a miss.
+ *
+ * \return \c true on a hit, \c false on a miss.
+ */
+bool
+cardano_uplc_sig_cache_lookup(
+  cardano_uplc_sig_cache_t* cache,
+  cardano_uplc_builtin_t    func,
+  const byte_t*             key,
+  size_t                    key_size,
+  const byte_t*             msg,
+  size_t                    msg_size,
+  const byte_t*             sig,
+  size_t                    sig_size,
+  byte_t                    digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE],
+  bool*                     valid);
+
+/**
+ * \brief Remembers the outcome of a signature check.
+ *
+ * \param[in] cache The cache. Must not be NULL.
+ * \param[in] digest The key \ref cardano_uplc_sig_cache_lookup produced for the check.
+ * \param[in] valid The verification outcome.
+ */
+void
+cardano_uplc_sig_cache_store(cardano_uplc_sig_cache_t* cache, const byte_t digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE], bool valid);
+
+/**
+ * \brief Returns the number of lookups that found a remembered outcome.
+ *
+ * \param[in] cache The cache. May be NULL, in which case 0 is returned.
+ *
+ * \return The hit count.
+ */
+uint64_t
+cardano_uplc_sig_cache_get_hits(const cardano_uplc_sig_cache_t* cache);
+
+/**
+ * \brief Returns the number of lookups that had to run the verification.
+ *
+ * \param[in] cache The cache. May be NULL, in which case 0 is returned.
+ *
+ * \return The miss count.
+ */
+uint64_t
+cardano_uplc_sig_cache_get_misses(const cardano_uplc_sig_cache_t* cache);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BIGLUP_LABS_INCLUDE_CARDANO_UPLC_BUILTINS_UPLC_SIG_CACHE_H */
@@ -1239,27 +1239,33 @@ arg_ex_mem(const cardano_uplc_value_t* value, bool costs_strings_by_utf8_bytes)
   return cardano_uplc_value_ex_mem(value, costs_strings_by_utf8_bytes);
 }
 
-/* DEFINITIONS ***************************************************************/
-
-cardano_uplc_budget_t
-cardano_uplc_builtin_cost(
-  const cardano_uplc_builtin_costs_t* costs,
-  cardano_uplc_builtin_t              func,
-  const cardano_uplc_value_t* const*  args,
-  size_t                              arg_count,
-  bool                                costs_strings_by_utf8_bytes)
+/**
+ * \brief Computes a builtin's budget from its cost entry, deriving every size.
+ *
+ * Feeds the ex-mem of each argument, then overrides the literal-derived sizes of
+ * the few builtins that take one, and evaluates whichever cost shape \p e holds.
+ * This is the shared path behind \ref cardano_uplc_builtin_cost and the fallback
+ * \ref cardano_uplc_builtin_cost_resolve hands out.
+ *
+ * \param[in] e The builtin's cost entry.
+ * \param[in] func The builtin being applied.
+ * \param[in] args The saturated argument values.
+ * \param[in] arg_count The number of arguments.
+ * \param[in] costs_strings_by_utf8_bytes The string-measure flag.
+ *
+ * \return The cpu and mem budget.
+ */
+static cardano_uplc_budget_t
+cost_general(
+  const cardano_uplc_builtin_cost_t* e,
+  cardano_uplc_builtin_t             func,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  bool                               costs_strings_by_utf8_bytes)
 {
-  cardano_uplc_budget_t              result = { 0, 0 };
-  const cardano_uplc_builtin_cost_t* e      = NULL;
-  int64_t                            s[6]   = { 0, 0, 0, 0, 0, 0 };
-  size_t                             i      = 0U;
-
-  if ((costs == NULL) || ((size_t)func >= (size_t)CARDANO_UPLC_BUILTIN_COUNT))
-  {
-    return result;
-  }
-
-  e = &costs->entries[(size_t)func];
+  cardano_uplc_budget_t result = { 0, 0 };
+  int64_t               s[6]   = { 0, 0, 0, 0, 0, 0 };
+  size_t                i      = 0U;
 
   for (i = 0U; (i < arg_count) && (i < 6U); ++i)
   {
@@ -1382,3 +1388,209 @@ cardano_uplc_builtin_cost(
 
   return result;
 }
+
+/**
+ * \brief Whether a builtin feeds any literal-derived size to its costing function.
+ *
+ * Mirrors the override chain in \ref cost_general; a builtin listed here must go
+ * through that path to be costed exactly.
+ *
+ * \param[in] func The builtin to test.
+ *
+ * \return \c true when at least one size is not the argument's ex-mem.
+ */
+static bool
+has_literal_sizes(cardano_uplc_builtin_t func)
+{
+  switch (func)
+  {
+    case CARDANO_UPLC_BUILTIN_INTEGER_TO_BYTE_STRING:
+    case CARDANO_UPLC_BUILTIN_REPLICATE_BYTE:
+    case CARDANO_UPLC_BUILTIN_WRITE_BITS:
+    case CARDANO_UPLC_BUILTIN_SHIFT_BYTE_STRING:
+    case CARDANO_UPLC_BUILTIN_ROTATE_BYTE_STRING:
+    case CARDANO_UPLC_BUILTIN_DROP_LIST:
+    case CARDANO_UPLC_BUILTIN_LIST_TO_ARRAY:
+    case CARDANO_UPLC_BUILTIN_BLS12_381_G1_MULTI_SCALAR_MUL:
+    case CARDANO_UPLC_BUILTIN_BLS12_381_G2_MULTI_SCALAR_MUL:
+    case CARDANO_UPLC_BUILTIN_INSERT_COIN:
+    case CARDANO_UPLC_BUILTIN_LOOKUP_COIN:
+    case CARDANO_UPLC_BUILTIN_UNION_VALUE:
+    case CARDANO_UPLC_BUILTIN_VALUE_CONTAINS:
+    case CARDANO_UPLC_BUILTIN_VALUE_DATA:
+    case CARDANO_UPLC_BUILTIN_UN_VALUE_DATA:
+    case CARDANO_UPLC_BUILTIN_SCALE_VALUE:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * \brief Returns the ex-mem size of argument \p index, or 0 when it was not applied.
+ *
+ * \param[in] args The argument values, or NULL.
+ * \param[in] arg_count The number of arguments.
+ * \param[in] index The argument position.
+ * \param[in] costs_strings_by_utf8_bytes The string-measure flag.
+ *
+ * \return The argument's ex-mem size, or 0.
+ */
+static inline int64_t
+arg_size(const cardano_uplc_value_t* const* args, size_t arg_count, size_t index, bool costs_strings_by_utf8_bytes)
+{
+  if ((args == NULL) || (index >= arg_count))
+  {
+    return 0;
+  }
+
+  return arg_ex_mem(args[index], costs_strings_by_utf8_bytes);
+}
+
+/**
+ * \brief Costs a one-size builtin whose size is its first argument's ex-mem.
+ *
+ * \param[in] e The builtin's cost entry, of arity ONE.
+ * \param[in] func Unused; part of the costing-function signature.
+ * \param[in] args The saturated argument values.
+ * \param[in] arg_count The number of arguments.
+ * \param[in] costs_strings_by_utf8_bytes The string-measure flag.
+ *
+ * \return The cpu and mem budget.
+ */
+static cardano_uplc_budget_t
+cost_one_ex_mem(
+  const cardano_uplc_builtin_cost_t* e,
+  cardano_uplc_builtin_t             func,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  bool                               costs_strings_by_utf8_bytes)
+{
+  cardano_uplc_budget_t result = { 0, 0 };
+  int64_t               x      = arg_size(args, arg_count, 0U, costs_strings_by_utf8_bytes);
+
+  (void)func;
+
+  result.cpu = cardano_uplc_one_arg_eval(&e->cpu.one, x);
+  result.mem = cardano_uplc_one_arg_eval(&e->mem.one, x);
+
+  return result;
+}
+
+/**
+ * \brief Costs a two-size builtin whose sizes are its arguments' ex-mem.
+ *
+ * \param[in] e The builtin's cost entry, of arity TWO.
+ * \param[in] func Unused; part of the costing-function signature.
+ * \param[in] args The saturated argument values.
+ * \param[in] arg_count The number of arguments.
+ * \param[in] costs_strings_by_utf8_bytes The string-measure flag.
+ *
+ * \return The cpu and mem budget.
+ */
+static cardano_uplc_budget_t
+cost_two_ex_mem(
+  const cardano_uplc_builtin_cost_t* e,
+  cardano_uplc_builtin_t             func,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  bool                               costs_strings_by_utf8_bytes)
+{
+  cardano_uplc_budget_t result = { 0, 0 };
+  int64_t               x      = arg_size(args, arg_count, 0U, costs_strings_by_utf8_bytes);
+  int64_t               y      = arg_size(args, arg_count, 1U, costs_strings_by_utf8_bytes);
+
+  (void)func;
+
+  result.cpu = cardano_uplc_two_arg_eval(&e->cpu.two, x, y);
+  result.mem = cardano_uplc_two_arg_eval(&e->mem.two, x, y);
+
+  return result;
+}
+
+/**
+ * \brief Costs a three-size builtin whose sizes are its arguments' ex-mem.
+ *
+ * \param[in] e The builtin's cost entry, of arity THREE.
+ * \param[in] func Unused; part of the costing-function signature.
+ * \param[in] args The saturated argument values.
+ * \param[in] arg_count The number of arguments.
+ * \param[in] costs_strings_by_utf8_bytes The string-measure flag.
+ *
+ * \return The cpu and mem budget.
+ */
+static cardano_uplc_budget_t
+cost_three_ex_mem(
+  const cardano_uplc_builtin_cost_t* e,
+  cardano_uplc_builtin_t             func,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  bool                               costs_strings_by_utf8_bytes)
+{
+  cardano_uplc_budget_t result = { 0, 0 };
+  int64_t               x      = arg_size(args, arg_count, 0U, costs_strings_by_utf8_bytes);
+  int64_t               y      = arg_size(args, arg_count, 1U, costs_strings_by_utf8_bytes);
+  int64_t               z      = arg_size(args, arg_count, 2U, costs_strings_by_utf8_bytes);
+
+  (void)func;
+
+  result.cpu = cardano_uplc_three_arg_eval(&e->cpu.three, x, y, z);
+  result.mem = cardano_uplc_three_arg_eval(&e->mem.three, x, y, z);
+
+  return result;
+}
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_uplc_budget_t
+cardano_uplc_builtin_cost(
+  const cardano_uplc_builtin_costs_t* costs,
+  cardano_uplc_builtin_t              func,
+  const cardano_uplc_value_t* const*  args,
+  size_t                              arg_count,
+  bool                                costs_strings_by_utf8_bytes)
+{
+  cardano_uplc_budget_t result = { 0, 0 };
+
+  if ((costs == NULL) || ((size_t)func >= (size_t)CARDANO_UPLC_BUILTIN_COUNT))
+  {
+    return result;
+  }
+
+  return cost_general(&costs->entries[(size_t)func], func, args, arg_count, costs_strings_by_utf8_bytes);
+}
+
+cardano_uplc_builtin_cost_fn_t
+cardano_uplc_builtin_cost_resolve(const cardano_uplc_builtin_costs_t* costs, cardano_uplc_builtin_t func)
+{
+  if ((costs == NULL) || ((size_t)func >= (size_t)CARDANO_UPLC_BUILTIN_COUNT) || has_literal_sizes(func))
+  {
+    return cost_general;
+  }
+
+  switch (costs->entries[(size_t)func].arity)
+  {
+    case CARDANO_UPLC_BUILTIN_COST_ARITY_ONE:
+    {
+      return cost_one_ex_mem;
+    }
+    case CARDANO_UPLC_BUILTIN_COST_ARITY_TWO:
+    {
+      return cost_two_ex_mem;
+    }
+    case CARDANO_UPLC_BUILTIN_COST_ARITY_THREE:
+    {
+      return cost_three_ex_mem;
+    }
+    case CARDANO_UPLC_BUILTIN_COST_ARITY_FOUR:
+    case CARDANO_UPLC_BUILTIN_COST_ARITY_SIX:
+    default:
+    {
+      return cost_general;
+    }
+  }
+}
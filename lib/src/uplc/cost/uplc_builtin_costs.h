@@ -112,6 +112,46 @@ cardano_uplc_builtin_cost(
   size_t                              arg_count,
   bool                                costs_strings_by_utf8_bytes);
 
+/**
+ * \brief A costing function pre-selected for one builtin and one cost entry.
+ *
+ * Produced by \ref cardano_uplc_builtin_cost_resolve. Calling it with the entry it
+ * was resolved for yields exactly the budget \ref cardano_uplc_builtin_cost computes
+ * for the same builtin and arguments, without re-deciding the argument sizing or
+ * the cost shape.
+ *
+ * \param[in] entry The builtin's cost entry. Must not be NULL.
+ * \param[in] func The builtin being applied.
+ * \param[in] args The saturated argument values, in application order.
+ * \param[in] arg_count The number of arguments applied.
+ * \param[in] costs_strings_by_utf8_bytes Selects the string ex-mem measure.
+ *
+ * \return The cpu and mem budget the builtin charges.
+ */
+typedef cardano_uplc_budget_t (*cardano_uplc_builtin_cost_fn_t)(
+  const cardano_uplc_builtin_cost_t* entry,
+  cardano_uplc_builtin_t             func,
+  const cardano_uplc_value_t* const* args,
+  size_t                             arg_count,
+  bool                               costs_strings_by_utf8_bytes);
+
+/**
+ * \brief Selects the specialized costing function for one builtin.
+ *
+ * Builtins whose sizes are all argument ex-mem and whose entry has one, two or
+ * three size parameters get a function that measures only those arguments and
+ * evaluates that shape directly; builtins with a literal-derived size, or a wider
+ * shape, get the general path shared with \ref cardano_uplc_builtin_cost.
+ *
+ * \param[in] costs The per-builtin costs the function will be called with. Must
+ *            not be NULL.
+ * \param[in] func The builtin to resolve. Must be a valid builtin tag.
+ *
+ * \return The costing function; never NULL.
+ */
+cardano_uplc_builtin_cost_fn_t
+cardano_uplc_builtin_cost_resolve(const cardano_uplc_builtin_costs_t* costs, cardano_uplc_builtin_t func);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -24,7 +24,9 @@
 #include "uplc_selected_cost_model.h"
 #include "../ast/uplc_lang_version.h"
 #include "../builtins/uplc_builtin_semantics.h"
+#include "uplc_builtin_costs.h"
 #include "uplc_cost_model.h"
+#include "uplc_machine_costs.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -94,3 +96,36 @@ cardano_uplc_select_cost_model(
 
   return CARDANO_SUCCESS;
 }
+
+void
+cardano_uplc_select_default_cost_model(
+  cardano_uplc_lang_version_t         lang_version,
+  uint64_t                            protocol_major,
+  cardano_uplc_selected_cost_model_t* out)
+{
+  const cardano_uplc_cost_model_version_t cost_version = cardano_uplc_cost_model_version_for_language(lang_version);
+
+  out->model.machine = cardano_uplc_machine_costs_default(cost_version);
+
+  switch (cost_version)
+  {
+    case CARDANO_UPLC_COST_MODEL_VERSION_V1:
+    {
+      out->model.builtins = cardano_uplc_builtin_costs_v1();
+      break;
+    }
+    case CARDANO_UPLC_COST_MODEL_VERSION_V2:
+    {
+      out->model.builtins = cardano_uplc_builtin_costs_v2();
+      break;
+    }
+    case CARDANO_UPLC_COST_MODEL_VERSION_V3:
+    default:
+    {
+      out->model.builtins = cardano_uplc_builtin_costs_v3();
+      break;
+    }
+  }
+
+  out->semantics = cardano_uplc_builtin_semantics_for_language_and_protocol(lang_version, protocol_major);
+}
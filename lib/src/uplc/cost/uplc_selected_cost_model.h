@@ -106,6 +106,23 @@ cardano_uplc_select_cost_model(
   size_t                              count,
   cardano_uplc_selected_cost_model_t* out);
 
+/**
+ * \brief Selects the built-in default cost model and builtin semantics for a script.
+ * The fallback of \ref cardano_uplc_select_cost_model for callers that hold no
+ * ledger cost model for the language: the machine step costs and builtin costs are
+ * the library defaults for the language version's cost-model ordering, and the
+ * semantics variant is selected exactly as \ref cardano_uplc_select_cost_model does.
+ * \param[in] lang_version The script's language version.
+ * \param[in] protocol_major The protocol major version, selecting the semantics
+ *            variant.
+ * \param[out] out Set to the default cost model and semantics. Must not be NULL.
+ */
+void
+cardano_uplc_select_default_cost_model(
+  cardano_uplc_lang_version_t         lang_version,
+  uint64_t                            protocol_major,
+  cardano_uplc_selected_cost_model_t* out);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -85,6 +85,16 @@ static const size_t CARDANO_UPLC_DATA_CBOR_CHUNK = 64U;
  */
 static const int64_t CARDANO_UPLC_DATA_UNCOMPUTED = -1;
 
+/**
+ * \brief The 64-bit FNV-1a offset basis, the seed of every node hash.
+ */
+static const uint64_t CARDANO_UPLC_DATA_HASH_SEED = 0xCBF29CE484222325ULL;
+
+/**
+ * \brief The 64-bit FNV-1a prime used to fold bytes and child hashes.
+ */
+static const uint64_t CARDANO_UPLC_DATA_HASH_PRIME = 0x100000001B3ULL;
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -517,6 +527,175 @@ children_node_count(const cardano_uplc_data_t* data)
   return total;
 }
 
+/**
+ * \brief Finalizes a 64-bit hash state with the splitmix64 avalanche.
+ *
+ * \param[in] value The hash state.
+ *
+ * \return The mixed value.
+ */
+static uint64_t
+hash_mix(uint64_t value)
+{
+  uint64_t mixed = value;
+
+  mixed ^= mixed >> 30U;
+  mixed *= 0xBF58476D1CE4E5B9ULL;
+  mixed ^= mixed >> 27U;
+  mixed *= 0x94D049BB133111EBULL;
+  mixed ^= mixed >> 31U;
+
+  return mixed;
+}
+
+/**
+ * \brief Folds one 64-bit word into a hash state.
+ *
+ * \param[in] state The current hash state.
+ * \param[in] word The word to fold in.
+ *
+ * \return The updated hash state.
+ */
+static uint64_t
+hash_fold(uint64_t state, uint64_t word)
+{
+  return (state ^ hash_mix(word)) * CARDANO_UPLC_DATA_HASH_PRIME;
+}
+
+/**
+ * \brief Returns the hash of an integer leaf, independent of its representation.
+ *
+ * A bigint that fits an \c int64_t hashes as the inline value so the two storage
+ * forms \ref integer_equals treats as equal always collide. A wider bigint folds
+ * only its sign and bit length: coarse, but every such collision is resolved by the
+ * full comparison.
+ *
+ * \param[in] data An integer data node.
+ *
+ * \return The integer leaf hash.
+ */
+static uint64_t
+integer_hash(const cardano_uplc_data_t* data)
+{
+  uint64_t state        = hash_fold(CARDANO_UPLC_DATA_HASH_SEED, (uint64_t)CARDANO_UPLC_DATA_KIND_INTEGER);
+  int64_t  inline_value = 0;
+
+  if (data->as.integer.is_small)
+  {
+    return hash_fold(state, (uint64_t)data->as.integer.small);
+  }
+
+  if (data->as.integer.big == NULL)
+  {
+    return hash_fold(state, 0U);
+  }
+
+  if (cardano_uplc_int_bigint_fits_int64(data->as.integer.big, &inline_value))
+  {
+    return hash_fold(state, (uint64_t)inline_value);
+  }
+
+  state = hash_fold(state, (uint64_t)(int64_t)cardano_bigint_signum(data->as.integer.big));
+
+  return hash_fold(state, (uint64_t)cardano_bigint_bit_length(data->as.integer.big));
+}
+
+/**
+ * \brief Returns the hash of a byte-string leaf.
+ *
+ * \param[in] data A byte-string data node.
+ *
+ * \return The byte-string leaf hash.
+ */
+static uint64_t
+bytes_hash(const cardano_uplc_data_t* data)
+{
+  uint64_t state = hash_fold(CARDANO_UPLC_DATA_HASH_SEED, (uint64_t)CARDANO_UPLC_DATA_KIND_BYTES);
+
+  state = hash_fold(state, (uint64_t)data->as.bytes.size);
+
+  for (size_t i = 0U; i < data->as.bytes.size; ++i)
+  {
+    state = (state ^ (uint64_t)data->as.bytes.data[i]) * CARDANO_UPLC_DATA_HASH_PRIME;
+  }
+
+  return hash_mix(state);
+}
+
+/**
+ * \brief Combines the memoized hashes of a node's immediate children into its own.
+ *
+ * \param[in] data The parent node, whose children's hash memos are set.
+ *
+ * \return The node hash.
+ */
+static uint64_t
+children_hash(const cardano_uplc_data_t* data)
+{
+  uint64_t state = hash_fold(CARDANO_UPLC_DATA_HASH_SEED, (uint64_t)data->kind);
+  size_t   i     = 0U;
+
+  switch (data->kind)
+  {
+    case CARDANO_UPLC_DATA_KIND_CONSTR:
+    {
+      state = hash_fold(state, data->as.constr.tag);
+      state = hash_fold(state, (uint64_t)data->as.constr.count);
+
+      for (i = 0U; i < data->as.constr.count; ++i)
+      {
+        const cardano_uplc_data_t* child = data->as.constr.fields[i];
+
+        state = hash_fold(state, (child != NULL) ? child->hash : 0U);
+      }
+
+      break;
+    }
+    case CARDANO_UPLC_DATA_KIND_MAP:
+    {
+      state = hash_fold(state, (uint64_t)data->as.map.count);
+
+      for (i = 0U; i < data->as.map.count; ++i)
+      {
+        const cardano_uplc_data_t* key   = data->as.map.entries[i].key;
+        const cardano_uplc_data_t* value = data->as.map.entries[i].value;
+
+        state = hash_fold(state, (key != NULL) ? key->hash : 0U);
+        state = hash_fold(state, (value != NULL) ? value->hash : 0U);
+      }
+
+      break;
+    }
+    case CARDANO_UPLC_DATA_KIND_LIST:
+    {
+      state = hash_fold(state, (uint64_t)data->as.list.count);
+
+      for (i = 0U; i < data->as.list.count; ++i)
+      {
+        const cardano_uplc_data_t* child = data->as.list.items[i];
+
+        state = hash_fold(state, (child != NULL) ? child->hash : 0U);
+      }
+
+      break;
+    }
+    case CARDANO_UPLC_DATA_KIND_INTEGER:
+    {
+      return integer_hash(data);
+    }
+    case CARDANO_UPLC_DATA_KIND_BYTES:
+    {
+      return bytes_hash(data);
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return hash_mix(state);
+}
+
 /**
  * \brief Computes the data ex-mem of a subtree iteratively, memoizing every node.
  *
@@ -647,6 +826,68 @@ compute_node_count(const cardano_uplc_data_t* data)
   return data->node_count;
 }
 
+/**
+ * \brief Hashes a subtree iteratively, memoizing every node.
+ *
+ * Uses an explicit post-order work stack so adversarial nesting cannot overflow the C
+ * stack. Unlike the cost walks there is no safe partial answer, so an allocation
+ * failure is reported and any hashes already memoized on descendants stay valid.
+ *
+ * \param[in] data The data node. Must not be NULL.
+ *
+ * \return \c true when \c data->hash is set, \c false if the work stack cannot grow.
+ */
+static bool
+compute_hash(const cardano_uplc_data_t* data)
+{
+  walk_frame_t* stack    = NULL;
+  size_t        capacity = 0U;
+  size_t        count    = 0U;
+
+  if (data->has_hash)
+  {
+    return true;
+  }
+
+  if (!walk_push(&stack, &capacity, &count, data, false))
+  {
+    return false;
+  }
+
+  while (count > 0U)
+  {
+    // cppcheck-suppress misra-c2012-13.3; Reason: local post-increment with no aliasing
+    walk_frame_t frame = stack[--count];
+
+    if ((frame.node == NULL) || frame.node->has_hash)
+    {
+      continue;
+    }
+
+    if (frame.expanded)
+    {
+      // cppcheck-suppress misra-c2012-11.8; Reason: interfacing a non-const-correct API
+      cardano_uplc_data_t* node = (cardano_uplc_data_t*)((void*)frame.node);
+
+      node->hash     = children_hash(frame.node);
+      node->has_hash = true;
+
+      continue;
+    }
+
+    if (!walk_push(&stack, &capacity, &count, frame.node, true) || !push_children(frame.node, &stack, &capacity, &count))
+    {
+      _cardano_free(stack);
+
+      return false;
+    }
+  }
+
+  _cardano_free(stack);
+
+  return true;
+}
+
 /**
  * \brief Tests two integer data nodes for value equality.
  *
@@ -2805,8 +3046,12 @@ cardano_uplc_data_integer_materialize(
     return result;
   }
 
-  mutable_node->as.integer.big = built;
-  *out                         = built;
+  if (cardano_uplc_arena_owns(arena, data))
+  {
+    mutable_node->as.integer.big = built;
+  }
+
+  *out = built;
 
   return CARDANO_SUCCESS;
 }
@@ -2819,6 +3064,16 @@ cardano_uplc_data_equals(const cardano_uplc_data_t* lhs, const cardano_uplc_data
   size_t         count    = 0U;
   bool           equal    = true;
 
+  if (lhs == rhs)
+  {
+    return true;
+  }
+
+  if ((lhs != NULL) && (rhs != NULL) && compute_hash(lhs) && compute_hash(rhs) && (lhs->hash != rhs->hash))
+  {
+    return false;
+  }
+
   if (!equals_push(&stack, &capacity, &count, lhs, rhs))
   {
     return false;
@@ -2846,6 +3101,13 @@ cardano_uplc_data_equals(const cardano_uplc_data_t* lhs, const cardano_uplc_data
       break;
     }
 
+    if (a->has_hash && b->has_hash && (a->hash != b->hash))
+    {
+      equal = false;
+
+      break;
+    }
+
     switch (a->kind)
     {
       case CARDANO_UPLC_DATA_KIND_CONSTR:
@@ -2954,6 +3216,31 @@ cardano_uplc_data_node_count(const cardano_uplc_data_t* data)
   return compute_node_count(data);
 }
 
+bool
+cardano_uplc_data_node_hash(const cardano_uplc_data_t* data, uint64_t* out)
+{
+  if (out == NULL)
+  {
+    return false;
+  }
+
+  if (data == NULL)
+  {
+    *out = 0U;
+
+    return true;
+  }
+
+  if (!compute_hash(data))
+  {
+    return false;
+  }
+
+  *out = data->hash;
+
+  return true;
+}
+
 cardano_error_t
 cardano_uplc_data_from_cbor_bytes(
   cardano_uplc_arena_t* arena,
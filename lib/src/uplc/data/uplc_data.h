@@ -64,13 +64,17 @@ extern "C" {
  * The \c ex_mem field memoizes the data ex-mem of the subtree rooted at this node:
  * it is \c -1 until the first \ref cardano_uplc_data_ex_mem call fills it, after
  * which the value is reused with no re-walk. The \c node_count field memoizes the
- * subtree node count the same way.
+ * subtree node count the same way. The \c hash field memoizes a structural hash of
+ * the subtree, valid once \c has_hash is set by \ref cardano_uplc_data_node_hash;
+ * structurally equal trees always hash equal, so a hash mismatch proves inequality.
  */
 typedef struct cardano_uplc_data_t
 {
     cardano_uplc_data_kind_t kind;
     int64_t                  ex_mem;
     int64_t                  node_count;
+    uint64_t                 hash;
+    bool                     has_hash;
 
     // cppcheck-suppress misra-c2012-19.2; Reason: tagged union is the VM value and cost-shape representation
     union
@@ -247,8 +251,10 @@ cardano_uplc_data_new_bytes(
  * For a node whose value already lives in \c integer.big this returns it directly.
  * For an inline node it builds a bigint equal to \c integer.small, registers it with
  * \p arena (which takes ownership), caches it in the node, and returns it; later
- * calls return the cached pointer. The returned bigint is owned by the arena and the
- * caller must not unref it.
+ * calls return the cached pointer. The bigint is only cached when the node itself
+ * was allocated from \p arena; a node owned by a longer-lived arena gets a fresh
+ * bigint on every call, so resetting \p arena never leaves it dangling. The returned
+ * bigint is owned by the arena and the caller must not unref it.
  *
  * \param[in] arena The arena the lazily built bigint is registered with.
  * \param[in] data An integer data node. Must not be NULL and must be of kind
@@ -273,6 +279,11 @@ cardano_uplc_data_integer_materialize(
  * integer value (inline or bigint), and byte content. Mirrors the structural
  * equality of \ref cardano_plutus_data_equals on the same tree.
  *
+ * Both roots are hashed first with \ref cardano_uplc_data_node_hash, so a mismatch
+ * is rejected without descending and repeated comparisons against the same tree
+ * reuse the memoized hashes. Pointer-equal subtrees and subtrees whose hashes
+ * differ are settled without a walk; only equal-hash pairs are compared in full.
+ *
  * \param[in] lhs The first node, or NULL.
  * \param[in] rhs The second node, or NULL.
  *
@@ -310,6 +321,24 @@ cardano_uplc_data_node_ex_mem(const cardano_uplc_data_t* data);
 int64_t
 cardano_uplc_data_node_count(const cardano_uplc_data_t* data);
 
+/**
+ * \brief Returns the memoized structural hash of a data tree.
+ *
+ * Hashes every node bottom-up by the same iterative traversal as
+ * \ref cardano_uplc_data_node_ex_mem, caching the result on each node. The hash
+ * covers exactly what \ref cardano_uplc_data_equals compares: an integer hashes
+ * the same whether stored inline or as a bigint, and the map round-trip flag is
+ * ignored. A NULL node hashes to 0.
+ *
+ * \param[in] data The data tree, or NULL.
+ * \param[out] out On success, the structural hash.
+ *
+ * \return \c true on success, \c false if the traversal cannot allocate its work
+ *         stack, in which case \p out is left untouched.
+ */
+bool
+cardano_uplc_data_node_hash(const cardano_uplc_data_t* data, uint64_t* out);
+
 /**
  * \brief Parses CBOR bytes into an arena data tree with no per-node caching.
  *
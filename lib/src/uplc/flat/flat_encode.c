@@ -736,3 +736,35 @@ cardano_uplc_int_flat_encode_program(
 
   return result;
 }
+
+cardano_error_t
+cardano_uplc_int_flat_term_size(
+  const cardano_uplc_term_t* term,
+  size_t*                    out_bits)
+{
+  cardano_uplc_flat_writer_t writer = { NULL, 0U, 0U };
+  cardano_error_t            result = CARDANO_SUCCESS;
+
+  if ((term == NULL) || (out_bits == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  result = cardano_uplc_flat_writer_init(&writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = write_term(&writer, term);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *out_bits = (cardano_buffer_get_size(writer.buffer) * 8U) + (size_t)writer.used;
+  }
+
+  cardano_uplc_flat_writer_dispose(&writer);
+
+  return result;
+}
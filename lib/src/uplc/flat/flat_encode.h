@@ -62,6 +62,27 @@ cardano_uplc_int_flat_encode_program(
   const cardano_uplc_program_t* program,
   cardano_buffer_t**            out_flat);
 
+/**
+ * \brief Measures the flat encoding of a term, in bits.
+ *
+ * Writes \p term exactly as \ref cardano_uplc_int_flat_encode_program would, but
+ * starting on a byte boundary, and reports how many bits it took. The padding
+ * before a byte string depends on where the term lands in a program, so the size
+ * inside a program may differ from this by up to seven bits per byte string.
+ *
+ * \param[in] term The term to measure. Must not be NULL.
+ * \param[out] out_bits On success, the encoded size in bits; left untouched on failure.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p term or \p out_bits is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT for a
+ *         term with no flat serialization, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if a buffer cannot be grown.
+ */
+cardano_error_t
+cardano_uplc_int_flat_term_size(
+  const cardano_uplc_term_t* term,
+  size_t*                    out_bits);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
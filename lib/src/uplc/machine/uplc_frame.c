@@ -23,230 +23,268 @@
 
 #include "uplc_frame.h"
 
-#include "../arena/uplc_arena.h"
+#include "../../allocators.h"
 
 #include <stddef.h>
+#include <string.h>
 
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Allocates a zero-initialized frame from the arena.
+ * \brief Reserves a zero-initialized frame on top of the stack, growing it as needed.
  *
- * \param[in] arena The arena to allocate from.
+ * \param[in,out] stack The stack to push onto.
  *
- * \return The new frame, or NULL if the arena cannot serve the node.
+ * \return The new top frame, or NULL if the stack cannot grow.
  */
 static cardano_uplc_frame_t*
-alloc_frame(cardano_uplc_arena_t* arena)
+push_frame(cardano_uplc_frame_stack_t* stack)
 {
-  return (cardano_uplc_frame_t*)cardano_uplc_arena_alloc(arena, sizeof(cardano_uplc_frame_t), 0U);
+  cardano_uplc_frame_t* frame = NULL;
+
+  if (stack->count >= stack->capacity)
+  {
+    size_t                next  = (stack->capacity == 0U) ? 64U : (stack->capacity * 2U);
+    cardano_uplc_frame_t* grown = (cardano_uplc_frame_t*)_cardano_realloc(stack->frames, next * sizeof(cardano_uplc_frame_t));
+
+    if (grown == NULL)
+    {
+      return NULL;
+    }
+
+    stack->frames   = grown;
+    stack->capacity = next;
+  }
+
+  frame = &stack->frames[stack->count];
+  ++stack->count;
+
+  (void)memset(frame, 0, sizeof(cardano_uplc_frame_t));
+
+  return frame;
 }
 
 /* DEFINITIONS ***************************************************************/
 
+void
+cardano_uplc_frame_stack_init(cardano_uplc_frame_stack_t* stack)
+{
+  if (stack == NULL)
+  {
+    return;
+  }
+
+  stack->frames   = NULL;
+  stack->count    = 0U;
+  stack->capacity = 0U;
+}
+
+void
+cardano_uplc_frame_stack_free(cardano_uplc_frame_stack_t* stack)
+{
+  if (stack == NULL)
+  {
+    return;
+  }
+
+  _cardano_free(stack->frames);
+
+  cardano_uplc_frame_stack_init(stack);
+}
+
+cardano_uplc_frame_t*
+cardano_uplc_frame_stack_top(const cardano_uplc_frame_stack_t* stack)
+{
+  if ((stack == NULL) || (stack->count == 0U))
+  {
+    return NULL;
+  }
+
+  return &stack->frames[stack->count - 1U];
+}
+
+void
+cardano_uplc_frame_stack_pop(cardano_uplc_frame_stack_t* stack)
+{
+  if ((stack == NULL) || (stack->count == 0U))
+  {
+    return;
+  }
+
+  --stack->count;
+}
+
 cardano_error_t
-cardano_uplc_frame_new_no_frame(
-  cardano_uplc_arena_t*  arena,
-  cardano_uplc_frame_t** out)
+cardano_uplc_frame_stack_push_no_frame(cardano_uplc_frame_stack_t* stack)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (out == NULL))
+  if (stack == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind = CARDANO_UPLC_FRAME_NO_FRAME;
-
-  *out = result;
+  frame->kind = CARDANO_UPLC_FRAME_NO_FRAME;
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_uplc_frame_new_await_arg(
-  cardano_uplc_arena_t*       arena,
-  const cardano_uplc_value_t* value,
-  const cardano_uplc_frame_t* ctx,
-  cardano_uplc_frame_t**      out)
+cardano_uplc_frame_stack_push_await_arg(
+  cardano_uplc_frame_stack_t* stack,
+  const cardano_uplc_value_t* value)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (value == NULL) || (ctx == NULL) || (out == NULL))
+  if ((stack == NULL) || (value == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind               = CARDANO_UPLC_FRAME_AWAIT_ARG;
-  result->as.await_arg.value = value;
-  result->as.await_arg.ctx   = ctx;
-
-  *out = result;
+  frame->kind               = CARDANO_UPLC_FRAME_AWAIT_ARG;
+  frame->as.await_arg.value = value;
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_uplc_frame_new_await_fun_term(
-  cardano_uplc_arena_t*       arena,
+cardano_uplc_frame_stack_push_await_fun_term(
+  cardano_uplc_frame_stack_t* stack,
   const cardano_uplc_env_t*   env,
-  const cardano_uplc_term_t*  term,
-  const cardano_uplc_frame_t* ctx,
-  cardano_uplc_frame_t**      out)
+  const cardano_uplc_term_t*  term)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (term == NULL) || (ctx == NULL) || (out == NULL))
+  if ((stack == NULL) || (term == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind                   = CARDANO_UPLC_FRAME_AWAIT_FUN_TERM;
-  result->as.await_fun_term.env  = env;
-  result->as.await_fun_term.term = term;
-  result->as.await_fun_term.ctx  = ctx;
-
-  *out = result;
+  frame->kind                   = CARDANO_UPLC_FRAME_AWAIT_FUN_TERM;
+  frame->as.await_fun_term.env  = env;
+  frame->as.await_fun_term.term = term;
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_uplc_frame_new_await_fun_value(
-  cardano_uplc_arena_t*       arena,
-  const cardano_uplc_value_t* value,
-  const cardano_uplc_frame_t* ctx,
-  cardano_uplc_frame_t**      out)
+cardano_uplc_frame_stack_push_await_fun_value(
+  cardano_uplc_frame_stack_t* stack,
+  const cardano_uplc_value_t* value)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (value == NULL) || (ctx == NULL) || (out == NULL))
+  if ((stack == NULL) || (value == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind                     = CARDANO_UPLC_FRAME_AWAIT_FUN_VALUE;
-  result->as.await_fun_value.value = value;
-  result->as.await_fun_value.ctx   = ctx;
-
-  *out = result;
+  frame->kind                     = CARDANO_UPLC_FRAME_AWAIT_FUN_VALUE;
+  frame->as.await_fun_value.value = value;
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_uplc_frame_new_force(
-  cardano_uplc_arena_t*       arena,
-  const cardano_uplc_frame_t* ctx,
-  cardano_uplc_frame_t**      out)
+cardano_uplc_frame_stack_push_force(cardano_uplc_frame_stack_t* stack)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (ctx == NULL) || (out == NULL))
+  if (stack == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind         = CARDANO_UPLC_FRAME_FORCE;
-  result->as.force.ctx = ctx;
-
-  *out = result;
+  frame->kind = CARDANO_UPLC_FRAME_FORCE;
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_uplc_frame_new_constr(
-  cardano_uplc_arena_t*              arena,
-  const cardano_uplc_env_t*          env,
-  uint64_t                           tag,
-  const cardano_uplc_term_t* const*  fields,
-  size_t                             field_count,
-  const cardano_uplc_value_t* const* resolved,
-  size_t                             resolved_count,
-  const cardano_uplc_frame_t*        ctx,
-  cardano_uplc_frame_t**             out)
+cardano_uplc_frame_stack_push_constr(
+  cardano_uplc_frame_stack_t*       stack,
+  const cardano_uplc_env_t*         env,
+  uint64_t                          tag,
+  const cardano_uplc_term_t* const* fields,
+  size_t                            field_count,
+  const cardano_uplc_value_t**      resolved,
+  size_t                            resolved_count)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (ctx == NULL) || (out == NULL))
+  if ((stack == NULL) || (resolved == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  if (((fields == NULL) && (field_count != 0U)) || ((resolved == NULL) && (resolved_count != 0U)))
+  if ((fields == NULL) && (field_count != 0U))
   {
     return CARDANO_ERROR_INVALID_ARGUMENT;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind                     = CARDANO_UPLC_FRAME_CONSTR;
-  result->as.constr.env            = env;
-  result->as.constr.tag            = tag;
-  result->as.constr.fields         = fields;
-  result->as.constr.field_count    = field_count;
-  result->as.constr.resolved       = resolved;
-  result->as.constr.resolved_count = resolved_count;
-  result->as.constr.ctx            = ctx;
-
-  *out = result;
+  frame->kind                     = CARDANO_UPLC_FRAME_CONSTR;
+  frame->as.constr.env            = env;
+  frame->as.constr.tag            = tag;
+  frame->as.constr.fields         = fields;
+  frame->as.constr.field_count    = field_count;
+  frame->as.constr.resolved       = resolved;
+  frame->as.constr.resolved_count = resolved_count;
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_uplc_frame_new_cases(
-  cardano_uplc_arena_t*             arena,
+cardano_uplc_frame_stack_push_cases(
+  cardano_uplc_frame_stack_t*       stack,
   const cardano_uplc_env_t*         env,
   const cardano_uplc_term_t* const* branches,
-  size_t                            branch_count,
-  const cardano_uplc_frame_t*       ctx,
-  cardano_uplc_frame_t**            out)
+  size_t                            branch_count)
 {
-  cardano_uplc_frame_t* result = NULL;
+  cardano_uplc_frame_t* frame = NULL;
 
-  if ((arena == NULL) || (ctx == NULL) || (out == NULL))
+  if (stack == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
@@ -256,20 +294,17 @@ cardano_uplc_frame_new_cases(
     return CARDANO_ERROR_INVALID_ARGUMENT;
   }
 
-  result = alloc_frame(arena);
+  frame = push_frame(stack);
 
-  if (result == NULL)
+  if (frame == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  result->kind                  = CARDANO_UPLC_FRAME_CASES;
-  result->as.cases.env          = env;
-  result->as.cases.branches     = branches;
-  result->as.cases.branch_count = branch_count;
-  result->as.cases.ctx          = ctx;
-
-  *out = result;
+  frame->kind                  = CARDANO_UPLC_FRAME_CASES;
+  frame->as.cases.env          = env;
+  frame->as.cases.branches     = branches;
+  frame->as.cases.branch_count = branch_count;
 
   return CARDANO_SUCCESS;
 }
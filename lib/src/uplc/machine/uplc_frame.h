@@ -28,7 +28,6 @@
 #include "uplc_frame_kind.h"
 #include "uplc_value.h"
 
-#include "../arena/uplc_arena.h"
 #include "../ast/uplc_term.h"
 #include <cardano/error.h>
 #include <cardano/typedefs.h>
@@ -42,12 +41,13 @@ extern "C" {
 typedef struct cardano_uplc_frame_t cardano_uplc_frame_t;
 
 /**
- * \brief An immutable CEK continuation frame, tagged by its frame kind.
+ * \brief A CEK continuation frame, tagged by its frame kind.
  *
- * Frames form the continuation chain: every non-empty frame holds a \c ctx
- * pointing at the enclosing frame, terminating at a \ref CARDANO_UPLC_FRAME_NO_FRAME
- * frame whose \c ctx is NULL. The \c kind selects the active arm; never read an
- * arm the kind does not select. Frames are arena-allocated and immutable.
+ * Frames live in a \ref cardano_uplc_frame_stack_t: the enclosing frame of a
+ * frame is the one right below it, and the bottom of a machine's stack is a
+ * \ref CARDANO_UPLC_FRAME_NO_FRAME frame. The \c kind selects the active arm;
+ * never read an arm the kind does not select. A frame is only valid until the
+ * next push onto its stack, which may move the storage.
  */
 struct cardano_uplc_frame_t
 {
@@ -59,36 +59,27 @@ struct cardano_uplc_frame_t
         struct
         {
             const cardano_uplc_value_t* value;
-            const cardano_uplc_frame_t* ctx;
         } await_arg;
 
         struct
         {
-            const cardano_uplc_env_t*   env;
-            const cardano_uplc_term_t*  term;
-            const cardano_uplc_frame_t* ctx;
+            const cardano_uplc_env_t*  env;
+            const cardano_uplc_term_t* term;
         } await_fun_term;
 
         struct
         {
             const cardano_uplc_value_t* value;
-            const cardano_uplc_frame_t* ctx;
         } await_fun_value;
 
         struct
         {
-            const cardano_uplc_frame_t* ctx;
-        } force;
-
-        struct
-        {
-            const cardano_uplc_env_t*          env;
-            uint64_t                           tag;
-            const cardano_uplc_term_t* const*  fields;
-            size_t                             field_count;
-            const cardano_uplc_value_t* const* resolved;
-            size_t                             resolved_count;
-            const cardano_uplc_frame_t*        ctx;
+            const cardano_uplc_env_t*         env;
+            uint64_t                          tag;
+            const cardano_uplc_term_t* const* fields;
+            size_t                            field_count;
+            const cardano_uplc_value_t**      resolved;
+            size_t                            resolved_count;
         } constr;
 
         struct
@@ -96,7 +87,6 @@ struct cardano_uplc_frame_t
             const cardano_uplc_env_t*         env;
             const cardano_uplc_term_t* const* branches;
             size_t                            branch_count;
-            const cardano_uplc_frame_t*       ctx;
         } cases;
 
         // cppcheck-suppress misra-c2012-19.2; Reason: tagged union is the VM value and cost-shape representation
@@ -104,171 +94,190 @@ struct cardano_uplc_frame_t
 };
 
 /**
- * \brief Builds the empty continuation frame.
+ * \brief A contiguous, growable LIFO stack of continuation frames.
+ *
+ * Frames are pushed and popped in place, so the storage a machine needs is
+ * proportional to its continuation depth rather than to the number of steps it
+ * takes. The storage comes from the library allocators, not from an arena, and
+ * is kept across pops so a deep continuation is only grown once.
+ */
+typedef struct cardano_uplc_frame_stack_t
+{
+    cardano_uplc_frame_t* frames;
+    size_t                count;
+    size_t                capacity;
+} cardano_uplc_frame_stack_t;
+
+/**
+ * \brief Initializes an empty frame stack without allocating.
+ *
+ * \param[out] stack The stack to initialize. Ignored when NULL.
+ */
+void
+cardano_uplc_frame_stack_init(cardano_uplc_frame_stack_t* stack);
+
+/**
+ * \brief Releases the storage of a frame stack and leaves it empty.
+ *
+ * \param[in,out] stack The stack to release. Ignored when NULL.
+ */
+void
+cardano_uplc_frame_stack_free(cardano_uplc_frame_stack_t* stack);
+
+/**
+ * \brief Returns the top frame of a stack.
+ *
+ * The frame may be updated in place; it stays valid until the next push.
+ *
+ * \param[in] stack The stack to inspect.
+ *
+ * \return The top frame, or NULL if \p stack is NULL or empty.
+ */
+cardano_uplc_frame_t*
+cardano_uplc_frame_stack_top(const cardano_uplc_frame_stack_t* stack);
+
+/**
+ * \brief Pops the top frame of a stack, keeping its storage for reuse.
  *
- * Returning a value into this frame ends evaluation. Its \c ctx is NULL.
+ * \param[in,out] stack The stack to pop. Ignored when NULL or empty.
+ */
+void
+cardano_uplc_frame_stack_pop(cardano_uplc_frame_stack_t* stack);
+
+/**
+ * \brief Pushes the empty continuation frame.
+ *
+ * Returning a value into this frame ends evaluation.
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
- * \param[out] out On success, set to the new frame; left untouched on failure.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
- *         \p arena or \p out is NULL, or
- *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
- *         the node.
+ *         \p stack is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if
+ *         the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_no_frame(
-  struct cardano_uplc_arena_t* arena,
-  cardano_uplc_frame_t**       out);
+cardano_uplc_frame_stack_push_no_frame(cardano_uplc_frame_stack_t* stack);
 
 /**
- * \brief Builds an await-argument frame holding a function value.
+ * \brief Pushes an await-argument frame holding a function value.
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  * \param[in] value The function value to apply once the argument is computed.
- *            Must not be NULL and must live in \p arena.
- * \param[in] ctx The enclosing frame. Must not be NULL and must live in \p arena.
- * \param[out] out On success, set to the new frame; left untouched on failure.
+ *            Must not be NULL.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
  *         any argument is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if
- *         the arena cannot serve the node.
+ *         the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_await_arg(
-  struct cardano_uplc_arena_t* arena,
-  const cardano_uplc_value_t*  value,
-  const cardano_uplc_frame_t*  ctx,
-  cardano_uplc_frame_t**       out);
+cardano_uplc_frame_stack_push_await_arg(
+  cardano_uplc_frame_stack_t* stack,
+  const cardano_uplc_value_t* value);
 
 /**
- * \brief Builds an await-function-term frame holding the argument term and env.
+ * \brief Pushes an await-function-term frame holding the argument term and env.
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  * \param[in] env The environment the argument term is computed in, or NULL for
  *            the empty environment.
- * \param[in] term The argument term still to be computed. Must not be NULL and
- *            must live in \p arena.
- * \param[in] ctx The enclosing frame. Must not be NULL and must live in \p arena.
- * \param[out] out On success, set to the new frame; left untouched on failure.
+ * \param[in] term The argument term still to be computed. Must not be NULL.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
- *         \p arena, \p term, \p ctx, or \p out is NULL, or
- *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
- *         the node.
+ *         \p stack or \p term is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_await_fun_term(
-  struct cardano_uplc_arena_t* arena,
-  const cardano_uplc_env_t*    env,
-  const cardano_uplc_term_t*   term,
-  const cardano_uplc_frame_t*  ctx,
-  cardano_uplc_frame_t**       out);
+cardano_uplc_frame_stack_push_await_fun_term(
+  cardano_uplc_frame_stack_t* stack,
+  const cardano_uplc_env_t*   env,
+  const cardano_uplc_term_t*  term);
 
 /**
- * \brief Builds an await-function-value frame holding an argument value.
+ * \brief Pushes an await-function-value frame holding an argument value.
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  * \param[in] value The argument value held while the function is computed. Must
- *            not be NULL and must live in \p arena.
- * \param[in] ctx The enclosing frame. Must not be NULL and must live in \p arena.
- * \param[out] out On success, set to the new frame; left untouched on failure.
+ *            not be NULL.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
  *         any argument is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if
- *         the arena cannot serve the node.
+ *         the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_await_fun_value(
-  struct cardano_uplc_arena_t* arena,
-  const cardano_uplc_value_t*  value,
-  const cardano_uplc_frame_t*  ctx,
-  cardano_uplc_frame_t**       out);
+cardano_uplc_frame_stack_push_await_fun_value(
+  cardano_uplc_frame_stack_t* stack,
+  const cardano_uplc_value_t* value);
 
 /**
- * \brief Builds a force frame.
+ * \brief Pushes a force frame.
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
- * \param[in] ctx The enclosing frame. Must not be NULL and must live in \p arena.
- * \param[out] out On success, set to the new frame; left untouched on failure.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
- *         \p arena, \p ctx, or \p out is NULL, or
- *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
- *         the node.
+ *         \p stack is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if
+ *         the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_force(
-  struct cardano_uplc_arena_t* arena,
-  const cardano_uplc_frame_t*  ctx,
-  cardano_uplc_frame_t**       out);
+cardano_uplc_frame_stack_push_force(cardano_uplc_frame_stack_t* stack);
 
 /**
- * \brief Builds a constructor frame for evaluating fields one at a time.
+ * \brief Pushes a constructor frame for evaluating fields one at a time.
  *
- * \p fields is the list of field terms still to be computed and \p resolved is
- * the list of field values computed so far; both arrays and the nodes they point
- * at must live in \p arena. Either may be empty (count 0 with a NULL array).
+ * \p fields is the list of field terms still to be computed once the field
+ * currently being computed returns. \p resolved is a buffer with room for every
+ * field of the constructor, \p resolved_count + 1 + \p field_count values: the
+ * frame writes each returned field into it in place, and it becomes the field
+ * array of the constructor value, so it must outlive the evaluation (typically
+ * it lives in the machine arena).
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  * \param[in] env The environment the remaining field terms are computed in, or
  *            NULL for the empty environment.
  * \param[in] tag The constructor tag being built.
  * \param[in] fields The field terms still to compute, or NULL when
  *            \p field_count is 0.
  * \param[in] field_count The number of remaining field terms.
- * \param[in] resolved The field values resolved so far, or NULL when
- *            \p resolved_count is 0.
- * \param[in] resolved_count The number of resolved field values.
- * \param[in] ctx The enclosing frame. Must not be NULL and must live in \p arena.
- * \param[out] out On success, set to the new frame; left untouched on failure.
+ * \param[in] resolved The buffer of field values. Must not be NULL.
+ * \param[in] resolved_count The number of field values already in \p resolved.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
- *         \p arena, \p ctx, or \p out is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT
- *         if a count is non-zero while its array is NULL, or
- *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
- *         the node.
+ *         \p stack or \p resolved is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT
+ *         if \p field_count is non-zero while \p fields is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_constr(
-  struct cardano_uplc_arena_t*       arena,
-  const cardano_uplc_env_t*          env,
-  uint64_t                           tag,
-  const cardano_uplc_term_t* const*  fields,
-  size_t                             field_count,
-  const cardano_uplc_value_t* const* resolved,
-  size_t                             resolved_count,
-  const cardano_uplc_frame_t*        ctx,
-  cardano_uplc_frame_t**             out);
+cardano_uplc_frame_stack_push_constr(
+  cardano_uplc_frame_stack_t*       stack,
+  const cardano_uplc_env_t*         env,
+  uint64_t                          tag,
+  const cardano_uplc_term_t* const* fields,
+  size_t                            field_count,
+  const cardano_uplc_value_t**      resolved,
+  size_t                            resolved_count);
 
 /**
- * \brief Builds a cases frame holding the case branches.
+ * \brief Pushes a cases frame holding the case branches.
  *
- * The \p branches array and the terms it points at must live in \p arena. A case
- * with no branches is allowed with \p branch_count 0 and \p branches NULL.
+ * A case with no branches is allowed with \p branch_count 0 and \p branches
+ * NULL.
  *
- * \param[in] arena The arena to allocate the frame from. Must not be NULL.
+ * \param[in,out] stack The stack to push onto. Must not be NULL.
  * \param[in] env The environment the chosen branch is computed in, or NULL for
  *            the empty environment.
  * \param[in] branches The branch terms, or NULL when \p branch_count is 0.
  * \param[in] branch_count The number of branches.
- * \param[in] ctx The enclosing frame. Must not be NULL and must live in \p arena.
- * \param[out] out On success, set to the new frame; left untouched on failure.
  *
  * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
- *         \p arena, \p ctx, or \p out is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT
- *         if \p branches is NULL while \p branch_count is non-zero, or
- *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
- *         the node.
+ *         \p stack is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT if \p branches
+ *         is NULL while \p branch_count is non-zero, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the stack cannot grow.
  */
 cardano_error_t
-cardano_uplc_frame_new_cases(
-  struct cardano_uplc_arena_t*      arena,
+cardano_uplc_frame_stack_push_cases(
+  cardano_uplc_frame_stack_t*       stack,
   const cardano_uplc_env_t*         env,
   const cardano_uplc_term_t* const* branches,
-  size_t                            branch_count,
-  const cardano_uplc_frame_t*       ctx,
-  cardano_uplc_frame_t**            out);
+  size_t                            branch_count);
 
 #ifdef __cplusplus
 }
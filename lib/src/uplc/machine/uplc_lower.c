@@ -0,0 +1,363 @@
+/**
+ * \file uplc_lower.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "uplc_lower.h"
+
+#include "../../allocators.h"
+#include "../ast/uplc_term.h"
+#include "uplc_value.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief One pending node of the lowering walk.
+ *
+ * \c source is the node still to be copied and \c slot is where the address of its
+ * copy is written once it has a place in the node array (NULL for the root and
+ * during the counting pass).
+ */
+typedef struct lower_frame_t
+{
+    const cardano_uplc_term_t*  source;
+    const cardano_uplc_term_t** slot;
+} lower_frame_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Pushes a node onto the lowering work stack, growing it as needed.
+ *
+ * \param[in,out] stack The stack base pointer.
+ * \param[in,out] capacity The current element capacity.
+ * \param[in,out] count The current element count.
+ * \param[in] source The node to push.
+ * \param[in] slot Where to write the address of the node's copy, or NULL.
+ *
+ * \return \c true on success, \c false if the stack cannot grow.
+ */
+static bool
+lower_push(
+  lower_frame_t**             stack,
+  size_t*                     capacity,
+  size_t*                     count,
+  const cardano_uplc_term_t*  source,
+  const cardano_uplc_term_t** slot)
+{
+  if (*count >= *capacity)
+  {
+    size_t         next  = (*capacity == 0U) ? 64U : (*capacity * 2U);
+    lower_frame_t* grown = (lower_frame_t*)_cardano_realloc(*stack, next * sizeof(lower_frame_t));
+
+    if (grown == NULL)
+    {
+      return false;
+    }
+
+    *stack    = grown;
+    *capacity = next;
+  }
+
+  (*stack)[*count].source = source;
+  (*stack)[*count].slot   = slot;
+  ++(*count);
+
+  return true;
+}
+
+/**
+ * \brief Pushes the children of a node so they pop in pre-order.
+ *
+ * Children are pushed last-first, so the first child (the function of an
+ * application, the scrutinee of a case, the first constr field) is copied right
+ * after its parent. When \p copy is non-NULL each child's slot points into the
+ * copy, and constr fields and case branches are given consecutive entries of
+ * \p slots starting at \p next_slot; when it is NULL only the nodes are pushed.
+ *
+ * \param[in,out] stack The stack base pointer.
+ * \param[in,out] capacity The current element capacity.
+ * \param[in,out] count The current element count.
+ * \param[in] source The node whose children are pushed.
+ * \param[in,out] copy The copy of \p source, or NULL during the counting pass.
+ * \param[in] slots The packed child pointer array, or NULL during the counting pass.
+ * \param[in,out] next_slot The next free entry of \p slots; advanced by the number
+ *                of constr fields or case branches of \p source.
+ *
+ * \return \ref CARDANO_SUCCESS on success,
+ *         \ref CARDANO_ERROR_INVALID_ARGUMENT for an unknown term kind, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the stack cannot grow.
+ */
+static cardano_error_t
+push_children(
+  lower_frame_t**             stack,
+  size_t*                     capacity,
+  size_t*                     count,
+  const cardano_uplc_term_t*  source,
+  cardano_uplc_term_t*        copy,
+  const cardano_uplc_term_t** slots,
+  size_t*                     next_slot)
+{
+  bool pushed = true;
+
+  switch (source->kind)
+  {
+    case CARDANO_UPLC_TERM_VAR:
+    case CARDANO_UPLC_TERM_CONSTANT:
+    case CARDANO_UPLC_TERM_ERROR:
+    case CARDANO_UPLC_TERM_BUILTIN:
+    {
+      break;
+    }
+
+    case CARDANO_UPLC_TERM_DELAY:
+    case CARDANO_UPLC_TERM_LAMBDA:
+    case CARDANO_UPLC_TERM_FORCE:
+    {
+      pushed = lower_push(stack, capacity, count, source->as.unary, (copy != NULL) ? &copy->as.unary : NULL);
+      break;
+    }
+
+    case CARDANO_UPLC_TERM_APPLY:
+    {
+      pushed = lower_push(stack, capacity, count, source->as.apply.argument, (copy != NULL) ? &copy->as.apply.argument : NULL)
+        && lower_push(stack, capacity, count, source->as.apply.function, (copy != NULL) ? &copy->as.apply.function : NULL);
+      break;
+    }
+
+    case CARDANO_UPLC_TERM_CONSTR:
+    {
+      const size_t base = *next_slot;
+
+      if (copy != NULL)
+      {
+        copy->as.constr.fields = (source->as.constr.field_count > 0U) ? &slots[base] : NULL;
+      }
+
+      for (size_t i = source->as.constr.field_count; pushed && (i > 0U); --i)
+      {
+        pushed = lower_push(stack, capacity, count, source->as.constr.fields[i - 1U], (copy != NULL) ? &slots[base + i - 1U] : NULL);
+      }
+
+      *next_slot = base + source->as.constr.field_count;
+      break;
+    }
+
+    case CARDANO_UPLC_TERM_CASE:
+    {
+      const size_t base = *next_slot;
+
+      if (copy != NULL)
+      {
+        copy->as.cases.branches = (source->as.cases.branch_count > 0U) ? &slots[base] : NULL;
+      }
+
+      for (size_t i = source->as.cases.branch_count; pushed && (i > 0U); --i)
+      {
+        pushed = lower_push(stack, capacity, count, source->as.cases.branches[i - 1U], (copy != NULL) ? &slots[base + i - 1U] : NULL);
+      }
+
+      pushed = pushed && lower_push(stack, capacity, count, source->as.cases.scrutinee, (copy != NULL) ? &copy->as.cases.scrutinee : NULL);
+
+      *next_slot = base + source->as.cases.branch_count;
+      break;
+    }
+
+    default:
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+
+  return pushed ? CARDANO_SUCCESS : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+}
+
+/**
+ * \brief Counts the nodes and packed child pointers of a term tree.
+ *
+ * \param[in] root The root term.
+ * \param[out] node_count The number of term nodes.
+ * \param[out] slot_count The total number of constr fields and case branches.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the failure of \ref push_children.
+ */
+static cardano_error_t
+count_tree(const cardano_uplc_term_t* root, size_t* node_count, size_t* slot_count)
+{
+  lower_frame_t*  stack    = NULL;
+  size_t          capacity = 0U;
+  size_t          count    = 0U;
+  cardano_error_t error    = CARDANO_SUCCESS;
+
+  *node_count = 0U;
+  *slot_count = 0U;
+
+  if (!lower_push(&stack, &capacity, &count, root, NULL))
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  while ((count > 0U) && (error == CARDANO_SUCCESS))
+  {
+    const cardano_uplc_term_t* source = stack[--count].source;
+
+    ++(*node_count);
+    error = push_children(&stack, &capacity, &count, source, NULL, NULL, slot_count);
+  }
+
+  _cardano_free(stack);
+
+  return error;
+}
+
+/**
+ * \brief Copies a term tree into preallocated node and child pointer arrays.
+ *
+ * \param[in] arena The arena the pre-wrapped values are allocated from.
+ * \param[in] root The root term.
+ * \param[out] nodes The node array, sized by \ref count_tree; \c nodes[0] receives
+ *             the root.
+ * \param[out] slots The child pointer array, sized by \ref count_tree.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an allocation or
+ *         \ref push_children failure.
+ */
+static cardano_error_t
+copy_tree(
+  cardano_uplc_arena_t*       arena,
+  const cardano_uplc_term_t*  root,
+  cardano_uplc_term_t*        nodes,
+  const cardano_uplc_term_t** slots)
+{
+  lower_frame_t*  stack     = NULL;
+  size_t          capacity  = 0U;
+  size_t          count     = 0U;
+  size_t          next_node = 0U;
+  size_t          next_slot = 0U;
+  cardano_error_t error     = CARDANO_SUCCESS;
+
+  if (!lower_push(&stack, &capacity, &count, root, NULL))
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  while ((count > 0U) && (error == CARDANO_SUCCESS))
+  {
+    lower_frame_t         frame = stack[--count];
+    cardano_uplc_term_t*  copy  = &nodes[next_node];
+    cardano_uplc_value_t* value = NULL;
+
+    ++next_node;
+
+    *copy       = *frame.source;
+    copy->value = NULL;
+
+    if (frame.slot != NULL)
+    {
+      *frame.slot = copy;
+    }
+
+    if (copy->kind == CARDANO_UPLC_TERM_CONSTANT)
+    {
+      error = cardano_uplc_value_new_constant(arena, copy->as.constant, &value);
+    }
+    else if (copy->kind == CARDANO_UPLC_TERM_BUILTIN)
+    {
+      error = cardano_uplc_value_new_builtin(arena, copy->as.builtin, (size_t)0, NULL, (size_t)0, &value);
+    }
+    else
+    {
+      error = push_children(&stack, &capacity, &count, frame.source, copy, slots, &next_slot);
+    }
+
+    copy->value = value;
+  }
+
+  _cardano_free(stack);
+
+  return error;
+}
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+cardano_uplc_int_lower_program(
+  cardano_uplc_arena_t*          arena,
+  const cardano_uplc_program_t*  program,
+  const cardano_uplc_program_t** out)
+{
+  cardano_uplc_term_t*        nodes      = NULL;
+  const cardano_uplc_term_t** slots      = NULL;
+  cardano_uplc_program_t*     lowered    = NULL;
+  size_t                      node_count = 0U;
+  size_t                      slot_count = 0U;
+  cardano_error_t             error      = CARDANO_SUCCESS;
+
+  if ((arena == NULL) || (program == NULL) || (program->term == NULL) || (out == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  error = count_tree(program->term, &node_count, &slot_count);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  if ((node_count > (SIZE_MAX / sizeof(cardano_uplc_term_t))) || (slot_count > (SIZE_MAX / sizeof(const cardano_uplc_term_t*))))
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  nodes   = (cardano_uplc_term_t*)cardano_uplc_arena_alloc(arena, node_count * sizeof(cardano_uplc_term_t), 0U);
+  lowered = (cardano_uplc_program_t*)cardano_uplc_arena_alloc(arena, sizeof(cardano_uplc_program_t), 0U);
+
+  if (slot_count > 0U)
+  {
+    slots = (const cardano_uplc_term_t**)cardano_uplc_arena_alloc(arena, slot_count * sizeof(const cardano_uplc_term_t*), 0U);
+  }
+
+  if ((nodes == NULL) || (lowered == NULL) || ((slot_count > 0U) && (slots == NULL)))
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  error = copy_tree(arena, program->term, nodes, slots);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  lowered->version_major = program->version_major;
+  lowered->version_minor = program->version_minor;
+  lowered->version_patch = program->version_patch;
+  lowered->term          = &nodes[0];
+
+  *out = lowered;
+
+  return CARDANO_SUCCESS;
+}
@@ -0,0 +1,81 @@
+/**
+ * \file uplc_lower.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UPLC_MACHINE_UPLC_LOWER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UPLC_MACHINE_UPLC_LOWER_H
+
+/* INCLUDES ******************************************************************/
+
+#include "../arena/uplc_arena.h"
+#include "../ast/uplc_program.h"
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Lowers a decoded program into the compact form the CEK machine runs best.
+ *
+ * The decoder allocates one term node at a time, interleaved with constants and
+ * their payloads, so a large script is spread over the arena. Lowering copies the
+ * whole term tree into a single contiguous array laid out in pre-order (a node is
+ * followed by its first child, so the machine's descent into a function or a
+ * scrutinee reads the next node), and packs every constr field and case branch
+ * pointer into a second contiguous array. De Bruijn indices are carried inline as
+ * before.
+ *
+ * Each constant and builtin term also gets its machine value wrapped once, in
+ * \c value, so computing it returns the shared value instead of allocating a new
+ * one on every visit. Lowering does not change what the machine charges: every
+ * step is costed exactly as for the decoded program, so the two evaluate to the
+ * same outcome, budget and result.
+ *
+ * The lowered program lives in \p arena, which must outlive every evaluation of
+ * it. It shares the constants of \p program, so the arena that owns \p program
+ * must outlive it too. Lowering is optional; the machine runs decoded and lowered
+ * programs alike.
+ *
+ * \param[in] arena The arena the lowered program is allocated from. Must not be NULL.
+ * \param[in] program The program to lower. Must not be NULL and must carry a
+ *            non-NULL term.
+ * \param[out] out On success, the lowered program; left untouched on failure.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         any argument or the program term is NULL,
+ *         \ref CARDANO_ERROR_INVALID_ARGUMENT for an unknown term kind, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena or the work
+ *         stack cannot be allocated.
+ */
+cardano_error_t
+cardano_uplc_int_lower_program(
+  cardano_uplc_arena_t*          arena,
+  const cardano_uplc_program_t*  program,
+  const cardano_uplc_program_t** out);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BIGLUP_LABS_INCLUDE_CARDANO_UPLC_MACHINE_UPLC_LOWER_H */
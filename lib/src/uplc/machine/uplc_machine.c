@@ -26,6 +26,7 @@
 #include "../builtins/builtins.h"
 #include "../builtins/uplc_builtin.h"
 #include "../builtins/uplc_builtin_semantics.h"
+#include "../builtins/uplc_builtin_site.h"
 #include "../cost/uplc_builtin_costs.h"
 #include "../cost/uplc_cost_model.h"
 #include "../cost/uplc_machine_costs.h"
@@ -72,14 +73,13 @@ typedef enum
 /**
  * \brief A CEK machine state: a Compute, a Return, or a Done.
  *
- * Compute carries the term, its environment and the continuation; Return carries
- * the value and the continuation; Done carries only the final value. The active
- * fields are selected by \c kind.
+ * Compute carries the term and its environment; Return carries the value; Done
+ * carries only the final value. The continuation is not part of the state: it
+ * is the frame stack of the machine. The active fields are selected by \c kind.
  */
 typedef struct
 {
     cardano_uplc_state_kind_t   kind;
-    const cardano_uplc_frame_t* ctx;
     const cardano_uplc_env_t*   env;
     const cardano_uplc_term_t*  term;
     const cardano_uplc_value_t* value;
@@ -92,18 +92,27 @@ typedef struct
  * accumulator, and the initial budget used to test exhaustion. It also carries
  * the full cost model (machine-step costs plus the per-builtin costing functions)
  * and the builtin semantics variant; the step loop reads its machine-step costs
- * through the accumulator, and the saturated-builtin path reads \c cost_model.builtins
- * and \c semantics to charge builtin costs.
+ * through the accumulator. The builtin call sites are resolved once against
+ * \c cost_model.builtins, \c semantics, \c language and \c protocol_major when the
+ * machine is set up, so the application and saturated-builtin paths read arity,
+ * availability and the specialized costing function from \c builtins by tag.
+ * \c sig_cache is the optional signature verification cache the saturated
+ * builtin path hands to the verification builtins; NULL turns caching off.
+ * \c frames is the continuation, pushed and popped in place so its storage
+ * follows the continuation depth rather than the step count.
  */
 typedef struct
 {
     cardano_uplc_arena_t*            arena;
+    cardano_uplc_frame_stack_t       frames;
     cardano_uplc_step_accumulator_t  acc;
     cardano_uplc_budget_t            initial;
     cardano_uplc_cost_model_t        cost_model;
     cardano_uplc_builtin_semantics_t semantics;
     cardano_uplc_lang_version_t      language;
     uint64_t                         protocol_major;
+    cardano_uplc_builtin_sites_t     builtins;
+    cardano_uplc_sig_cache_t*        sig_cache;
 } machine_t;
 
 /**
@@ -124,10 +133,11 @@ charge_step(machine_t* machine, cardano_uplc_step_kind_t kind)
  * \brief Computes a term in an environment under a continuation.
  *
  * Implements the Compute half of the CEK transition for every term form, charging
- * the matching step and producing the next state.
+ * the matching step and producing the next state. A constant or builtin term that
+ * carries a pre-wrapped \c value (see \ref cardano_uplc_int_lower_program) returns
+ * it directly; the step is charged the same either way.
  *
- * \param[in,out] machine The machine context.
- * \param[in] ctx The continuation the result returns into.
+ * \param[in,out] machine The machine context; frames are pushed onto its stack.
  * \param[in] env The environment the term is computed in.
  * \param[in] term The term to compute.
  * \param[out] next On \ref PRV_STEP_CONTINUE, the next state.
@@ -138,12 +148,11 @@ charge_step(machine_t* machine, cardano_uplc_step_kind_t kind)
  */
 static step_outcome_t
 run_compute_state(
-  machine_t*                  machine,
-  const cardano_uplc_frame_t* ctx,
-  const cardano_uplc_env_t*   env,
-  const cardano_uplc_term_t*  term,
-  state_t*                    next,
-  cardano_error_t*            host_error)
+  machine_t*                 machine,
+  const cardano_uplc_env_t*  env,
+  const cardano_uplc_term_t* term,
+  state_t*                   next,
+  cardano_error_t*           host_error)
 {
   *host_error = CARDANO_SUCCESS;
 
@@ -166,7 +175,6 @@ run_compute_state(
       }
 
       next->kind  = CARDANO_UPLC_STATE_RETURN;
-      next->ctx   = ctx;
       next->value = value;
 
       return PRV_STEP_CONTINUE;
@@ -191,7 +199,6 @@ run_compute_state(
       }
 
       next->kind  = CARDANO_UPLC_STATE_RETURN;
-      next->ctx   = ctx;
       next->value = value;
 
       return PRV_STEP_CONTINUE;
@@ -216,7 +223,6 @@ run_compute_state(
       }
 
       next->kind  = CARDANO_UPLC_STATE_RETURN;
-      next->ctx   = ctx;
       next->value = value;
 
       return PRV_STEP_CONTINUE;
@@ -224,8 +230,6 @@ run_compute_state(
 
     case CARDANO_UPLC_TERM_APPLY:
     {
-      cardano_uplc_frame_t* frame = NULL;
-
       *host_error = charge_step(machine, CARDANO_UPLC_STEP_KIND_APPLY);
 
       if (*host_error != CARDANO_SUCCESS)
@@ -233,7 +237,7 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      *host_error = cardano_uplc_frame_new_await_fun_term(machine->arena, env, term->as.apply.argument, ctx, &frame);
+      *host_error = cardano_uplc_frame_stack_push_await_fun_term(&machine->frames, env, term->as.apply.argument);
 
       if (*host_error != CARDANO_SUCCESS)
       {
@@ -241,7 +245,6 @@ run_compute_state(
       }
 
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = frame;
       next->env  = env;
       next->term = term->as.apply.function;
 
@@ -259,6 +262,15 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
+      next->kind = CARDANO_UPLC_STATE_RETURN;
+
+      if (term->value != NULL)
+      {
+        next->value = term->value;
+
+        return PRV_STEP_CONTINUE;
+      }
+
       *host_error = cardano_uplc_value_new_constant(machine->arena, term->as.constant, &value);
 
       if (*host_error != CARDANO_SUCCESS)
@@ -266,8 +278,6 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      next->kind  = CARDANO_UPLC_STATE_RETURN;
-      next->ctx   = ctx;
       next->value = value;
 
       return PRV_STEP_CONTINUE;
@@ -275,8 +285,6 @@ run_compute_state(
 
     case CARDANO_UPLC_TERM_FORCE:
     {
-      cardano_uplc_frame_t* frame = NULL;
-
       *host_error = charge_step(machine, CARDANO_UPLC_STEP_KIND_FORCE);
 
       if (*host_error != CARDANO_SUCCESS)
@@ -284,7 +292,7 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      *host_error = cardano_uplc_frame_new_force(machine->arena, ctx, &frame);
+      *host_error = cardano_uplc_frame_stack_push_force(&machine->frames);
 
       if (*host_error != CARDANO_SUCCESS)
       {
@@ -292,7 +300,6 @@ run_compute_state(
       }
 
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = frame;
       next->env  = env;
       next->term = term->as.unary;
 
@@ -315,6 +322,15 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
+      next->kind = CARDANO_UPLC_STATE_RETURN;
+
+      if (term->value != NULL)
+      {
+        next->value = term->value;
+
+        return PRV_STEP_CONTINUE;
+      }
+
       *host_error = cardano_uplc_value_new_builtin(machine->arena, term->as.builtin, (size_t)0, NULL, (size_t)0, &value);
 
       if (*host_error != CARDANO_SUCCESS)
@@ -322,8 +338,6 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      next->kind  = CARDANO_UPLC_STATE_RETURN;
-      next->ctx   = ctx;
       next->value = value;
 
       return PRV_STEP_CONTINUE;
@@ -350,25 +364,31 @@ run_compute_state(
         }
 
         next->kind  = CARDANO_UPLC_STATE_RETURN;
-        next->ctx   = ctx;
         next->value = value;
 
         return PRV_STEP_CONTINUE;
       }
       else
       {
-        cardano_uplc_frame_t* frame = NULL;
-
-        *host_error = cardano_uplc_frame_new_constr(
+        const cardano_uplc_value_t** resolved = (const cardano_uplc_value_t**)cardano_uplc_arena_alloc(
           machine->arena,
+          sizeof(const cardano_uplc_value_t*) * term->as.constr.field_count,
+          0U);
+
+        if (resolved == NULL)
+        {
+          *host_error = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+          return PRV_STEP_SCRIPT_ERROR;
+        }
+
+        *host_error = cardano_uplc_frame_stack_push_constr(
+          &machine->frames,
           env,
           term->as.constr.tag,
           &term->as.constr.fields[1],
           term->as.constr.field_count - (size_t)1,
-          NULL,
-          (size_t)0,
-          ctx,
-          &frame);
+          resolved,
+          (size_t)0);
 
         if (*host_error != CARDANO_SUCCESS)
         {
@@ -376,7 +396,6 @@ run_compute_state(
         }
 
         next->kind = CARDANO_UPLC_STATE_COMPUTE;
-        next->ctx  = frame;
         next->env  = env;
         next->term = term->as.constr.fields[0];
 
@@ -388,8 +407,6 @@ run_compute_state(
 
     case CARDANO_UPLC_TERM_CASE:
     {
-      cardano_uplc_frame_t* frame = NULL;
-
       *host_error = charge_step(machine, CARDANO_UPLC_STEP_KIND_CASE);
 
       if (*host_error != CARDANO_SUCCESS)
@@ -397,13 +414,11 @@ run_compute_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      *host_error = cardano_uplc_frame_new_cases(
-        machine->arena,
+      *host_error = cardano_uplc_frame_stack_push_cases(
+        &machine->frames,
         env,
         term->as.cases.branches,
-        term->as.cases.branch_count,
-        ctx,
-        &frame);
+        term->as.cases.branch_count);
 
       if (*host_error != CARDANO_SUCCESS)
       {
@@ -411,7 +426,6 @@ run_compute_state(
       }
 
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = frame;
       next->env  = env;
       next->term = term->as.cases.scrutinee;
 
@@ -478,21 +492,19 @@ extend_builtin_args(
 /**
  * \brief Applies a forced or applied builtin, saturating it if it is ready.
  *
- * Builds the next builtin value from \p func, \p forces and \p args and, when it
+ * Builds the next builtin value from \p site, \p forces and \p args and, when it
  * has all its forces and arguments, runs it through the builtin runtime. A ready
  * builtin spends its cost before its body runs (cost-before-execute, handled by
- * \ref cardano_uplc_int_builtin_run using \c machine->cost_model.builtins and
- * \c machine->semantics); the body produces the resulting value, fails the script
- * on a Plutus error (type mismatch, etc.), or reports that this VM build does not
- * implement that builtin. An unsaturated builtin is returned as a value.
+ * \ref cardano_uplc_int_builtin_run_site through the site's specialized costing
+ * function); the body produces the resulting value, fails the script on a Plutus
+ * error (type mismatch, etc.), or reports that this VM build does not implement
+ * that builtin. An unsaturated builtin is returned as a value.
  *
  * \param[in,out] machine The machine context.
- * \param[in] func The builtin function tag.
+ * \param[in] site The resolved site of the builtin.
  * \param[in] forces The forces accumulated so far.
  * \param[in] args The argument values accumulated so far.
  * \param[in] arg_count The number of arguments accumulated so far.
- * \param[in] arity The builtin's arity, supplied by the caller.
- * \param[in] force_count The builtin's force count, supplied by the caller.
  * \param[out] out On \ref PRV_STEP_CONTINUE, the resulting value (the partially
  *             applied builtin when unsaturated, or the builtin result when ready).
  * \param[out] host_error On a host failure, the error code.
@@ -505,12 +517,10 @@ extend_builtin_args(
 static step_outcome_t
 try_call_builtin(
   machine_t*                         machine,
-  cardano_uplc_builtin_t             func,
+  const cardano_uplc_builtin_site_t* site,
   size_t                             forces,
   const cardano_uplc_value_t* const* args,
   size_t                             arg_count,
-  size_t                             arity,
-  size_t                             force_count,
   const cardano_uplc_value_t**       out,
   cardano_error_t*                   host_error)
 {
@@ -518,20 +528,19 @@ try_call_builtin(
 
   *host_error = CARDANO_SUCCESS;
 
-  if ((arg_count == arity) && (forces == force_count))
+  if ((arg_count == site->arity) && (forces == site->force_count))
   {
-    if (!cardano_uplc_builtin_available(func, machine->language, machine->protocol_major))
+    if (!site->available)
     {
       return PRV_STEP_UNSUPPORTED_BUILTIN;
     }
 
     const cardano_uplc_value_t*        result  = NULL;
-    cardano_uplc_int_builtin_outcome_t outcome = cardano_uplc_int_builtin_run(
+    cardano_uplc_int_builtin_outcome_t outcome = cardano_uplc_int_builtin_run_site(
       machine->arena,
       &machine->acc,
-      &machine->cost_model.builtins,
-      machine->semantics,
-      func,
+      site,
+      machine->sig_cache,
       args,
       arg_count,
       &result,
@@ -558,7 +567,7 @@ try_call_builtin(
     }
   }
 
-  *host_error = cardano_uplc_value_new_builtin(machine->arena, func, forces, args, arg_count, &value);
+  *host_error = cardano_uplc_value_new_builtin(machine->arena, site->func, forces, args, arg_count, &value);
 
   if (*host_error != CARDANO_SUCCESS)
   {
@@ -578,7 +587,6 @@ try_call_builtin(
  * any other value is a non-functional application and fails as a script error.
  *
  * \param[in,out] machine The machine context.
- * \param[in] ctx The continuation the application returns into.
  * \param[in] function The function value applied.
  * \param[in] arg The argument value applied.
  * \param[out] next On \ref PRV_STEP_CONTINUE, the next state.
@@ -589,7 +597,6 @@ try_call_builtin(
 static step_outcome_t
 apply_evaluate(
   machine_t*                  machine,
-  const cardano_uplc_frame_t* ctx,
   const cardano_uplc_value_t* function,
   const cardano_uplc_value_t* arg,
   state_t*                    next,
@@ -611,7 +618,6 @@ apply_evaluate(
       }
 
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = ctx;
       next->env  = env;
       next->term = function->as.lambda.body;
 
@@ -620,17 +626,16 @@ apply_evaluate(
 
     case CARDANO_UPLC_VALUE_BUILTIN:
     {
-      const cardano_uplc_value_t* const* args        = NULL;
-      const cardano_uplc_value_t*        value       = NULL;
-      size_t                             arity       = (size_t)0;
-      size_t                             force_count = (size_t)0;
+      const cardano_uplc_value_t* const* args  = NULL;
+      const cardano_uplc_value_t*        value = NULL;
+      const cardano_uplc_builtin_site_t* site  = cardano_uplc_builtin_sites_get(&machine->builtins, function->as.builtin.func);
 
-      if ((cardano_uplc_builtin_arity(function->as.builtin.func, &arity) != CARDANO_SUCCESS) || (cardano_uplc_builtin_force_count(function->as.builtin.func, &force_count) != CARDANO_SUCCESS))
+      if (site == NULL)
       {
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      if ((force_count <= function->as.builtin.forces) && (arity > function->as.builtin.arg_count))
+      if ((site->force_count <= function->as.builtin.forces) && (site->arity > function->as.builtin.arg_count))
       {
         *host_error = extend_builtin_args(machine->arena, function, arg, &args);
 
@@ -641,12 +646,10 @@ apply_evaluate(
 
         step_outcome_t outcome = try_call_builtin(
           machine,
-          function->as.builtin.func,
+          site,
           function->as.builtin.forces,
           args,
           function->as.builtin.arg_count + (size_t)1,
-          arity,
-          force_count,
           &value,
           host_error);
 
@@ -656,7 +659,6 @@ apply_evaluate(
         }
 
         next->kind  = CARDANO_UPLC_STATE_RETURN;
-        next->ctx   = ctx;
         next->value = value;
 
         return PRV_STEP_CONTINUE;
@@ -683,7 +685,6 @@ apply_evaluate(
  * non-polymorphic instantiation and fails as a script error.
  *
  * \param[in,out] machine The machine context.
- * \param[in] ctx The continuation the force returns into.
  * \param[in] value The value being forced.
  * \param[out] next On \ref PRV_STEP_CONTINUE, the next state.
  * \param[out] host_error On a host failure, the error code.
@@ -693,7 +694,6 @@ apply_evaluate(
 static step_outcome_t
 force_evaluate(
   machine_t*                  machine,
-  const cardano_uplc_frame_t* ctx,
   const cardano_uplc_value_t* value,
   state_t*                    next,
   cardano_error_t*            host_error)
@@ -705,7 +705,6 @@ force_evaluate(
     case CARDANO_UPLC_VALUE_DELAY:
     {
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = ctx;
       next->env  = value->as.delay.env;
       next->term = value->as.delay.body;
 
@@ -714,26 +713,23 @@ force_evaluate(
 
     case CARDANO_UPLC_VALUE_BUILTIN:
     {
-      const cardano_uplc_value_t* resolved    = NULL;
-      size_t                      arity       = (size_t)0;
-      size_t                      force_count = (size_t)0;
-      step_outcome_t              outcome;
+      const cardano_uplc_value_t*        resolved = NULL;
+      const cardano_uplc_builtin_site_t* site     = cardano_uplc_builtin_sites_get(&machine->builtins, value->as.builtin.func);
+      step_outcome_t                     outcome;
 
-      if ((cardano_uplc_builtin_arity(value->as.builtin.func, &arity) != CARDANO_SUCCESS) || (cardano_uplc_builtin_force_count(value->as.builtin.func, &force_count) != CARDANO_SUCCESS))
+      if (site == NULL)
       {
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      if (force_count > value->as.builtin.forces)
+      if (site->force_count > value->as.builtin.forces)
       {
         outcome = try_call_builtin(
           machine,
-          value->as.builtin.func,
+          site,
           value->as.builtin.forces + (size_t)1,
           value->as.builtin.args,
           value->as.builtin.arg_count,
-          arity,
-          force_count,
           &resolved,
           host_error);
 
@@ -743,7 +739,6 @@ force_evaluate(
         }
 
         next->kind  = CARDANO_UPLC_STATE_RETURN;
-        next->ctx   = ctx;
         next->value = resolved;
 
         return PRV_STEP_CONTINUE;
@@ -769,46 +764,36 @@ force_evaluate(
  * Wraps each field, last first, in a \ref CARDANO_UPLC_FRAME_AWAIT_FUN_VALUE frame
  * so that when the branch value returns it is applied to field 0 first.
  *
- * \param[in,out] machine The machine context.
+ * \param[in,out] machine The machine context whose frame stack is pushed onto.
  * \param[in] fields The resolved constructor field values.
  * \param[in] field_count The number of fields.
- * \param[in] ctx The continuation to push the frames onto.
- * \param[out] out On success, the continuation with the field frames pushed.
  *
  * \return \ref CARDANO_SUCCESS on success, or
- *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
- *         frame.
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the frame stack cannot
+ *         grow.
  */
 static cardano_error_t
 transfer_arg_stack(
   machine_t*                         machine,
   const cardano_uplc_value_t* const* fields,
-  size_t                             field_count,
-  const cardano_uplc_frame_t*        ctx,
-  const cardano_uplc_frame_t**       out)
+  size_t                             field_count)
 {
-  const cardano_uplc_frame_t* current = ctx;
-  size_t                      i       = field_count;
+  size_t i = field_count;
 
   while (i > (size_t)0)
   {
-    cardano_uplc_frame_t* frame = NULL;
-    cardano_error_t       error;
+    cardano_error_t error;
 
     --i;
 
-    error = cardano_uplc_frame_new_await_fun_value(machine->arena, fields[i], current, &frame);
+    error = cardano_uplc_frame_stack_push_await_fun_value(&machine->frames, fields[i]);
 
     if (error != CARDANO_SUCCESS)
     {
       return error;
     }
-
-    current = frame;
   }
 
-  *out = current;
-
   return CARDANO_SUCCESS;
 }
 
@@ -843,7 +828,10 @@ constant_to_index(const cardano_bigint_t* integer, size_t* out)
 }
 
 /**
- * \brief Wraps a constant as a fresh constant value in the arena.
+ * \brief Wraps a constant as a constant value.
+ *
+ * A unit, a boolean or a small integer is served by its shared value; any other
+ * constant is wrapped in a fresh value from the arena.
  *
  * \param[in,out] machine The machine context.
  * \param[in] constant The constant to wrap.
@@ -859,8 +847,18 @@ constant_value(
   const cardano_uplc_constant_t* constant,
   const cardano_uplc_value_t**   out)
 {
-  cardano_uplc_value_t* value = NULL;
-  cardano_error_t       error = cardano_uplc_value_new_constant(machine->arena, constant, &value);
+  cardano_uplc_value_t*       value  = NULL;
+  const cardano_uplc_value_t* shared = cardano_uplc_value_shared_for(constant);
+  cardano_error_t             error  = CARDANO_SUCCESS;
+
+  if (shared != NULL)
+  {
+    *out = shared;
+
+    return CARDANO_SUCCESS;
+  }
+
+  error = cardano_uplc_value_new_constant(machine->arena, constant, &value);
 
   if (error != CARDANO_SUCCESS)
   {
@@ -883,7 +881,8 @@ constant_value(
  * missing branch, is a script error.
  *
  * \param[in,out] machine The machine context.
- * \param[in] frame The cases frame holding the branches and environment.
+ * \param[in] frame The cases frame holding the branches and environment, already
+ *            popped off the frame stack.
  * \param[in] constant The constant scrutinee.
  * \param[out] next On \ref PRV_STEP_CONTINUE, the next state.
  * \param[out] host_error On a host failure, the error code.
@@ -898,8 +897,7 @@ case_on_constant(
   state_t*                       next,
   cardano_error_t*               host_error)
 {
-  const cardano_uplc_frame_t* branch_ctx = frame->as.cases.ctx;
-  size_t                      tag        = (size_t)0;
+  size_t tag = (size_t)0;
 
   *host_error = CARDANO_SUCCESS;
 
@@ -999,7 +997,7 @@ case_on_constant(
           return PRV_STEP_SCRIPT_ERROR;
         }
 
-        *host_error = transfer_arg_stack(machine, fields, (size_t)2, frame->as.cases.ctx, &branch_ctx);
+        *host_error = transfer_arg_stack(machine, fields, (size_t)2);
 
         if (*host_error != CARDANO_SUCCESS)
         {
@@ -1044,7 +1042,7 @@ case_on_constant(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      *host_error = transfer_arg_stack(machine, fields, (size_t)2, frame->as.cases.ctx, &branch_ctx);
+      *host_error = transfer_arg_stack(machine, fields, (size_t)2);
 
       if (*host_error != CARDANO_SUCCESS)
       {
@@ -1071,7 +1069,6 @@ case_on_constant(
   }
 
   next->kind = CARDANO_UPLC_STATE_COMPUTE;
-  next->ctx  = branch_ctx;
   next->env  = frame->as.cases.env;
   next->term = frame->as.cases.branches[tag];
 
@@ -1081,11 +1078,13 @@ case_on_constant(
 /**
  * \brief Returns a computed value into the current continuation.
  *
- * Implements the Return half of the CEK transition for every frame. The empty
- * frame ends the machine; the apply, force, constr and cases frames advance it.
+ * Implements the Return half of the CEK transition for every frame, working on
+ * the top of the frame stack in place. The empty frame ends the machine; the
+ * apply, force, constr and cases frames advance it, an await-function-term and
+ * an unfinished constr frame being updated where they stand rather than popped
+ * and pushed again.
  *
  * \param[in,out] machine The machine context.
- * \param[in] ctx The frame the value returns into.
  * \param[in] value The value being returned.
  * \param[out] next On \ref PRV_STEP_CONTINUE, the next state; on
  *             \ref PRV_STEP_DONE, the final value in \c value.
@@ -1096,14 +1095,20 @@ case_on_constant(
 static step_outcome_t
 run_return_state(
   machine_t*                  machine,
-  const cardano_uplc_frame_t* ctx,
   const cardano_uplc_value_t* value,
   state_t*                    next,
   cardano_error_t*            host_error)
 {
+  cardano_uplc_frame_t* top = cardano_uplc_frame_stack_top(&machine->frames);
+
   *host_error = CARDANO_SUCCESS;
 
-  switch (ctx->kind)
+  if (top == NULL)
+  {
+    return PRV_STEP_SCRIPT_ERROR;
+  }
+
+  switch (top->kind)
   {
     case CARDANO_UPLC_FRAME_NO_FRAME:
     {
@@ -1115,71 +1120,55 @@ run_return_state(
 
     case CARDANO_UPLC_FRAME_AWAIT_FUN_TERM:
     {
-      cardano_uplc_frame_t* frame = NULL;
-
-      *host_error = cardano_uplc_frame_new_await_arg(machine->arena, value, ctx->as.await_fun_term.ctx, &frame);
-
-      if (*host_error != CARDANO_SUCCESS)
-      {
-        return PRV_STEP_SCRIPT_ERROR;
-      }
-
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = frame;
-      next->env  = ctx->as.await_fun_term.env;
-      next->term = ctx->as.await_fun_term.term;
+      next->env  = top->as.await_fun_term.env;
+      next->term = top->as.await_fun_term.term;
+
+      top->kind               = CARDANO_UPLC_FRAME_AWAIT_ARG;
+      top->as.await_arg.value = value;
 
       return PRV_STEP_CONTINUE;
     }
 
     case CARDANO_UPLC_FRAME_AWAIT_ARG:
     {
-      return apply_evaluate(machine, ctx->as.await_arg.ctx, ctx->as.await_arg.value, value, next, host_error);
+      const cardano_uplc_value_t* function = top->as.await_arg.value;
+
+      cardano_uplc_frame_stack_pop(&machine->frames);
+
+      return apply_evaluate(machine, function, value, next, host_error);
     }
 
     case CARDANO_UPLC_FRAME_AWAIT_FUN_VALUE:
     {
-      return apply_evaluate(machine, ctx->as.await_fun_value.ctx, value, ctx->as.await_fun_value.value, next, host_error);
+      const cardano_uplc_value_t* arg = top->as.await_fun_value.value;
+
+      cardano_uplc_frame_stack_pop(&machine->frames);
+
+      return apply_evaluate(machine, value, arg, next, host_error);
     }
 
     case CARDANO_UPLC_FRAME_FORCE:
     {
-      return force_evaluate(machine, ctx->as.force.ctx, value, next, host_error);
+      cardano_uplc_frame_stack_pop(&machine->frames);
+
+      return force_evaluate(machine, value, next, host_error);
     }
 
     case CARDANO_UPLC_FRAME_CONSTR:
     {
-      const cardano_uplc_value_t** resolved = NULL;
-      size_t                       count    = ctx->as.constr.resolved_count;
-      size_t                       i        = (size_t)0;
+      top->as.constr.resolved[top->as.constr.resolved_count] = value;
+      ++top->as.constr.resolved_count;
 
-      resolved = (const cardano_uplc_value_t**)cardano_uplc_arena_alloc(
-        machine->arena,
-        sizeof(const cardano_uplc_value_t*) * (count + (size_t)1),
-        0U);
-
-      if (resolved == NULL)
-      {
-        *host_error = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-        return PRV_STEP_SCRIPT_ERROR;
-      }
-
-      for (i = (size_t)0; i < count; ++i)
-      {
-        resolved[i] = ctx->as.constr.resolved[i];
-      }
-
-      resolved[count] = value;
-
-      if (ctx->as.constr.field_count == (size_t)0)
+      if (top->as.constr.field_count == (size_t)0)
       {
         cardano_uplc_value_t* result = NULL;
 
         *host_error = cardano_uplc_value_new_constr(
           machine->arena,
-          ctx->as.constr.tag,
-          resolved,
-          count + (size_t)1,
+          top->as.constr.tag,
+          top->as.constr.resolved,
+          top->as.constr.resolved_count,
           &result);
 
         if (*host_error != CARDANO_SUCCESS)
@@ -1187,36 +1176,21 @@ run_return_state(
           return PRV_STEP_SCRIPT_ERROR;
         }
 
+        cardano_uplc_frame_stack_pop(&machine->frames);
+
         next->kind  = CARDANO_UPLC_STATE_RETURN;
-        next->ctx   = ctx->as.constr.ctx;
         next->value = result;
 
         return PRV_STEP_CONTINUE;
       }
       else
       {
-        cardano_uplc_frame_t* frame = NULL;
-
-        *host_error = cardano_uplc_frame_new_constr(
-          machine->arena,
-          ctx->as.constr.env,
-          ctx->as.constr.tag,
-          &ctx->as.constr.fields[1],
-          ctx->as.constr.field_count - (size_t)1,
-          resolved,
-          count + (size_t)1,
-          ctx->as.constr.ctx,
-          &frame);
-
-        if (*host_error != CARDANO_SUCCESS)
-        {
-          return PRV_STEP_SCRIPT_ERROR;
-        }
-
         next->kind = CARDANO_UPLC_STATE_COMPUTE;
-        next->ctx  = frame;
-        next->env  = ctx->as.constr.env;
-        next->term = ctx->as.constr.fields[0];
+        next->env  = top->as.constr.env;
+        next->term = top->as.constr.fields[0];
+
+        top->as.constr.fields = &top->as.constr.fields[1];
+        --top->as.constr.field_count;
 
         return PRV_STEP_CONTINUE;
       }
@@ -1226,11 +1200,13 @@ run_return_state(
 
     case CARDANO_UPLC_FRAME_CASES:
     {
-      const cardano_uplc_frame_t* branch_ctx = NULL;
+      const cardano_uplc_frame_t frame = *top;
+
+      cardano_uplc_frame_stack_pop(&machine->frames);
 
       if (value->kind == CARDANO_UPLC_VALUE_CONSTANT)
       {
-        return case_on_constant(machine, ctx, value->as.constant, next, host_error);
+        return case_on_constant(machine, &frame, value->as.constant, next, host_error);
       }
 
       if (value->kind != CARDANO_UPLC_VALUE_CONSTR)
@@ -1238,17 +1214,12 @@ run_return_state(
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      if (value->as.constr.tag >= ctx->as.cases.branch_count)
+      if (value->as.constr.tag >= frame.as.cases.branch_count)
       {
         return PRV_STEP_SCRIPT_ERROR;
       }
 
-      *host_error = transfer_arg_stack(
-        machine,
-        value->as.constr.fields,
-        value->as.constr.field_count,
-        ctx->as.cases.ctx,
-        &branch_ctx);
+      *host_error = transfer_arg_stack(machine, value->as.constr.fields, value->as.constr.field_count);
 
       if (*host_error != CARDANO_SUCCESS)
       {
@@ -1256,9 +1227,8 @@ run_return_state(
       }
 
       next->kind = CARDANO_UPLC_STATE_COMPUTE;
-      next->ctx  = branch_ctx;
-      next->env  = ctx->as.cases.env;
-      next->term = ctx->as.cases.branches[value->as.constr.tag];
+      next->env  = frame.as.cases.env;
+      next->term = frame.as.cases.branches[value->as.constr.tag];
 
       return PRV_STEP_CONTINUE;
     }
@@ -1871,61 +1841,32 @@ cost_model_for_version(cardano_uplc_machine_version_t version)
   return model;
 }
 
-cardano_error_t
-cardano_uplc_int_evaluate_with_costs(
-  cardano_uplc_arena_t*            arena,
-  const cardano_uplc_program_t*    program,
-  const cardano_uplc_cost_model_t* cost_model,
-  cardano_uplc_builtin_semantics_t semantics,
-  cardano_uplc_lang_version_t      language,
-  uint64_t                         protocol_major,
-  cardano_uplc_budget_t            initial_budget,
-  cardano_uplc_eval_result_t*      out)
+/**
+ * \brief Runs the CEK machine over a term until it is done, fails or runs out of budget.
+ *
+ * The machine must be set up and its frame stack empty; the continuation frames
+ * are left on the stack for the caller to release.
+ *
+ * \param[in,out] machine The machine context.
+ * \param[in] term The term to evaluate in the empty environment.
+ * \param[out] out On success, the evaluation result.
+ *
+ * \return \ref CARDANO_SUCCESS when the evaluation reached an outcome, or the
+ *         host error that interrupted it.
+ */
+static cardano_error_t
+run_machine(
+  machine_t*                  machine,
+  const cardano_uplc_term_t*  term,
+  cardano_uplc_eval_result_t* out)
 {
-  machine_t             machine;
-  cardano_uplc_frame_t* no_frame = NULL;
-  state_t               state;
-  cardano_error_t       error       = CARDANO_SUCCESS;
-  bool                  running     = true;
-  bool                  failed      = false;
-  bool                  unsupported = false;
-
-  if ((arena == NULL) || (program == NULL) || (program->term == NULL) || (cost_model == NULL) || (out == NULL))
-  {
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
-  machine.arena          = arena;
-  machine.initial        = initial_budget;
-  machine.cost_model     = *cost_model;
-  machine.semantics      = semantics;
-  machine.language       = language;
-  machine.protocol_major = protocol_major;
-
-  error = cardano_uplc_step_accumulator_init(&machine.acc, &machine.cost_model.machine);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    return error;
-  }
-
-  error = cardano_uplc_step_accumulator_charge_startup(&machine.acc);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    return error;
-  }
+  state_t         state;
+  cardano_error_t error       = CARDANO_SUCCESS;
+  bool            running     = true;
+  bool            failed      = false;
+  bool            unsupported = false;
 
-  if (cardano_uplc_step_accumulator_is_exhausted(&machine.acc, machine.initial))
-  {
-    out->status = CARDANO_UPLC_EVAL_OUT_OF_BUDGET;
-    out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
-    out->result = NULL;
-
-    return CARDANO_SUCCESS;
-  }
-
-  error = cardano_uplc_frame_new_no_frame(arena, &no_frame);
+  error = cardano_uplc_frame_stack_push_no_frame(&machine->frames);
 
   if (error != CARDANO_SUCCESS)
   {
@@ -1933,16 +1874,15 @@ cardano_uplc_int_evaluate_with_costs(
   }
 
   state.kind  = CARDANO_UPLC_STATE_COMPUTE;
-  state.ctx   = no_frame;
   state.env   = NULL;
-  state.term  = program->term;
+  state.term  = term;
   state.value = NULL;
 
   while (running)
   {
     state_t               next;
     step_outcome_t        outcome      = PRV_STEP_DONE;
-    cardano_uplc_budget_t spent_before = machine.acc.spent;
+    cardano_uplc_budget_t spent_before = machine->acc.spent;
 
     next.kind = CARDANO_UPLC_STATE_COMPUTE;
 
@@ -1950,13 +1890,13 @@ cardano_uplc_int_evaluate_with_costs(
     {
       case CARDANO_UPLC_STATE_COMPUTE:
       {
-        outcome = run_compute_state(&machine, state.ctx, state.env, state.term, &next, &error);
+        outcome = run_compute_state(machine, state.env, state.term, &next, &error);
         break;
       }
 
       case CARDANO_UPLC_STATE_RETURN:
       {
-        outcome = run_return_state(&machine, state.ctx, state.value, &next, &error);
+        outcome = run_return_state(machine, state.value, &next, &error);
         break;
       }
 
@@ -1973,10 +1913,10 @@ cardano_uplc_int_evaluate_with_costs(
       return error;
     }
 
-    if (((machine.acc.spent.cpu != spent_before.cpu) || (machine.acc.spent.mem != spent_before.mem)) && cardano_uplc_step_accumulator_is_exhausted(&machine.acc, machine.initial))
+    if (((machine->acc.spent.cpu != spent_before.cpu) || (machine->acc.spent.mem != spent_before.mem)) && cardano_uplc_step_accumulator_is_exhausted(&machine->acc, machine->initial))
     {
       out->status = CARDANO_UPLC_EVAL_OUT_OF_BUDGET;
-      out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
+      out->spent  = cardano_uplc_step_accumulator_spent(&machine->acc);
       out->result = NULL;
 
       return CARDANO_SUCCESS;
@@ -2003,17 +1943,17 @@ cardano_uplc_int_evaluate_with_costs(
     }
   }
 
-  error = cardano_uplc_step_accumulator_flush(&machine.acc);
+  error = cardano_uplc_step_accumulator_flush(&machine->acc);
 
   if (error != CARDANO_SUCCESS)
   {
     return error;
   }
 
-  if (cardano_uplc_step_accumulator_is_exhausted(&machine.acc, machine.initial))
+  if (cardano_uplc_step_accumulator_is_exhausted(&machine->acc, machine->initial))
   {
     out->status = CARDANO_UPLC_EVAL_OUT_OF_BUDGET;
-    out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
+    out->spent  = cardano_uplc_step_accumulator_spent(&machine->acc);
     out->result = NULL;
 
     return CARDANO_SUCCESS;
@@ -2022,7 +1962,7 @@ cardano_uplc_int_evaluate_with_costs(
   if (unsupported)
   {
     out->status = CARDANO_UPLC_EVAL_UNSUPPORTED_BUILTIN;
-    out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
+    out->spent  = cardano_uplc_step_accumulator_spent(&machine->acc);
     out->result = NULL;
 
     return CARDANO_SUCCESS;
@@ -2031,7 +1971,7 @@ cardano_uplc_int_evaluate_with_costs(
   if (failed)
   {
     out->status = CARDANO_UPLC_EVAL_ERROR_TERM;
-    out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
+    out->spent  = cardano_uplc_step_accumulator_spent(&machine->acc);
     out->result = NULL;
 
     return CARDANO_SUCCESS;
@@ -2040,7 +1980,7 @@ cardano_uplc_int_evaluate_with_costs(
   {
     const cardano_uplc_term_t* result = NULL;
 
-    error = discharge_value(arena, (size_t)0, state.value, &result);
+    error = discharge_value(machine->arena, (size_t)0, state.value, &result);
 
     if (error != CARDANO_SUCCESS)
     {
@@ -2048,13 +1988,80 @@ cardano_uplc_int_evaluate_with_costs(
     }
 
     out->status = CARDANO_UPLC_EVAL_SUCCESS;
-    out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
+    out->spent  = cardano_uplc_step_accumulator_spent(&machine->acc);
     out->result = result;
   }
 
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_uplc_int_evaluate_with_costs(
+  cardano_uplc_arena_t*            arena,
+  const cardano_uplc_program_t*    program,
+  const cardano_uplc_cost_model_t* cost_model,
+  cardano_uplc_builtin_semantics_t semantics,
+  cardano_uplc_lang_version_t      language,
+  uint64_t                         protocol_major,
+  cardano_uplc_budget_t            initial_budget,
+  cardano_uplc_sig_cache_t*        sig_cache,
+  cardano_uplc_eval_result_t*      out)
+{
+  machine_t       machine;
+  cardano_error_t error = CARDANO_SUCCESS;
+
+  if ((arena == NULL) || (program == NULL) || (program->term == NULL) || (cost_model == NULL) || (out == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  machine.arena          = arena;
+  machine.initial        = initial_budget;
+  machine.cost_model     = *cost_model;
+  machine.semantics      = semantics;
+  machine.language       = language;
+  machine.protocol_major = protocol_major;
+  machine.sig_cache      = sig_cache;
+
+  error = cardano_uplc_builtin_sites_init(&machine.cost_model.builtins, semantics, language, protocol_major, &machine.builtins);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  error = cardano_uplc_step_accumulator_init(&machine.acc, &machine.cost_model.machine);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  error = cardano_uplc_step_accumulator_charge_startup(&machine.acc);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  if (cardano_uplc_step_accumulator_is_exhausted(&machine.acc, machine.initial))
+  {
+    out->status = CARDANO_UPLC_EVAL_OUT_OF_BUDGET;
+    out->spent  = cardano_uplc_step_accumulator_spent(&machine.acc);
+    out->result = NULL;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_uplc_frame_stack_init(&machine.frames);
+
+  error = run_machine(&machine, program->term, out);
+
+  cardano_uplc_frame_stack_free(&machine.frames);
+
+  return error;
+}
+
 cardano_error_t
 cardano_uplc_evaluate(
   cardano_uplc_arena_t*          arena,
@@ -2069,5 +2076,5 @@ cardano_uplc_evaluate(
   // This generic entry point does not carry a protocol version; gate by language
   // only by assuming the newest protocol, where every builtin of the language is
   // available. The transaction evaluator threads the real protocol version below.
-  return cardano_uplc_int_evaluate_with_costs(arena, program, &cost_model, semantics, lang_version(version), 11U, initial_budget, out);
+  return cardano_uplc_int_evaluate_with_costs(arena, program, &cost_model, semantics, lang_version(version), 11U, initial_budget, NULL, out);
 }
@@ -28,6 +28,7 @@
 #include "../ast/uplc_program.h"
 #include "../ast/uplc_term.h"
 #include "../builtins/uplc_builtin_semantics.h"
+#include "../builtins/uplc_sig_cache.h"
 #include "../cost/uplc_cost_model.h"
 #include "uplc_budget.h"
 #include "uplc_eval_result.h"
@@ -129,6 +130,9 @@ cardano_uplc_evaluate(
  * \param[in] protocol_major The major protocol version the program is evaluated
  *            under, used together with \p language to gate builtins.
  * \param[in] initial_budget The CPU and memory ceiling for the evaluation.
+ * \param[in,out] sig_cache An optional signature verification cache, or NULL. A
+ *                cache that outlives the evaluation lets later evaluations reuse
+ *                the outcomes this one verified; it never changes the budget spent.
  * \param[out] out On a \ref CARDANO_SUCCESS return, the script outcome, spent
  *             budget and result term.
  *
@@ -144,6 +148,7 @@ cardano_uplc_int_evaluate_with_costs(
   cardano_uplc_lang_version_t      language,
   uint64_t                         protocol_major,
   cardano_uplc_budget_t            initial_budget,
+  cardano_uplc_sig_cache_t*        sig_cache,
   cardano_uplc_eval_result_t*      out);
 
 #ifdef __cplusplus
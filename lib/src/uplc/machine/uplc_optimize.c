@@ -0,0 +1,934 @@
+/**
+ * \file uplc_optimize.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "uplc_optimize.h"
+
+#include "../ast/uplc_term.h"
+#include "../builtins/uplc_builtin.h"
+#include "../cost/uplc_selected_cost_model.h"
+#include "../flat/flat_encode.h"
+#include "uplc_budget.h"
+#include "uplc_eval_result.h"
+#include "uplc_machine.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Limits of the optimizer.
+ *
+ * \c PRV_OPTIMIZE_MAX_DEPTH caps the nesting depth the recursive walks follow, as
+ * \c PRV_DISCHARGE_MAX_DEPTH does for the machine's discharge; a deeper subterm is
+ * left as it is. \c PRV_OPTIMIZE_MAX_ROUNDS bounds the number of whole-program
+ * rounds, each of which can expose new redexes to the next.
+ */
+enum
+{
+  PRV_OPTIMIZE_MAX_DEPTH  = 4096,
+  PRV_OPTIMIZE_MAX_ROUNDS = 8
+};
+
+/**
+ * \brief The budget a single constant-folding evaluation may spend.
+ *
+ * A saturated builtin over constants finishes well inside this; one that does not
+ * is simply not folded.
+ */
+static const cardano_uplc_budget_t FOLD_BUDGET = { 10000000000LL, 100000000LL };
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Visits one child during a structural walk.
+ *
+ * \param[in,out] state The state of the walk.
+ * \param[in] depth The nesting depth of \p term.
+ * \param[in] level The de Bruijn index that refers to the walk's binder at \p term.
+ * \param[in] term The child to visit.
+ * \param[out] out The rewritten child, or \p term itself when nothing changed.
+ */
+typedef cardano_error_t (*visit_t)(
+  void*                       state,
+  size_t                      depth,
+  uint64_t                    level,
+  const cardano_uplc_term_t*  term,
+  const cardano_uplc_term_t** out);
+
+/**
+ * \brief State of a variable rewrite.
+ *
+ * With \c arg set, the variable bound at the walk's level is replaced by \c arg
+ * and every variable bound further out loses the removed binder. With \c arg
+ * NULL, every variable bound at the walk's level or further out is shifted up by
+ * \c delta.
+ */
+typedef struct var_rewrite_t
+{
+    cardano_uplc_arena_t*      arena;
+    const cardano_uplc_term_t* arg;
+    uint64_t                   delta;
+} var_rewrite_t;
+
+/**
+ * \brief State of an optimization round.
+ *
+ * \c costs holds the default cost model and builtin semantics for \c language at
+ * \c protocol_major, which constant folding evaluates under.
+ */
+typedef struct optimizer_t
+{
+    cardano_uplc_arena_t*              arena;
+    const cardano_uplc_program_t*      program;
+    cardano_uplc_lang_version_t        language;
+    uint64_t                           protocol_major;
+    cardano_uplc_selected_cost_model_t costs;
+    bool                               changed;
+} optimizer_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Returns whether a term is a value, whose evaluation takes one step and
+ *        cannot fail.
+ *
+ * A free variable is not a value: looking it up fails, so an application that
+ * would drop it must be kept for the program to keep failing.
+ *
+ * \param[in] term The term to inspect.
+ * \param[in] level The de Bruijn level of \p term; variable indices from 1
+ *            up to but excluding it are bound.
+ *
+ * \return \c true for a bound variable, constant, builtin, lambda or delay.
+ */
+static bool
+is_value(const cardano_uplc_term_t* term, const uint64_t level)
+{
+  if (term->kind == CARDANO_UPLC_TERM_VAR)
+  {
+    return (term->as.var_index > 0U) && (term->as.var_index < level);
+  }
+
+  return (term->kind == CARDANO_UPLC_TERM_CONSTANT) || (term->kind == CARDANO_UPLC_TERM_BUILTIN) || (term->kind == CARDANO_UPLC_TERM_LAMBDA) || (term->kind == CARDANO_UPLC_TERM_DELAY);
+}
+
+/**
+ * \brief Returns whether a value is small enough to substitute at several uses
+ *        without growing the script.
+ *
+ * \param[in] term The value to inspect.
+ *
+ * \return \c true for a variable, a builtin, or an integer, boolean or unit constant
+ *         that fits an \c int64_t.
+ */
+static bool
+is_duplicable(const cardano_uplc_term_t* term)
+{
+  if ((term->kind == CARDANO_UPLC_TERM_VAR) || (term->kind == CARDANO_UPLC_TERM_BUILTIN))
+  {
+    return true;
+  }
+
+  if (term->kind != CARDANO_UPLC_TERM_CONSTANT)
+  {
+    return false;
+  }
+
+  switch (term->as.constant->kind)
+  {
+    case CARDANO_UPLC_TYPE_INTEGER:
+    {
+      return term->as.constant->as.integer.is_small;
+    }
+    case CARDANO_UPLC_TYPE_BOOL:
+    case CARDANO_UPLC_TYPE_UNIT:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * \brief Returns whether a builtin result may replace the builtin application.
+ *
+ * A result replaces the application only when its flat encoding is no larger than
+ * the application's, so folding never grows the script: \c sha3_256 of an empty
+ * byte string, or a \c replicateByte that yields many bytes, are left in place.
+ *
+ * \param[in] application The builtin application being folded.
+ * \param[in] folded The constant term holding its result.
+ * \param[out] foldable Set to whether \p folded may replace \p application.
+ *
+ * \return \ref CARDANO_SUCCESS on success or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if a term cannot be measured.
+ */
+static cardano_error_t
+is_foldable(const cardano_uplc_term_t* application, const cardano_uplc_term_t* folded, bool* foldable)
+{
+  size_t          application_bits = 0U;
+  size_t          folded_bits      = 0U;
+  cardano_error_t error            = CARDANO_SUCCESS;
+
+  *foldable = false;
+
+  switch (folded->as.constant->kind)
+  {
+    case CARDANO_UPLC_TYPE_INTEGER:
+    case CARDANO_UPLC_TYPE_BOOL:
+    case CARDANO_UPLC_TYPE_UNIT:
+    case CARDANO_UPLC_TYPE_BYTE_STRING:
+    case CARDANO_UPLC_TYPE_STRING:
+    {
+      break;
+    }
+    default:
+    {
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  error = cardano_uplc_int_flat_term_size(application, &application_bits);
+
+  if (error == CARDANO_SUCCESS)
+  {
+    error = cardano_uplc_int_flat_term_size(folded, &folded_bits);
+  }
+
+  if (error == CARDANO_ERROR_MEMORY_ALLOCATION_FAILED)
+  {
+    return error;
+  }
+
+  *foldable = (error == CARDANO_SUCCESS) && (folded_bits <= application_bits);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Counts the uses of the variable bound at \p level.
+ *
+ * \param[in] term The term to search.
+ * \param[in] depth The nesting depth of \p term.
+ * \param[in] level The de Bruijn index of the variable at \p term.
+ * \param[in,out] count Incremented once per use; saturates at \c SIZE_MAX, which is
+ *                also what a term nested too deep to search reports.
+ */
+static void
+count_uses(const cardano_uplc_term_t* term, size_t depth, uint64_t level, size_t* count)
+{
+  if (*count == SIZE_MAX)
+  {
+    return;
+  }
+
+  if (depth > (size_t)PRV_OPTIMIZE_MAX_DEPTH)
+  {
+    *count = SIZE_MAX;
+
+    return;
+  }
+
+  switch (term->kind)
+  {
+    case CARDANO_UPLC_TERM_VAR:
+    {
+      if (term->as.var_index == level)
+      {
+        ++(*count);
+      }
+
+      break;
+    }
+    case CARDANO_UPLC_TERM_DELAY:
+    case CARDANO_UPLC_TERM_FORCE:
+    {
+      // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+      count_uses(term->as.unary, depth + 1U, level, count);
+      break;
+    }
+    case CARDANO_UPLC_TERM_LAMBDA:
+    {
+      // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+      count_uses(term->as.unary, depth + 1U, level + 1U, count);
+      break;
+    }
+    case CARDANO_UPLC_TERM_APPLY:
+    {
+      // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+      count_uses(term->as.apply.function, depth + 1U, level, count);
+      // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+      count_uses(term->as.apply.argument, depth + 1U, level, count);
+      break;
+    }
+    case CARDANO_UPLC_TERM_CONSTR:
+    {
+      for (size_t i = 0U; i < term->as.constr.field_count; ++i)
+      {
+        // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+        count_uses(term->as.constr.fields[i], depth + 1U, level, count);
+      }
+
+      break;
+    }
+    case CARDANO_UPLC_TERM_CASE:
+    {
+      // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+      count_uses(term->as.cases.scrutinee, depth + 1U, level, count);
+
+      for (size_t i = 0U; i < term->as.cases.branch_count; ++i)
+      {
+        // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+        count_uses(term->as.cases.branches[i], depth + 1U, level, count);
+      }
+
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * \brief Visits every term of a constr field or case branch list.
+ *
+ * \param[in] arena The arena a rewritten list is allocated from.
+ * \param[in,out] state The state passed to \p visit.
+ * \param[in] visit The visitor.
+ * \param[in] depth The nesting depth of the list items.
+ * \param[in] level The de Bruijn level passed to \p visit.
+ * \param[in] items The list.
+ * \param[in] count The number of items in the list.
+ * \param[out] out The rewritten list, or \p items itself when no item changed.
+ *
+ * \return \ref CARDANO_SUCCESS on success, the first error \p visit reports, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
+ *         the rewritten list.
+ */
+static cardano_error_t
+map_list(
+  cardano_uplc_arena_t*               arena,
+  void*                               state,
+  visit_t                             visit,
+  size_t                              depth,
+  uint64_t                            level,
+  const cardano_uplc_term_t* const*   items,
+  size_t                              count,
+  const cardano_uplc_term_t* const**  out)
+{
+  const cardano_uplc_term_t** copy = NULL;
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const cardano_uplc_term_t* item  = NULL;
+    cardano_error_t            error = visit(state, depth, level, items[i], &item);
+
+    if (error != CARDANO_SUCCESS)
+    {
+      return error;
+    }
+
+    if ((copy == NULL) && (item != items[i]))
+    {
+      copy = (const cardano_uplc_term_t**)cardano_uplc_arena_alloc(arena, count * sizeof(const cardano_uplc_term_t*), 0U);
+
+      if (copy == NULL)
+      {
+        return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+      }
+
+      for (size_t j = 0U; j < i; ++j)
+      {
+        copy[j] = items[j];
+      }
+    }
+
+    if (copy != NULL)
+    {
+      copy[i] = item;
+    }
+  }
+
+  *out = (copy != NULL) ? copy : items;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Visits the children of a term and rebuilds it around the rewritten ones.
+ *
+ * The body of a lambda is visited one level deeper. A term none of whose children
+ * changed is returned as is, so untouched subtrees stay shared.
+ *
+ * \param[in] arena The arena rebuilt nodes are allocated from.
+ * \param[in,out] state The state passed to \p visit.
+ * \param[in] visit The visitor.
+ * \param[in] depth The nesting depth of \p term.
+ * \param[in] level The de Bruijn level at \p term.
+ * \param[in] term The term whose children are visited.
+ * \param[out] out The rebuilt term, or \p term itself.
+ *
+ * \return \ref CARDANO_SUCCESS on success, the first error \p visit reports, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
+ *         node.
+ */
+static cardano_error_t
+map_children(
+  cardano_uplc_arena_t*       arena,
+  void*                       state,
+  visit_t                     visit,
+  size_t                      depth,
+  uint64_t                    level,
+  const cardano_uplc_term_t*  term,
+  const cardano_uplc_term_t** out)
+{
+  cardano_error_t      error   = CARDANO_SUCCESS;
+  cardano_uplc_term_t* rebuilt = NULL;
+
+  *out = term;
+
+  switch (term->kind)
+  {
+    case CARDANO_UPLC_TERM_DELAY:
+    case CARDANO_UPLC_TERM_LAMBDA:
+    case CARDANO_UPLC_TERM_FORCE:
+    {
+      const cardano_uplc_term_t* body = NULL;
+
+      error = visit(state, depth + 1U, (term->kind == CARDANO_UPLC_TERM_LAMBDA) ? (level + 1U) : level, term->as.unary, &body);
+
+      if ((error != CARDANO_SUCCESS) || (body == term->as.unary))
+      {
+        return error;
+      }
+
+      if (term->kind == CARDANO_UPLC_TERM_DELAY)
+      {
+        error = cardano_uplc_term_new_delay(arena, body, &rebuilt);
+      }
+      else if (term->kind == CARDANO_UPLC_TERM_LAMBDA)
+      {
+        error = cardano_uplc_term_new_lambda(arena, body, &rebuilt);
+      }
+      else
+      {
+        error = cardano_uplc_term_new_force(arena, body, &rebuilt);
+      }
+
+      break;
+    }
+    case CARDANO_UPLC_TERM_APPLY:
+    {
+      const cardano_uplc_term_t* function = NULL;
+      const cardano_uplc_term_t* argument = NULL;
+
+      error = visit(state, depth + 1U, level, term->as.apply.function, &function);
+
+      if (error == CARDANO_SUCCESS)
+      {
+        error = visit(state, depth + 1U, level, term->as.apply.argument, &argument);
+      }
+
+      if ((error != CARDANO_SUCCESS) || ((function == term->as.apply.function) && (argument == term->as.apply.argument)))
+      {
+        return error;
+      }
+
+      error = cardano_uplc_term_new_apply(arena, function, argument, &rebuilt);
+
+      break;
+    }
+    case CARDANO_UPLC_TERM_CONSTR:
+    {
+      const cardano_uplc_term_t* const* fields = NULL;
+
+      error = map_list(arena, state, visit, depth + 1U, level, term->as.constr.fields, term->as.constr.field_count, &fields);
+
+      if ((error != CARDANO_SUCCESS) || (fields == term->as.constr.fields))
+      {
+        return error;
+      }
+
+      error = cardano_uplc_term_new_constr(arena, term->as.constr.tag, fields, term->as.constr.field_count, &rebuilt);
+
+      break;
+    }
+    case CARDANO_UPLC_TERM_CASE:
+    {
+      const cardano_uplc_term_t*        scrutinee = NULL;
+      const cardano_uplc_term_t* const* branches  = NULL;
+
+      error = visit(state, depth + 1U, level, term->as.cases.scrutinee, &scrutinee);
+
+      if (error == CARDANO_SUCCESS)
+      {
+        error = map_list(arena, state, visit, depth + 1U, level, term->as.cases.branches, term->as.cases.branch_count, &branches);
+      }
+
+      if ((error != CARDANO_SUCCESS) || ((scrutinee == term->as.cases.scrutinee) && (branches == term->as.cases.branches)))
+      {
+        return error;
+      }
+
+      error = cardano_uplc_term_new_case(arena, scrutinee, branches, term->as.cases.branch_count, &rebuilt);
+
+      break;
+    }
+    default:
+    {
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  if (error == CARDANO_SUCCESS)
+  {
+    *out = rebuilt;
+  }
+
+  return error;
+}
+
+/**
+ * \brief Substitutes or shifts the variables of a term; a \ref visit_t over a
+ *        \ref var_rewrite_t.
+ *
+ * \return \ref CARDANO_SUCCESS on success,
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
+ *         node, or \ref CARDANO_ERROR_ILLEGAL_STATE past
+ *         \ref PRV_OPTIMIZE_MAX_DEPTH or when an index would overflow.
+ */
+static cardano_error_t
+rewrite_vars(
+  void*                       state,
+  size_t                      depth,
+  uint64_t                    level,
+  const cardano_uplc_term_t*  term,
+  const cardano_uplc_term_t** out)
+{
+  const var_rewrite_t* rewrite = (const var_rewrite_t*)state;
+  cardano_uplc_term_t* var     = NULL;
+  uint64_t             index   = 0U;
+  cardano_error_t      error   = CARDANO_SUCCESS;
+
+  if (depth > (size_t)PRV_OPTIMIZE_MAX_DEPTH)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  if (term->kind != CARDANO_UPLC_TERM_VAR)
+  {
+    // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+    return map_children(rewrite->arena, state, rewrite_vars, depth, level, term, out);
+  }
+
+  index = term->as.var_index;
+
+  if (index < level)
+  {
+    *out = term;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (rewrite->arg == NULL)
+  {
+    if (index > (UINT64_MAX - rewrite->delta))
+    {
+      return CARDANO_ERROR_ILLEGAL_STATE;
+    }
+
+    index += rewrite->delta;
+  }
+  else if (index == level)
+  {
+    const var_rewrite_t shift = { rewrite->arena, NULL, level - 1U };
+
+    if (level == 1U)
+    {
+      *out = rewrite->arg;
+
+      return CARDANO_SUCCESS;
+    }
+
+    // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+    return rewrite_vars((void*)&shift, depth + 1U, 1U, rewrite->arg, out);
+  }
+  else
+  {
+    index -= 1U;
+  }
+
+  error = cardano_uplc_term_new_var(rewrite->arena, index, &var);
+
+  if (error == CARDANO_SUCCESS)
+  {
+    *out = var;
+  }
+
+  return error;
+}
+
+/**
+ * \brief Beta-reduces <tt>[(lam x body) arg]</tt> when \c arg is a value.
+ *
+ * An unused binding is dropped whatever the value; otherwise the value is
+ * substituted when it is used once or is small enough to duplicate.
+ *
+ * \param[in,out] optimizer The optimization round.
+ * \param[in] depth The nesting depth of \p term.
+ * \param[in] term The application.
+ * \param[out] out The reduced body, or \p term itself.
+ *
+ * \return \ref CARDANO_SUCCESS on success or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
+ *         node.
+ */
+static cardano_error_t
+reduce_apply(optimizer_t* optimizer, size_t depth, const cardano_uplc_term_t* term, const cardano_uplc_term_t** out)
+{
+  const cardano_uplc_term_t* body    = term->as.apply.function->as.unary;
+  const cardano_uplc_term_t* reduced = NULL;
+  size_t                     uses    = 0U;
+
+  var_rewrite_t   rewrite = { optimizer->arena, term->as.apply.argument, 0U };
+  cardano_error_t error   = CARDANO_SUCCESS;
+
+  count_uses(body, depth, 1U, &uses);
+
+  if ((uses > 1U) && !is_duplicable(term->as.apply.argument))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  error = rewrite_vars((void*)&rewrite, depth, 1U, body, &reduced);
+
+  if (error == CARDANO_ERROR_ILLEGAL_STATE)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (error == CARDANO_SUCCESS)
+  {
+    optimizer->changed = true;
+    *out               = reduced;
+  }
+
+  return error;
+}
+
+/**
+ * \brief Folds a builtin saturated with constant arguments into its result.
+ *
+ * The builtin is evaluated under the optimizer's language, protocol version and
+ * default cost model; one that is not available to that language at that protocol
+ * version is left in place, as the ledger would reject it.
+ *
+ * \param[in,out] optimizer The optimization round.
+ * \param[in] term The outermost application or force of the builtin.
+ * \param[out] out The result constant, or \p term itself.
+ *
+ * \return \ref CARDANO_SUCCESS on success or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve
+ *         the evaluation or the folded node.
+ */
+static cardano_error_t
+fold_builtin(optimizer_t* optimizer, const cardano_uplc_term_t* term, const cardano_uplc_term_t** out)
+{
+  const cardano_uplc_term_t* head        = term;
+  size_t                     args        = 0U;
+  size_t                     forces      = 0U;
+  size_t                     arity       = 0U;
+  size_t                     force_count = 0U;
+
+  cardano_uplc_program_t     closed = *optimizer->program;
+  cardano_uplc_eval_result_t result = { CARDANO_UPLC_EVAL_SUCCESS, { 0, 0 }, NULL };
+  cardano_uplc_term_t*       folded = NULL;
+  bool                       fits   = false;
+  cardano_error_t            error  = CARDANO_SUCCESS;
+
+  while ((head->kind == CARDANO_UPLC_TERM_APPLY) || (head->kind == CARDANO_UPLC_TERM_FORCE))
+  {
+    if (head->kind == CARDANO_UPLC_TERM_FORCE)
+    {
+      ++forces;
+      head = head->as.unary;
+    }
+    else if (head->as.apply.argument->kind == CARDANO_UPLC_TERM_CONSTANT)
+    {
+      ++args;
+      head = head->as.apply.function;
+    }
+    else
+    {
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  if ((head->kind != CARDANO_UPLC_TERM_BUILTIN) || (head->as.builtin == CARDANO_UPLC_BUILTIN_TRACE) || !cardano_uplc_builtin_available(head->as.builtin, optimizer->language, optimizer->protocol_major))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if ((cardano_uplc_builtin_arity(head->as.builtin, &arity) != CARDANO_SUCCESS) || (cardano_uplc_builtin_force_count(head->as.builtin, &force_count) != CARDANO_SUCCESS))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if ((args != arity) || (forces != force_count))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  closed.term = term;
+  error       = cardano_uplc_int_evaluate_with_costs(optimizer->arena, &closed, &optimizer->costs.model, optimizer->costs.semantics, optimizer->language, optimizer->protocol_major, FOLD_BUDGET, NULL, &result);
+
+  if (error == CARDANO_ERROR_MEMORY_ALLOCATION_FAILED)
+  {
+    return error;
+  }
+
+  if ((error != CARDANO_SUCCESS) || (result.status != CARDANO_UPLC_EVAL_SUCCESS) || (result.result == NULL))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (result.result->kind != CARDANO_UPLC_TERM_CONSTANT)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  error = cardano_uplc_term_new_constant(optimizer->arena, result.result->as.constant, &folded);
+
+  if (error == CARDANO_SUCCESS)
+  {
+    error = is_foldable(term, folded, &fits);
+  }
+
+  if ((error == CARDANO_SUCCESS) && fits)
+  {
+    optimizer->changed = true;
+    *out               = folded;
+  }
+
+  return error;
+}
+
+/**
+ * \brief Rewrites <tt>(case (constr i f...) b...)</tt> into <tt>[b_i f...]</tt>.
+ *
+ * Only constructors of at most two value fields are rewritten: each field becomes
+ * an application step, so past two fields the rewrite would charge more steps
+ * than the constr and case it removes.
+ *
+ * \param[in,out] optimizer The optimization round.
+ * \param[in] level The de Bruijn level of \p term.
+ * \param[in] term The case.
+ * \param[out] out The selected branch applied to the fields, or \p term itself.
+ *
+ * \return \ref CARDANO_SUCCESS on success or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
+ *         node.
+ */
+static cardano_error_t
+select_branch(optimizer_t* optimizer, const uint64_t level, const cardano_uplc_term_t* term, const cardano_uplc_term_t** out)
+{
+  const cardano_uplc_term_t* scrutinee = term->as.cases.scrutinee;
+  const cardano_uplc_term_t* selected  = NULL;
+
+  if ((scrutinee->kind != CARDANO_UPLC_TERM_CONSTR) || (scrutinee->as.constr.tag >= (uint64_t)term->as.cases.branch_count) || (scrutinee->as.constr.field_count > 2U))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  for (size_t i = 0U; i < scrutinee->as.constr.field_count; ++i)
+  {
+    if (!is_value(scrutinee->as.constr.fields[i], level))
+    {
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  selected = term->as.cases.branches[scrutinee->as.constr.tag];
+
+  for (size_t i = 0U; i < scrutinee->as.constr.field_count; ++i)
+  {
+    cardano_uplc_term_t* apply = NULL;
+    cardano_error_t      error = cardano_uplc_term_new_apply(optimizer->arena, selected, scrutinee->as.constr.fields[i], &apply);
+
+    if (error != CARDANO_SUCCESS)
+    {
+      return error;
+    }
+
+    selected = apply;
+  }
+
+  optimizer->changed = true;
+  *out               = selected;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Optimizes a term bottom-up; a \ref visit_t over an \ref optimizer_t.
+ *
+ * \return \ref CARDANO_SUCCESS on success or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
+ *         node.
+ */
+static cardano_error_t
+optimize_term(
+  void*                       state,
+  size_t                      depth,
+  uint64_t                    level,
+  const cardano_uplc_term_t*  term,
+  const cardano_uplc_term_t** out)
+{
+  optimizer_t*               optimizer = (optimizer_t*)state;
+  const cardano_uplc_term_t* mapped    = NULL;
+  cardano_error_t            error     = CARDANO_SUCCESS;
+
+  *out = term;
+
+  if (depth > (size_t)PRV_OPTIMIZE_MAX_DEPTH)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  // cppcheck-suppress misra-c2012-17.2; Reason: bounded-depth recursion limited by PRV_OPTIMIZE_MAX_DEPTH
+  error = map_children(optimizer->arena, state, optimize_term, depth, level, term, &mapped);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  *out = mapped;
+
+  switch (mapped->kind)
+  {
+    case CARDANO_UPLC_TERM_FORCE:
+    {
+      if (mapped->as.unary->kind == CARDANO_UPLC_TERM_DELAY)
+      {
+        optimizer->changed = true;
+        *out               = mapped->as.unary->as.unary;
+
+        return CARDANO_SUCCESS;
+      }
+
+      return fold_builtin(optimizer, mapped, out);
+    }
+    case CARDANO_UPLC_TERM_APPLY:
+    {
+      if ((mapped->as.apply.function->kind == CARDANO_UPLC_TERM_LAMBDA) && is_value(mapped->as.apply.argument, level))
+      {
+        return reduce_apply(optimizer, depth, mapped, out);
+      }
+
+      return fold_builtin(optimizer, mapped, out);
+    }
+    case CARDANO_UPLC_TERM_CASE:
+    {
+      return select_branch(optimizer, level, mapped, out);
+    }
+    default:
+    {
+      return CARDANO_SUCCESS;
+    }
+  }
+}
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+cardano_uplc_int_optimize_program(
+  cardano_uplc_arena_t*          arena,
+  const cardano_uplc_program_t*  program,
+  cardano_uplc_lang_version_t    language,
+  uint64_t                       protocol_major,
+  const cardano_uplc_program_t** out)
+{
+  optimizer_t                optimizer;
+  const cardano_uplc_term_t* term      = NULL;
+  cardano_uplc_program_t*    optimized = NULL;
+
+  if ((arena == NULL) || (program == NULL) || (program->term == NULL) || (out == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  optimizer.arena          = arena;
+  optimizer.program        = program;
+  optimizer.language       = language;
+  optimizer.protocol_major = protocol_major;
+  optimizer.changed        = false;
+
+  cardano_uplc_select_default_cost_model(language, protocol_major, &optimizer.costs);
+
+  term = program->term;
+
+  for (size_t round = 0U; round < (size_t)PRV_OPTIMIZE_MAX_ROUNDS; ++round)
+  {
+    const cardano_uplc_term_t* next  = NULL;
+    cardano_error_t            error = CARDANO_SUCCESS;
+
+    optimizer.changed = false;
+    error             = optimize_term((void*)&optimizer, 0U, 1U, term, &next);
+
+    if (error != CARDANO_SUCCESS)
+    {
+      return error;
+    }
+
+    term = next;
+
+    if (!optimizer.changed)
+    {
+      break;
+    }
+  }
+
+  optimized = (cardano_uplc_program_t*)cardano_uplc_arena_alloc(arena, sizeof(cardano_uplc_program_t), 0U);
+
+  if (optimized == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  optimized->version_major = program->version_major;
+  optimized->version_minor = program->version_minor;
+  optimized->version_patch = program->version_patch;
+  optimized->term          = term;
+
+  *out = optimized;
+
+  return CARDANO_SUCCESS;
+}
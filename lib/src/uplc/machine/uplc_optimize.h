@@ -0,0 +1,97 @@
+/**
+ * \file uplc_optimize.h
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UPLC_MACHINE_UPLC_OPTIMIZE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UPLC_MACHINE_UPLC_OPTIMIZE_H
+
+/* INCLUDES ******************************************************************/
+
+#include "../arena/uplc_arena.h"
+#include "../ast/uplc_program.h"
+#include "../ast/uplc_lang_version.h"
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Rewrites a program into an equivalent one that is smaller and cheaper to run.
+ *
+ * The optimizer applies the following rewrites bottom-up, repeating the walk until
+ * a round changes nothing or a fixed number of rounds has run:
+ *
+ * - force/delay cancellation: <tt>(force (delay t))</tt> becomes \c t;
+ * - beta-reduction: <tt>[(lam x body) arg]</tt> becomes \c body with \c arg
+ *   substituted for \c x when \c arg is a value (a variable, constant, builtin,
+ *   lambda or delay) and substituting it does not duplicate anything larger than
+ *   a variable, a builtin or a small scalar constant;
+ * - dead-binding elimination: the binding is dropped altogether when \c x is
+ *   unused, whatever value \c arg is;
+ * - constant folding: a builtin saturated with constant arguments is evaluated
+ *   once and replaced by its result when that is an integer, a boolean, the unit,
+ *   a byte string or a string whose flat encoding is no larger than the
+ *   application it replaces. \c trace is never folded, and neither is a builtin
+ *   that fails or that \p language cannot use at \p protocol_major;
+ * - case-of-known-constructor: <tt>(case (constr i f...) b...)</tt> becomes
+ *   <tt>[b_i f...]</tt> when every field is a value and there are at most two
+ *   fields.
+ *
+ * Every rewrite removes machine steps or builtin calls without adding any (a
+ * substituted value costs the same step as the variable it replaces), so the
+ * optimized program never charges more than the original on success, and it
+ * reaches the same result. A program that fails still fails.
+ *
+ * Terms the optimizer does not touch are shared with \p program rather than
+ * copied, so the arena that owns \p program must outlive the result. Constant
+ * folding runs the machine in \p arena, which grows accordingly. Subterms nested
+ * deeper than the traversal follows are left as they are.
+ *
+ * \param[in] arena The arena the optimized program is allocated from. Must not be NULL.
+ * \param[in] program The program to optimize. Must not be NULL and must carry a
+ *            non-NULL term.
+ * \param[in] language The Plutus language of \p program, selecting the builtins
+ *            and default costs constant folding evaluates under.
+ * \param[in] protocol_major The protocol major version the script will run under,
+ *            gating builtins and selecting their semantics as the ledger does.
+ * \param[out] out On success, the optimized program; left untouched on failure.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         any argument or the program term is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena cannot serve a
+ *         node.
+ */
+cardano_error_t
+cardano_uplc_int_optimize_program(
+  cardano_uplc_arena_t*          arena,
+  const cardano_uplc_program_t*  program,
+  cardano_uplc_lang_version_t    language,
+  uint64_t                       protocol_major,
+  const cardano_uplc_program_t** out);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BIGLUP_LABS_INCLUDE_CARDANO_UPLC_MACHINE_UPLC_OPTIMIZE_H */
@@ -27,6 +27,64 @@
 
 #include <stddef.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Number of shared small-integer values.
+ */
+#define SHARED_INT_COUNT 272U
+
+/**
+ * \brief Expands a table entry macro for eight, sixteen or sixty-four consecutive indices.
+ */
+#define SHARED_REPEAT_8(M, n)  M(n), M((n) + 1), M((n) + 2), M((n) + 3), M((n) + 4), M((n) + 5), M((n) + 6), M((n) + 7)
+#define SHARED_REPEAT_16(M, n) SHARED_REPEAT_8(M, n), SHARED_REPEAT_8(M, (n) + 8)
+#define SHARED_REPEAT_64(M, n) SHARED_REPEAT_16(M, n), SHARED_REPEAT_16(M, (n) + 16), SHARED_REPEAT_16(M, (n) + 32), SHARED_REPEAT_16(M, (n) + 48)
+
+/**
+ * \brief An inline integer constant with no materialized bigint.
+ */
+#define SHARED_INT_CONSTANT(n) { CARDANO_UPLC_TYPE_INTEGER, { { (int64_t)(n), NULL, true } } }
+
+/**
+ * \brief A constant value wrapping entry \p i of the shared integer constants.
+ */
+#define SHARED_INT_VALUE(i) { CARDANO_UPLC_VALUE_CONSTANT, 1, { &SHARED_INT_CONSTANTS[(i)] } }
+
+/**
+ * \brief The shared integer constants, from \ref CARDANO_UPLC_VALUE_SHARED_INT_MIN
+ *        to \ref CARDANO_UPLC_VALUE_SHARED_INT_MAX.
+ */
+static const cardano_uplc_constant_t SHARED_INT_CONSTANTS[SHARED_INT_COUNT] = {
+  SHARED_REPEAT_16(SHARED_INT_CONSTANT, -16),
+  SHARED_REPEAT_64(SHARED_INT_CONSTANT, 0),
+  SHARED_REPEAT_64(SHARED_INT_CONSTANT, 64),
+  SHARED_REPEAT_64(SHARED_INT_CONSTANT, 128),
+  SHARED_REPEAT_64(SHARED_INT_CONSTANT, 192)
+};
+
+/**
+ * \brief The shared integer values, one per shared integer constant.
+ *
+ * Every shared value has its ex-mem size precomputed (1 for an inline integer,
+ * a boolean and the unit) so the lazy ex-mem cache never writes to them.
+ */
+static const cardano_uplc_value_t SHARED_INT_VALUES[SHARED_INT_COUNT] = {
+  SHARED_REPEAT_16(SHARED_INT_VALUE, 0),
+  SHARED_REPEAT_64(SHARED_INT_VALUE, 16),
+  SHARED_REPEAT_64(SHARED_INT_VALUE, 80),
+  SHARED_REPEAT_64(SHARED_INT_VALUE, 144),
+  SHARED_REPEAT_64(SHARED_INT_VALUE, 208)
+};
+
+static const cardano_uplc_constant_t SHARED_FALSE_CONSTANT = { CARDANO_UPLC_TYPE_BOOL, { .boolean = false } };
+static const cardano_uplc_constant_t SHARED_TRUE_CONSTANT  = { CARDANO_UPLC_TYPE_BOOL, { .boolean = true } };
+static const cardano_uplc_constant_t SHARED_UNIT_CONSTANT  = { CARDANO_UPLC_TYPE_UNIT, { { 0, NULL, false } } };
+
+static const cardano_uplc_value_t SHARED_FALSE_VALUE = { CARDANO_UPLC_VALUE_CONSTANT, 1, { &SHARED_FALSE_CONSTANT } };
+static const cardano_uplc_value_t SHARED_TRUE_VALUE  = { CARDANO_UPLC_VALUE_CONSTANT, 1, { &SHARED_TRUE_CONSTANT } };
+static const cardano_uplc_value_t SHARED_UNIT_VALUE  = { CARDANO_UPLC_VALUE_CONSTANT, 1, { &SHARED_UNIT_CONSTANT } };
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -51,6 +109,74 @@ alloc_value(cardano_uplc_arena_t* arena)
 
 /* DEFINITIONS ***************************************************************/
 
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_bool(const bool value)
+{
+  return value ? &SHARED_TRUE_VALUE : &SHARED_FALSE_VALUE;
+}
+
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_unit(void)
+{
+  return &SHARED_UNIT_VALUE;
+}
+
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_int(const int64_t value)
+{
+  if ((value < CARDANO_UPLC_VALUE_SHARED_INT_MIN) || (value > CARDANO_UPLC_VALUE_SHARED_INT_MAX))
+  {
+    return NULL;
+  }
+
+  return &SHARED_INT_VALUES[value - CARDANO_UPLC_VALUE_SHARED_INT_MIN];
+}
+
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_for(const cardano_uplc_constant_t* constant)
+{
+  if (constant == NULL)
+  {
+    return NULL;
+  }
+
+  switch (constant->kind)
+  {
+    case CARDANO_UPLC_TYPE_BOOL:
+    {
+      return cardano_uplc_value_shared_bool(constant->as.boolean);
+    }
+
+    case CARDANO_UPLC_TYPE_UNIT:
+    {
+      return cardano_uplc_value_shared_unit();
+    }
+
+    case CARDANO_UPLC_TYPE_INTEGER:
+    {
+      if (!constant->as.integer.is_small)
+      {
+        return NULL;
+      }
+
+      return cardano_uplc_value_shared_int(constant->as.integer.small);
+    }
+
+    default:
+    {
+      return NULL;
+    }
+  }
+}
+
+bool
+cardano_uplc_value_constant_is_shared(const cardano_uplc_constant_t* constant)
+{
+  const cardano_uplc_value_t* shared = cardano_uplc_value_shared_for(constant);
+
+  return (shared != NULL) && (shared->as.constant == constant);
+}
+
 cardano_error_t
 cardano_uplc_value_new_constant(
   cardano_uplc_arena_t*          arena,
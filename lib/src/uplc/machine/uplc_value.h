@@ -67,7 +67,9 @@ extern "C" {
  * values applied so far until it saturates. A \c constr holds its tag and the
  * already-resolved field values. Values are arena-allocated and never mutated
  * after construction; the constant an arena owns inside a \c constant value is
- * already registered with that arena.
+ * already registered with that arena. The unit, boolean and small-integer
+ * constant values returned by \ref cardano_uplc_value_shared_for are the
+ * exception: they are static, shared by every arena, and must never be written.
  *
  * \c ex_mem caches the value's ex-mem size so the builtin cost path does not
  * walk the constant on every application. It starts at
@@ -135,6 +137,72 @@ cardano_uplc_value_new_constant(
   const cardano_uplc_constant_t* constant,
   cardano_uplc_value_t**         out);
 
+/**
+ * \brief Smallest integer served by the shared small-integer values.
+ */
+#define CARDANO_UPLC_VALUE_SHARED_INT_MIN ((int64_t)-16)
+
+/**
+ * \brief Largest integer served by the shared small-integer values.
+ */
+#define CARDANO_UPLC_VALUE_SHARED_INT_MAX ((int64_t)255)
+
+/**
+ * \brief Returns the shared boolean constant value.
+ *
+ * \param[in] value The boolean value.
+ *
+ * \return The static \c True or \c False value; never NULL.
+ */
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_bool(bool value);
+
+/**
+ * \brief Returns the shared unit constant value.
+ *
+ * \return The static \c () value; never NULL.
+ */
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_unit(void);
+
+/**
+ * \brief Returns the shared constant value of a small integer.
+ *
+ * \param[in] value The integer value.
+ *
+ * \return The static value of \p value, or NULL when it lies outside
+ *         [\ref CARDANO_UPLC_VALUE_SHARED_INT_MIN, \ref CARDANO_UPLC_VALUE_SHARED_INT_MAX].
+ */
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_int(int64_t value);
+
+/**
+ * \brief Returns the shared value equal to a constant, if there is one.
+ *
+ * Lets the machine and the builtins hand back a unit, a boolean or a small
+ * integer without allocating a value, nor a constant, from the arena.
+ *
+ * \param[in] constant The constant to look up, or NULL.
+ *
+ * \return The static value of \p constant when it is a unit, a boolean or an
+ *         inline integer in the shared range, or NULL otherwise.
+ */
+const cardano_uplc_value_t*
+cardano_uplc_value_shared_for(const cardano_uplc_constant_t* constant);
+
+/**
+ * \brief Tells whether a constant is one of the static shared constants.
+ *
+ * Shared constants live in read-only storage, so code that caches data inside
+ * a constant (such as a materialized bigint) must skip them.
+ *
+ * \param[in] constant The constant to test, or NULL.
+ *
+ * \return \c true if \p constant is shared, \c false otherwise.
+ */
+bool
+cardano_uplc_value_constant_is_shared(const cardano_uplc_constant_t* constant);
+
 /**
  * \brief Builds a delay value closing a body term over an environment.
  *
@@ -23,11 +23,77 @@
 
 #include "../ast/uplc_program.h"
 #include "../ast/uplc_term.h"
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/object.h>
 #include <cardano/uplc/uplc_apply_params.h>
 
+#include "../../allocators.h"
 #include "../arena/uplc_arena.h"
 
+#include <src/string_safe.h>
+
+#include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The block size of every arena this module creates.
+ */
+static const size_t APPLY_PARAMS_ARENA_BLOCK_SIZE = 4096U;
+
+/**
+ * \brief The size of the hashes the cache is keyed by.
+ */
+#define APPLY_PARAMS_KEY_SIZE 32U
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A decoded base program, kept in its own arena.
+ */
+typedef struct apply_params_base_t
+{
+    bool                          used;
+    uint64_t                      last_use;
+    byte_t                        script_hash[APPLY_PARAMS_KEY_SIZE];
+    cardano_uplc_arena_t*         arena;
+    const cardano_uplc_program_t* program;
+} apply_params_base_t;
+
+/**
+ * \brief An applied script and its ledger hash.
+ */
+typedef struct apply_params_entry_t
+{
+    bool                              used;
+    uint64_t                          last_use;
+    byte_t                            script_hash[APPLY_PARAMS_KEY_SIZE];
+    byte_t                            params_hash[APPLY_PARAMS_KEY_SIZE];
+    cardano_plutus_language_version_t language;
+    cardano_buffer_t*                 script;
+    cardano_blake2b_hash_t*           hash;
+} apply_params_entry_t;
+
+/**
+ * \brief A cache of parameterized script applications.
+ *
+ * \c entries and \c bases each hold \c capacity slots. \c clock stamps every use
+ * so the least recently used slot of a full table can be evicted.
+ */
+typedef struct cardano_uplc_apply_params_cache_t
+{
+    cardano_object_t      base;
+    size_t                capacity;
+    apply_params_entry_t* entries;
+    apply_params_base_t*  bases;
+    uint64_t              clock;
+    size_t                hits;
+    size_t                misses;
+} cardano_uplc_apply_params_cache_t;
 
 /* STATIC FUNCTIONS **********************************************************/
 
@@ -90,6 +156,385 @@ apply_param_list(
   return CARDANO_SUCCESS;
 }
 
+/**
+ * \brief Applies a parameter list to a program and encodes the result.
+ *
+ * The applied nodes are allocated from a scratch arena released before this
+ * returns; \p program is only read, so it can live in a longer-lived arena and be
+ * applied again with other parameters.
+ *
+ * \param[in] program The base program.
+ * \param[in] params The parameters to apply, or NULL to apply none.
+ * \param[out] out_script On success, the CBOR-wrapped flat bytes of the result.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated error.
+ */
+static cardano_error_t
+apply_and_encode(
+  const cardano_uplc_program_t* program,
+  const cardano_plutus_list_t*  params,
+  cardano_buffer_t**            out_script)
+{
+  cardano_uplc_arena_t*         arena   = NULL;
+  const cardano_uplc_program_t* applied = NULL;
+  cardano_error_t               result  = cardano_uplc_arena_new(APPLY_PARAMS_ARENA_BLOCK_SIZE, &arena);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = apply_param_list(arena, params, program, &applied);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_program_to_cbor(applied, out_script);
+  }
+
+  cardano_uplc_arena_free(&arena);
+
+  return result;
+}
+
+/**
+ * \brief Hashes a byte range into a cache key.
+ *
+ * \param[in] data The bytes to hash. Must not be NULL.
+ * \param[in] size The number of bytes; must be non-zero.
+ * \param[out] out The Blake2b-256 digest.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated hashing error.
+ */
+static cardano_error_t
+compute_key(const byte_t* data, size_t size, byte_t out[APPLY_PARAMS_KEY_SIZE])
+{
+  cardano_blake2b_hash_t* hash   = NULL;
+  cardano_error_t         result = cardano_blake2b_compute_hash(data, size, (size_t)CARDANO_BLAKE2B_HASH_SIZE_256, &hash);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_safe_memcpy(out, APPLY_PARAMS_KEY_SIZE, cardano_blake2b_hash_get_data(hash), APPLY_PARAMS_KEY_SIZE);
+  cardano_blake2b_hash_unref(&hash);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Hashes the CBOR encoding of a parameter list into a cache key.
+ *
+ * A NULL list is keyed as the empty definite list.
+ *
+ * \param[in] params The parameters, or NULL.
+ * \param[out] out The Blake2b-256 digest of the encoding.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated encoding or hashing error.
+ */
+static cardano_error_t
+compute_params_key(const cardano_plutus_list_t* params, byte_t out[APPLY_PARAMS_KEY_SIZE])
+{
+  cardano_cbor_writer_t* writer  = cardano_cbor_writer_new();
+  cardano_buffer_t*      encoded = NULL;
+  cardano_error_t        result  = CARDANO_SUCCESS;
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  if (params != NULL)
+  {
+    result = cardano_plutus_list_to_cbor(params, writer);
+  }
+  else
+  {
+    result = cardano_cbor_writer_write_start_array(writer, 0);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_in_buffer(writer, &encoded);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = compute_key(cardano_buffer_get_data(encoded), cardano_buffer_get_size(encoded), out);
+
+  cardano_buffer_unref(&encoded);
+
+  return result;
+}
+
+/**
+ * \brief Computes the ledger hash of a script in a Plutus language.
+ *
+ * The ledger hashes the script bytes prefixed with the language tag (1 for
+ * PlutusV1 through 4 for PlutusV4) under Blake2b-224.
+ *
+ * \param[in] language The Plutus language.
+ * \param[in] script The script bytes.
+ * \param[out] out On success, the script hash.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT for an
+ *         unknown language, or a propagated allocation or hashing error.
+ */
+static cardano_error_t
+compute_script_hash(
+  cardano_plutus_language_version_t language,
+  const cardano_buffer_t*           script,
+  cardano_blake2b_hash_t**          out)
+{
+  cardano_buffer_t* input  = NULL;
+  byte_t            tag    = 0U;
+  cardano_error_t   result = CARDANO_SUCCESS;
+
+  switch (language)
+  {
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V1:
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V2:
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V3:
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V4:
+    {
+      tag = (byte_t)((uint32_t)language + 1U);
+      break;
+    }
+
+    default:
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+
+  input = cardano_buffer_new(cardano_buffer_get_size(script) + 1U);
+
+  if (input == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_buffer_write(input, &tag, 1U);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_buffer_write(input, cardano_buffer_get_data(script), cardano_buffer_get_size(script));
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_blake2b_compute_hash(cardano_buffer_get_data(input), cardano_buffer_get_size(input), (size_t)CARDANO_BLAKE2B_HASH_SIZE_224, out);
+  }
+
+  cardano_buffer_unref(&input);
+
+  return result;
+}
+
+/**
+ * \brief Releases the contents of an applied-script slot and marks it free.
+ *
+ * \param[in,out] entry The slot to release.
+ */
+static void
+release_entry(apply_params_entry_t* entry)
+{
+  cardano_buffer_unref(&entry->script);
+  cardano_blake2b_hash_unref(&entry->hash);
+  entry->used = false;
+}
+
+/**
+ * \brief Releases the contents of a base-program slot and marks it free.
+ *
+ * \param[in,out] base The slot to release.
+ */
+static void
+release_base(apply_params_base_t* base)
+{
+  cardano_uplc_arena_free(&base->arena);
+  base->program = NULL;
+  base->used    = false;
+}
+
+/**
+ * \brief Returns a free base-program slot, or the least recently used one.
+ *
+ * \param[in] cache The cache.
+ *
+ * \return The slot to fill.
+ */
+static apply_params_base_t*
+pick_base_slot(cardano_uplc_apply_params_cache_t* cache)
+{
+  apply_params_base_t* victim = &cache->bases[0];
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    if (!cache->bases[i].used)
+    {
+      return &cache->bases[i];
+    }
+
+    if (cache->bases[i].last_use < victim->last_use)
+    {
+      victim = &cache->bases[i];
+    }
+  }
+
+  return victim;
+}
+
+/**
+ * \brief Returns a free applied-script slot, or the least recently used one.
+ *
+ * \param[in] cache The cache.
+ *
+ * \return The slot to fill.
+ */
+static apply_params_entry_t*
+pick_entry_slot(cardano_uplc_apply_params_cache_t* cache)
+{
+  apply_params_entry_t* victim = &cache->entries[0];
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    if (!cache->entries[i].used)
+    {
+      return &cache->entries[i];
+    }
+
+    if (cache->entries[i].last_use < victim->last_use)
+    {
+      victim = &cache->entries[i];
+    }
+  }
+
+  return victim;
+}
+
+/**
+ * \brief Returns the decoded base program for a script, decoding it on a miss.
+ *
+ * \param[in,out] cache The cache.
+ * \param[in] script_hash The key of the script.
+ * \param[in] script_bytes The script bytes.
+ * \param[in] script_size The number of bytes in \p script_bytes.
+ * \param[out] out On success, the decoded program, owned by the cache.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a propagated decoding error.
+ */
+static cardano_error_t
+get_base_program(
+  cardano_uplc_apply_params_cache_t* cache,
+  const byte_t*                      script_hash,
+  const byte_t*                      script_bytes,
+  size_t                             script_size,
+  const cardano_uplc_program_t**     out)
+{
+  apply_params_base_t* slot   = NULL;
+  cardano_error_t      result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    apply_params_base_t* base = &cache->bases[i];
+
+    if (base->used && (memcmp(base->script_hash, script_hash, APPLY_PARAMS_KEY_SIZE) == 0))
+    {
+      base->last_use = ++cache->clock;
+      *out           = base->program;
+
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  slot = pick_base_slot(cache);
+
+  if (slot->used)
+  {
+    release_base(slot);
+  }
+
+  result = cardano_uplc_arena_new(APPLY_PARAMS_ARENA_BLOCK_SIZE, &slot->arena);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_uplc_program_from_script_bytes(slot->arena, script_bytes, script_size, &slot->program);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    release_base(slot);
+
+    return result;
+  }
+
+  cardano_safe_memcpy(slot->script_hash, APPLY_PARAMS_KEY_SIZE, script_hash, APPLY_PARAMS_KEY_SIZE);
+  slot->used     = true;
+  slot->last_use = ++cache->clock;
+
+  *out = slot->program;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Hands a cached application back to the caller.
+ *
+ * \param[in] entry The cached application.
+ * \param[out] out_script Set to a copy of the applied script bytes.
+ * \param[out] out_hash If not NULL, set to a new reference to the script hash.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the copy cannot be allocated.
+ */
+static cardano_error_t
+copy_out(const apply_params_entry_t* entry, cardano_buffer_t** out_script, cardano_blake2b_hash_t** out_hash)
+{
+  cardano_buffer_t* script = cardano_buffer_new_from(cardano_buffer_get_data(entry->script), cardano_buffer_get_size(entry->script));
+
+  if (script == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  if (out_hash != NULL)
+  {
+    cardano_blake2b_hash_ref(entry->hash);
+    *out_hash = entry->hash;
+  }
+
+  *out_script = script;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Deallocates an apply-params cache object.
+ *
+ * \param object A void pointer to the cache object to be deallocated.
+ */
+static void
+cardano_uplc_apply_params_cache_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_uplc_apply_params_cache_t* cache = (cardano_uplc_apply_params_cache_t*)object;
+
+  cardano_uplc_apply_params_cache_clear(cache);
+
+  _cardano_free(cache->entries);
+  _cardano_free(cache->bases);
+  _cardano_free(cache);
+}
+
 /* DEFINITIONS ***************************************************************/
 
 cardano_error_t
@@ -99,8 +544,6 @@ cardano_uplc_apply_params_to_script(
   size_t                       script_size,
   cardano_buffer_t**           out_script)
 {
-  static const size_t kArenaBlockSize = 4096U;
-
   cardano_uplc_arena_t*         arena   = NULL;
   const cardano_uplc_program_t* program = NULL;
   const cardano_uplc_program_t* applied = NULL;
@@ -112,7 +555,7 @@ cardano_uplc_apply_params_to_script(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = cardano_uplc_arena_new(kArenaBlockSize, &arena);
+  result = cardano_uplc_arena_new(APPLY_PARAMS_ARENA_BLOCK_SIZE, &arena);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -150,3 +593,240 @@ cardano_uplc_apply_params_to_script(
 
   return CARDANO_SUCCESS;
 }
+
+cardano_error_t
+cardano_uplc_apply_params_cache_new(size_t capacity, cardano_uplc_apply_params_cache_t** cache)
+{
+  if (cache == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((capacity == 0U) || (capacity > (SIZE_MAX / sizeof(apply_params_entry_t))))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_uplc_apply_params_cache_t* data = _cardano_malloc(sizeof(cardano_uplc_apply_params_cache_t));
+
+  if (data == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  data->entries = _cardano_malloc(capacity * sizeof(apply_params_entry_t));
+  data->bases   = _cardano_malloc(capacity * sizeof(apply_params_base_t));
+
+  if ((data->entries == NULL) || (data->bases == NULL))
+  {
+    _cardano_free(data->entries);
+    _cardano_free(data->bases);
+    _cardano_free(data);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(data->entries, 0, capacity * sizeof(apply_params_entry_t)));
+  CARDANO_UNUSED(memset(data->bases, 0, capacity * sizeof(apply_params_base_t)));
+
+  data->base.ref_count     = 1;
+  data->base.last_error[0] = '\0';
+  data->base.deallocator   = cardano_uplc_apply_params_cache_deallocate;
+  data->capacity           = capacity;
+  data->clock              = 0U;
+  data->hits               = 0U;
+  data->misses             = 0U;
+
+  *cache = data;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_uplc_apply_params_cache_apply(
+  cardano_uplc_apply_params_cache_t* cache,
+  cardano_plutus_language_version_t  language,
+  const cardano_plutus_list_t*       params,
+  const byte_t*                      script_bytes,
+  size_t                             script_size,
+  cardano_buffer_t**                 out_script,
+  cardano_blake2b_hash_t**           out_hash)
+{
+  byte_t                        script_key[APPLY_PARAMS_KEY_SIZE];
+  byte_t                        params_key[APPLY_PARAMS_KEY_SIZE];
+  const cardano_uplc_program_t* program = NULL;
+  apply_params_entry_t*         slot    = NULL;
+  cardano_buffer_t*             script  = NULL;
+  cardano_blake2b_hash_t*       hash    = NULL;
+  cardano_error_t               result  = CARDANO_SUCCESS;
+
+  if ((cache == NULL) || (out_script == NULL) || ((script_bytes == NULL) && (script_size != 0U)))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (script_size == 0U)
+  {
+    // An empty script is not a program; report it exactly as the uncached path does.
+    return cardano_uplc_apply_params_to_script(params, script_bytes, script_size, out_script);
+  }
+
+  result = compute_key(script_bytes, script_size, script_key);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = compute_params_key(params, params_key);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    apply_params_entry_t* entry = &cache->entries[i];
+
+    if (entry->used && (entry->language == language) && (memcmp(entry->script_hash, script_key, APPLY_PARAMS_KEY_SIZE) == 0) && (memcmp(entry->params_hash, params_key, APPLY_PARAMS_KEY_SIZE) == 0))
+    {
+      entry->last_use = ++cache->clock;
+      ++cache->hits;
+
+      return copy_out(entry, out_script, out_hash);
+    }
+  }
+
+  ++cache->misses;
+
+  result = get_base_program(cache, script_key, script_bytes, script_size, &program);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = apply_and_encode(program, params, &script);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = compute_script_hash(language, script, &hash);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_buffer_unref(&script);
+
+    return result;
+  }
+
+  slot = pick_entry_slot(cache);
+
+  if (slot->used)
+  {
+    release_entry(slot);
+  }
+
+  cardano_safe_memcpy(slot->script_hash, APPLY_PARAMS_KEY_SIZE, script_key, APPLY_PARAMS_KEY_SIZE);
+  cardano_safe_memcpy(slot->params_hash, APPLY_PARAMS_KEY_SIZE, params_key, APPLY_PARAMS_KEY_SIZE);
+  slot->language = language;
+  slot->script   = script;
+  slot->hash     = hash;
+  slot->used     = true;
+  slot->last_use = ++cache->clock;
+
+  return copy_out(slot, out_script, out_hash);
+}
+
+void
+cardano_uplc_apply_params_cache_clear(cardano_uplc_apply_params_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    if (cache->entries[i].used)
+    {
+      release_entry(&cache->entries[i]);
+    }
+
+    if (cache->bases[i].used)
+    {
+      release_base(&cache->bases[i]);
+    }
+  }
+}
+
+size_t
+cardano_uplc_apply_params_cache_get_hits(const cardano_uplc_apply_params_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return 0U;
+  }
+
+  return cache->hits;
+}
+
+size_t
+cardano_uplc_apply_params_cache_get_misses(const cardano_uplc_apply_params_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return 0U;
+  }
+
+  return cache->misses;
+}
+
+void
+cardano_uplc_apply_params_cache_unref(cardano_uplc_apply_params_cache_t** cache)
+{
+  if ((cache == NULL) || (*cache == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*cache)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *cache = NULL;
+    return;
+  }
+}
+
+void
+cardano_uplc_apply_params_cache_ref(cardano_uplc_apply_params_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&cache->base);
+}
+
+size_t
+cardano_uplc_apply_params_cache_refcount(const cardano_uplc_apply_params_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&cache->base);
+}
+
+void
+cardano_uplc_apply_params_cache_set_last_error(cardano_uplc_apply_params_cache_t* cache, const char* message)
+{
+  cardano_object_set_last_error(&cache->base, message);
+}
+
+const char*
+cardano_uplc_apply_params_cache_get_last_error(const cardano_uplc_apply_params_cache_t* cache)
+{
+  return cardano_object_get_last_error(&cache->base);
+}
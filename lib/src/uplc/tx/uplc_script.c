@@ -0,0 +1,424 @@
+/**
+ * \file uplc_script.c
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/object.h>
+#include <cardano/uplc/uplc_script.h>
+
+#include "../../allocators.h"
+#include "../arena/uplc_arena.h"
+#include "../ast/uplc_lang_version.h"
+#include "../ast/uplc_program.h"
+#include "../builtins/uplc_sig_cache.h"
+#include "../cost/uplc_selected_cost_model.h"
+#include "../machine/uplc_lower.h"
+#include "../machine/uplc_machine.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Block size of the arenas a script is loaded into and evaluated in.
+ */
+static const size_t ARENA_BLOCK_SIZE = 4096U;
+
+/**
+ * \brief Number of signature verifications a script remembers across evaluations.
+ */
+static const size_t SIG_CACHE_CAPACITY = 256U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A Plutus script loaded for repeated evaluation.
+ *
+ * The decoded and lowered program lives in \c program_arena for the lifetime of the
+ * handle. Each evaluation builds its argument applications and every machine value
+ * in \c run_arena, which is reset after the evaluation so its blocks serve the next.
+ */
+typedef struct cardano_uplc_script_t
+{
+    cardano_object_t                   base;
+    cardano_plutus_language_version_t  language;
+    cardano_uplc_lang_version_t        lang_version;
+    uint64_t                           protocol_major;
+    cardano_uplc_selected_cost_model_t cost_model;
+    cardano_uplc_arena_t*              program_arena;
+    cardano_uplc_arena_t*              run_arena;
+    cardano_uplc_sig_cache_t*          sig_cache;
+    const cardano_uplc_program_t*      program;
+} cardano_uplc_script_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a script object.
+ *
+ * \param object A void pointer to the script object to be deallocated.
+ */
+static void
+cardano_uplc_script_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_uplc_script_t* script = (cardano_uplc_script_t*)object;
+
+  cardano_uplc_arena_free(&script->run_arena);
+  cardano_uplc_arena_free(&script->program_arena);
+  cardano_uplc_sig_cache_free(&script->sig_cache);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Maps a Plutus language to the machine's language version.
+ *
+ * \param[in] language The Plutus language.
+ * \param[out] lang_version The machine language version.
+ *
+ * \return \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_INVALID_ARGUMENT for an unknown language.
+ */
+static cardano_error_t
+to_lang_version(const cardano_plutus_language_version_t language, cardano_uplc_lang_version_t* lang_version)
+{
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  switch (language)
+  {
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V1:
+    {
+      *lang_version = CARDANO_UPLC_LANG_VERSION_V1;
+      break;
+    }
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V2:
+    {
+      *lang_version = CARDANO_UPLC_LANG_VERSION_V2;
+      break;
+    }
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V3:
+    {
+      *lang_version = CARDANO_UPLC_LANG_VERSION_V3;
+      break;
+    }
+    case CARDANO_PLUTUS_LANGUAGE_VERSION_V4:
+    {
+      *lang_version = CARDANO_UPLC_LANG_VERSION_V4;
+      break;
+    }
+    default:
+    {
+      result = CARDANO_ERROR_INVALID_ARGUMENT;
+      break;
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Selects the cost model a script is charged with.
+ *
+ * \param[in,out] script The script, whose language and protocol version are set.
+ * \param[in] cost_model The ledger cost model, or NULL for the library default.
+ *
+ * \return \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_INVALID_ARGUMENT if \p cost_model
+ *         does not fit the language of the script.
+ */
+static cardano_error_t
+select_cost_model(cardano_uplc_script_t* script, const cardano_cost_model_t* cost_model)
+{
+  if (cost_model == NULL)
+  {
+    cardano_uplc_select_default_cost_model(script->lang_version, script->protocol_major, &script->cost_model);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_plutus_language_version_t language = CARDANO_PLUTUS_LANGUAGE_VERSION_V1;
+
+  cardano_error_t result = cardano_cost_model_get_language(cost_model, &language);
+
+  if ((result == CARDANO_SUCCESS) && (language != script->language))
+  {
+    result = CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_select_cost_model(
+      script->lang_version,
+      script->protocol_major,
+      cardano_cost_model_get_costs(cost_model),
+      cardano_cost_model_get_costs_size(cost_model),
+      &script->cost_model);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Clamps a public budget component to the machine's signed range.
+ *
+ * \param[in] units The budget component.
+ *
+ * \return \p units, or INT64_MAX if it does not fit.
+ */
+static int64_t
+to_budget_units(const uint64_t units)
+{
+  return (units > (uint64_t)INT64_MAX) ? INT64_MAX : (int64_t)units;
+}
+
+/**
+ * \brief Maps the machine's evaluation status to the public script status.
+ *
+ * \param[in] status The machine status.
+ *
+ * \return The matching script status.
+ */
+static cardano_uplc_script_status_t
+to_script_status(const cardano_uplc_eval_status_t status)
+{
+  cardano_uplc_script_status_t result = CARDANO_UPLC_SCRIPT_STATUS_FAILURE;
+
+  switch (status)
+  {
+    case CARDANO_UPLC_EVAL_SUCCESS:
+    {
+      result = CARDANO_UPLC_SCRIPT_STATUS_SUCCESS;
+      break;
+    }
+    case CARDANO_UPLC_EVAL_OUT_OF_BUDGET:
+    {
+      result = CARDANO_UPLC_SCRIPT_STATUS_OUT_OF_BUDGET;
+      break;
+    }
+    case CARDANO_UPLC_EVAL_UNSUPPORTED_BUILTIN:
+    {
+      result = CARDANO_UPLC_SCRIPT_STATUS_UNSUPPORTED_BUILTIN;
+      break;
+    }
+    case CARDANO_UPLC_EVAL_ERROR_TERM:
+    default:
+    {
+      break;
+    }
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_uplc_script_new(
+  const cardano_plutus_language_version_t language,
+  const byte_t*                           script_bytes,
+  const size_t                            script_size,
+  const cardano_cost_model_t*             cost_model,
+  const uint64_t                          protocol_major,
+  cardano_uplc_script_t**                 script)
+{
+  if ((script_bytes == NULL) || (script == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_uplc_lang_version_t lang_version = CARDANO_UPLC_LANG_VERSION_V1;
+
+  if (to_lang_version(language, &lang_version) != CARDANO_SUCCESS)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_uplc_script_t* new_script = (cardano_uplc_script_t*)_cardano_malloc(sizeof(cardano_uplc_script_t));
+
+  if (new_script == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(new_script, 0, sizeof(cardano_uplc_script_t)));
+
+  new_script->base.deallocator   = cardano_uplc_script_deallocate;
+  new_script->base.ref_count     = 1;
+  new_script->base.last_error[0] = '\0';
+  new_script->language           = language;
+  new_script->lang_version       = lang_version;
+  new_script->protocol_major     = protocol_major;
+
+  const cardano_uplc_program_t* decoded = NULL;
+
+  cardano_error_t result = select_cost_model(new_script, cost_model);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_arena_new(ARENA_BLOCK_SIZE, &new_script->program_arena);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_arena_new(ARENA_BLOCK_SIZE, &new_script->run_arena);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_sig_cache_new(SIG_CACHE_CAPACITY, &new_script->sig_cache);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_program_from_script_bytes(new_script->program_arena, script_bytes, script_size, &decoded);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_uplc_int_lower_program(new_script->program_arena, decoded, &new_script->program);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_uplc_script_unref(&new_script);
+
+    return result;
+  }
+
+  *script = new_script;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_uplc_script_evaluate(
+  cardano_uplc_script_t*        script,
+  cardano_plutus_data_t* const* args,
+  const size_t                  arg_count,
+  const uint64_t                max_cpu,
+  const uint64_t                max_memory,
+  cardano_uplc_script_result_t* result)
+{
+  if ((script == NULL) || (result == NULL) || ((args == NULL) && (arg_count > 0U)))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const cardano_uplc_budget_t budget  = { to_budget_units(max_cpu), to_budget_units(max_memory) };
+  cardano_uplc_program_t*     applied = NULL;
+  cardano_uplc_eval_result_t  outcome = { 0 };
+
+  /* Releases the previous run, and with it the term it returned, keeping the blocks for this one. */
+  cardano_uplc_arena_reset(script->run_arena);
+
+  cardano_error_t error = cardano_uplc_program_apply_data_params(script->run_arena, script->program, args, arg_count, &applied);
+
+  if (error == CARDANO_SUCCESS)
+  {
+    error = cardano_uplc_int_evaluate_with_costs(
+      script->run_arena,
+      applied,
+      &script->cost_model.model,
+      script->cost_model.semantics,
+      script->lang_version,
+      script->protocol_major,
+      budget,
+      script->sig_cache,
+      &outcome);
+  }
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return error;
+  }
+
+  result->status = to_script_status(outcome.status);
+  result->cpu    = (outcome.spent.cpu > 0) ? (uint64_t)outcome.spent.cpu : 0U;
+  result->memory = (outcome.spent.mem > 0) ? (uint64_t)outcome.spent.mem : 0U;
+  result->term   = outcome.result;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_plutus_language_version_t
+cardano_uplc_script_get_language(const cardano_uplc_script_t* script)
+{
+  if (script == NULL)
+  {
+    return CARDANO_PLUTUS_LANGUAGE_VERSION_V1;
+  }
+
+  return script->language;
+}
+
+void
+cardano_uplc_script_unref(cardano_uplc_script_t** script)
+{
+  if ((script == NULL) || (*script == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*script)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *script = NULL;
+    return;
+  }
+}
+
+void
+cardano_uplc_script_ref(cardano_uplc_script_t* script)
+{
+  if (script == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&script->base);
+}
+
+size_t
+cardano_uplc_script_refcount(const cardano_uplc_script_t* script)
+{
+  if (script == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&script->base);
+}
+
+void
+cardano_uplc_script_set_last_error(cardano_uplc_script_t* script, const char* message)
+{
+  cardano_object_set_last_error(&script->base, message);
+}
+
+const char*
+cardano_uplc_script_get_last_error(const cardano_uplc_script_t* script)
+{
+  return cardano_object_get_last_error(&script->base);
+}
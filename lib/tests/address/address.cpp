@@ -25,6 +25,7 @@
 
 #include "../allocators_helpers.h"
 #include "../src/allocators.h"
+#include "../src/config.h"
 #include "cip19_test_vectors.h"
 
 extern "C" {
@@ -33,6 +34,9 @@ extern "C" {
 
 #include <gmock/gmock.h>
 
+#include <thread>
+#include <vector>
+
 /* UNIT TESTS ****************************************************************/
 
 TEST(cardano_address_from_bytes, canCreateAddressFromBaseAddressBytes)
@@ -1003,6 +1007,24 @@ TEST(cardano_address_get_string, returnErrorWhenAddressIsNull)
   EXPECT_EQ(address, nullptr);
 }
 
+TEST(cardano_address_get_string, formatsTheStringOnceAndReusesIt)
+{
+  // Arrange
+  cardano_address_t* address = NULL;
+  EXPECT_EQ(cardano_address_from_bytes(Cip19TestVectors::basePaymentKeyStakeKeyBytes, sizeof(Cip19TestVectors::basePaymentKeyStakeKeyBytes), &address), CARDANO_SUCCESS);
+
+  // Act
+  const char* first  = cardano_address_get_string(address);
+  const char* second = cardano_address_get_string(address);
+
+  // Assert
+  EXPECT_EQ(std::string(first), Cip19TestVectors::basePaymentKeyStakeKey);
+  EXPECT_EQ(first, second);
+
+  // Clean up
+  cardano_address_unref(&address);
+}
+
 TEST(cardano_address_is_valid_bech32, canValidateAddress)
 {
   // Act
@@ -1240,7 +1262,8 @@ TEST(cardano_address_get_network_id, returnsErrorWhenByronAddressIsInvalid)
   cardano_address_t* byron_address = (cardano_address_t*)_cardano_malloc(sizeof(cardano_address_t));
 
   byron_address->type               = CARDANO_ADDRESS_TYPE_BYRON;
-  byron_address->network_id         = NULL;
+  byron_address->network_id         = CARDANO_NETWORK_ID_MAIN_NET;
+  byron_address->address_str        = NULL;
   byron_address->stake_pointer      = NULL;
   byron_address->payment_credential = NULL;
   byron_address->stake_credential   = NULL;
@@ -1262,7 +1285,8 @@ TEST(cardano_address_get_network_id, returnsMainetIfByronAddressDoesntHaveMagicS
   cardano_address_t* byron_address = (cardano_address_t*)_cardano_malloc(sizeof(cardano_address_t));
 
   byron_address->type                            = CARDANO_ADDRESS_TYPE_BYRON;
-  byron_address->network_id                      = NULL;
+  byron_address->network_id                      = CARDANO_NETWORK_ID_MAIN_NET;
+  byron_address->address_str                     = NULL;
   byron_address->stake_pointer                   = NULL;
   byron_address->payment_credential              = NULL;
   byron_address->stake_credential                = NULL;
@@ -1286,7 +1310,8 @@ TEST(cardano_address_get_network_id, returnsTestnetIfByronAddressHaveMagicSet)
   cardano_address_t* byron_address = (cardano_address_t*)_cardano_malloc(sizeof(cardano_address_t));
 
   byron_address->type                            = CARDANO_ADDRESS_TYPE_BYRON;
-  byron_address->network_id                      = NULL;
+  byron_address->network_id                      = CARDANO_NETWORK_ID_MAIN_NET;
+  byron_address->address_str                     = NULL;
   byron_address->stake_pointer                   = NULL;
   byron_address->payment_credential              = NULL;
   byron_address->stake_credential                = NULL;
@@ -1304,13 +1329,14 @@ TEST(cardano_address_get_network_id, returnsTestnetIfByronAddressHaveMagicSet)
   cardano_address_unref(&byron_address);
 }
 
-TEST(cardano_address_get_network_id, returnsErrorIfAddressInternalStateIsInvalid)
+TEST(cardano_address_get_network_id, returnsTheStoredNetworkIdOfShelleyAddresses)
 {
   // Arrange
   cardano_address_t* address = (cardano_address_t*)_cardano_malloc(sizeof(cardano_address_t));
 
   address->type               = CARDANO_ADDRESS_TYPE_BASE_PAYMENT_KEY_STAKE_KEY;
-  address->network_id         = NULL;
+  address->network_id         = CARDANO_NETWORK_ID_TEST_NET;
+  address->address_str        = NULL;
   address->stake_pointer      = NULL;
   address->payment_credential = NULL;
   address->stake_credential   = NULL;
@@ -1320,7 +1346,8 @@ TEST(cardano_address_get_network_id, returnsErrorIfAddressInternalStateIsInvalid
 
   // Act
   cardano_network_id_t network_id;
-  EXPECT_EQ(cardano_address_get_network_id(address, &network_id), CARDANO_ERROR_INVALID_ADDRESS_FORMAT);
+  EXPECT_EQ(cardano_address_get_network_id(address, &network_id), CARDANO_SUCCESS);
+  EXPECT_EQ(network_id, CARDANO_NETWORK_ID_TEST_NET);
 
   // Clean up
   cardano_address_unref(&address);
@@ -1732,3 +1759,46 @@ TEST(cardano_address_equals, returnsFalseIfOneIsNull2)
   // Cleanup
   cardano_address_unref(&address);
 }
+
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+
+TEST(cardano_address_get_string, returnsTheSameStringWhenFirstCalledConcurrently)
+{
+  for (int round = 0; round < 100; ++round)
+  {
+    // Arrange
+    cardano_address_t* address = NULL;
+
+    EXPECT_EQ(cardano_address_from_bytes(Cip19TestVectors::basePaymentKeyStakeKeyBytes, sizeof(Cip19TestVectors::basePaymentKeyStakeKeyBytes), &address), CARDANO_SUCCESS);
+
+    std::vector<std::thread> workers;
+    std::vector<const char*> results(8, nullptr);
+
+    // Act
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      workers.emplace_back([address, &results, i]()
+      {
+        results[i] = cardano_address_get_string(address);
+      });
+    }
+
+    for (std::thread& worker: workers)
+    {
+      worker.join();
+    }
+
+    // Assert
+    for (const char* result: results)
+    {
+      EXPECT_EQ(result, results[0]);
+    }
+
+    EXPECT_STREQ(results[0], Cip19TestVectors::basePaymentKeyStakeKey.c_str());
+
+    // Cleanup
+    cardano_address_unref(&address);
+  }
+}
+
+#endif
@@ -63,7 +63,7 @@ TEST(_cardano_unpack_base_address, returnsErrorIfMemoryAllocationFails)
   cardano_base_address_t* address = NULL;
 
   reset_allocators_run_count();
-  cardano_set_allocators(fail_after_four_malloc, realloc, free);
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
 
   // Act
   EXPECT_EQ(_cardano_unpack_base_address(Cip19TestVectors::basePaymentKeyStakeKeyBytes, sizeof(Cip19TestVectors::basePaymentKeyStakeKeyBytes), &address), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
@@ -159,9 +159,11 @@ TEST(cardano_base_address_from_credentials, returnErrorIfEventualMemoryAllocatio
 {
   // Arrange
   cardano_credential_t*   payment      = NULL;
-  cardano_credential_t*   stake        = (cardano_credential_t*)"";
+  cardano_credential_t*   stake        = NULL;
   cardano_base_address_t* base_address = NULL;
 
+  char bech32[128] = { 0 };
+
   EXPECT_EQ(
     cardano_credential_from_hash_hex(
       Cip19TestVectors::paymentKeyHashHex.c_str(),
@@ -178,17 +180,24 @@ TEST(cardano_base_address_from_credentials, returnErrorIfEventualMemoryAllocatio
       &stake),
     CARDANO_SUCCESS);
 
+  EXPECT_EQ(cardano_base_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, stake, &base_address), CARDANO_SUCCESS);
+
+  // The string is formatted on first access, so the allocation failure surfaces there.
   reset_allocators_run_count();
-  cardano_set_allocators(fail_after_one_malloc, realloc, free);
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
 
   // Act
-  cardano_error_t result = cardano_base_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, stake, &base_address);
+  cardano_error_t result = cardano_base_address_to_bech32(base_address, bech32, sizeof(bech32));
+  const char*     str    = cardano_base_address_get_string(base_address);
+  const size_t    size   = cardano_base_address_get_bech32_size(base_address);
 
   cardano_set_allocators(malloc, realloc, free);
 
   // Assert
   EXPECT_EQ(result, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(base_address, nullptr);
+  EXPECT_EQ(str, nullptr);
+  EXPECT_EQ(size, 0U);
+  EXPECT_EQ(cardano_base_address_get_string(base_address), Cip19TestVectors::basePaymentKeyStakeKey);
 
   // Clean up
   cardano_credential_unref(&payment);
@@ -375,6 +384,34 @@ TEST(cardano_base_address_get_stake_credential, returnsErrorWhenBaseAddressIsNul
   EXPECT_EQ(stake, nullptr);
 }
 
+TEST(cardano_base_address_get_stake_credential, decodesTheCredentialsOfAParsedAddress)
+{
+  // Arrange
+  cardano_base_address_t* base_address = NULL;
+
+  EXPECT_EQ(cardano_base_address_from_bech32(Cip19TestVectors::basePaymentKeyStakeKey.c_str(), Cip19TestVectors::basePaymentKeyStakeKey.size(), &base_address), CARDANO_SUCCESS);
+
+  // Act
+  cardano_credential_t* payment = cardano_base_address_get_payment_credential(base_address);
+  cardano_credential_t* stake   = cardano_base_address_get_stake_credential(base_address);
+  cardano_credential_t* again   = cardano_base_address_get_stake_credential(base_address);
+
+  cardano_credential_type_t stake_type = CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH;
+
+  // Assert
+  EXPECT_EQ(cardano_credential_get_type(stake, &stake_type), CARDANO_SUCCESS);
+  EXPECT_EQ(stake_type, CARDANO_CREDENTIAL_TYPE_KEY_HASH);
+  EXPECT_EQ(std::string(cardano_credential_get_hash_hex(payment)), Cip19TestVectors::paymentKeyHashHex);
+  EXPECT_EQ(std::string(cardano_credential_get_hash_hex(stake)), Cip19TestVectors::stakeKeyHashHex);
+  EXPECT_EQ(stake, again);
+
+  // Clean up
+  cardano_credential_unref(&payment);
+  cardano_credential_unref(&stake);
+  cardano_credential_unref(&again);
+  cardano_base_address_unref(&base_address);
+}
+
 TEST(cardano_base_address_get_stake_credential, canGetStakeCredential)
 {
   // Arrange
@@ -1029,4 +1066,91 @@ TEST(cardano_base_address_get_network_id, canGetNetworkId)
 
   // Clean up
   cardano_base_address_unref(&address);
-}
\ No newline at end of file
+}
+TEST(cardano_base_address_derive_bytes, derivesTheSameAddressesAsBuildingEachAddress)
+{
+  // Arrange
+  static const char* account_key_hex = "6fd8d9c696b01525cc45f15583fc9447c66e1c71fd1a11c8885368404cd0a4ab00b5f1652f5cbe257e567c883dc2b16e0a9568b19c5b81ea8bd197fc95e8bdcf";
+
+  cardano_bip32_public_key_t* account_key = NULL;
+  cardano_credential_t*       stake       = NULL;
+
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(account_key_hex, strlen(account_key_hex), &account_key), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_credential_from_hash_hex(Cip19TestVectors::scriptHash.c_str(), Cip19TestVectors::scriptHash.size(), CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH, &stake), CARDANO_SUCCESS);
+
+  // More than one chunk of key hashes.
+  const size_t count                 = 40U;
+  byte_t       addresses[40U * 57U]  = { 0 };
+  byte_t       key_hashes[40U * 28U] = { 0 };
+
+  // Act
+  cardano_error_t result = cardano_base_address_derive_bytes(account_key, CARDANO_NETWORK_ID_TEST_NET, 0U, 3U, count, stake, addresses, sizeof(addresses));
+
+  // Assert
+  ASSERT_EQ(result, CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 3U, count, key_hashes, sizeof(key_hashes)), CARDANO_SUCCESS);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_credential_t*   payment      = NULL;
+    cardano_base_address_t* base_address = NULL;
+
+    ASSERT_EQ(cardano_credential_from_hash_bytes(&key_hashes[i * 28U], 28U, CARDANO_CREDENTIAL_TYPE_KEY_HASH, &payment), CARDANO_SUCCESS);
+    ASSERT_EQ(cardano_base_address_from_credentials(CARDANO_NETWORK_ID_TEST_NET, payment, stake, &base_address), CARDANO_SUCCESS);
+
+    ASSERT_EQ(cardano_base_address_get_bytes_size(base_address), 57U);
+    EXPECT_EQ(memcmp(&addresses[i * 57U], cardano_base_address_get_bytes(base_address), 57U), 0);
+
+    cardano_base_address_unref(&base_address);
+    cardano_credential_unref(&payment);
+  }
+
+  // Cleanup
+  cardano_credential_unref(&stake);
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_base_address_derive_bytes, returnsErrorIfGivenANullPtr)
+{
+  // Arrange
+  static const char* account_key_hex = "6fd8d9c696b01525cc45f15583fc9447c66e1c71fd1a11c8885368404cd0a4ab00b5f1652f5cbe257e567c883dc2b16e0a9568b19c5b81ea8bd197fc95e8bdcf";
+
+  cardano_bip32_public_key_t* account_key    = NULL;
+  cardano_credential_t*       stake          = NULL;
+  byte_t                      addresses[57U] = { 0 };
+
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(account_key_hex, strlen(account_key_hex), &account_key), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_credential_from_hash_hex(Cip19TestVectors::stakeKeyHashHex.c_str(), Cip19TestVectors::stakeKeyHashHex.size(), CARDANO_CREDENTIAL_TYPE_KEY_HASH, &stake), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_base_address_derive_bytes(NULL, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 1U, stake, addresses, sizeof(addresses)), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_base_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 1U, NULL, addresses, sizeof(addresses)), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_base_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 1U, stake, NULL, sizeof(addresses)), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_credential_unref(&stake);
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_base_address_derive_bytes, returnsErrorIfBufferIsTooSmall)
+{
+  // Arrange
+  static const char* account_key_hex = "6fd8d9c696b01525cc45f15583fc9447c66e1c71fd1a11c8885368404cd0a4ab00b5f1652f5cbe257e567c883dc2b16e0a9568b19c5b81ea8bd197fc95e8bdcf";
+
+  cardano_bip32_public_key_t* account_key    = NULL;
+  cardano_credential_t*       stake          = NULL;
+  byte_t                      addresses[57U] = { 0 };
+
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(account_key_hex, strlen(account_key_hex), &account_key), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_credential_from_hash_hex(Cip19TestVectors::stakeKeyHashHex.c_str(), Cip19TestVectors::stakeKeyHashHex.size(), CARDANO_CREDENTIAL_TYPE_KEY_HASH, &stake), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_base_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 2U, stake, addresses, sizeof(addresses));
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE);
+
+  // Cleanup
+  cardano_credential_unref(&stake);
+  cardano_bip32_public_key_unref(&account_key);
+}
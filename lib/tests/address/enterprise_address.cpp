@@ -124,6 +124,8 @@ TEST(cardano_enterprise_address_from_credentials, returnErrorIfEventualMemoryAll
   cardano_credential_t*         payment            = NULL;
   cardano_enterprise_address_t* enterprise_address = NULL;
 
+  char bech32[128] = { 0 };
+
   EXPECT_EQ(
     cardano_credential_from_hash_hex(
       Cip19TestVectors::paymentKeyHashHex.c_str(),
@@ -132,16 +134,24 @@ TEST(cardano_enterprise_address_from_credentials, returnErrorIfEventualMemoryAll
       &payment),
     CARDANO_SUCCESS);
 
+  EXPECT_EQ(cardano_enterprise_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, &enterprise_address), CARDANO_SUCCESS);
+
+  // The string is formatted on first access, so the allocation failure surfaces there.
   reset_allocators_run_count();
-  cardano_set_allocators(fail_after_one_malloc, realloc, free);
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
 
   // Act
-  cardano_error_t result = cardano_enterprise_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, &enterprise_address);
+  cardano_error_t result = cardano_enterprise_address_to_bech32(enterprise_address, bech32, sizeof(bech32));
+  const char*     str    = cardano_enterprise_address_get_string(enterprise_address);
+  const size_t    size   = cardano_enterprise_address_get_bech32_size(enterprise_address);
+
   cardano_set_allocators(malloc, realloc, free);
 
   // Assert
   EXPECT_EQ(result, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(enterprise_address, nullptr);
+  EXPECT_EQ(str, nullptr);
+  EXPECT_EQ(size, 0U);
+  EXPECT_EQ(cardano_enterprise_address_get_string(enterprise_address), Cip19TestVectors::enterpriseKey);
 
   // Clean up
   cardano_credential_unref(&payment);
@@ -801,4 +811,61 @@ TEST(cardano_enterprise_address_get_network_id, canGetNetworkId)
 
   // Clean up
   cardano_enterprise_address_unref(&address);
-}
\ No newline at end of file
+}
+TEST(cardano_enterprise_address_derive_bytes, derivesTheSameAddressesAsBuildingEachAddress)
+{
+  // Arrange
+  static const char* account_key_hex = "6fd8d9c696b01525cc45f15583fc9447c66e1c71fd1a11c8885368404cd0a4ab00b5f1652f5cbe257e567c883dc2b16e0a9568b19c5b81ea8bd197fc95e8bdcf";
+
+  cardano_bip32_public_key_t* account_key = NULL;
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(account_key_hex, strlen(account_key_hex), &account_key), CARDANO_SUCCESS);
+
+  const size_t count                = 5U;
+  byte_t       addresses[5U * 29U]  = { 0 };
+  byte_t       key_hashes[5U * 28U] = { 0 };
+
+  // Act
+  cardano_error_t result = cardano_enterprise_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 1U, 0U, count, addresses, sizeof(addresses));
+
+  // Assert
+  ASSERT_EQ(result, CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_bip32_public_key_derive_key_hashes(account_key, 1U, 0U, count, key_hashes, sizeof(key_hashes)), CARDANO_SUCCESS);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_credential_t*         payment            = NULL;
+    cardano_enterprise_address_t* enterprise_address = NULL;
+
+    ASSERT_EQ(cardano_credential_from_hash_bytes(&key_hashes[i * 28U], 28U, CARDANO_CREDENTIAL_TYPE_KEY_HASH, &payment), CARDANO_SUCCESS);
+    ASSERT_EQ(cardano_enterprise_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, &enterprise_address), CARDANO_SUCCESS);
+
+    ASSERT_EQ(cardano_enterprise_address_get_bytes_size(enterprise_address), 29U);
+    EXPECT_EQ(memcmp(&addresses[i * 29U], cardano_enterprise_address_get_bytes(enterprise_address), 29U), 0);
+
+    cardano_enterprise_address_unref(&enterprise_address);
+    cardano_credential_unref(&payment);
+  }
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_enterprise_address_derive_bytes, returnsErrorIfGivenInvalidArguments)
+{
+  // Arrange
+  static const char* account_key_hex = "6fd8d9c696b01525cc45f15583fc9447c66e1c71fd1a11c8885368404cd0a4ab00b5f1652f5cbe257e567c883dc2b16e0a9568b19c5b81ea8bd197fc95e8bdcf";
+
+  cardano_bip32_public_key_t* account_key    = NULL;
+  byte_t                      addresses[29U] = { 0 };
+
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(account_key_hex, strlen(account_key_hex), &account_key), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_enterprise_address_derive_bytes(NULL, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 1U, addresses, sizeof(addresses)), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_enterprise_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 1U, NULL, sizeof(addresses)), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_enterprise_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 0U, 0U, 2U, addresses, sizeof(addresses)), CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE);
+  EXPECT_EQ(cardano_enterprise_address_derive_bytes(account_key, CARDANO_NETWORK_ID_MAIN_NET, 0x80000000U, 0U, 1U, addresses, sizeof(addresses)), CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX);
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
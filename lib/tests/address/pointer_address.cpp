@@ -125,6 +125,8 @@ TEST(cardano_pointer_address_from_credentials, returnErrorIfMemoryAllocationEven
   cardano_credential_t*      payment         = NULL;
   cardano_pointer_address_t* pointer_address = NULL;
 
+  char bech32[128] = { 0 };
+
   EXPECT_EQ(
     cardano_credential_from_hash_hex(
       Cip19TestVectors::paymentKeyHashHex.c_str(),
@@ -133,17 +135,24 @@ TEST(cardano_pointer_address_from_credentials, returnErrorIfMemoryAllocationEven
       &payment),
     CARDANO_SUCCESS);
 
+  EXPECT_EQ(cardano_pointer_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, Cip19TestVectors::stakePointer, &pointer_address), CARDANO_SUCCESS);
+
+  // The string is formatted on first access, so the allocation failure surfaces there.
   reset_allocators_run_count();
-  cardano_set_allocators(fail_after_two_malloc, realloc, free);
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
 
   // Act
-  cardano_error_t result = cardano_pointer_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, Cip19TestVectors::stakePointer, &pointer_address);
+  cardano_error_t result = cardano_pointer_address_to_bech32(pointer_address, bech32, sizeof(bech32));
+  const char*     str    = cardano_pointer_address_get_string(pointer_address);
+  const size_t    size   = cardano_pointer_address_get_bech32_size(pointer_address);
 
   cardano_set_allocators(malloc, realloc, free);
 
   // Assert
   EXPECT_EQ(result, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(pointer_address, nullptr);
+  EXPECT_EQ(str, nullptr);
+  EXPECT_EQ(size, 0U);
+  EXPECT_EQ(cardano_pointer_address_get_string(pointer_address), Cip19TestVectors::pointerKey);
 
   // Clean up
   cardano_credential_unref(&payment);
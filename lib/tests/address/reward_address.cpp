@@ -124,28 +124,38 @@ TEST(cardano_reward_address_from_credentials, returnErrorIfEventualMemoryAllocat
   cardano_credential_t*     payment        = NULL;
   cardano_reward_address_t* reward_address = NULL;
 
+  char bech32[128] = { 0 };
+
   EXPECT_EQ(
     cardano_credential_from_hash_hex(
-      Cip19TestVectors::paymentKeyHashHex.c_str(),
-      Cip19TestVectors::paymentKeyHashHex.size(),
+      Cip19TestVectors::stakeKeyHashHex.c_str(),
+      Cip19TestVectors::stakeKeyHashHex.size(),
       CARDANO_CREDENTIAL_TYPE_KEY_HASH,
       &payment),
     CARDANO_SUCCESS);
 
+  EXPECT_EQ(cardano_reward_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, &reward_address), CARDANO_SUCCESS);
+
+  // The string is formatted on first access, so the allocation failure surfaces there.
   reset_allocators_run_count();
-  cardano_set_allocators(fail_after_one_malloc, realloc, free);
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
 
   // Act
-  cardano_error_t result = cardano_reward_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment, &reward_address);
+  cardano_error_t result = cardano_reward_address_to_bech32(reward_address, bech32, sizeof(bech32));
+  const char*     str    = cardano_reward_address_get_string(reward_address);
+  const size_t    size   = cardano_reward_address_get_bech32_size(reward_address);
+
+  cardano_set_allocators(malloc, realloc, free);
 
   // Assert
   EXPECT_EQ(result, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(reward_address, nullptr);
+  EXPECT_EQ(str, nullptr);
+  EXPECT_EQ(size, 0U);
+  EXPECT_EQ(cardano_reward_address_get_string(reward_address), Cip19TestVectors::rewardKey);
 
   // Clean up
   cardano_credential_unref(&payment);
   cardano_reward_address_unref(&reward_address);
-  cardano_set_allocators(malloc, realloc, free);
 }
 
 TEST(cardano_reward_address_from_address, returnsErrorWhenAddressIsNull)
@@ -0,0 +1,785 @@
+/**
+ * \file block.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/block/block.h>
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/transaction/transaction.h>
+
+#include "../allocators_helpers.h"
+#include "../src/allocators.h"
+
+#include <gmock/gmock.h>
+#include <string>
+#include <vector>
+
+/* CONSTANTS *****************************************************************/
+
+static const char* TX_CBOR    = "84a40081825820f6dd880fb30480aa43117c73bfd09442ba30de5644c3ec1a91d9232fbe715aab000182a20058390071213dc119131f48f54d62e339053388d9d84faedecba9d8722ad2cad9debf34071615fc6452dfc743a4963f6bec68e488001c7384942c13011b0000000253c8e4f6a300581d702ed2631dbb277c84334453c5c437b86325d371f0835a28b910a91a6e011a001e848002820058209d7fee57d1dbb9b000b2a133256af0f2c83ffe638df523b2d1c13d405356d8ae021a0002fb050b582088e4779d217d10398a705530f9fb2af53ffac20aef6e75e85c26e93a00877556a10481d8799fd8799f40ffd8799fa1d8799fd8799fd87980d8799fd8799f581c71213dc119131f48f54d62e339053388d9d84faedecba9d8722ad2caffd8799fd8799fd8799f581cd9debf34071615fc6452dfc743a4963f6bec68e488001c7384942c13ffffffffffd8799f4040ffff1a001e8480a0a000ffd87c9f9fd8799fd8799fd8799fd87980d8799fd8799f581caa47de0ab3b7f0b1d8d196406b6af1b0d88cd46168c49ca0557b4f70ffd8799fd8799fd8799f581cd4b8fc88aec1d1c2f43ca5587898d88da20ef73964b8cf6f8f08ddfbffffffffffd8799fd87980d8799fd8799f581caa47de0ab3b7f0b1d8d196406b6af1b0d88cd46168c49ca0557b4f70ffd8799fd8799fd8799f581cd4b8fc88aec1d1c2f43ca5587898d88da20ef73964b8cf6f8f08ddfbffffffffffd8799f4040ffd87a9f1a00989680ffffd87c9f9fd8799fd87a9fd8799f4752656c65617365d8799fd87980d8799fd8799f581caa47de0ab3b7f0b1d8d196406b6af1b0d88cd46168c49ca0557b4f70ffd8799fd8799fd8799f581cd4b8fc88aec1d1c2f43ca5587898d88da20ef73964b8cf6f8f08ddfbffffffffffff9fd8799f0101ffffffd87c9f9fd8799fd87b9fd9050280ffd87980ffff1b000001884e1fb1c0d87980ffffff1b000001884e1fb1c0d87980ffffff1b000001884e1fb1c0d87980fffff5f6";
+static const char* TX_ID      = "2d7f290c815e061fb7c27e91d2a898bd7b454a71c9b7a26660e2257ac31ebe32";
+static const char* PREV_HASH  = "00112233445566778899aabbccddeeff00112233445566778899aabbccddeeff";
+static const char* BODY_HASH  = "ffeeddccbbaa99887766554433221100ffeeddccbbaa99887766554433221100";
+static const char* AUX_CBOR   = "a100a0";
+static const size_t BODY_SIZE = 1024U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The encoded parts of a transaction.
+ */
+typedef struct transaction_parts_t
+{
+    std::vector<byte_t> body;
+    std::vector<byte_t> witness_set;
+} transaction_parts_t;
+
+/**
+ * \brief Shape of a synthetic block.
+ */
+typedef struct block_shape_t
+{
+    size_t              transaction_count;
+    size_t              witness_set_count;
+    bool                babbage_header;
+    bool                has_previous_hash;
+    bool                has_invalid_transactions;
+    bool                indefinite_sequences;
+    std::vector<size_t> auxiliary_data_indices;
+    std::vector<size_t> invalid_indices;
+} block_shape_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Converts a hex string to bytes.
+ */
+static std::vector<byte_t>
+from_hex(const char* hex)
+{
+  std::vector<byte_t> bytes(strlen(hex) / 2U);
+
+  for (size_t i = 0U; i < bytes.size(); ++i)
+  {
+    bytes[i] = (byte_t)std::stoul(std::string(&hex[i * 2U], 2U), nullptr, 16);
+  }
+
+  return bytes;
+}
+
+/**
+ * \brief Copies the encoding of the next value of a reader.
+ */
+static std::vector<byte_t>
+read_encoded(cardano_cbor_reader_t* reader)
+{
+  cardano_buffer_t* buffer = NULL;
+
+  EXPECT_EQ(cardano_cbor_reader_read_encoded_value(reader, &buffer), CARDANO_SUCCESS);
+
+  std::vector<byte_t> bytes(cardano_buffer_get_data(buffer), cardano_buffer_get_data(buffer) + cardano_buffer_get_size(buffer));
+
+  cardano_buffer_unref(&buffer);
+
+  return bytes;
+}
+
+/**
+ * \brief Splits the test transaction into its encoded body and witness set.
+ */
+static transaction_parts_t
+split_transaction()
+{
+  transaction_parts_t    parts  = {};
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(TX_CBOR, strlen(TX_CBOR));
+  int64_t                length = 0;
+
+  EXPECT_EQ(cardano_cbor_reader_read_start_array(reader, &length), CARDANO_SUCCESS);
+
+  parts.body        = read_encoded(reader);
+  parts.witness_set = read_encoded(reader);
+
+  cardano_cbor_reader_unref(&reader);
+
+  return parts;
+}
+
+/**
+ * \brief Writes a block header.
+ */
+static void
+write_header(cardano_cbor_writer_t* writer, const block_shape_t& shape)
+{
+  const std::vector<byte_t> prev_hash = from_hex(PREV_HASH);
+  const std::vector<byte_t> body_hash = from_hex(BODY_HASH);
+  const byte_t              key[32]   = { 0 };
+
+  EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, 2), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, shape.babbage_header ? 10 : 15), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, 42U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, 123456U), CARDANO_SUCCESS);
+
+  if (shape.has_previous_hash)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, prev_hash.data(), prev_hash.size()), CARDANO_SUCCESS);
+  }
+  else
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_null(writer), CARDANO_SUCCESS);
+  }
+
+  EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+
+  const size_t vrf_count = shape.babbage_header ? 1U : 2U;
+
+  for (size_t i = 0U; i < vrf_count; ++i)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, 2), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+  }
+
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, BODY_SIZE), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, body_hash.data(), body_hash.size()), CARDANO_SUCCESS);
+
+  if (shape.babbage_header)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, 4), CARDANO_SUCCESS);
+  }
+
+  EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, 7U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, 300U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+
+  if (shape.babbage_header)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, 2), CARDANO_SUCCESS);
+  }
+
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, shape.babbage_header ? 9U : 6U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_uint(writer, 0U), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_cbor_writer_write_bytestring(writer, key, sizeof(key)), CARDANO_SUCCESS);
+}
+
+/**
+ * \brief Encodes the header a block of the given shape carries.
+ */
+static std::vector<byte_t>
+encode_header(const block_shape_t& shape)
+{
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+  write_header(writer, shape);
+
+  std::vector<byte_t> bytes(cardano_cbor_writer_get_encode_size(writer));
+
+  EXPECT_EQ(cardano_cbor_writer_encode(writer, bytes.data(), bytes.size()), CARDANO_SUCCESS);
+
+  cardano_cbor_writer_unref(&writer);
+
+  return bytes;
+}
+
+/**
+ * \brief Starts a sequence of a synthetic block.
+ */
+static void
+write_start(cardano_cbor_writer_t* writer, const block_shape_t& shape, const size_t count, const bool is_map)
+{
+  const int64_t length = shape.indefinite_sequences ? -1 : (int64_t)count;
+
+  if (is_map)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_start_map(writer, length), CARDANO_SUCCESS);
+  }
+  else
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, length), CARDANO_SUCCESS);
+  }
+}
+
+/**
+ * \brief Ends a sequence of a synthetic block.
+ */
+static void
+write_end(cardano_cbor_writer_t* writer, const block_shape_t& shape, const bool is_map)
+{
+  if (!shape.indefinite_sequences)
+  {
+    return;
+  }
+
+  if (is_map)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_end_map(writer), CARDANO_SUCCESS);
+  }
+  else
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_end_array(writer), CARDANO_SUCCESS);
+  }
+}
+
+/**
+ * \brief Encodes a synthetic block whose transactions are all the test transaction.
+ */
+static std::vector<byte_t>
+encode_block(const block_shape_t& shape, const uint64_t era = 0U)
+{
+  const transaction_parts_t parts  = split_transaction();
+  const std::vector<byte_t> header = encode_header(shape);
+  const std::vector<byte_t> aux    = from_hex(AUX_CBOR);
+  cardano_cbor_writer_t*    writer = cardano_cbor_writer_new();
+
+  if (era != 0U)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, 2), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_cbor_writer_write_uint(writer, era), CARDANO_SUCCESS);
+  }
+
+  EXPECT_EQ(cardano_cbor_writer_write_start_array(writer, shape.has_invalid_transactions ? 5 : 4), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_cbor_writer_write_encoded(writer, header.data(), header.size()), CARDANO_SUCCESS);
+
+  write_start(writer, shape, shape.transaction_count, false);
+
+  for (size_t i = 0U; i < shape.transaction_count; ++i)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_encoded(writer, parts.body.data(), parts.body.size()), CARDANO_SUCCESS);
+  }
+
+  write_end(writer, shape, false);
+  write_start(writer, shape, shape.witness_set_count, false);
+
+  for (size_t i = 0U; i < shape.witness_set_count; ++i)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_encoded(writer, parts.witness_set.data(), parts.witness_set.size()), CARDANO_SUCCESS);
+  }
+
+  write_end(writer, shape, false);
+  write_start(writer, shape, shape.auxiliary_data_indices.size(), true);
+
+  for (const size_t index: shape.auxiliary_data_indices)
+  {
+    EXPECT_EQ(cardano_cbor_writer_write_uint(writer, index), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_cbor_writer_write_encoded(writer, aux.data(), aux.size()), CARDANO_SUCCESS);
+  }
+
+  write_end(writer, shape, true);
+
+  if (shape.has_invalid_transactions)
+  {
+    write_start(writer, shape, shape.invalid_indices.size(), false);
+
+    for (const size_t index: shape.invalid_indices)
+    {
+      EXPECT_EQ(cardano_cbor_writer_write_uint(writer, index), CARDANO_SUCCESS);
+    }
+
+    write_end(writer, shape, false);
+  }
+
+  std::vector<byte_t> bytes(cardano_cbor_writer_get_encode_size(writer));
+
+  EXPECT_EQ(cardano_cbor_writer_encode(writer, bytes.data(), bytes.size()), CARDANO_SUCCESS);
+
+  cardano_cbor_writer_unref(&writer);
+
+  return bytes;
+}
+
+/**
+ * \brief The shape of a typical Conway block: three transactions, the second with auxiliary
+ * data and the third invalid.
+ */
+static block_shape_t
+default_shape()
+{
+  block_shape_t shape            = {};
+  shape.transaction_count        = 3U;
+  shape.witness_set_count        = 3U;
+  shape.babbage_header           = true;
+  shape.has_previous_hash        = true;
+  shape.has_invalid_transactions = true;
+  shape.auxiliary_data_indices   = { 1U };
+  shape.invalid_indices          = { 2U };
+
+  return shape;
+}
+
+/**
+ * \brief Decodes a block from its encoding.
+ */
+static cardano_error_t
+decode_block(const std::vector<byte_t>& bytes, cardano_block_t** block)
+{
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_new(bytes.data(), bytes.size());
+  cardano_error_t        result = cardano_block_from_cbor(reader, block);
+
+  cardano_cbor_reader_unref(&reader);
+
+  return result;
+}
+
+/**
+ * \brief Converts a hash to hex.
+ */
+static std::string
+to_hex(const cardano_blake2b_hash_t* hash)
+{
+  char hex[65] = { 0 };
+
+  EXPECT_EQ(cardano_blake2b_hash_to_hex(hash, hex, sizeof(hex)), CARDANO_SUCCESS);
+
+  return hex;
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_block_from_cbor, decodesTheHeader)
+{
+  const block_shape_t shape = default_shape();
+  cardano_block_t*    block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(shape), &block), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_block_get_block_number(block), 42U);
+  EXPECT_EQ(cardano_block_get_slot(block), 123456U);
+  EXPECT_EQ(cardano_block_get_body_size(block), BODY_SIZE);
+  EXPECT_EQ(cardano_block_get_transaction_count(block), 3U);
+
+  const std::vector<byte_t> header        = encode_header(shape);
+  cardano_blake2b_hash_t*   expected_hash = NULL;
+
+  ASSERT_EQ(cardano_blake2b_compute_hash(header.data(), header.size(), 32U, &expected_hash), CARDANO_SUCCESS);
+
+  cardano_blake2b_hash_t*     header_hash   = cardano_block_get_header_hash(block);
+  cardano_blake2b_hash_t*     previous_hash = cardano_block_get_previous_hash(block);
+  cardano_blake2b_hash_t*     body_hash     = cardano_block_get_body_hash(block);
+  cardano_protocol_version_t* version       = cardano_block_get_protocol_version(block);
+
+  EXPECT_EQ(cardano_blake2b_hash_compare(header_hash, expected_hash), 0);
+  EXPECT_EQ(to_hex(previous_hash), PREV_HASH);
+  EXPECT_EQ(to_hex(body_hash), BODY_HASH);
+  EXPECT_EQ(cardano_protocol_version_get_major(version), 9U);
+  EXPECT_EQ(cardano_protocol_version_get_minor(version), 0U);
+
+  cardano_blake2b_hash_unref(&expected_hash);
+  cardano_blake2b_hash_unref(&header_hash);
+  cardano_blake2b_hash_unref(&previous_hash);
+  cardano_blake2b_hash_unref(&body_hash);
+  cardano_protocol_version_unref(&version);
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_from_cbor, decodesPreBabbageHeadersAndBlocksWithoutInvalidTransactions)
+{
+  block_shape_t shape            = default_shape();
+  shape.babbage_header           = false;
+  shape.has_invalid_transactions = false;
+  shape.invalid_indices          = {};
+
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(shape), &block), CARDANO_SUCCESS);
+
+  cardano_protocol_version_t* version = cardano_block_get_protocol_version(block);
+
+  EXPECT_EQ(cardano_block_get_block_number(block), 42U);
+  EXPECT_EQ(cardano_block_get_body_size(block), BODY_SIZE);
+  EXPECT_EQ(cardano_protocol_version_get_major(version), 6U);
+  EXPECT_EQ(cardano_block_get_transaction_count(block), 3U);
+
+  for (size_t i = 0U; i < 3U; ++i)
+  {
+    EXPECT_TRUE(cardano_block_is_transaction_valid(block, i));
+  }
+
+  cardano_protocol_version_unref(&version);
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_from_cbor, blockAfterGenesisHasNoPreviousHash)
+{
+  block_shape_t shape     = default_shape();
+  shape.has_previous_hash = false;
+
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(shape), &block), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_block_get_previous_hash(block), nullptr);
+
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_from_cbor, unwrapsTheEraEnvelope)
+{
+  const std::vector<byte_t> bare     = encode_block(default_shape());
+  const std::vector<byte_t> wrapped  = encode_block(default_shape(), 7U);
+  cardano_block_t*          block    = NULL;
+  cardano_block_t*          expected = NULL;
+
+  ASSERT_EQ(decode_block(wrapped, &block), CARDANO_SUCCESS);
+  ASSERT_EQ(decode_block(bare, &expected), CARDANO_SUCCESS);
+
+  cardano_blake2b_hash_t* hash          = cardano_block_get_header_hash(block);
+  cardano_blake2b_hash_t* expected_hash = cardano_block_get_header_hash(expected);
+
+  EXPECT_EQ(cardano_blake2b_hash_compare(hash, expected_hash), 0);
+  EXPECT_EQ(cardano_block_get_transaction_count(block), 3U);
+
+  cardano_blake2b_hash_unref(&hash);
+  cardano_blake2b_hash_unref(&expected_hash);
+  cardano_block_unref(&block);
+  cardano_block_unref(&expected);
+}
+
+TEST(cardano_block_from_cbor, acceptsIndefiniteLengthSequences)
+{
+  block_shape_t shape        = default_shape();
+  shape.indefinite_sequences = true;
+
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(shape), &block), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_block_get_transaction_count(block), 3U);
+  EXPECT_FALSE(cardano_block_is_transaction_valid(block, 2U));
+
+  cardano_transaction_t* transaction = NULL;
+
+  ASSERT_EQ(cardano_block_get_transaction(block, 1U, &transaction), CARDANO_SUCCESS);
+
+  cardano_auxiliary_data_t* aux = cardano_transaction_get_auxiliary_data(transaction);
+
+  EXPECT_NE(aux, nullptr);
+
+  cardano_auxiliary_data_unref(&aux);
+  cardano_transaction_unref(&transaction);
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_from_cbor, decodesBlocksWithoutTransactions)
+{
+  block_shape_t shape          = default_shape();
+  shape.transaction_count      = 0U;
+  shape.witness_set_count      = 0U;
+  shape.auxiliary_data_indices = {};
+  shape.invalid_indices        = {};
+
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(shape), &block), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_block_get_transaction_count(block), 0U);
+
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfByronBlock)
+{
+  cardano_block_t* block = NULL;
+
+  EXPECT_EQ(decode_block(encode_block(default_shape(), 1U), &block), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(block, nullptr);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfWitnessSetCountDiffers)
+{
+  block_shape_t shape     = default_shape();
+  shape.witness_set_count = 2U;
+
+  cardano_block_t* block = NULL;
+
+  EXPECT_EQ(decode_block(encode_block(shape), &block), CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE);
+  EXPECT_EQ(block, nullptr);
+
+  shape.witness_set_count = 4U;
+
+  EXPECT_EQ(decode_block(encode_block(shape), &block), CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE);
+  EXPECT_EQ(block, nullptr);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfTransactionIndexIsOutOfBounds)
+{
+  block_shape_t    shape = default_shape();
+  cardano_block_t* block = NULL;
+
+  shape.invalid_indices = { 3U };
+
+  EXPECT_EQ(decode_block(encode_block(shape), &block), CARDANO_ERROR_INVALID_CBOR_VALUE);
+  EXPECT_EQ(block, nullptr);
+
+  shape                        = default_shape();
+  shape.auxiliary_data_indices = { 5U };
+
+  EXPECT_EQ(decode_block(encode_block(shape), &block), CARDANO_ERROR_INVALID_CBOR_VALUE);
+  EXPECT_EQ(block, nullptr);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfAuxiliaryDataIndexIsDuplicated)
+{
+  block_shape_t shape          = default_shape();
+  shape.auxiliary_data_indices = { 1U, 1U };
+
+  cardano_block_t* block = NULL;
+
+  EXPECT_EQ(decode_block(encode_block(shape), &block), CARDANO_ERROR_DUPLICATED_CBOR_MAP_KEY);
+  EXPECT_EQ(block, nullptr);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfNotABlock)
+{
+  cardano_block_t*       block  = NULL;
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex("83010203", 8U);
+
+  EXPECT_EQ(cardano_block_from_cbor(reader, &block), CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE);
+  EXPECT_EQ(block, nullptr);
+
+  cardano_cbor_reader_unref(&reader);
+
+  reader = cardano_cbor_reader_from_hex("a0", 2U);
+
+  EXPECT_NE(cardano_block_from_cbor(reader, &block), CARDANO_SUCCESS);
+  EXPECT_EQ(block, nullptr);
+
+  cardano_cbor_reader_unref(&reader);
+
+  std::vector<byte_t> bytes = encode_block(default_shape());
+
+  bytes.resize(bytes.size() - 1U);
+
+  EXPECT_NE(decode_block(bytes, &block), CARDANO_SUCCESS);
+  EXPECT_EQ(block, nullptr);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfPointerIsNull)
+{
+  cardano_block_t*       block  = NULL;
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex("a0", 2U);
+
+  EXPECT_EQ(cardano_block_from_cbor(nullptr, &block), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_block_from_cbor(reader, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_cbor_reader_unref(&reader);
+}
+
+TEST(cardano_block_from_cbor, returnsErrorIfMemoryAllocationFails)
+{
+  const std::vector<byte_t> bare    = encode_block(default_shape());
+  const std::vector<byte_t> wrapped = encode_block(default_shape(), 6U);
+
+  for (const std::vector<byte_t>* bytes: { &bare, &wrapped })
+  {
+    for (int i = 0; i < 64; ++i)
+    {
+      cardano_cbor_reader_t* reader = cardano_cbor_reader_new(bytes->data(), bytes->size());
+      cardano_block_t*       block  = NULL;
+
+      reset_allocators_run_count();
+      set_malloc_limit(i);
+      cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+      const cardano_error_t result = cardano_block_from_cbor(reader, &block);
+
+      cardano_set_allocators(malloc, realloc, free);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        EXPECT_EQ(cardano_block_get_transaction_count(block), 3U);
+      }
+      else
+      {
+        EXPECT_EQ(block, nullptr);
+      }
+
+      cardano_block_unref(&block);
+      cardano_cbor_reader_unref(&reader);
+    }
+  }
+}
+
+TEST(cardano_block_get_transaction, decodesEachTransactionFromItsSlices)
+{
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(default_shape()), &block), CARDANO_SUCCESS);
+
+  for (size_t i = 0U; i < 3U; ++i)
+  {
+    cardano_transaction_t*    transaction = NULL;
+    cardano_blake2b_hash_t*   block_id    = NULL;
+    cardano_blake2b_hash_t*   id          = NULL;
+    cardano_auxiliary_data_t* aux         = NULL;
+
+    ASSERT_EQ(cardano_block_get_transaction(block, i, &transaction), CARDANO_SUCCESS);
+    ASSERT_EQ(cardano_block_get_transaction_id(block, i, &block_id), CARDANO_SUCCESS);
+
+    id  = cardano_transaction_get_id(transaction);
+    aux = cardano_transaction_get_auxiliary_data(transaction);
+
+    EXPECT_EQ(to_hex(id), TX_ID);
+    EXPECT_EQ(to_hex(block_id), TX_ID);
+    EXPECT_EQ(cardano_transaction_get_is_valid(transaction), i != 2U);
+    EXPECT_EQ(cardano_block_is_transaction_valid(block, i), i != 2U);
+    EXPECT_EQ(aux != nullptr, i == 1U);
+
+    cardano_auxiliary_data_unref(&aux);
+    cardano_blake2b_hash_unref(&id);
+    cardano_blake2b_hash_unref(&block_id);
+    cardano_transaction_unref(&transaction);
+  }
+
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_get_transaction, returnsErrorIfIndexIsOutOfBounds)
+{
+  cardano_block_t*        block       = NULL;
+  cardano_transaction_t*  transaction = NULL;
+  cardano_blake2b_hash_t* id          = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(default_shape()), &block), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_block_get_transaction(block, 3U, &transaction), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+  EXPECT_EQ(transaction, nullptr);
+  EXPECT_EQ(cardano_block_get_transaction_id(block, 3U, &id), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+  EXPECT_EQ(id, nullptr);
+  EXPECT_FALSE(cardano_block_is_transaction_valid(block, 3U));
+
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_get_transaction, returnsErrorIfPointerIsNull)
+{
+  cardano_block_t*        block       = NULL;
+  cardano_transaction_t*  transaction = NULL;
+  cardano_blake2b_hash_t* id          = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(default_shape()), &block), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_block_get_transaction(nullptr, 0U, &transaction), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_block_get_transaction(block, 0U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_block_get_transaction_id(nullptr, 0U, &id), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_block_get_transaction_id(block, 0U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_get_transaction, returnsErrorIfMemoryAllocationFails)
+{
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(default_shape()), &block), CARDANO_SUCCESS);
+
+  for (int i = 0; i < 256; ++i)
+  {
+    cardano_transaction_t* transaction = NULL;
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    const cardano_error_t result = cardano_block_get_transaction(block, 1U, &transaction);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      EXPECT_EQ(transaction, nullptr);
+    }
+
+    cardano_transaction_unref(&transaction);
+  }
+
+  cardano_block_unref(&block);
+}
+
+TEST(cardano_block_getters, returnDefaultsIfBlockIsNull)
+{
+  EXPECT_EQ(cardano_block_get_block_number(nullptr), 0U);
+  EXPECT_EQ(cardano_block_get_slot(nullptr), 0U);
+  EXPECT_EQ(cardano_block_get_body_size(nullptr), 0U);
+  EXPECT_EQ(cardano_block_get_header_hash(nullptr), nullptr);
+  EXPECT_EQ(cardano_block_get_previous_hash(nullptr), nullptr);
+  EXPECT_EQ(cardano_block_get_body_hash(nullptr), nullptr);
+  EXPECT_EQ(cardano_block_get_protocol_version(nullptr), nullptr);
+  EXPECT_EQ(cardano_block_get_transaction_count(nullptr), 0U);
+  EXPECT_FALSE(cardano_block_is_transaction_valid(nullptr, 0U));
+}
+
+TEST(cardano_block_ref, increasesTheReferenceCount)
+{
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(default_shape()), &block), CARDANO_SUCCESS);
+
+  cardano_block_ref(block);
+
+  EXPECT_EQ(cardano_block_refcount(block), 2U);
+
+  // Two unrefs are needed: one for the decode, one for the extra ref.
+  cardano_block_unref(&block);
+  cardano_block_unref(&block);
+
+  EXPECT_EQ(block, nullptr);
+}
+
+TEST(cardano_block_ref, doesntCrashIfGivenANullPtr)
+{
+  cardano_block_ref(nullptr);
+}
+
+TEST(cardano_block_unref, doesntCrashIfGivenAPtrToANullPtr)
+{
+  cardano_block_t* block = nullptr;
+
+  cardano_block_unref(&block);
+  cardano_block_unref((cardano_block_t**)nullptr);
+}
+
+TEST(cardano_block_refcount, returnsZeroIfGivenANullPtr)
+{
+  EXPECT_EQ(cardano_block_refcount(nullptr), 0U);
+}
+
+TEST(cardano_block_set_last_error, doesNothingWhenObjectIsNull)
+{
+  cardano_block_set_last_error(nullptr, "Security is the mother of all evils.");
+
+  EXPECT_STREQ(cardano_block_get_last_error(nullptr), "Object is NULL.");
+}
+
+TEST(cardano_block_set_last_error, recordsTheMessage)
+{
+  cardano_block_t* block = NULL;
+
+  ASSERT_EQ(decode_block(encode_block(default_shape()), &block), CARDANO_SUCCESS);
+
+  cardano_block_set_last_error(block, "This is a test message");
+
+  EXPECT_STREQ(cardano_block_get_last_error(block), "This is a test message");
+
+  cardano_block_unref(&block);
+}
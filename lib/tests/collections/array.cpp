@@ -1130,6 +1130,96 @@ TEST(cardano_array_sort, sortsTheArray)
   cardano_object_unref((cardano_object_t**)&ref_str3);
 }
 
+TEST(cardano_array_insert_sorted, returnsZeroWhenArrayIsNull)
+{
+  // Act
+  size_t new_size = cardano_array_insert_sorted(nullptr, nullptr, nullptr, nullptr);
+
+  // Assert
+  EXPECT_EQ(new_size, 0);
+}
+
+TEST(cardano_array_insert_sorted, doesNothingWhenItemOrComparatorIsNull)
+{
+  // Arrange
+  cardano_array_t*      array   = cardano_array_new(1);
+  ref_counted_string_t* ref_str = ref_counted_string_new("Hello, World!");
+
+  // Act & Assert
+  EXPECT_EQ(cardano_array_insert_sorted(array, nullptr, nullptr, nullptr), 0);
+  EXPECT_EQ(cardano_array_insert_sorted(array, &ref_str->base, nullptr, nullptr), 0);
+
+  // Cleanup
+  cardano_array_unref(&array);
+  cardano_object_unref((cardano_object_t**)&ref_str);
+}
+
+TEST(cardano_array_insert_sorted, keepsTheArraySorted)
+{
+  // Arrange
+  cardano_array_t*      array    = cardano_array_new(1);
+  ref_counted_string_t* ref_str1 = ref_counted_string_new("1");
+  ref_counted_string_t* ref_str2 = ref_counted_string_new("2");
+  ref_counted_string_t* ref_str3 = ref_counted_string_new("3");
+  ref_counted_string_t* ref_str4 = ref_counted_string_new("4");
+
+  cardano_array_compare_item_t compare = [](const cardano_object_t* a, const cardano_object_t* b, void* context) -> int
+  {
+    return strcmp(((ref_counted_string_t*)a)->string, ((ref_counted_string_t*)b)->string);
+  };
+
+  // Act
+  EXPECT_EQ(cardano_array_insert_sorted(array, &ref_str3->base, compare, nullptr), 1);
+  EXPECT_EQ(cardano_array_insert_sorted(array, &ref_str1->base, compare, nullptr), 2);
+  EXPECT_EQ(cardano_array_insert_sorted(array, &ref_str4->base, compare, nullptr), 3);
+  EXPECT_EQ(cardano_array_insert_sorted(array, &ref_str2->base, compare, nullptr), 4);
+
+  // Assert
+  const char* expected[] = { "1", "2", "3", "4" };
+
+  for (size_t i = 0U; i < 4U; ++i)
+  {
+    cardano_object_t* item = cardano_array_get(array, i);
+
+    EXPECT_STREQ(((ref_counted_string_t*)item)->string, expected[i]);
+
+    cardano_object_unref(&item);
+  }
+
+  // Cleanup
+  cardano_array_unref(&array);
+  cardano_object_unref((cardano_object_t**)&ref_str1);
+  cardano_object_unref((cardano_object_t**)&ref_str2);
+  cardano_object_unref((cardano_object_t**)&ref_str3);
+  cardano_object_unref((cardano_object_t**)&ref_str4);
+}
+
+TEST(cardano_array_insert_sorted, returnsOldSizeIfMemoryAllocationFails)
+{
+  // Arrange
+  cardano_array_t*      array   = cardano_array_new(1);
+  ref_counted_string_t* ref_str = ref_counted_string_new("Hello, World!");
+
+  cardano_array_compare_item_t compare = [](const cardano_object_t* a, const cardano_object_t* b, void* context) -> int
+  {
+    return strcmp(((ref_counted_string_t*)a)->string, ((ref_counted_string_t*)b)->string);
+  };
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, fail_right_away_realloc, free);
+
+  // Act
+  size_t new_size = cardano_array_insert_sorted(array, &ref_str->base, compare, nullptr);
+
+  // Assert
+  EXPECT_EQ(new_size, 0);
+
+  // Cleanup
+  cardano_set_allocators(malloc, realloc, free);
+  cardano_array_unref(&array);
+  cardano_object_unref((cardano_object_t**)&ref_str);
+}
+
 TEST(cardano_array_find, returnsNullWhenArrayIsNull)
 {
   // Arrange
@@ -0,0 +1,726 @@
+/**
+ * \file utxo_snapshot.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/error.h>
+
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/common/utxo_snapshot.h>
+#include <cardano/transaction_body/transaction_output.h>
+
+#include "tests/allocators_helpers.h"
+
+#include <allocators.h>
+#include <gmock/gmock.h>
+#include <string.h>
+#include <vector>
+
+/* CONSTANTS *****************************************************************/
+
+// An output with six native assets, an inline datum and a script reference.
+static const char* UTXO_WITH_EVERYTHING_CBOR = "82825820bb217abaca60fc0ca68c1555eca6a96d2478547818ae76ce6836133f3cc546e001a400583900537ba48a023f0a3c65e54977ffc2d78c143fb418ef6db058e006d78a7c16240714ea0e12b41a914f2945784ac494bb19573f0ca61a08afa801821a000f4240a2581c00000000000000000000000000000000000000000000000000000000a3443031323218644433343536186344404142420a581c11111111111111111111111111111111111111111111111111111111a3443031323218644433343536186344404142420a028201d81849d8799f0102030405ff03d8185182014e4d01000033222220051200120011";
+
+// An output with a datum hash and a script reference.
+static const char* UTXO_WITH_DATUM_HASH_CBOR = "82825820bb217abaca60fc0ca68c1555eca6a96d2478547818ae76ce6836133f3cc546e002a400583900537ba48a023f0a3c65e54977ffc2d78c143fb418ef6db058e006d78a7c16240714ea0e12b41a914f2945784ac494bb19573f0ca61a08afa801821a000f4240a2581c00000000000000000000000000000000000000000000000000000000a3443031323218644433343536186344404142420a581c11111111111111111111111111111111111111111111111111111111a3443031323218644433343536186344404142420a0282005820000000000000000000000000000000000000000000000000000000000000000003d8185182014e4d01000033222220051200120011";
+
+// A legacy output paying to a pointer address, with lovelace only.
+static const char* UTXO_ADA_ONLY_CBOR = "82825820cc217abaca60fc0ca68c1555eca6a96d2478547818ae76ce6836133f3cc546e000825826412813b99a80cfb4024374bd0f502959485aa56e0648564ff805f2e51bbcd9819561bddc66141a02faf080";
+
+static const byte_t FIRST_TX_ID[] = {
+  0xbb, 0x21, 0x7a, 0xba, 0xca, 0x60, 0xfc, 0x0c, 0xa6, 0x8c, 0x15, 0x55, 0xec, 0xa6, 0xa9, 0x6d,
+  0x24, 0x78, 0x54, 0x78, 0x18, 0xae, 0x76, 0xce, 0x68, 0x36, 0x13, 0x3f, 0x3c, 0xc5, 0x46, 0xe0
+};
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * Creates a new UTxO from its CBOR encoding.
+ * @return A new instance of the utxo.
+ */
+static cardano_utxo_t*
+new_utxo(const char* cbor)
+{
+  cardano_utxo_t*        utxo   = NULL;
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(cbor, strlen(cbor));
+
+  EXPECT_EQ(cardano_utxo_from_cbor(reader, &utxo), CARDANO_SUCCESS);
+
+  cardano_cbor_reader_unref(&reader);
+
+  return utxo;
+}
+
+/**
+ * Creates a new UTxO list holding one UTxO of each kind.
+ * @return A new instance of the utxo list.
+ */
+static cardano_utxo_list_t*
+new_default_utxo_list()
+{
+  cardano_utxo_list_t* list = NULL;
+
+  EXPECT_EQ(cardano_utxo_list_new(&list), CARDANO_SUCCESS);
+
+  const char* cbors[] = { UTXO_WITH_EVERYTHING_CBOR, UTXO_WITH_DATUM_HASH_CBOR, UTXO_ADA_ONLY_CBOR };
+
+  for (const char* cbor: cbors)
+  {
+    cardano_utxo_t* utxo = new_utxo(cbor);
+
+    EXPECT_EQ(cardano_utxo_list_add(list, utxo), CARDANO_SUCCESS);
+
+    cardano_utxo_unref(&utxo);
+  }
+
+  return list;
+}
+
+/**
+ * Encodes the default UTxO list as a snapshot.
+ * @return The snapshot bytes.
+ */
+static std::vector<byte_t>
+new_default_snapshot_bytes()
+{
+  cardano_utxo_list_t* list   = new_default_utxo_list();
+  cardano_buffer_t*    buffer = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_encode(list, &buffer), CARDANO_SUCCESS);
+
+  std::vector<byte_t> bytes(cardano_buffer_get_data(buffer), cardano_buffer_get_data(buffer) + cardano_buffer_get_size(buffer));
+
+  cardano_buffer_unref(&buffer);
+  cardano_utxo_list_unref(&list);
+
+  return bytes;
+}
+
+/**
+ * Writes a little-endian 64-bit integer into a snapshot.
+ */
+static void
+write_u64(std::vector<byte_t>& bytes, size_t offset, uint64_t value)
+{
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    bytes[offset + i] = (byte_t)(value >> (8U * i));
+  }
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_utxo_snapshot_encode, roundTripsEveryEntry)
+{
+  // Arrange
+  cardano_utxo_list_t*     list     = new_default_utxo_list();
+  cardano_buffer_t*        buffer   = NULL;
+  cardano_utxo_snapshot_t* snapshot = NULL;
+  cardano_utxo_list_t*     utxos    = NULL;
+
+  // Act
+  EXPECT_EQ(cardano_utxo_snapshot_encode(list, &buffer), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_snapshot_load(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer), &snapshot), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxos(snapshot, NULL, 0U, &utxos), CARDANO_SUCCESS);
+
+  // Assert
+  ASSERT_EQ(cardano_utxo_snapshot_get_count(snapshot), 3U);
+  ASSERT_EQ(cardano_utxo_list_get_length(utxos), 3U);
+
+  for (size_t i = 0U; i < 3U; ++i)
+  {
+    cardano_utxo_t* expected = NULL;
+    cardano_utxo_t* actual   = NULL;
+
+    EXPECT_EQ(cardano_utxo_list_get(list, i, &expected), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_utxo_list_get(utxos, i, &actual), CARDANO_SUCCESS);
+
+    EXPECT_TRUE(cardano_utxo_equals(expected, actual));
+
+    cardano_utxo_unref(&expected);
+    cardano_utxo_unref(&actual);
+  }
+
+  // Cleanup
+  cardano_utxo_list_unref(&utxos);
+  cardano_utxo_snapshot_unref(&snapshot);
+  cardano_buffer_unref(&buffer);
+  cardano_utxo_list_unref(&list);
+}
+
+TEST(cardano_utxo_snapshot_encode, encodesAnEmptyList)
+{
+  // Arrange
+  cardano_utxo_list_t*     list     = NULL;
+  cardano_buffer_t*        buffer   = NULL;
+  cardano_utxo_snapshot_t* snapshot = NULL;
+  cardano_utxo_list_t*     utxos    = NULL;
+
+  EXPECT_EQ(cardano_utxo_list_new(&list), CARDANO_SUCCESS);
+
+  // Act
+  EXPECT_EQ(cardano_utxo_snapshot_encode(list, &buffer), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_snapshot_load(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer), &snapshot), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxos(snapshot, NULL, 0U, &utxos), CARDANO_SUCCESS);
+
+  // Assert
+  EXPECT_EQ(cardano_buffer_get_size(buffer), 48U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_count(snapshot), 0U);
+  EXPECT_EQ(cardano_utxo_list_get_length(utxos), 0U);
+
+  // Cleanup
+  cardano_utxo_list_unref(&utxos);
+  cardano_utxo_snapshot_unref(&snapshot);
+  cardano_buffer_unref(&buffer);
+  cardano_utxo_list_unref(&list);
+}
+
+TEST(cardano_utxo_snapshot_encode, returnsErrorIfGivenANullPtr)
+{
+  // Arrange
+  cardano_utxo_list_t* list   = new_default_utxo_list();
+  cardano_buffer_t*    buffer = NULL;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_encode(NULL, &buffer), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_encode(list, NULL), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_utxo_list_unref(&list);
+}
+
+TEST(cardano_utxo_snapshot_encode, returnsErrorIfMemoryAllocationFails)
+{
+  // Arrange
+  cardano_utxo_list_t* list = new_default_utxo_list();
+
+  for (int i = 0; i < 256; ++i)
+  {
+    cardano_buffer_t* buffer = NULL;
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    // Act
+    cardano_error_t result = cardano_utxo_snapshot_encode(list, &buffer);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    // Assert
+    if (result != CARDANO_SUCCESS)
+    {
+      EXPECT_EQ(buffer, nullptr);
+    }
+
+    cardano_buffer_unref(&buffer);
+  }
+
+  // Cleanup
+  cardano_utxo_list_unref(&list);
+}
+
+TEST(cardano_utxo_snapshot_load, loadsFromUnalignedMemory)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  std::vector<byte_t>      shifted(bytes.size() + 1U);
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  memcpy(&shifted[1], bytes.data(), bytes.size());
+
+  // Act
+  cardano_error_t result = cardano_utxo_snapshot_load(&shifted[1], bytes.size(), &snapshot);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_snapshot_get_count(snapshot), 3U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_lovelace(snapshot, 2U), 50000000U);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfGivenANullPtr)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(NULL, bytes.size(), &snapshot), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), NULL), CARDANO_ERROR_POINTER_IS_NULL);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfMagicIsInvalid)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  bytes[0] = 'X';
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_ERROR_INVALID_MAGIC);
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), 4U, &snapshot), CARDANO_ERROR_INVALID_MAGIC);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfVersionIsUnknown)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  bytes[8] = 2U;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_ERROR_NOT_IMPLEMENTED);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfTruncated)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size() - 1U, &snapshot), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), 47U, &snapshot), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfCountsDoNotMatchTheSize)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  write_u64(bytes, 16U, UINT64_MAX / 2U);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfAnEntryPointsOutsideTheBlob)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  write_u64(bytes, 48U + 64U, UINT64_MAX - 1U);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfAnEntryPointsOutsideTheAssets)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  write_u64(bytes, 48U + 48U, 100U);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfLovelaceIsOutOfRange)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  write_u64(bytes, 48U + 40U, UINT64_MAX);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_load, returnsErrorIfMemoryAllocationFails)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act
+  cardano_error_t result = cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(snapshot, nullptr);
+
+  // Cleanup
+  cardano_set_allocators(malloc, realloc, free);
+}
+
+TEST(cardano_utxo_snapshot_get_tx_id, readsEntriesInPlace)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act
+  const byte_t* tx_id = cardano_utxo_snapshot_get_tx_id(snapshot, 0U);
+
+  // Assert
+  EXPECT_EQ(memcmp(tx_id, FIRST_TX_ID, sizeof(FIRST_TX_ID)), 0);
+  EXPECT_GE(tx_id, bytes.data());
+  EXPECT_LT(tx_id, bytes.data() + bytes.size());
+  EXPECT_EQ(cardano_utxo_snapshot_get_output_index(snapshot, 0U), 1U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_output_index(snapshot, 1U), 2U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_output_index(snapshot, 2U), 0U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_lovelace(snapshot, 0U), 1000000U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_lovelace(snapshot, 2U), 50000000U);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_tx_id, returnsNullIfIndexIsOutOfBounds)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_get_tx_id(snapshot, 3U), nullptr);
+  EXPECT_EQ(cardano_utxo_snapshot_get_tx_id(NULL, 0U), nullptr);
+  EXPECT_EQ(cardano_utxo_snapshot_get_output_index(snapshot, 3U), 0U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_lovelace(snapshot, 3U), 0U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset_count(snapshot, 3U), 0U);
+  EXPECT_FALSE(cardano_utxo_snapshot_has_datum(snapshot, 3U));
+  EXPECT_FALSE(cardano_utxo_snapshot_has_script_ref(snapshot, 3U));
+  EXPECT_EQ(cardano_utxo_snapshot_get_count(NULL), 0U);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_address, returnsTheAddressBytes)
+{
+  // Arrange
+  std::vector<byte_t>           bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t*      snapshot = NULL;
+  cardano_utxo_t*               utxo     = new_utxo(UTXO_ADA_ONLY_CBOR);
+  cardano_transaction_output_t* output   = cardano_utxo_get_output(utxo);
+  cardano_address_t*            expected = cardano_transaction_output_get_address(output);
+  const byte_t*                 address  = NULL;
+  size_t                        size     = 0U;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_utxo_snapshot_get_address(snapshot, 2U, &address, &size);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  ASSERT_EQ(size, cardano_address_get_bytes_size(expected));
+  EXPECT_EQ(memcmp(address, cardano_address_get_bytes(expected), size), 0);
+
+  // Cleanup
+  cardano_address_unref(&expected);
+  cardano_transaction_output_unref(&output);
+  cardano_utxo_unref(&utxo);
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_address, returnsErrorIfGivenInvalidArguments)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+  const byte_t*            address  = NULL;
+  size_t                   size     = 0U;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_get_address(NULL, 0U, &address, &size), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_address(snapshot, 0U, NULL, &size), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_address(snapshot, 0U, &address, NULL), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_address(snapshot, 3U, &address, &size), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_asset, returnsTheAssetsOfAnEntry)
+{
+  // Arrange
+  std::vector<byte_t>      bytes      = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot   = NULL;
+  const byte_t*            policy_id  = NULL;
+  const byte_t*            asset_name = NULL;
+  size_t                   name_size  = 0U;
+  int64_t                  quantity   = 0;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_utxo_snapshot_get_asset(snapshot, 0U, 5U, &policy_id, &asset_name, &name_size, &quantity);
+
+  // Assert
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset_count(snapshot, 0U), 6U);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset_count(snapshot, 2U), 0U);
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(policy_id[0], 0x11U);
+  EXPECT_EQ(policy_id[CARDANO_UTXO_SNAPSHOT_POLICY_ID_SIZE - 1U], 0x11U);
+  ASSERT_EQ(name_size, 4U);
+  EXPECT_EQ(memcmp(asset_name, "@ABB", 4U), 0);
+  EXPECT_EQ(quantity, 10);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_asset, returnsErrorIfGivenInvalidArguments)
+{
+  // Arrange
+  std::vector<byte_t>      bytes      = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot   = NULL;
+  const byte_t*            policy_id  = NULL;
+  const byte_t*            asset_name = NULL;
+  size_t                   name_size  = 0U;
+  int64_t                  quantity   = 0;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(NULL, 0U, 0U, &policy_id, &asset_name, &name_size, &quantity), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 0U, 0U, NULL, &asset_name, &name_size, &quantity), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 0U, 0U, &policy_id, NULL, &name_size, &quantity), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 0U, 0U, &policy_id, &asset_name, NULL, &quantity), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 0U, 0U, &policy_id, &asset_name, &name_size, NULL), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 0U, 6U, &policy_id, &asset_name, &name_size, &quantity), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 2U, 0U, &policy_id, &asset_name, &name_size, &quantity), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+  EXPECT_EQ(cardano_utxo_snapshot_get_asset(snapshot, 3U, 0U, &policy_id, &asset_name, &name_size, &quantity), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_has_datum, reportsDatumsAndScriptReferences)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_TRUE(cardano_utxo_snapshot_has_datum(snapshot, 0U));
+  EXPECT_TRUE(cardano_utxo_snapshot_has_datum(snapshot, 1U));
+  EXPECT_FALSE(cardano_utxo_snapshot_has_datum(snapshot, 2U));
+  EXPECT_TRUE(cardano_utxo_snapshot_has_script_ref(snapshot, 0U));
+  EXPECT_TRUE(cardano_utxo_snapshot_has_script_ref(snapshot, 1U));
+  EXPECT_FALSE(cardano_utxo_snapshot_has_script_ref(snapshot, 2U));
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_utxo, returnsErrorIfGivenInvalidArguments)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+  cardano_utxo_t*          utxo     = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxo(NULL, 0U, &utxo), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxo(snapshot, 0U, NULL), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxo(snapshot, 3U, &utxo), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_utxo, returnsErrorIfMemoryAllocationFails)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  for (int i = 0; i < 128; ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    // Act
+    cardano_error_t result = cardano_utxo_snapshot_get_utxo(snapshot, 0U, &utxo);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    // Assert
+    if (result != CARDANO_SUCCESS)
+    {
+      EXPECT_EQ(utxo, nullptr);
+    }
+
+    cardano_utxo_unref(&utxo);
+  }
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_utxos, materializesOnlyTheSelectedEntries)
+{
+  // Arrange
+  std::vector<byte_t>      bytes     = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot  = NULL;
+  cardano_utxo_list_t*     utxos     = NULL;
+  cardano_utxo_t*          first     = NULL;
+  cardano_utxo_t*          second    = NULL;
+  cardano_utxo_t*          ada_only  = new_utxo(UTXO_ADA_ONLY_CBOR);
+  cardano_utxo_t*          with_hash = new_utxo(UTXO_WITH_DATUM_HASH_CBOR);
+  const size_t             indices[] = { 2U, 1U };
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_utxo_snapshot_get_utxos(snapshot, indices, 2U, &utxos);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_utxo_list_get_length(utxos), 2U);
+  EXPECT_EQ(cardano_utxo_list_get(utxos, 0U, &first), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_list_get(utxos, 1U, &second), CARDANO_SUCCESS);
+  EXPECT_TRUE(cardano_utxo_equals(first, ada_only));
+  EXPECT_TRUE(cardano_utxo_equals(second, with_hash));
+
+  // Cleanup
+  cardano_utxo_unref(&first);
+  cardano_utxo_unref(&second);
+  cardano_utxo_unref(&ada_only);
+  cardano_utxo_unref(&with_hash);
+  cardano_utxo_list_unref(&utxos);
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_utxos, returnsErrorIfGivenInvalidArguments)
+{
+  // Arrange
+  std::vector<byte_t>      bytes     = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot  = NULL;
+  cardano_utxo_list_t*     utxos     = NULL;
+  const size_t             indices[] = { 0U, 3U };
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxos(NULL, NULL, 0U, &utxos), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxos(snapshot, NULL, 0U, NULL), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_utxo_snapshot_get_utxos(snapshot, indices, 2U, &utxos), CARDANO_ERROR_INDEX_OUT_OF_BOUNDS);
+  EXPECT_EQ(utxos, nullptr);
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_ref, increasesTheReferenceCount)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act
+  cardano_utxo_snapshot_ref(snapshot);
+
+  // Assert
+  EXPECT_EQ(cardano_utxo_snapshot_refcount(snapshot), 2U);
+
+  // Cleanup - We need to unref twice since one reference was added.
+  cardano_utxo_snapshot_unref(&snapshot);
+  cardano_utxo_snapshot_unref(&snapshot);
+  EXPECT_EQ(snapshot, nullptr);
+}
+
+TEST(cardano_utxo_snapshot_ref, doesntCrashIfGivenANullPtr)
+{
+  // Act
+  cardano_utxo_snapshot_ref(NULL);
+}
+
+TEST(cardano_utxo_snapshot_unref, doesntCrashIfGivenAPtrToANullPtr)
+{
+  // Arrange
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  // Act
+  cardano_utxo_snapshot_unref(&snapshot);
+  cardano_utxo_snapshot_unref(NULL);
+}
+
+TEST(cardano_utxo_snapshot_refcount, returnsZeroIfGivenANullPtr)
+{
+  // Act & Assert
+  EXPECT_EQ(cardano_utxo_snapshot_refcount(NULL), 0U);
+}
+
+TEST(cardano_utxo_snapshot_get_last_error, returnsNullTerminatedMessage)
+{
+  // Arrange
+  std::vector<byte_t>      bytes    = new_default_snapshot_bytes();
+  cardano_utxo_snapshot_t* snapshot = NULL;
+
+  EXPECT_EQ(cardano_utxo_snapshot_load(bytes.data(), bytes.size(), &snapshot), CARDANO_SUCCESS);
+
+  // Act
+  cardano_utxo_snapshot_set_last_error(snapshot, "This is a test message");
+
+  // Assert
+  EXPECT_STREQ(cardano_utxo_snapshot_get_last_error(snapshot), "This is a test message");
+
+  // Cleanup
+  cardano_utxo_snapshot_unref(&snapshot);
+}
+
+TEST(cardano_utxo_snapshot_get_last_error, returnsObjectIsNullIfGivenANullPtr)
+{
+  // Act & Assert
+  EXPECT_STREQ(cardano_utxo_snapshot_get_last_error(NULL), "Object is NULL.");
+}
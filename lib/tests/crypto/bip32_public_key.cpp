@@ -777,4 +777,114 @@ TEST(cardano_bip32_public_key_to_hash, canComputeTheHash)
   // Cleanup
   cardano_bip32_public_key_unref(&public_key);
   cardano_blake2b_hash_unref(&hash);
-}
\ No newline at end of file
+}
+TEST(cardano_bip32_public_key_derive_key_hashes, derivesTheSameHashesAsDerivingEachKey)
+{
+  // Arrange
+  cardano_bip32_public_key_t* account_key = nullptr;
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(BIP32_PUBLIC_KEY_HEX, BIP32_PUBLIC_KEY_SIZE * 2, &account_key), CARDANO_SUCCESS);
+
+  const size_t count                = 5U;
+  byte_t       key_hashes[5U * 28U] = { 0 };
+
+  // Act
+  cardano_error_t error = cardano_bip32_public_key_derive_key_hashes(account_key, 1U, 10U, count, key_hashes, sizeof(key_hashes));
+
+  // Assert
+  ASSERT_EQ(error, CARDANO_SUCCESS);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const uint32_t                indices[]   = { 1U, 10U + (uint32_t)i };
+    cardano_bip32_public_key_t*   derived_key = nullptr;
+    cardano_ed25519_public_key_t* ed25519_key = nullptr;
+    cardano_blake2b_hash_t*       hash        = nullptr;
+
+    ASSERT_EQ(cardano_bip32_public_key_derive(account_key, indices, 2, &derived_key), CARDANO_SUCCESS);
+    ASSERT_EQ(cardano_bip32_public_key_to_ed25519_key(derived_key, &ed25519_key), CARDANO_SUCCESS);
+    ASSERT_EQ(cardano_ed25519_public_key_to_hash(ed25519_key, &hash), CARDANO_SUCCESS);
+
+    EXPECT_EQ(memcmp(&key_hashes[i * 28U], cardano_blake2b_hash_get_data(hash), 28U), 0);
+
+    cardano_blake2b_hash_unref(&hash);
+    cardano_ed25519_public_key_unref(&ed25519_key);
+    cardano_bip32_public_key_unref(&derived_key);
+  }
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_bip32_public_key_derive_key_hashes, doesntAllocateMemory)
+{
+  // Arrange
+  cardano_bip32_public_key_t* account_key = nullptr;
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(BIP32_PUBLIC_KEY_HEX, BIP32_PUBLIC_KEY_SIZE * 2, &account_key), CARDANO_SUCCESS);
+
+  byte_t key_hashes[3U * 28U] = { 0 };
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act
+  cardano_error_t error = cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 0U, 3U, key_hashes, sizeof(key_hashes));
+
+  cardano_set_allocators(malloc, realloc, free);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_bip32_public_key_derive_key_hashes, returnsErrorIfGivenANullPtr)
+{
+  // Arrange
+  cardano_bip32_public_key_t* account_key = nullptr;
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(BIP32_PUBLIC_KEY_HEX, BIP32_PUBLIC_KEY_SIZE * 2, &account_key), CARDANO_SUCCESS);
+
+  byte_t key_hashes[28U] = { 0 };
+
+  // Act & Assert
+  EXPECT_EQ(cardano_bip32_public_key_derive_key_hashes(nullptr, 0U, 0U, 1U, key_hashes, sizeof(key_hashes)), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 0U, 1U, nullptr, sizeof(key_hashes)), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_bip32_public_key_derive_key_hashes, returnsErrorIfBufferIsTooSmall)
+{
+  // Arrange
+  cardano_bip32_public_key_t* account_key = nullptr;
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(BIP32_PUBLIC_KEY_HEX, BIP32_PUBLIC_KEY_SIZE * 2, &account_key), CARDANO_SUCCESS);
+
+  byte_t key_hashes[2U * 28U] = { 0 };
+
+  // Act
+  cardano_error_t error = cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 0U, 3U, key_hashes, sizeof(key_hashes));
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE);
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
+
+TEST(cardano_bip32_public_key_derive_key_hashes, returnsErrorWhenUsingHardenedIndices)
+{
+  // Arrange
+  cardano_bip32_public_key_t* account_key = nullptr;
+  ASSERT_EQ(cardano_bip32_public_key_from_hex(BIP32_PUBLIC_KEY_HEX, BIP32_PUBLIC_KEY_SIZE * 2, &account_key), CARDANO_SUCCESS);
+
+  byte_t key_hashes[2U * 28U] = { 0 };
+
+  // Act & Assert
+  EXPECT_EQ(cardano_bip32_public_key_derive_key_hashes(account_key, cardano_bip32_harden(0), 0U, 1U, key_hashes, sizeof(key_hashes)), CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX);
+  EXPECT_EQ(cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 0x7FFFFFFFU, 2U, key_hashes, sizeof(key_hashes)), CARDANO_ERROR_INVALID_BIP32_DERIVATION_INDEX);
+  EXPECT_EQ(cardano_bip32_public_key_derive_key_hashes(account_key, 0U, 0x7FFFFFFFU, 1U, key_hashes, sizeof(key_hashes)), CARDANO_SUCCESS);
+
+  // Cleanup
+  cardano_bip32_public_key_unref(&account_key);
+}
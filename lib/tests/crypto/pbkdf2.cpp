@@ -55,7 +55,9 @@ static const pbkdf2_hmac_sha512_vectors_t pbkdf2_hmac_sha512_test_vectors[] = {
   { (const byte_t*)"password", strlen("password"), (const byte_t*)"salt", strlen("salt"), 1, 100, "867f70cf1ade02cff3752599a3a53dc4af34c7a669815ae5d513554e1c8cf252c02d470a285a0501bad999bfe943c08f050235d7d68b1da55e63f73b60a57fce7b532e206c2967d4c7d2ffa460539fc4d4e5eec70125d74c6c7cf86d25284f297907fcea" },
   { (const byte_t*)"password", 0, (const byte_t*)"salt", strlen("salt"), 1, 100, "00ef42cdbfc98d29db20976608e455567fdddf141f6eb03b5a85addd25974f5d2375bd5082b803e8f4cfa88ae1bd25256fcbddd2318676566ff2797792302aee6ca733014ec4a8969e9b4d25a196e71b38d7e3434496810e7ffedd58624f2fd53874cfa5" },
   { NULL, 0, (const byte_t*)"salt", strlen("salt"), 1, 100, "00ef42cdbfc98d29db20976608e455567fdddf141f6eb03b5a85addd25974f5d2375bd5082b803e8f4cfa88ae1bd25256fcbddd2318676566ff2797792302aee6ca733014ec4a8969e9b4d25a196e71b38d7e3434496810e7ffedd58624f2fd53874cfa5" },
-  { NULL, 0, (const byte_t*)"salt", strlen("salt"), 19162, 32, "879094d1113e95e3bc05c4a2d2b2a66cbc7876d454ee3c886cdf1a14c72188c7" }
+  { NULL, 0, (const byte_t*)"salt", strlen("salt"), 19162, 32, "879094d1113e95e3bc05c4a2d2b2a66cbc7876d454ee3c886cdf1a14c72188c7" },
+  // A password longer than the SHA-512 block size is hashed before keying the HMAC.
+  { (const byte_t*)"passwordPASSWORDpasswordPASSWORDpasswordPASSWORDpasswordPASSWORDpasswordPASSWORDpasswordPASSWORDpasswordPASSWORDpasswordPASSWORDpasswordPASSWORD", 144, (const byte_t*)"salt", strlen("salt"), 1000, 64, "6719ad650bf2039fcc1fa5576f6b7074964cb6228f00354eebe30edf4055f11150f3fa395d9265f9a5ba907cb93018941ceb1f966edba7328119b73264811656" }
 };
 
 /* UNIT TESTS ****************************************************************/
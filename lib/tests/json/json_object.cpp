@@ -32,6 +32,7 @@
 
 #include <cardano/json/json_writer.h>
 #include <gmock/gmock.h>
+#include <string>
 
 extern "C" {
 #include "../src/json/internals/json_parser.h"
@@ -456,6 +457,45 @@ TEST(cardano_json_object_get, returnsTrueIfFound)
   cardano_json_object_unref(&obj2);
 }
 
+TEST(cardano_json_object_get, findsEveryPropertyOfALargeObject)
+{
+  // Arrange
+  std::string json = "{";
+
+  for (int i = 0; i < 40; ++i)
+  {
+    json += "\"key" + std::to_string(i) + "\": " + std::to_string(i) + ", ";
+  }
+
+  json += "\"key7\": 1000}";
+
+  cardano_json_object_t* obj = cardano_json_object_parse(json.c_str(), json.size());
+
+  // Act & Assert
+  for (int i = 0; i < 40; ++i)
+  {
+    const std::string      key   = "key" + std::to_string(i);
+    cardano_json_object_t* value = NULL;
+    uint64_t               uint  = 0U;
+
+    EXPECT_TRUE(cardano_json_object_has_property(obj, key.c_str(), key.size()));
+    ASSERT_TRUE(cardano_json_object_get_ex(obj, key.c_str(), key.size(), &value));
+    EXPECT_EQ(cardano_json_object_get_uint(value, &uint), CARDANO_SUCCESS);
+
+    // The first occurrence of a duplicated key wins, as with a linear scan.
+    EXPECT_EQ(uint, (uint64_t)i);
+  }
+
+  cardano_json_object_t* value = NULL;
+
+  EXPECT_FALSE(cardano_json_object_has_property(obj, "key40", 5));
+  EXPECT_FALSE(cardano_json_object_get_ex(obj, "key", 3, &value));
+  EXPECT_EQ(cardano_json_object_get_property_count(obj), 41U);
+
+  // Cleanup
+  cardano_json_object_unref(&obj);
+}
+
 TEST(cardano_json_object_get_ex, returnsObjectWithoutReferenceIncrese)
 {
   cardano_json_object_t* obj   = cardano_json_object_parse("{ \"aaa\": 1}", strlen("{ \"aaa\": 1}"));
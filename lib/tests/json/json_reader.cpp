@@ -0,0 +1,556 @@
+/**
+ * \file json_reader.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * \section LICENSE
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/json/json_reader.h>
+
+#include "../allocators_helpers.h"
+#include "../src/allocators.h"
+
+#include <gmock/gmock.h>
+#include <string>
+#include <vector>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads every token of a JSON document.
+ *
+ * \param json The JSON text.
+ * \param result Receives the result of the first failing read, or CARDANO_SUCCESS.
+ *
+ * \return The tokens read, including the final end of document token.
+ */
+static std::vector<cardano_json_token_type_t>
+read_all_tokens(const char* json, cardano_error_t* result)
+{
+  std::vector<cardano_json_token_type_t> tokens;
+  cardano_json_reader_t*                 reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t              token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  *result = CARDANO_SUCCESS;
+
+  while (token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT)
+  {
+    *result = cardano_json_reader_read(reader, &token);
+
+    if (*result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    tokens.push_back(token);
+  }
+
+  cardano_json_reader_unref(&reader);
+
+  return tokens;
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_json_reader_new, returnsNullIfGivenNull)
+{
+  EXPECT_EQ(cardano_json_reader_new(nullptr, 0), nullptr);
+}
+
+TEST(cardano_json_reader_new, returnsNullIfMemoryAllocationFails)
+{
+  // Arrange
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act
+  cardano_json_reader_t* reader = cardano_json_reader_new("{}", 2);
+
+  // Assert
+  EXPECT_EQ(reader, nullptr);
+
+  // Cleanup
+  cardano_set_allocators(malloc, realloc, free);
+}
+
+TEST(cardano_json_reader_new, returnsNullIfScratchBufferAllocationFails)
+{
+  // Arrange
+  reset_allocators_run_count();
+  set_malloc_limit(1);
+  cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+  // Act
+  cardano_json_reader_t* reader = cardano_json_reader_new("{}", 2);
+
+  // Assert
+  EXPECT_EQ(reader, nullptr);
+
+  // Cleanup
+  cardano_set_allocators(malloc, realloc, free);
+}
+
+TEST(cardano_json_reader_read, readsTheTokensOfADocument)
+{
+  // Arrange
+  const char*     json   = "{ \"a\": [1, -2.5e3, \"x\", true, false, null], \"b\": {} }";
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // Act
+  std::vector<cardano_json_token_type_t> tokens = read_all_tokens(json, &result);
+
+  // Assert
+  const std::vector<cardano_json_token_type_t> expected = {
+    CARDANO_JSON_TOKEN_TYPE_START_OBJECT,
+    CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME,
+    CARDANO_JSON_TOKEN_TYPE_START_ARRAY,
+    CARDANO_JSON_TOKEN_TYPE_NUMBER,
+    CARDANO_JSON_TOKEN_TYPE_NUMBER,
+    CARDANO_JSON_TOKEN_TYPE_STRING,
+    CARDANO_JSON_TOKEN_TYPE_BOOLEAN,
+    CARDANO_JSON_TOKEN_TYPE_BOOLEAN,
+    CARDANO_JSON_TOKEN_TYPE_NULL,
+    CARDANO_JSON_TOKEN_TYPE_END_ARRAY,
+    CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME,
+    CARDANO_JSON_TOKEN_TYPE_START_OBJECT,
+    CARDANO_JSON_TOKEN_TYPE_END_OBJECT,
+    CARDANO_JSON_TOKEN_TYPE_END_OBJECT,
+    CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT
+  };
+
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(tokens, expected);
+}
+
+TEST(cardano_json_reader_read, readsAScalarRootValue)
+{
+  // Arrange
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // Act
+  std::vector<cardano_json_token_type_t> tokens = read_all_tokens("  42  ", &result);
+
+  // Assert
+  const std::vector<cardano_json_token_type_t> expected = {
+    CARDANO_JSON_TOKEN_TYPE_NUMBER,
+    CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT
+  };
+
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(tokens, expected);
+}
+
+TEST(cardano_json_reader_read, acceptsTrailingCommasLikeTheDomParser)
+{
+  // Arrange
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // Act
+  std::vector<cardano_json_token_type_t> tokens = read_all_tokens("{\"a\": [1, 2,], }", &result);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(tokens.back(), CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT);
+}
+
+TEST(cardano_json_reader_read, returnsErrorIfJsonIsMalformed)
+{
+  const char* invalid[] = {
+    "",
+    "{",
+    "[1 2]",
+    "[,]",
+    "{\"a\" 1}",
+    "{\"a\": }",
+    "{1: 2}",
+    "\"unterminated",
+    "01",
+    "1.",
+    "-",
+    "1e",
+    "tru",
+    "nul",
+    "{} {}",
+    "[1]]",
+    "[}"
+  };
+
+  for (const char* json: invalid)
+  {
+    cardano_error_t result = CARDANO_SUCCESS;
+
+    read_all_tokens(json, &result);
+
+    EXPECT_EQ(result, CARDANO_ERROR_INVALID_JSON) << json;
+  }
+}
+
+TEST(cardano_json_reader_read, errorsAreSticky)
+{
+  // Arrange
+  cardano_json_reader_t*    reader = cardano_json_reader_new("[1 2]", 5);
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t first  = cardano_json_reader_read(reader, &token);
+  cardano_error_t second = cardano_json_reader_read(reader, &token);
+
+  // Assert
+  EXPECT_EQ(first, CARDANO_ERROR_INVALID_JSON);
+  EXPECT_EQ(second, CARDANO_ERROR_INVALID_JSON);
+  EXPECT_STRNE(cardano_json_reader_get_last_error(reader), "");
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_read, returnsErrorIfMaximumDepthIsExceeded)
+{
+  // Arrange
+  std::string deep(300, '[');
+  deep.append(300, ']');
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // Act
+  read_all_tokens(deep.c_str(), &result);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_INVALID_JSON);
+}
+
+TEST(cardano_json_reader_read, returnsErrorIfGivenNull)
+{
+  cardano_json_reader_t*    reader = cardano_json_reader_new("{}", 2);
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  EXPECT_EQ(cardano_json_reader_read(nullptr, &token), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_json_reader_read(reader, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_read, reportsTheDepthOfEachToken)
+{
+  // Arrange
+  const char*               json   = "{\"a\": [1]}";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  std::vector<size_t>       depths;
+
+  // Act
+  while ((cardano_json_reader_read(reader, &token) == CARDANO_SUCCESS) && (token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT))
+  {
+    depths.push_back(cardano_json_reader_get_depth(reader));
+  }
+
+  // Assert
+  const std::vector<size_t> expected = { 0, 1, 1, 2, 1, 0 };
+
+  EXPECT_EQ(depths, expected);
+  EXPECT_EQ(cardano_json_reader_get_depth(nullptr), 0U);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_get_offset, delimitsTheTextOfAValue)
+{
+  // Arrange
+  const char*               json   = "{\"a\": {\"b\": [1, 2]}, \"c\": 3}";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(token, CARDANO_JSON_TOKEN_TYPE_START_OBJECT);
+
+  const size_t start = cardano_json_reader_get_offset(reader) - 1U;
+
+  EXPECT_EQ(cardano_json_reader_skip(reader), CARDANO_SUCCESS);
+
+  const size_t end = cardano_json_reader_get_offset(reader);
+
+  // Assert
+  EXPECT_EQ(std::string(json + start, end - start), "{\"b\": [1, 2]}");
+  EXPECT_EQ(cardano_json_reader_get_offset(nullptr), 0U);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_skip, skipsNestedValues)
+{
+  // Arrange
+  const char*               json   = "{\"skip\": {\"a\": [1, {\"b\": 2}]}, \"keep\": 7}";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  uint64_t                  value  = 0U;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(token, CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME);
+
+  // Act
+  EXPECT_EQ(cardano_json_reader_skip(reader), CARDANO_SUCCESS);
+
+  // Assert
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(token, CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME);
+  EXPECT_STREQ(cardano_json_reader_get_string(reader, nullptr), "keep");
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+  EXPECT_EQ(value, 7U);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(token, CARDANO_JSON_TOKEN_TYPE_END_OBJECT);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_skip, returnsErrorIfGivenNull)
+{
+  EXPECT_EQ(cardano_json_reader_skip(nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+}
+
+TEST(cardano_json_reader_get_string, returnsUnescapedStrings)
+{
+  // Arrange
+  const char*               json   = "[\"a\\n\\\"b\\u00e9\"]";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  size_t                    size   = 0U;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_string(reader, &size), nullptr);
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act
+  const char* value = cardano_json_reader_get_string(reader, &size);
+
+  // Assert
+  EXPECT_STREQ(value, "a\n\"b\xC3\xA9");
+  EXPECT_EQ(size, 6U);
+  EXPECT_EQ(cardano_json_reader_get_string(nullptr, &size), nullptr);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_get_uint, readsNumbersAndNumericStrings)
+{
+  // Arrange
+  const char*               json   = "[18446744073709551615, \"42\", -1, 1.5, true, \"abc\", 18446744073709551616]";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  uint64_t                  value  = 0U;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+  EXPECT_EQ(value, UINT64_MAX);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+  EXPECT_EQ(value, 42U);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_NE(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_NE(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_uint(reader, &value), CARDANO_ERROR_JSON_TYPE_MISMATCH);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_NE(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_NE(cardano_json_reader_get_uint(reader, &value), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_json_reader_get_uint(reader, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_json_reader_get_uint(nullptr, &value), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_get_signed_int, readsNumbersAndNumericStrings)
+{
+  // Arrange
+  const char*               json   = "[-9223372036854775808, \"-42\", 9223372036854775808, null]";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  int64_t                   value  = 0;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_signed_int(reader, &value), CARDANO_SUCCESS);
+  EXPECT_EQ(value, INT64_MIN);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_signed_int(reader, &value), CARDANO_SUCCESS);
+  EXPECT_EQ(value, -42);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_NE(cardano_json_reader_get_signed_int(reader, &value), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_signed_int(reader, &value), CARDANO_ERROR_JSON_TYPE_MISMATCH);
+
+  EXPECT_EQ(cardano_json_reader_get_signed_int(nullptr, &value), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_get_double, readsRealNumbers)
+{
+  // Arrange
+  const char*               json   = "[-2.5e3, 7, \"x\"]";
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, strlen(json));
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  double                    value  = 0.0;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_TRUE(cardano_json_reader_get_is_real_number(reader));
+  EXPECT_EQ(cardano_json_reader_get_double(reader, &value), CARDANO_SUCCESS);
+  EXPECT_DOUBLE_EQ(value, -2500.0);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_FALSE(cardano_json_reader_get_is_real_number(reader));
+  EXPECT_EQ(cardano_json_reader_get_double(reader, &value), CARDANO_SUCCESS);
+  EXPECT_DOUBLE_EQ(value, 7.0);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_double(reader, &value), CARDANO_ERROR_JSON_TYPE_MISMATCH);
+
+  EXPECT_EQ(cardano_json_reader_get_double(nullptr, &value), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_FALSE(cardano_json_reader_get_is_real_number(nullptr));
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_get_boolean, readsBooleans)
+{
+  // Arrange
+  cardano_json_reader_t*    reader = cardano_json_reader_new("[false, 1]", 10);
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+  bool                      value  = true;
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_boolean(reader, &value), CARDANO_SUCCESS);
+  EXPECT_FALSE(value);
+
+  EXPECT_EQ(cardano_json_reader_read(reader, &token), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_reader_get_boolean(reader, &value), CARDANO_ERROR_JSON_TYPE_MISMATCH);
+
+  EXPECT_EQ(cardano_json_reader_get_boolean(nullptr, &value), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_get_token_type, returnsNoneIfGivenNull)
+{
+  EXPECT_EQ(cardano_json_reader_get_token_type(nullptr), CARDANO_JSON_TOKEN_TYPE_NONE);
+}
+
+TEST(cardano_json_reader_ref, increasesTheReferenceCount)
+{
+  // Arrange
+  cardano_json_reader_t* reader = cardano_json_reader_new("{}", 2);
+
+  // Act
+  cardano_json_reader_ref(reader);
+
+  // Assert
+  EXPECT_EQ(cardano_json_reader_refcount(reader), 2);
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+  cardano_json_reader_unref(&reader);
+}
+
+TEST(cardano_json_reader_ref, doesntCrashIfGivenANullPtr)
+{
+  cardano_json_reader_ref(nullptr);
+}
+
+TEST(cardano_json_reader_unref, doesntCrashIfGivenANullPtr)
+{
+  cardano_json_reader_t* reader = nullptr;
+
+  cardano_json_reader_unref(&reader);
+  cardano_json_reader_unref((cardano_json_reader_t**)nullptr);
+}
+
+TEST(cardano_json_reader_refcount, returnsZeroIfGivenANullPtr)
+{
+  EXPECT_EQ(cardano_json_reader_refcount(nullptr), 0);
+}
+
+TEST(cardano_json_reader_set_last_error, doesNothingWhenObjectIsNull)
+{
+  // Arrange
+  cardano_json_reader_t* reader = nullptr;
+
+  // Act
+  cardano_json_reader_set_last_error(reader, "Test message");
+
+  // Assert
+  EXPECT_STREQ(cardano_json_reader_get_last_error(reader), "Object is NULL.");
+}
+
+TEST(cardano_json_reader_set_last_error, doesNothingWhenWhenMessageIsNull)
+{
+  // Arrange
+  cardano_json_reader_t* reader = cardano_json_reader_new("{}", 2);
+
+  // Act
+  cardano_json_reader_set_last_error(reader, nullptr);
+
+  // Assert
+  EXPECT_STREQ(cardano_json_reader_get_last_error(reader), "");
+
+  // Cleanup
+  cardano_json_reader_unref(&reader);
+}
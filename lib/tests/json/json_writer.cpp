@@ -32,6 +32,8 @@
 #include "../src/allocators.h"
 
 #include <gmock/gmock.h>
+#include <string>
+#include <vector>
 
 extern "C" {
 #include "../src/json/internals/json_writer_common.h"
@@ -2598,4 +2600,179 @@ TEST(cardano_json_writer_write_buffer_as_bech32, canWriteEmptyBufferAsBech32)
   free(json_str);
   cardano_json_writer_unref(&json);
   cardano_buffer_unref(&buffer);
-}
\ No newline at end of file
+}
+static cardano_error_t
+collect_chunks(void* context, const byte_t* data, const size_t size)
+{
+  std::vector<std::string>* chunks = static_cast<std::vector<std::string>*>(context);
+
+  chunks->emplace_back(reinterpret_cast<const char*>(data), size);
+
+  return CARDANO_SUCCESS;
+}
+
+static cardano_error_t
+reject_chunks(void* context, const byte_t* data, const size_t size)
+{
+  CARDANO_UNUSED(context);
+  CARDANO_UNUSED(data);
+  CARDANO_UNUSED(size);
+
+  return CARDANO_ERROR_ENCODING;
+}
+
+TEST(cardano_json_writer_new_with_sink, returnsNullIfSinkIsNullOrThresholdIsZero)
+{
+  // Arrange
+  std::vector<std::string> chunks;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, nullptr, &chunks, 16U), nullptr);
+  EXPECT_EQ(cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, collect_chunks, &chunks, 0U), nullptr);
+}
+
+TEST(cardano_json_writer_new_with_sink, returnsNullIfMemoryAllocationFails)
+{
+  // Arrange
+  std::vector<std::string> chunks;
+
+  for (int i = 0; i < 3; ++i)
+  {
+    reset_allocators_run_count();
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+    set_malloc_limit(i);
+
+    // Act & Assert
+    EXPECT_EQ(cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, collect_chunks, &chunks, 16U), nullptr);
+  }
+
+  cardano_set_allocators(malloc, realloc, free);
+}
+
+TEST(cardano_json_writer_new_with_sink, streamsOutputInBoundedChunks)
+{
+  // Arrange
+  std::vector<std::string> chunks;
+  cardano_json_writer_t*   writer = cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, collect_chunks, &chunks, 16U);
+  cardano_json_writer_t*   plain  = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  // Act
+  for (cardano_json_writer_t* target : { writer, plain })
+  {
+    cardano_json_writer_write_start_array(target);
+
+    for (uint64_t i = 0U; i < 100U; ++i)
+    {
+      cardano_json_writer_write_start_object(target);
+      cardano_json_writer_write_property_name(target, "index", 5);
+      cardano_json_writer_write_uint(target, i);
+      cardano_json_writer_write_end_object(target);
+    }
+
+    cardano_json_writer_write_raw_value(target, "\"a raw value longer than the threshold\"", 39);
+    cardano_json_writer_write_end_array(target);
+  }
+
+  EXPECT_EQ(cardano_json_writer_flush(writer), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_json_writer_flush(plain), CARDANO_SUCCESS);
+
+  // Assert
+  const size_t expected_size = cardano_json_writer_get_encoded_size(plain);
+  char*        expected      = (char*)malloc(expected_size);
+
+  EXPECT_EQ(cardano_json_writer_encode(plain, expected, expected_size), CARDANO_SUCCESS);
+
+  std::string streamed;
+
+  for (const std::string& chunk : chunks)
+  {
+    if (chunk.size() >= 32U)
+    {
+      EXPECT_EQ(chunk, "\"a raw value longer than the threshold\"");
+    }
+
+    streamed += chunk;
+  }
+
+  EXPECT_GT(chunks.size(), 1U);
+  EXPECT_EQ(streamed, std::string(expected));
+  EXPECT_EQ(cardano_json_writer_get_encoded_size(writer), expected_size);
+
+  // Cleanup
+  cardano_json_writer_unref(&writer);
+  cardano_json_writer_unref(&plain);
+  free(expected);
+}
+
+TEST(cardano_json_writer_new_with_sink, cannotBeEncoded)
+{
+  // Arrange
+  std::vector<std::string> chunks;
+  cardano_json_writer_t*   writer = cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, collect_chunks, &chunks, 16U);
+  cardano_buffer_t*        buffer = nullptr;
+  char                     data[16];
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_end_object(writer);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_json_writer_encode(writer, data, sizeof(data)), CARDANO_ERROR_ILLEGAL_STATE);
+  EXPECT_EQ(cardano_json_writer_encode_in_buffer(writer, &buffer), CARDANO_ERROR_ILLEGAL_STATE);
+  EXPECT_EQ(buffer, nullptr);
+  EXPECT_TRUE(chunks.empty());
+
+  EXPECT_EQ(cardano_json_writer_flush(writer), CARDANO_SUCCESS);
+  ASSERT_EQ(chunks.size(), 1U);
+  EXPECT_EQ(chunks[0], "{}");
+
+  // Cleanup
+  cardano_json_writer_unref(&writer);
+}
+
+TEST(cardano_json_writer_new_with_sink, recordsSinkErrors)
+{
+  // Arrange
+  cardano_json_writer_t* writer = cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, reject_chunks, nullptr, 4U);
+
+  // Act
+  cardano_json_writer_write_start_array(writer);
+  cardano_json_writer_write_string(writer, "value", 5);
+  cardano_json_writer_write_end_array(writer);
+
+  // Assert
+  EXPECT_EQ(cardano_json_writer_flush(writer), CARDANO_ERROR_ENCODING);
+  EXPECT_EQ(cardano_json_writer_get_encoded_size(writer), 0U);
+
+  // Cleanup
+  cardano_json_writer_unref(&writer);
+}
+
+TEST(cardano_json_writer_reset, keepsSink)
+{
+  // Arrange
+  std::vector<std::string> chunks;
+  cardano_json_writer_t*   writer = cardano_json_writer_new_with_sink(CARDANO_JSON_FORMAT_COMPACT, collect_chunks, &chunks, 16U);
+
+  cardano_json_writer_write_uint(writer, 1U);
+  EXPECT_EQ(cardano_json_writer_flush(writer), CARDANO_SUCCESS);
+
+  // Act
+  EXPECT_EQ(cardano_json_writer_reset(writer), CARDANO_SUCCESS);
+
+  cardano_json_writer_write_uint(writer, 2U);
+  EXPECT_EQ(cardano_json_writer_flush(writer), CARDANO_SUCCESS);
+
+  // Assert
+  ASSERT_EQ(chunks.size(), 2U);
+  EXPECT_EQ(chunks[1], "2");
+  EXPECT_EQ(cardano_json_writer_get_encoded_size(writer), 2U);
+
+  // Cleanup
+  cardano_json_writer_unref(&writer);
+}
+
+TEST(cardano_json_writer_flush, returnsErrorIfWriterIsNull)
+{
+  // Act & Assert
+  EXPECT_EQ(cardano_json_writer_flush(nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+}
@@ -33,6 +33,7 @@
 #include <cardano/key_handlers/derivation_path.h>
 #include <cardano/key_handlers/secure_key_handler_type.h>
 #include <cardano/object.h>
+#include <cardano/witness_set/vkey_witness_set.h>
 #include <gmock/gmock.h>
 
 /* DECLARATIONS **************************************************************/
@@ -388,6 +389,180 @@ TEST(cardano_secure_key_handler_bip32_sign_transaction, returnsSuccessIfBip32Sig
   cardano_secure_key_handler_unref(&secure_key_handler);
 }
 
+TEST(cardano_secure_key_handler_bip32_sign_transactions, returnsErrorIfGivenANullPtr)
+{
+  // Arrange
+  cardano_secure_key_handler_t*   secure_key_handler = nullptr;
+  cardano_bip32_signing_request_t request            = { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 };
+  cardano_vkey_witness_set_t*     witness_sets[1]    = { nullptr };
+
+  cardano_error_t error = cardano_secure_key_handler_new(cardano_secure_key_handler_impl_new(), &secure_key_handler);
+
+  ASSERT_EQ(error, CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_secure_key_handler_bip32_sign_transactions(nullptr, &request, 1, witness_sets), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, nullptr, 1, witness_sets), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, &request, 1, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  request.tx = nullptr;
+  EXPECT_EQ(cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, &request, 1, witness_sets), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_secure_key_handler_unref(&secure_key_handler);
+}
+
+TEST(cardano_secure_key_handler_bip32_sign_transactions, returnsErrorIfBip32SigningIsNotImplemented)
+{
+  // Arrange
+  cardano_secure_key_handler_t*   secure_key_handler = nullptr;
+  cardano_bip32_signing_request_t request            = { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 };
+  cardano_vkey_witness_set_t*     witness_sets[1]    = { nullptr };
+
+  cardano_error_t error = cardano_secure_key_handler_new(cardano_empty_secure_key_handler_impl_new(), &secure_key_handler);
+
+  ASSERT_EQ(error, CARDANO_SUCCESS);
+
+  // Act
+  error = cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, &request, 1, witness_sets);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_NOT_IMPLEMENTED);
+
+  // Cleanup
+  cardano_secure_key_handler_unref(&secure_key_handler);
+}
+
+TEST(cardano_secure_key_handler_bip32_sign_transactions, signsOneTransactionAtATimeIfBatchingIsNotImplemented)
+{
+  // Arrange
+  static size_t                     calls = 0U;
+  cardano_secure_key_handler_impl_t impl  = cardano_secure_key_handler_impl_new();
+
+  impl.bip32_sign_transaction = [](
+                                  cardano_secure_key_handler_impl_t*,
+                                  cardano_transaction_t*,
+                                  const cardano_derivation_path_t*,
+                                  size_t,
+                                  cardano_vkey_witness_set_t** vkey_witness_set) -> cardano_error_t
+  {
+    ++calls;
+
+    return cardano_vkey_witness_set_new(vkey_witness_set);
+  };
+
+  cardano_secure_key_handler_t*   secure_key_handler = nullptr;
+  cardano_bip32_signing_request_t requests[3]        = {
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 },
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 },
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 }
+  };
+  cardano_vkey_witness_set_t* witness_sets[3] = { nullptr, nullptr, nullptr };
+
+  cardano_error_t error = cardano_secure_key_handler_new(impl, &secure_key_handler);
+
+  ASSERT_EQ(error, CARDANO_SUCCESS);
+
+  // Act
+  error = cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, requests, 3, witness_sets);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(calls, 3U);
+
+  for (cardano_vkey_witness_set_t*& witness_set: witness_sets)
+  {
+    EXPECT_NE(witness_set, nullptr);
+    cardano_vkey_witness_set_unref(&witness_set);
+  }
+
+  // Cleanup
+  cardano_secure_key_handler_unref(&secure_key_handler);
+}
+
+TEST(cardano_secure_key_handler_bip32_sign_transactions, releasesEveryWitnessSetIfOneTransactionFails)
+{
+  // Arrange
+  static size_t                     calls = 0U;
+  cardano_secure_key_handler_impl_t impl  = cardano_secure_key_handler_impl_new();
+
+  impl.bip32_sign_transaction = [](
+                                  cardano_secure_key_handler_impl_t*,
+                                  cardano_transaction_t*,
+                                  const cardano_derivation_path_t*,
+                                  size_t,
+                                  cardano_vkey_witness_set_t** vkey_witness_set) -> cardano_error_t
+  {
+    ++calls;
+
+    return (calls == 2U) ? CARDANO_ERROR_GENERIC : cardano_vkey_witness_set_new(vkey_witness_set);
+  };
+
+  cardano_secure_key_handler_t*   secure_key_handler = nullptr;
+  cardano_bip32_signing_request_t requests[3]        = {
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 },
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 },
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 }
+  };
+  cardano_vkey_witness_set_t* witness_sets[3] = { nullptr, nullptr, nullptr };
+
+  cardano_error_t error = cardano_secure_key_handler_new(impl, &secure_key_handler);
+
+  ASSERT_EQ(error, CARDANO_SUCCESS);
+
+  // Act
+  error = cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, requests, 3, witness_sets);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_GENERIC);
+  EXPECT_EQ(calls, 2U);
+  EXPECT_EQ(witness_sets[0], nullptr);
+  EXPECT_EQ(witness_sets[1], nullptr);
+  EXPECT_EQ(witness_sets[2], nullptr);
+
+  // Cleanup
+  cardano_secure_key_handler_unref(&secure_key_handler);
+}
+
+TEST(cardano_secure_key_handler_bip32_sign_transactions, usesTheBatchCallbackIfImplemented)
+{
+  // Arrange
+  static size_t                     batch_size = 0U;
+  cardano_secure_key_handler_impl_t impl       = cardano_secure_key_handler_impl_new();
+
+  impl.bip32_sign_transactions = [](
+                                   cardano_secure_key_handler_impl_t*,
+                                   const cardano_bip32_signing_request_t*,
+                                   size_t num_requests,
+                                   cardano_vkey_witness_set_t**) -> cardano_error_t
+  {
+    batch_size = num_requests;
+
+    return CARDANO_SUCCESS;
+  };
+
+  cardano_secure_key_handler_t*   secure_key_handler = nullptr;
+  cardano_bip32_signing_request_t requests[2]        = {
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 },
+    { (cardano_transaction_t*)"", (cardano_derivation_path_t*)"", 0 }
+  };
+  cardano_vkey_witness_set_t* witness_sets[2] = { nullptr, nullptr };
+
+  cardano_error_t error = cardano_secure_key_handler_new(impl, &secure_key_handler);
+
+  ASSERT_EQ(error, CARDANO_SUCCESS);
+
+  // Act
+  error = cardano_secure_key_handler_bip32_sign_transactions(secure_key_handler, requests, 2, witness_sets);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(batch_size, 2U);
+
+  // Cleanup
+  cardano_secure_key_handler_unref(&secure_key_handler);
+}
+
 TEST(cardano_secure_key_handler_bip32_get_extended_account_public_key, returnsErrorIfGivenANullPtr)
 {
   // Arrange
@@ -1555,3 +1555,205 @@ TEST(cardano_software_secure_key_handler_bip32_sign_transaction, returnsErrorOnM
   cardano_transaction_unref(&transaction);
   cardano_secure_key_handler_unref(&key_handler);
 }
+
+TEST(cardano_software_secure_key_handler_bip32_sign_transactions, signsEveryTransactionWithASinglePassphraseRequest)
+{
+  // Arrange
+  static size_t          passphrase_requests = 0U;
+  cardano_transaction_t* transaction         = nullptr;
+  cardano_cbor_reader_t* reader              = cardano_cbor_reader_from_hex(TX_CBOR, strlen(TX_CBOR));
+
+  cardano_error_t error = cardano_transaction_from_cbor(reader, &transaction);
+
+  cardano_cbor_reader_unref(&reader);
+
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  cardano_secure_key_handler_t* key_handler = nullptr;
+
+  byte_t entropy_bytes[1024];
+  from_hex_to_buffer(ENTROPY_BYTES, entropy_bytes, strlen(ENTROPY_BYTES) / 2);
+
+  error = cardano_software_secure_key_handler_new(
+    entropy_bytes,
+    strlen(ENTROPY_BYTES) / 2,
+    (const byte_t*)&PASSWORD[0],
+    strlen(PASSWORD),
+    [](byte_t* buffer, const size_t buffer_len) -> int32_t
+    {
+      ++passphrase_requests;
+
+      return get_passphrase(buffer, buffer_len);
+    },
+    &key_handler);
+
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  cardano_derivation_path_t path[] = {
+    { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0U, 0U, 0U },
+    { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0U, 2U, 0U },
+    { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0U, 3U, 0U },
+    { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0U, 4U, 0U }
+  };
+
+  cardano_bip32_signing_request_t requests[] = {
+    { transaction, &path[0], 4 },
+    { transaction, &path[0], 1 },
+    { transaction, &path[0], 4 }
+  };
+
+  cardano_vkey_witness_set_t* witness_sets[3] = { nullptr, nullptr, nullptr };
+
+  // Act
+  error = cardano_secure_key_handler_bip32_sign_transactions(key_handler, requests, 3, witness_sets);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(passphrase_requests, 1U);
+
+  for (size_t set = 0; set < 3; ++set)
+  {
+    EXPECT_EQ(cardano_vkey_witness_set_get_length(witness_sets[set]), requests[set].num_paths);
+
+    for (size_t i = 0; i < requests[set].num_paths; ++i)
+    {
+      cardano_vkey_witness_t* witness = NULL;
+
+      error = cardano_vkey_witness_set_get(witness_sets[set], i, &witness);
+
+      EXPECT_EQ(error, CARDANO_SUCCESS);
+
+      cardano_ed25519_signature_t*  signature = cardano_vkey_witness_get_signature(witness);
+      cardano_ed25519_public_key_t* key       = cardano_vkey_witness_get_vkey(witness);
+
+      char sig_hex[1024];
+      char key_hex[1024];
+
+      EXPECT_EQ(cardano_ed25519_signature_to_hex(signature, sig_hex, cardano_ed25519_signature_get_hex_size(signature)), CARDANO_SUCCESS);
+      EXPECT_EQ(cardano_ed25519_public_key_to_hex(key, key_hex, cardano_ed25519_public_key_get_hex_size(key)), CARDANO_SUCCESS);
+
+      EXPECT_STREQ(sig_hex, VK_WITNESS_SIGNATURES[i]);
+      EXPECT_STREQ(key_hex, VK_WITNESS_KEYS[i]);
+
+      cardano_vkey_witness_unref(&witness);
+      cardano_ed25519_signature_unref(&signature);
+      cardano_ed25519_public_key_unref(&key);
+    }
+
+    cardano_vkey_witness_set_unref(&witness_sets[set]);
+  }
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+  cardano_secure_key_handler_unref(&key_handler);
+}
+
+TEST(cardano_software_secure_key_handler_bip32_sign_transactions, failsWithInvalidPassword)
+{
+  // Arrange
+  cardano_transaction_t* transaction = nullptr;
+  cardano_cbor_reader_t* reader      = cardano_cbor_reader_from_hex(TX_CBOR, strlen(TX_CBOR));
+
+  cardano_error_t error = cardano_transaction_from_cbor(reader, &transaction);
+
+  cardano_cbor_reader_unref(&reader);
+
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  cardano_secure_key_handler_t* key_handler = nullptr;
+
+  byte_t entropy_bytes[1024];
+  from_hex_to_buffer(ENTROPY_BYTES, entropy_bytes, strlen(ENTROPY_BYTES) / 2);
+
+  error = cardano_software_secure_key_handler_new(
+    entropy_bytes,
+    strlen(ENTROPY_BYTES) / 2,
+    (const byte_t*)&PASSWORD[0],
+    strlen(PASSWORD),
+    &get_invalid_passphrase,
+    &key_handler);
+
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  cardano_derivation_path_t       path        = { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0U, 0U, 0U };
+  cardano_bip32_signing_request_t requests[]  = { { transaction, &path, 1 }, { transaction, &path, 1 } };
+  cardano_vkey_witness_set_t*     witnesses[] = { nullptr, nullptr };
+
+  // Act
+  error = cardano_secure_key_handler_bip32_sign_transactions(key_handler, requests, 2, witnesses);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_INVALID_PASSPHRASE);
+  EXPECT_EQ(witnesses[0], nullptr);
+  EXPECT_EQ(witnesses[1], nullptr);
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+  cardano_secure_key_handler_unref(&key_handler);
+}
+
+TEST(cardano_software_secure_key_handler_bip32_sign_transactions, returnsErrorOnMemoryAllocationFail)
+{
+  // Arrange
+  cardano_transaction_t* transaction = nullptr;
+  cardano_cbor_reader_t* reader      = cardano_cbor_reader_from_hex(TX_CBOR, strlen(TX_CBOR));
+
+  cardano_error_t error = cardano_transaction_from_cbor(reader, &transaction);
+
+  cardano_cbor_reader_unref(&reader);
+
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  cardano_secure_key_handler_t* key_handler = nullptr;
+
+  byte_t entropy_bytes[1024];
+  from_hex_to_buffer(ENTROPY_BYTES, entropy_bytes, strlen(ENTROPY_BYTES) / 2);
+
+  error = cardano_software_secure_key_handler_new(
+    entropy_bytes,
+    strlen(ENTROPY_BYTES) / 2,
+    (const byte_t*)&PASSWORD[0],
+    strlen(PASSWORD),
+    &get_passphrase,
+    &key_handler);
+
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+
+  cardano_derivation_path_t       path        = { CARDANO_CIP_1852_PURPOSE_STANDARD, CARDANO_CIP_1852_COIN_TYPE, 0U, 0U, 0U };
+  cardano_bip32_signing_request_t requests[]  = { { transaction, &path, 1 }, { transaction, &path, 1 } };
+  cardano_vkey_witness_set_t*     witnesses[] = { nullptr, nullptr };
+
+  int limit = 0;
+
+  for (; limit < 500; ++limit)
+  {
+    reset_allocators_run_count();
+    set_malloc_limit(limit);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    error = cardano_secure_key_handler_bip32_sign_transactions(key_handler, requests, 2, witnesses);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    if (error == CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    EXPECT_EQ(witnesses[0], nullptr);
+    EXPECT_EQ(witnesses[1], nullptr);
+  }
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_GT(limit, 0);
+
+  // Cleanup
+  reset_allocators_run_count();
+  reset_limited_malloc();
+
+  cardano_vkey_witness_set_unref(&witnesses[0]);
+  cardano_vkey_witness_set_unref(&witnesses[1]);
+  cardano_transaction_unref(&transaction);
+  cardano_secure_key_handler_unref(&key_handler);
+}
@@ -24,10 +24,15 @@
 /* INCLUDES ******************************************************************/
 
 #include "../src/allocators.h"
+#include "../src/config.h"
 #include <cardano/object.h>
 
 #include <gmock/gmock.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 /* DECLARATIONS **************************************************************/
 
 /**
@@ -257,3 +262,90 @@ TEST(cardano_object_set_last_error, doesNothingWhenWhenMessageIsNull)
   // Cleanup
   cardano_object_unref(&object);
 }
+
+#if LIB_CARDANO_C_ATOMIC_REFCOUNT
+
+static std::atomic<int> s_deallocations { 0 };
+
+/**
+ * \brief Deallocator that counts how many times it runs before freeing the object.
+ *
+ * \param data The object to free.
+ */
+static void
+counting_free(void* data)
+{
+  s_deallocations.fetch_add(1);
+  _cardano_free(data);
+}
+
+TEST(cardano_object_ref, isAtomicWhenSharedBetweenThreads)
+{
+  // Arrange
+  cardano_object_t*        object = cardano_object_new(_cardano_free);
+  std::vector<std::thread> workers;
+
+  // Act
+  for (int i = 0; i < 8; ++i)
+  {
+    workers.emplace_back([object]()
+    {
+      for (int j = 0; j < 100000; ++j)
+      {
+        cardano_object_t* reference = object;
+
+        cardano_object_ref(reference);
+        cardano_object_unref(&reference);
+      }
+    });
+  }
+
+  for (std::thread& worker: workers)
+  {
+    worker.join();
+  }
+
+  // Assert
+  EXPECT_EQ(cardano_object_refcount(object), 1);
+
+  // Cleanup
+  cardano_object_unref(&object);
+}
+
+TEST(cardano_object_unref, deallocatesOnceWhenTheLastReferencesAreReleasedConcurrently)
+{
+  for (int round = 0; round < 100; ++round)
+  {
+    // Arrange
+    cardano_object_t*        object = cardano_object_new(counting_free);
+    std::vector<std::thread> workers;
+
+    s_deallocations.store(0);
+
+    for (int i = 1; i < 8; ++i)
+    {
+      cardano_object_ref(object);
+    }
+
+    // Act
+    for (int i = 0; i < 8; ++i)
+    {
+      workers.emplace_back([object]()
+      {
+        cardano_object_t* reference = object;
+
+        cardano_object_unref(&reference);
+      });
+    }
+
+    for (std::thread& worker: workers)
+    {
+      worker.join();
+    }
+
+    // Assert
+    EXPECT_EQ(s_deallocations.load(), 1);
+  }
+}
+
+#endif
@@ -26,6 +26,7 @@
 
 #include "../allocators_helpers.h"
 
+#include <allocators.h>
 #include <gmock/gmock.h>
 
 /* CONSTANTS *****************************************************************/
@@ -343,6 +344,66 @@ TEST(cardano_protocol_parameters_refcount, returnsZeroIfGivenANullPtr)
   EXPECT_EQ(ref_count, 0);
 }
 
+TEST(cardano_protocol_parameters_clone, returnsNullIfGivenANullPtr)
+{
+  // Act
+  cardano_protocol_parameters_t* clone = cardano_protocol_parameters_clone(nullptr);
+
+  // Assert
+  EXPECT_EQ(clone, nullptr);
+}
+
+TEST(cardano_protocol_parameters_clone, returnsNullIfMemoryAllocationFails)
+{
+  // Arrange
+  cardano_protocol_parameters_t* protocol_parameters = init_protocol_parameters();
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act
+  cardano_protocol_parameters_t* clone = cardano_protocol_parameters_clone(protocol_parameters);
+
+  // Assert
+  EXPECT_EQ(clone, nullptr);
+
+  // Cleanup
+  cardano_set_allocators(malloc, realloc, free);
+  cardano_protocol_parameters_unref(&protocol_parameters);
+}
+
+TEST(cardano_protocol_parameters_clone, copiesTheValuesAndSharesTheNestedObjects)
+{
+  // Arrange
+  cardano_protocol_parameters_t* protocol_parameters = init_protocol_parameters();
+
+  EXPECT_EQ(cardano_protocol_parameters_set_min_fee_a(protocol_parameters, 44U), CARDANO_SUCCESS);
+
+  // Act
+  cardano_protocol_parameters_t* clone = cardano_protocol_parameters_clone(protocol_parameters);
+
+  // Assert
+  ASSERT_NE(clone, nullptr);
+  EXPECT_NE(clone, protocol_parameters);
+  EXPECT_EQ(cardano_protocol_parameters_refcount(clone), 1U);
+  EXPECT_EQ(cardano_protocol_parameters_get_min_fee_a(clone), 44U);
+
+  cardano_costmdls_t* original_models = cardano_protocol_parameters_get_cost_models(protocol_parameters);
+  cardano_costmdls_t* cloned_models   = cardano_protocol_parameters_get_cost_models(clone);
+
+  EXPECT_EQ(original_models, cloned_models);
+
+  cardano_costmdls_unref(&original_models);
+  cardano_costmdls_unref(&cloned_models);
+
+  EXPECT_EQ(cardano_protocol_parameters_set_min_fee_a(clone, 55U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_get_min_fee_a(protocol_parameters), 44U);
+
+  // Cleanup
+  cardano_protocol_parameters_unref(&protocol_parameters);
+  cardano_protocol_parameters_unref(&clone);
+}
+
 TEST(cardano_protocol_parameters_set_last_error, doesNothingWhenObjectIsNull)
 {
   // Arrange
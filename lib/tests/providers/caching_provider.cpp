@@ -0,0 +1,756 @@
+/**
+ * \file caching_provider.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../allocators_helpers.h"
+#include "../src/allocators.h"
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/plutus_data/plutus_list.h>
+#include <cardano/providers/caching_provider.h>
+#include <cardano/slot_config.h>
+#include <cardano/transaction_body/transaction_body.h>
+#include <cardano/transaction_body/transaction_output_list.h>
+#include <cardano/witness_set/witness_set.h>
+#include <gmock/gmock.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const char* ADDRESS = "addr_test1qqydn46r6mhge0kfpqmt36m6q43knzsd9ga32n96m89px3nuzcjqw982pcftgx53fu5527z2cj2tkx2h8ux2vxsg475qypp3m9";
+static const char* TX_ID   = "bb217abaca60fc0ca68c1555eca6a96d2478547818ae76ce6836133f3cc546e0";
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Backend calls observed by the stub provider.
+ */
+typedef struct stub_calls_t
+{
+    size_t parameters;
+    size_t unspent_outputs;
+    size_t resolve;
+    size_t last_batch;
+    size_t datum;
+    size_t submit;
+} stub_calls_t;
+
+static stub_calls_t stub_calls = {};
+static uint64_t     fake_now   = 0U;
+
+/**
+ * \brief Reads the fake clock the tests advance by hand.
+ */
+static uint64_t
+fake_clock(void*)
+{
+  return fake_now;
+}
+
+static cardano_transaction_input_t*
+make_input(const uint64_t index)
+{
+  cardano_blake2b_hash_t*      id    = NULL;
+  cardano_transaction_input_t* input = NULL;
+
+  EXPECT_EQ(cardano_blake2b_hash_from_hex(TX_ID, strlen(TX_ID), &id), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_transaction_input_new(id, index, &input), CARDANO_SUCCESS);
+
+  cardano_blake2b_hash_unref(&id);
+
+  return input;
+}
+
+static cardano_utxo_t*
+make_utxo(cardano_transaction_input_t* input)
+{
+  cardano_address_t*            address = NULL;
+  cardano_transaction_output_t* output  = NULL;
+  cardano_utxo_t*               utxo    = NULL;
+
+  EXPECT_EQ(cardano_address_from_string(ADDRESS, strlen(ADDRESS), &address), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_transaction_output_new(address, 1000000U + cardano_transaction_input_get_index(input), &output), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_utxo_new(input, output, &utxo), CARDANO_SUCCESS);
+
+  cardano_transaction_output_unref(&output);
+  cardano_address_unref(&address);
+
+  return utxo;
+}
+
+static cardano_transaction_input_set_t*
+make_input_set(const std::vector<uint64_t>& indices)
+{
+  cardano_transaction_input_set_t* set = NULL;
+
+  EXPECT_EQ(cardano_transaction_input_set_new(&set), CARDANO_SUCCESS);
+
+  for (const uint64_t index: indices)
+  {
+    cardano_transaction_input_t* input = make_input(index);
+
+    EXPECT_EQ(cardano_transaction_input_set_add(set, input), CARDANO_SUCCESS);
+
+    cardano_transaction_input_unref(&input);
+  }
+
+  return set;
+}
+
+/**
+ * \brief Creates an in-process stub backend that counts its calls.
+ *
+ * It owns the outputs TX_ID#0 and TX_ID#1, resolves any input except index 99, returns resolved
+ * outputs in reverse order, answers datum lookups with the list [42], and fails them for a hash
+ * starting with 0xff.
+ */
+static cardano_provider_t*
+make_stub_provider(const cardano_network_magic_t magic)
+{
+  cardano_provider_impl_t impl = {};
+
+  CARDANO_UNUSED(memcpy(impl.name, "Stub", 5));
+
+  impl.network_magic = magic;
+
+  impl.get_parameters = [](cardano_provider_impl_t*, cardano_protocol_parameters_t** parameters) -> cardano_error_t
+  {
+    ++stub_calls.parameters;
+
+    return cardano_protocol_parameters_new(parameters);
+  };
+
+  impl.get_unspent_outputs = [](cardano_provider_impl_t*, cardano_address_t*, cardano_utxo_list_t** utxo_list) -> cardano_error_t
+  {
+    ++stub_calls.unspent_outputs;
+
+    EXPECT_EQ(cardano_utxo_list_new(utxo_list), CARDANO_SUCCESS);
+
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+      cardano_transaction_input_t* input = make_input(i);
+      cardano_utxo_t*              utxo  = make_utxo(input);
+
+      EXPECT_EQ(cardano_utxo_list_add(*utxo_list, utxo), CARDANO_SUCCESS);
+
+      cardano_utxo_unref(&utxo);
+      cardano_transaction_input_unref(&input);
+    }
+
+    return CARDANO_SUCCESS;
+  };
+
+  impl.resolve_unspent_outputs = [](cardano_provider_impl_t*, cardano_transaction_input_set_t* tx_ins, cardano_utxo_list_t** utxo_list) -> cardano_error_t
+  {
+    ++stub_calls.resolve;
+
+    const size_t length   = cardano_transaction_input_set_get_length(tx_ins);
+    stub_calls.last_batch = length;
+
+    EXPECT_EQ(cardano_utxo_list_new(utxo_list), CARDANO_SUCCESS);
+
+    for (size_t i = length; i > 0U; --i)
+    {
+      cardano_transaction_input_t* input = NULL;
+
+      EXPECT_EQ(cardano_transaction_input_set_get(tx_ins, i - 1U, &input), CARDANO_SUCCESS);
+
+      if (cardano_transaction_input_get_index(input) != 99U)
+      {
+        cardano_utxo_t* utxo = make_utxo(input);
+
+        EXPECT_EQ(cardano_utxo_list_add(*utxo_list, utxo), CARDANO_SUCCESS);
+
+        cardano_utxo_unref(&utxo);
+      }
+
+      cardano_transaction_input_unref(&input);
+    }
+
+    return CARDANO_SUCCESS;
+  };
+
+  impl.resolve_datum = [](cardano_provider_impl_t* self, cardano_blake2b_hash_t* hash, cardano_plutus_data_t** datum) -> cardano_error_t
+  {
+    ++stub_calls.datum;
+
+    if (cardano_blake2b_hash_get_data(hash)[0] == 0xffU)
+    {
+      CARDANO_UNUSED(memcpy(self->error_message, "Datum not found", 16));
+
+      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+    }
+
+    cardano_plutus_list_t* list    = NULL;
+    cardano_plutus_data_t* element = NULL;
+
+    EXPECT_EQ(cardano_plutus_list_new(&list), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_plutus_data_new_integer_from_int(42, &element), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_plutus_list_add(list, element), CARDANO_SUCCESS);
+
+    const cardano_error_t result = cardano_plutus_data_new_list(list, datum);
+
+    cardano_plutus_data_unref(&element);
+    cardano_plutus_list_unref(&list);
+
+    return result;
+  };
+
+  impl.post_transaction_to_chain = [](cardano_provider_impl_t*, cardano_transaction_t*, cardano_blake2b_hash_t** tx_id) -> cardano_error_t
+  {
+    ++stub_calls.submit;
+
+    return cardano_blake2b_hash_from_hex(TX_ID, strlen(TX_ID), tx_id);
+  };
+
+  impl.get_rewards_balance = [](cardano_provider_impl_t*, cardano_reward_address_t*, uint64_t* balance) -> cardano_error_t
+  {
+    *balance = 7U;
+
+    return CARDANO_SUCCESS;
+  };
+
+  cardano_provider_t* provider = NULL;
+
+  EXPECT_EQ(cardano_provider_new(impl, &provider), CARDANO_SUCCESS);
+
+  return provider;
+}
+
+static cardano_provider_t*
+make_caching_provider(const cardano_network_magic_t magic, cardano_caching_provider_options_t* options = NULL)
+{
+  stub_calls = {};
+  fake_now   = 1000U;
+
+  cardano_caching_provider_options_t defaults = cardano_caching_provider_options_default();
+
+  if (options == NULL)
+  {
+    options = &defaults;
+  }
+
+  options->clock = fake_clock;
+
+  cardano_provider_t* backend  = make_stub_provider(magic);
+  cardano_provider_t* provider = NULL;
+
+  EXPECT_EQ(cardano_caching_provider_new(backend, options, &provider), CARDANO_SUCCESS);
+
+  cardano_provider_unref(&backend);
+
+  return provider;
+}
+
+static cardano_transaction_t*
+make_transaction_spending(const std::vector<uint64_t>& indices)
+{
+  cardano_transaction_input_set_t*   inputs  = make_input_set(indices);
+  cardano_transaction_output_list_t* outputs = NULL;
+  cardano_transaction_body_t*        body    = NULL;
+  cardano_witness_set_t*             witness = NULL;
+  cardano_transaction_t*             tx      = NULL;
+
+  EXPECT_EQ(cardano_transaction_output_list_new(&outputs), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_transaction_body_new(inputs, outputs, 0U, NULL, &body), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_witness_set_new(&witness), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_transaction_new(body, witness, NULL, &tx), CARDANO_SUCCESS);
+
+  cardano_witness_set_unref(&witness);
+  cardano_transaction_body_unref(&body);
+  cardano_transaction_output_list_unref(&outputs);
+  cardano_transaction_input_set_unref(&inputs);
+
+  return tx;
+}
+
+static std::vector<uint64_t>
+resolve(cardano_provider_t* provider, const std::vector<uint64_t>& indices)
+{
+  cardano_transaction_input_set_t* set   = make_input_set(indices);
+  cardano_utxo_list_t*             utxos = NULL;
+  std::vector<uint64_t>            resolved;
+
+  EXPECT_EQ(cardano_provider_resolve_unspent_outputs(provider, set, &utxos), CARDANO_SUCCESS);
+
+  for (size_t i = 0U; i < cardano_utxo_list_get_length(utxos); ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+    EXPECT_EQ(cardano_utxo_list_get(utxos, i, &utxo), CARDANO_SUCCESS);
+
+    cardano_transaction_input_t* input = cardano_utxo_get_input(utxo);
+    resolved.push_back(cardano_transaction_input_get_index(input));
+
+    cardano_transaction_input_unref(&input);
+    cardano_utxo_unref(&utxo);
+  }
+
+  cardano_utxo_list_unref(&utxos);
+  cardano_transaction_input_set_unref(&set);
+
+  return resolved;
+}
+
+static size_t
+list_unspent_outputs(cardano_provider_t* provider)
+{
+  cardano_address_t*   address = NULL;
+  cardano_utxo_list_t* utxos   = NULL;
+
+  EXPECT_EQ(cardano_address_from_string(ADDRESS, strlen(ADDRESS), &address), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_provider_get_unspent_outputs(provider, address, &utxos), CARDANO_SUCCESS);
+
+  const size_t length = cardano_utxo_list_get_length(utxos);
+
+  cardano_utxo_list_unref(&utxos);
+  cardano_address_unref(&address);
+
+  return length;
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_caching_provider_new, returnsErrorIfGivenNull)
+{
+  cardano_provider_t* provider = NULL;
+  cardano_provider_t* backend  = make_stub_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  EXPECT_EQ(cardano_caching_provider_new(NULL, NULL, &provider), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_caching_provider_new(backend, NULL, NULL), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_provider_unref(&backend);
+}
+
+TEST(cardano_caching_provider_new, keepsBackendNetworkAndReleasesIt)
+{
+  cardano_provider_t* backend  = make_stub_provider(CARDANO_NETWORK_MAGIC_PREVIEW);
+  cardano_provider_t* provider = NULL;
+
+  ASSERT_EQ(cardano_caching_provider_new(backend, NULL, &provider), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_provider_get_network_magic(provider), CARDANO_NETWORK_MAGIC_PREVIEW);
+  EXPECT_STREQ(cardano_provider_get_name(provider), "Caching provider");
+  EXPECT_EQ(cardano_provider_refcount(backend), 2U);
+
+  cardano_provider_unref(&provider);
+
+  EXPECT_EQ(cardano_provider_refcount(backend), 1U);
+
+  cardano_provider_unref(&backend);
+}
+
+TEST(cardano_caching_provider_new, returnsErrorIfMemoryAllocationFails)
+{
+  cardano_provider_t* backend = make_stub_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  for (int i = 0; i < 2; ++i)
+  {
+    cardano_provider_t* provider = NULL;
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    EXPECT_EQ(cardano_caching_provider_new(backend, NULL, &provider), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+    EXPECT_EQ(provider, nullptr);
+
+    cardano_set_allocators(malloc, realloc, free);
+  }
+
+  EXPECT_EQ(cardano_provider_refcount(backend), 1U);
+
+  cardano_provider_unref(&backend);
+}
+
+TEST(cardano_caching_provider, cachesParametersUntilTheirTtl)
+{
+  cardano_caching_provider_options_t options = cardano_caching_provider_options_default();
+  options.parameters_ttl_ms                  = 5000U;
+
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_SANCHONET, &options);
+
+  cardano_protocol_parameters_t* first  = NULL;
+  cardano_protocol_parameters_t* second = NULL;
+
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &first), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &second), CARDANO_SUCCESS);
+
+  EXPECT_EQ(stub_calls.parameters, 1U);
+
+  cardano_protocol_parameters_unref(&second);
+
+  fake_now += 5000U;
+
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &second), CARDANO_SUCCESS);
+
+  EXPECT_EQ(stub_calls.parameters, 2U);
+
+  cardano_protocol_parameters_unref(&first);
+  cardano_protocol_parameters_unref(&second);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, servesEachCallerItsOwnParameters)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_SANCHONET);
+
+  cardano_protocol_parameters_t* first  = NULL;
+  cardano_protocol_parameters_t* second = NULL;
+
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &first), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_protocol_parameters_set_min_fee_a(first, 77U), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &second), CARDANO_SUCCESS);
+
+  EXPECT_NE(first, second);
+  EXPECT_EQ(cardano_protocol_parameters_get_min_fee_a(second), 0U);
+  EXPECT_EQ(stub_calls.parameters, 1U);
+
+  cardano_protocol_parameters_unref(&first);
+  cardano_protocol_parameters_unref(&second);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, dropsParametersAtTheEpochBoundary)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREVIEW);
+
+  // One second before the end of the first preview epoch (86400 one-second slots).
+  fake_now = CARDANO_PREVIEW_SLOT_CONFIG.zero_time + (86400U * 1000U) - 1000U;
+
+  cardano_protocol_parameters_t* parameters = NULL;
+
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &parameters), CARDANO_SUCCESS);
+  cardano_protocol_parameters_unref(&parameters);
+
+  fake_now += 500U;
+
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &parameters), CARDANO_SUCCESS);
+  cardano_protocol_parameters_unref(&parameters);
+
+  EXPECT_EQ(stub_calls.parameters, 1U);
+
+  fake_now += 1000U;
+
+  ASSERT_EQ(cardano_provider_get_parameters(provider, &parameters), CARDANO_SUCCESS);
+  cardano_protocol_parameters_unref(&parameters);
+
+  EXPECT_EQ(stub_calls.parameters, 2U);
+
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, resolvesOnlyMissingInputsInOneBatch)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  EXPECT_EQ(resolve(provider, { 5U, 3U }), std::vector<uint64_t>({ 3U, 5U }));
+  EXPECT_EQ(stub_calls.resolve, 1U);
+  EXPECT_EQ(stub_calls.last_batch, 2U);
+
+  EXPECT_EQ(resolve(provider, { 3U, 4U, 5U, 6U }), std::vector<uint64_t>({ 3U, 4U, 5U, 6U }));
+  EXPECT_EQ(stub_calls.resolve, 2U);
+  EXPECT_EQ(stub_calls.last_batch, 2U);
+
+  EXPECT_EQ(resolve(provider, { 6U, 4U, 3U }), std::vector<uint64_t>({ 3U, 4U, 6U }));
+  EXPECT_EQ(stub_calls.resolve, 2U);
+
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, omitsInputsTheBackendCannotResolve)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  EXPECT_EQ(resolve(provider, { 1U, 99U }), std::vector<uint64_t>({ 1U }));
+  EXPECT_EQ(resolve(provider, { 1U, 99U }), std::vector<uint64_t>({ 1U }));
+
+  // The unresolved input is asked for again; the resolved one is not.
+  EXPECT_EQ(stub_calls.resolve, 2U);
+  EXPECT_EQ(stub_calls.last_batch, 1U);
+
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, expiresUnspentOutputs)
+{
+  cardano_caching_provider_options_t options = cardano_caching_provider_options_default();
+  options.utxo_ttl_ms                        = 100U;
+
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD, &options);
+
+  EXPECT_EQ(resolve(provider, { 1U }).size(), 1U);
+
+  fake_now += 99U;
+  EXPECT_EQ(resolve(provider, { 1U }).size(), 1U);
+  EXPECT_EQ(stub_calls.resolve, 1U);
+
+  fake_now += 1U;
+  EXPECT_EQ(resolve(provider, { 1U }).size(), 1U);
+  EXPECT_EQ(stub_calls.resolve, 2U);
+
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, addressListingSeedsTheInputCache)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  EXPECT_EQ(list_unspent_outputs(provider), 2U);
+  EXPECT_EQ(list_unspent_outputs(provider), 2U);
+  EXPECT_EQ(stub_calls.unspent_outputs, 1U);
+
+  EXPECT_EQ(resolve(provider, { 0U, 1U }), std::vector<uint64_t>({ 0U, 1U }));
+  EXPECT_EQ(stub_calls.resolve, 0U);
+
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, submitInvalidatesSpentOutputsAndListings)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  EXPECT_EQ(list_unspent_outputs(provider), 2U);
+
+  cardano_transaction_t*  tx    = make_transaction_spending({ 0U });
+  cardano_blake2b_hash_t* tx_id = NULL;
+
+  ASSERT_EQ(cardano_provider_submit_transaction(provider, tx, &tx_id), CARDANO_SUCCESS);
+  EXPECT_EQ(stub_calls.submit, 1U);
+
+  cardano_blake2b_hash_unref(&tx_id);
+
+  EXPECT_EQ(list_unspent_outputs(provider), 2U);
+  EXPECT_EQ(stub_calls.unspent_outputs, 2U);
+
+  // The listing above re-seeded both outputs, so drop it again and check the spent one alone.
+  ASSERT_EQ(cardano_provider_submit_transaction(provider, tx, &tx_id), CARDANO_SUCCESS);
+  cardano_blake2b_hash_unref(&tx_id);
+
+  EXPECT_EQ(resolve(provider, { 0U, 1U }), std::vector<uint64_t>({ 0U, 1U }));
+  EXPECT_EQ(stub_calls.resolve, 1U);
+  EXPECT_EQ(stub_calls.last_batch, 1U);
+
+  cardano_transaction_unref(&tx);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, cachesDatumsByHash)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  cardano_blake2b_hash_t* hash   = NULL;
+  cardano_plutus_data_t*  first  = NULL;
+  cardano_plutus_data_t*  second = NULL;
+
+  ASSERT_EQ(cardano_blake2b_hash_from_hex(TX_ID, strlen(TX_ID), &hash), CARDANO_SUCCESS);
+
+  ASSERT_EQ(cardano_provider_resolve_datum(provider, hash, &first), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_provider_resolve_datum(provider, hash, &second), CARDANO_SUCCESS);
+
+  EXPECT_NE(first, second);
+  EXPECT_TRUE(cardano_plutus_data_equals(first, second));
+  EXPECT_EQ(stub_calls.datum, 1U);
+
+  cardano_plutus_data_unref(&first);
+  cardano_plutus_data_unref(&second);
+  cardano_blake2b_hash_unref(&hash);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, servesEachCallerItsOwnDatum)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  cardano_blake2b_hash_t* hash    = NULL;
+  cardano_plutus_data_t*  first   = NULL;
+  cardano_plutus_data_t*  second  = NULL;
+  cardano_plutus_data_t*  element = NULL;
+  cardano_plutus_list_t*  list    = NULL;
+
+  ASSERT_EQ(cardano_blake2b_hash_from_hex(TX_ID, strlen(TX_ID), &hash), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_provider_resolve_datum(provider, hash, &first), CARDANO_SUCCESS);
+
+  ASSERT_EQ(cardano_plutus_data_new_integer_from_int(7, &element), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_plutus_data_to_list(first, &list), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_plutus_list_add(list, element), CARDANO_SUCCESS);
+  cardano_plutus_list_unref(&list);
+  cardano_plutus_data_unref(&element);
+
+  ASSERT_EQ(cardano_provider_resolve_datum(provider, hash, &second), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_plutus_data_to_list(second, &list), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_plutus_list_get_length(list), 1U);
+  EXPECT_EQ(stub_calls.datum, 1U);
+
+  cardano_plutus_list_unref(&list);
+  cardano_plutus_data_unref(&first);
+  cardano_plutus_data_unref(&second);
+  cardano_blake2b_hash_unref(&hash);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, servesEachCallerItsOwnUnspentOutputs)
+{
+  cardano_provider_t*  provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+  cardano_address_t*   address  = NULL;
+  cardano_utxo_list_t* utxos    = NULL;
+  cardano_utxo_t*      utxo     = NULL;
+
+  ASSERT_EQ(cardano_address_from_string(ADDRESS, strlen(ADDRESS), &address), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_provider_get_unspent_outputs(provider, address, &utxos), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_utxo_list_get(utxos, 0U, &utxo), CARDANO_SUCCESS);
+
+  cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+  cardano_value_t*              value  = cardano_transaction_output_get_value(output);
+
+  ASSERT_EQ(cardano_value_set_coin(value, 1), CARDANO_SUCCESS);
+
+  cardano_value_unref(&value);
+  cardano_transaction_output_unref(&output);
+  cardano_utxo_unref(&utxo);
+  cardano_utxo_list_unref(&utxos);
+
+  // Both the address listing and the by-input cache still hold the original output.
+  ASSERT_EQ(cardano_provider_get_unspent_outputs(provider, address, &utxos), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_utxo_list_get(utxos, 0U, &utxo), CARDANO_SUCCESS);
+
+  output = cardano_utxo_get_output(utxo);
+  value  = cardano_transaction_output_get_value(output);
+
+  EXPECT_EQ(cardano_value_get_coin(value), 1000000);
+
+  cardano_value_unref(&value);
+  cardano_transaction_output_unref(&output);
+  cardano_utxo_unref(&utxo);
+  cardano_utxo_list_unref(&utxos);
+
+  cardano_transaction_input_set_t* set = make_input_set({ 0U });
+
+  ASSERT_EQ(cardano_provider_resolve_unspent_outputs(provider, set, &utxos), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_utxo_list_get(utxos, 0U, &utxo), CARDANO_SUCCESS);
+
+  output = cardano_utxo_get_output(utxo);
+  value  = cardano_transaction_output_get_value(output);
+
+  EXPECT_EQ(cardano_value_get_coin(value), 1000000);
+  EXPECT_EQ(stub_calls.unspent_outputs, 1U);
+  EXPECT_EQ(stub_calls.resolve, 0U);
+
+  cardano_value_unref(&value);
+  cardano_transaction_output_unref(&output);
+  cardano_utxo_unref(&utxo);
+  cardano_utxo_list_unref(&utxos);
+  cardano_transaction_input_set_unref(&set);
+  cardano_address_unref(&address);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, forwardsBackendErrors)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  static const char* MISSING = "ff217abaca60fc0ca68c1555eca6a96d2478547818ae76ce6836133f3cc546e0";
+
+  cardano_blake2b_hash_t* hash  = NULL;
+  cardano_plutus_data_t*  datum = NULL;
+
+  ASSERT_EQ(cardano_blake2b_hash_from_hex(MISSING, strlen(MISSING), &hash), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_provider_resolve_datum(provider, hash, &datum), CARDANO_ERROR_ELEMENT_NOT_FOUND);
+  EXPECT_STREQ(cardano_provider_get_last_error(provider), "Datum not found");
+
+  // Failures are not cached.
+  EXPECT_EQ(cardano_provider_resolve_datum(provider, hash, &datum), CARDANO_ERROR_ELEMENT_NOT_FOUND);
+  EXPECT_EQ(stub_calls.datum, 2U);
+
+  cardano_blake2b_hash_unref(&hash);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, forwardsUncachedRequests)
+{
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+  cardano_asset_id_t* asset_id = NULL;
+  cardano_utxo_t*     utxo     = NULL;
+
+  ASSERT_EQ(cardano_asset_id_new_lovelace(&asset_id), CARDANO_SUCCESS);
+
+  // The stub does not implement this request, and the caching provider reports it as such.
+  EXPECT_EQ(cardano_provider_get_unspent_output_by_nft(provider, asset_id, &utxo), CARDANO_ERROR_NOT_IMPLEMENTED);
+
+  cardano_asset_id_unref(&asset_id);
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, emptiesAFullCache)
+{
+  cardano_caching_provider_options_t options = cardano_caching_provider_options_default();
+  options.max_entries                        = 2U;
+
+  cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD, &options);
+
+  EXPECT_EQ(resolve(provider, { 1U, 2U }).size(), 2U);
+  EXPECT_EQ(resolve(provider, { 1U, 2U }).size(), 2U);
+  EXPECT_EQ(stub_calls.resolve, 1U);
+
+  // A third entry empties the cache before it is stored.
+  EXPECT_EQ(resolve(provider, { 3U }).size(), 1U);
+  EXPECT_EQ(resolve(provider, { 1U, 2U, 3U }).size(), 3U);
+  EXPECT_EQ(stub_calls.resolve, 3U);
+  EXPECT_EQ(stub_calls.last_batch, 2U);
+
+  cardano_provider_unref(&provider);
+}
+
+TEST(cardano_caching_provider, doesntCrashIfMemoryAllocationFails)
+{
+  for (int i = 0; i < 200; ++i)
+  {
+    cardano_provider_t* provider = make_caching_provider(CARDANO_NETWORK_MAGIC_PREPROD);
+
+    EXPECT_EQ(list_unspent_outputs(provider), 2U);
+
+    // Both inputs are cached by the listing above, so the stub backend is never reached.
+    cardano_transaction_input_set_t* set   = make_input_set({ 0U, 1U });
+    cardano_utxo_list_t*             utxos = NULL;
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    const cardano_error_t result = cardano_provider_resolve_unspent_outputs(provider, set, &utxos);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      EXPECT_EQ(cardano_utxo_list_get_length(utxos), 2U);
+    }
+    else
+    {
+      EXPECT_EQ(utxos, nullptr);
+    }
+
+    cardano_utxo_list_unref(&utxos);
+    cardano_transaction_input_set_unref(&set);
+    cardano_provider_unref(&provider);
+  }
+}
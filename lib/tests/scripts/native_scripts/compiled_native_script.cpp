@@ -0,0 +1,371 @@
+/**
+ * \file compiled_native_script.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../../allocators_helpers.h"
+
+#include <allocators.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
+
+#include <gmock/gmock.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const char* KEY1 = "966e394a544f242081e41d1965137b1bb412ac230d40ed5407821c37";
+static const char* KEY2 = "b275b08c999097247f7c17e77007c7010cd19f20cc086ad99d398538";
+static const char* KEY3 = "c37b1b5dc0669f1d3c61a6fddb2e8fde96be87b881c60bce8e8d542f";
+
+static const char* MULTISIG_SCRIPT =
+  "{"
+  "  \"type\": \"any\","
+  "  \"scripts\": ["
+  "    {"
+  "      \"type\": \"all\","
+  "      \"scripts\": ["
+  "        { \"type\": \"sig\", \"keyHash\": \"966e394a544f242081e41d1965137b1bb412ac230d40ed5407821c37\" },"
+  "        { \"type\": \"sig\", \"keyHash\": \"b275b08c999097247f7c17e77007c7010cd19f20cc086ad99d398538\" }"
+  "      ]"
+  "    },"
+  "    { \"type\": \"sig\", \"keyHash\": \"c37b1b5dc0669f1d3c61a6fddb2e8fde96be87b881c60bce8e8d542f\" }"
+  "  ]"
+  "}";
+
+static const char* AT_LEAST_SCRIPT =
+  "{"
+  "  \"type\": \"atLeast\","
+  "  \"required\": 2,"
+  "  \"scripts\": ["
+  "    { \"type\": \"sig\", \"keyHash\": \"966e394a544f242081e41d1965137b1bb412ac230d40ed5407821c37\" },"
+  "    { \"type\": \"sig\", \"keyHash\": \"b275b08c999097247f7c17e77007c7010cd19f20cc086ad99d398538\" },"
+  "    { \"type\": \"sig\", \"keyHash\": \"c37b1b5dc0669f1d3c61a6fddb2e8fde96be87b881c60bce8e8d542f\" },"
+  "    { \"type\": \"sig\", \"keyHash\": \"966e394a544f242081e41d1965137b1bb412ac230d40ed5407821c37\" }"
+  "  ]"
+  "}";
+
+static const char* TIME_LOCK_SCRIPT =
+  "{"
+  "  \"type\": \"all\","
+  "  \"scripts\": ["
+  "    { \"type\": \"after\", \"slot\": 1000 },"
+  "    { \"type\": \"before\", \"slot\": 2000 }"
+  "  ]"
+  "}";
+
+static const char* GUARD_SCRIPT =
+  "{ \"type\": \"guard\", \"keyHash\": \"c37b1b5dc0669f1d3c61a6fddb2e8fde96be87b881c60bce8e8d542f\" }";
+
+/* STATIC FUNCTIONS **********************************************************/
+
+static cardano_compiled_native_script_t*
+compile(const char* json)
+{
+  cardano_native_script_t*          script   = NULL;
+  cardano_compiled_native_script_t* compiled = NULL;
+
+  EXPECT_EQ(cardano_native_script_from_json(json, strlen(json), &script), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_compiled_native_script_new(script, &compiled), CARDANO_SUCCESS);
+
+  cardano_native_script_unref(&script);
+
+  return compiled;
+}
+
+static cardano_blake2b_hash_set_t*
+new_signers(std::initializer_list<const char*> keys)
+{
+  cardano_blake2b_hash_set_t* set = NULL;
+
+  EXPECT_EQ(cardano_blake2b_hash_set_new(&set), CARDANO_SUCCESS);
+
+  for (const char* key : keys)
+  {
+    cardano_blake2b_hash_t* hash = NULL;
+
+    EXPECT_EQ(cardano_blake2b_hash_from_hex(key, strlen(key), &hash), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_blake2b_hash_set_add(set, hash), CARDANO_SUCCESS);
+
+    cardano_blake2b_hash_unref(&hash);
+  }
+
+  return set;
+}
+
+static bool
+contains(cardano_blake2b_hash_set_t* set, const char* key)
+{
+  cardano_blake2b_hash_t* expected = NULL;
+  bool                    found    = false;
+
+  EXPECT_EQ(cardano_blake2b_hash_from_hex(key, strlen(key), &expected), CARDANO_SUCCESS);
+
+  for (size_t i = 0U; i < cardano_blake2b_hash_set_get_length(set); ++i)
+  {
+    cardano_blake2b_hash_t* hash = NULL;
+
+    EXPECT_EQ(cardano_blake2b_hash_set_get(set, i, &hash), CARDANO_SUCCESS);
+
+    found = found || cardano_blake2b_hash_equals(hash, expected);
+
+    cardano_blake2b_hash_unref(&hash);
+  }
+
+  cardano_blake2b_hash_unref(&expected);
+
+  return found;
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_compiled_native_script_evaluate, picksTheCheapestSatisfiedBranch)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled  = compile(MULTISIG_SCRIPT);
+  cardano_blake2b_hash_set_t*       signers   = new_signers({ KEY1, KEY2, KEY3 });
+  cardano_blake2b_hash_set_t*       minimal   = NULL;
+  bool                              satisfied = false;
+
+  // Act
+  cardano_error_t result = cardano_compiled_native_script_evaluate(compiled, signers, nullptr, nullptr, nullptr, &satisfied, &minimal);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+  EXPECT_EQ(cardano_blake2b_hash_set_get_length(minimal), 1U);
+  EXPECT_TRUE(contains(minimal, KEY3));
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+  cardano_blake2b_hash_set_unref(&signers);
+  cardano_blake2b_hash_set_unref(&minimal);
+}
+
+TEST(cardano_compiled_native_script_evaluate, canBeReusedWithDifferentSigners)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled  = compile(MULTISIG_SCRIPT);
+  cardano_blake2b_hash_set_t*       both      = new_signers({ KEY1, KEY2 });
+  cardano_blake2b_hash_set_t*       one       = new_signers({ KEY1 });
+  cardano_blake2b_hash_set_t*       minimal   = NULL;
+  bool                              satisfied = false;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, both, nullptr, nullptr, nullptr, &satisfied, &minimal), CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+  EXPECT_EQ(cardano_blake2b_hash_set_get_length(minimal), 2U);
+  EXPECT_TRUE(contains(minimal, KEY1));
+  EXPECT_TRUE(contains(minimal, KEY2));
+  cardano_blake2b_hash_set_unref(&minimal);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, one, nullptr, nullptr, nullptr, &satisfied, &minimal), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+  EXPECT_EQ(cardano_blake2b_hash_set_get_length(minimal), 0U);
+  cardano_blake2b_hash_set_unref(&minimal);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, nullptr, nullptr, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+  cardano_blake2b_hash_set_unref(&both);
+  cardano_blake2b_hash_set_unref(&one);
+}
+
+TEST(cardano_compiled_native_script_evaluate, countsSatisfiedSubScriptsForAtLeast)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled  = compile(AT_LEAST_SCRIPT);
+  cardano_blake2b_hash_set_t*       signers   = new_signers({ KEY2, KEY3 });
+  cardano_blake2b_hash_set_t*       lone      = new_signers({ KEY1 });
+  cardano_blake2b_hash_set_t*       minimal   = NULL;
+  cardano_blake2b_hash_set_t*       keys      = NULL;
+  bool                              satisfied = false;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, signers, nullptr, nullptr, nullptr, &satisfied, &minimal), CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+  EXPECT_EQ(cardano_blake2b_hash_set_get_length(minimal), 2U);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, lone, nullptr, nullptr, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+
+  EXPECT_EQ(cardano_compiled_native_script_get_key_hashes(compiled, &keys), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_blake2b_hash_set_get_length(keys), 3U);
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+  cardano_blake2b_hash_set_unref(&signers);
+  cardano_blake2b_hash_set_unref(&lone);
+  cardano_blake2b_hash_set_unref(&minimal);
+  cardano_blake2b_hash_set_unref(&keys);
+}
+
+TEST(cardano_compiled_native_script_evaluate, checksTheValidityInterval)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled  = compile(TIME_LOCK_SCRIPT);
+  const uint64_t                    start     = 1000U;
+  const uint64_t                    early     = 999U;
+  const uint64_t                    end       = 2000U;
+  const uint64_t                    late      = 2001U;
+  bool                              satisfied = false;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, &start, &end, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, &early, &end, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, &start, &late, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, nullptr, &end, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, &start, nullptr, nullptr, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+}
+
+TEST(cardano_compiled_native_script_evaluate, looksUpGuardsByCredentialType)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled   = compile(GUARD_SCRIPT);
+  cardano_guard_set_t*              guards     = NULL;
+  cardano_credential_t*             as_script  = NULL;
+  cardano_credential_t*             as_key     = NULL;
+  cardano_blake2b_hash_set_t*       signers    = new_signers({ KEY3 });
+  bool                              satisfied  = false;
+
+  EXPECT_EQ(cardano_guard_set_new(&guards), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_credential_from_hash_hex(KEY3, strlen(KEY3), CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH, &as_script), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_credential_from_hash_hex(KEY3, strlen(KEY3), CARDANO_CREDENTIAL_TYPE_KEY_HASH, &as_key), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_guard_set_add(guards, as_script), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, signers, nullptr, nullptr, guards, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_FALSE(satisfied);
+
+  EXPECT_EQ(cardano_guard_set_add(guards, as_key), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, nullptr, nullptr, guards, &satisfied, nullptr), CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+  cardano_guard_set_unref(&guards);
+  cardano_credential_unref(&as_script);
+  cardano_credential_unref(&as_key);
+  cardano_blake2b_hash_set_unref(&signers);
+}
+
+TEST(cardano_compiled_native_script_evaluate, returnsErrorIfPointerIsNull)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled  = compile(MULTISIG_SCRIPT);
+  bool                              satisfied = false;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(nullptr, nullptr, nullptr, nullptr, nullptr, &satisfied, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_compiled_native_script_get_key_hashes(compiled, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_compiled_native_script_new(nullptr, &compiled), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+}
+
+TEST(cardano_compiled_native_script_evaluate, returnsErrorIfMemoryAllocationFails)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled  = compile(MULTISIG_SCRIPT);
+  bool                              satisfied = false;
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_compiled_native_script_evaluate(compiled, nullptr, nullptr, nullptr, nullptr, &satisfied, nullptr), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+
+  // Cleanup
+  cardano_set_allocators(malloc, realloc, free);
+  cardano_compiled_native_script_unref(&compiled);
+}
+
+TEST(cardano_native_script_evaluate, compilesAndEvaluatesOnce)
+{
+  // Arrange
+  cardano_native_script_t*    script    = NULL;
+  cardano_blake2b_hash_set_t* signers   = new_signers({ KEY1, KEY2 });
+  bool                        satisfied = false;
+
+  EXPECT_EQ(cardano_native_script_from_json(MULTISIG_SCRIPT, strlen(MULTISIG_SCRIPT), &script), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_native_script_evaluate(script, signers, nullptr, nullptr, nullptr, &satisfied, nullptr);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_TRUE(satisfied);
+  EXPECT_EQ(cardano_native_script_evaluate(script, signers, nullptr, nullptr, nullptr, nullptr, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_native_script_unref(&script);
+  cardano_blake2b_hash_set_unref(&signers);
+}
+
+TEST(cardano_compiled_native_script_ref, increasesTheReferenceCount)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled = compile(MULTISIG_SCRIPT);
+
+  // Act
+  cardano_compiled_native_script_ref(compiled);
+
+  // Assert
+  EXPECT_EQ(cardano_compiled_native_script_refcount(compiled), 2U);
+  EXPECT_EQ(cardano_compiled_native_script_refcount(nullptr), 0U);
+  cardano_compiled_native_script_ref(nullptr);
+  cardano_compiled_native_script_unref(nullptr);
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+  cardano_compiled_native_script_unref(&compiled);
+  EXPECT_EQ(compiled, nullptr);
+}
+
+TEST(cardano_compiled_native_script_set_last_error, canSetTheLastError)
+{
+  // Arrange
+  cardano_compiled_native_script_t* compiled = compile(MULTISIG_SCRIPT);
+
+  // Act
+  cardano_compiled_native_script_set_last_error(compiled, "Test message");
+
+  // Assert
+  EXPECT_STREQ(cardano_compiled_native_script_get_last_error(compiled), "Test message");
+
+  // Cleanup
+  cardano_compiled_native_script_unref(&compiled);
+}
@@ -0,0 +1,497 @@
+/**
+ * \file phase1_validation.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/utxo.h>
+#include <cardano/scripts/native_scripts/native_script.h>
+#include <cardano/transaction/phase1_validation.h>
+#include <cardano/witness_set/native_script_set.h>
+#include <cardano/witness_set/redeemer.h>
+#include <cardano/witness_set/redeemer_list.h>
+
+#include <gmock/gmock.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const char* BALANCED_TX_CBOR   = "84a300d9010282825820027b68d4c11e97d7e065cc2702912cb1a21b6d0e56c6a74dd605889a5561138500825820d3c887d17486d483a2b46b58b01cb9344745f15fdd8f8e70a57f854cdd88a633010182a2005839005cf6c91279a859a072601779fb33bb07c34e1d641d45df51ff63b967f15db05f56035465bf8900a09bdaa16c3d8b8244fea686524408dd8001821a00e4e1c0a1581c0b0d621b5c26d0a1fd0893a4b04c19d860296a69ede1fbcfc5179882a1474e46542d30303101a200583900dc435fc2638f6684bd1f9f6f917d80c92ae642a4a33a412e516479e64245236ab8056760efceebbff57e8cab220182be3e36439e520a6454011a0d294e28021a00029eb9a0f5f6";
+static const char* UNBALANCED_TX_CBOR = "84a300d9010282825820027b68d4c11e97d7e065cc2702912cb1a21b6d0e56c6a74dd605889a5561138500825820d3c887d17486d483a2b46b58b01cb9344745f15fdd8f8e70a57f854cdd88a633010182a2005839005cf6c91279a859a072601779fb33bb07c34e1d641d45df51ff63b967f15db05f56035465bf8900a09bdaa16c3d8b8244fea686524408dd8001821a00e4e1c0a1581c0b0d621b5c26d0a1fd0893a4b04c19d860296a69ede1fbcfc5179882a1474e46542d30303101a200583900dc435fc2638f6684bd1f9f6f917d80c92ae642a4a33a412e516479e64245236ab8056760efceebbff57e8cab220182be3e36439e520a6454011a0d294e28021a00000000a0f5f6";
+static const char* UTXO1_CBOR         = "82825820027b68d4c11e97d7e065cc2702912cb1a21b6d0e56c6a74dd605889a5561138500a200583900287a7e37219128cfb05322626daa8b19d1ad37c6779d21853f7b94177c16240714ea0e12b41a914f2945784ac494bb19573f0ca61a08afa801821a00118f32a1581c0b0d621b5c26d0a1fd0893a4b04c19d860296a69ede1fbcfc5179882a1474e46542d30303101";
+static const char* UTXO2_CBOR         = "82825820d3c887d17486d483a2b46b58b01cb9344745f15fdd8f8e70a57f854cdd88a63301a200583900287a7e37219128cfb05322626daa8b19d1ad37c6779d21853f7b94177c16240714ea0e12b41a914f2945784ac494bb19573f0ca61a08afa8011a0dff3f6f";
+static const char* REDEEMER_CBOR      = "840000d8799f0102030405ff821821182c";
+static const char* TIME_LOCK_SCRIPT   = "{ \"type\": \"after\", \"slot\": 500 }";
+
+/* STATIC FUNCTIONS **********************************************************/
+
+static cardano_transaction_t*
+new_default_transaction(const char* cbor)
+{
+  cardano_transaction_t* transaction = NULL;
+  cardano_cbor_reader_t* reader      = cardano_cbor_reader_from_hex(cbor, strlen(cbor));
+
+  EXPECT_EQ(cardano_transaction_from_cbor(reader, &transaction), CARDANO_SUCCESS);
+
+  cardano_cbor_reader_unref(&reader);
+
+  return transaction;
+}
+
+static cardano_protocol_parameters_t*
+new_default_protocol_parameters()
+{
+  cardano_protocol_parameters_t* params         = NULL;
+  cardano_ex_unit_prices_t*      ex_unit_prices = NULL;
+  cardano_unit_interval_t*       memory_prices  = NULL;
+  cardano_unit_interval_t*       steps_prices   = NULL;
+  cardano_unit_interval_t*       ref_cost       = NULL;
+  cardano_ex_units_t*            max_ex_units   = NULL;
+
+  EXPECT_EQ(cardano_protocol_parameters_new(&params), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_unit_interval_from_double(0.0577, &memory_prices), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_unit_interval_from_double(0.0000721, &steps_prices), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_unit_interval_from_double(15.0, &ref_cost), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_ex_unit_prices_new(memory_prices, steps_prices, &ex_unit_prices), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_ex_units_new(14000000U, 10000000000U, &max_ex_units), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_protocol_parameters_set_min_fee_a(params, 44U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_min_fee_b(params, 155381U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_execution_costs(params, ex_unit_prices), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_ref_script_cost_per_byte(params, ref_cost), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_ada_per_utxo_byte(params, 4310U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_tx_size(params, 16384U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_value_size(params, 5000U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_tx_ex_units(params, max_ex_units), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_collateral_percentage(params, 150U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_collateral_inputs(params, 3U), CARDANO_SUCCESS);
+
+  cardano_unit_interval_unref(&memory_prices);
+  cardano_unit_interval_unref(&steps_prices);
+  cardano_unit_interval_unref(&ref_cost);
+  cardano_ex_unit_prices_unref(&ex_unit_prices);
+  cardano_ex_units_unref(&max_ex_units);
+
+  return params;
+}
+
+static cardano_utxo_list_t*
+new_default_utxo_list()
+{
+  cardano_utxo_list_t* list = NULL;
+
+  EXPECT_EQ(cardano_utxo_list_new(&list), CARDANO_SUCCESS);
+
+  for (const char* cbor : { UTXO1_CBOR, UTXO2_CBOR })
+  {
+    cardano_utxo_t*        utxo   = NULL;
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(cbor, strlen(cbor));
+
+    EXPECT_EQ(cardano_utxo_from_cbor(reader, &utxo), CARDANO_SUCCESS);
+    EXPECT_EQ(cardano_utxo_list_add(list, utxo), CARDANO_SUCCESS);
+
+    cardano_utxo_unref(&utxo);
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  return list;
+}
+
+static void
+add_redeemer(cardano_transaction_t* transaction)
+{
+  cardano_redeemer_list_t* redeemers = NULL;
+  cardano_redeemer_t*      redeemer  = NULL;
+  cardano_cbor_reader_t*   reader    = cardano_cbor_reader_from_hex(REDEEMER_CBOR, strlen(REDEEMER_CBOR));
+
+  EXPECT_EQ(cardano_redeemer_from_cbor(reader, &redeemer), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_redeemer_list_new(&redeemers), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_redeemer_list_add(redeemers, redeemer), CARDANO_SUCCESS);
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(transaction);
+
+  EXPECT_EQ(cardano_witness_set_set_redeemers(witness_set, redeemers), CARDANO_SUCCESS);
+
+  cardano_witness_set_unref(&witness_set);
+  cardano_redeemer_list_unref(&redeemers);
+  cardano_redeemer_unref(&redeemer);
+  cardano_cbor_reader_unref(&reader);
+}
+
+static void
+use_inputs_as_collateral(cardano_transaction_t* transaction)
+{
+  cardano_transaction_body_t*      body   = cardano_transaction_get_body(transaction);
+  cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(body);
+
+  EXPECT_EQ(cardano_transaction_body_set_collateral(body, inputs), CARDANO_SUCCESS);
+
+  cardano_transaction_input_set_unref(&inputs);
+  cardano_transaction_body_unref(&body);
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_transaction_validate_phase1, onlyReportsMissingWitnessesForABalancedUnsignedTransaction)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_phase1_validation_result_t report = {};
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(report.violations, (uint32_t)CARDANO_PHASE1_VIOLATION_MISSING_VKEY_WITNESSES);
+  EXPECT_EQ(report.missing_signer_count, 1U);
+  EXPECT_EQ(report.undersized_output_count, 0U);
+  EXPECT_GT(report.tx_size, 0U);
+  EXPECT_GT(report.min_fee, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_transaction_validate_phase1, reportsAFeeBelowTheMinimumAndUnbalancedValue)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(UNBALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_phase1_validation_result_t report = {};
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL, 0U);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_VALUE_NOT_CONSERVED, 0U);
+  EXPECT_GT(report.min_fee, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_transaction_validate_phase1, reportsUnresolvedInputsAndSkipsTheRulesThatNeedThem)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = NULL;
+  cardano_phase1_validation_result_t report = {};
+
+  EXPECT_EQ(cardano_utxo_list_new(&utxos), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(report.violations, (uint32_t)CARDANO_PHASE1_VIOLATION_BAD_INPUTS);
+  EXPECT_EQ(report.min_fee, 0U);
+  EXPECT_EQ(report.missing_signer_count, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_transaction_validate_phase1, reportsSizeAndOutputLimits)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_phase1_validation_result_t report = {};
+
+  EXPECT_EQ(cardano_protocol_parameters_set_max_tx_size(params, 100U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_value_size(params, 10U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_ada_per_utxo_byte(params, 1000000U), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_MAX_TX_SIZE_EXCEEDED, 0U);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_OUTPUT_VALUE_TOO_LARGE, 0U);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_OUTPUT_TOO_SMALL, 0U);
+  EXPECT_EQ(report.undersized_output_count, 2U);
+  EXPECT_GT(report.tx_size, 100U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_transaction_validate_phase1, checksTheValidityIntervalAgainstTheCurrentSlot)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_phase1_validation_result_t report = {};
+  const uint64_t                     after  = 2000U;
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  EXPECT_EQ(cardano_transaction_body_set_invalid_after(body, &after), CARDANO_SUCCESS);
+  cardano_transaction_body_unref(&body);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 1999U, &report), CARDANO_SUCCESS);
+  EXPECT_EQ(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_OUTSIDE_VALIDITY_INTERVAL, 0U);
+
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 2000U, &report), CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_OUTSIDE_VALIDITY_INTERVAL, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_transaction_validate_phase1, requiresCollateralWhenScriptsRun)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_phase1_validation_result_t report = {};
+
+  add_redeemer(tx);
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_NO_COLLATERAL_INPUTS, 0U);
+  EXPECT_EQ(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_EX_UNITS_TOO_BIG, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_transaction_validate_phase1, checksCollateralLimitsAndDeclaredTotal)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_ex_units_t*                limit  = NULL;
+  cardano_phase1_validation_result_t report = {};
+  const uint64_t                     total  = 1U;
+
+  add_redeemer(tx);
+  use_inputs_as_collateral(tx);
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  EXPECT_EQ(cardano_transaction_body_set_total_collateral(body, &total), CARDANO_SUCCESS);
+  cardano_transaction_body_unref(&body);
+
+  EXPECT_EQ(cardano_ex_units_new(10U, 10U, &limit), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_tx_ex_units(params, limit), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_protocol_parameters_set_max_collateral_inputs(params, 1U), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_EX_UNITS_TOO_BIG, 0U);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_TOO_MANY_COLLATERAL_INPUTS, 0U);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_INCORRECT_TOTAL_COLLATERAL, 0U);
+  EXPECT_EQ(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_INSUFFICIENT_COLLATERAL, 0U);
+  EXPECT_EQ(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_NO_COLLATERAL_INPUTS, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+  cardano_ex_units_unref(&limit);
+}
+
+TEST(cardano_transaction_validate_phase1, reportsCollateralThatTakesNativeAssets)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_utxo_t*                    utxo   = NULL;
+  cardano_phase1_validation_result_t report = {};
+
+  add_redeemer(tx);
+  use_inputs_as_collateral(tx);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report), CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_COLLATERAL_CONTAINS_NON_ADA, 0U);
+
+  EXPECT_EQ(cardano_utxo_list_get(utxos, 0U, &utxo), CARDANO_SUCCESS);
+
+  cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+  cardano_transaction_body_t*   body   = cardano_transaction_get_body(tx);
+
+  EXPECT_EQ(cardano_transaction_body_set_collateral_return(body, output), CARDANO_SUCCESS);
+
+  cardano_transaction_body_unref(&body);
+  cardano_transaction_output_unref(&output);
+
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report), CARDANO_SUCCESS);
+  EXPECT_EQ(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_COLLATERAL_CONTAINS_NON_ADA, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+  cardano_utxo_unref(&utxo);
+}
+
+TEST(cardano_transaction_validate_phase1, checksTheCollateralReturnAgainstTheMinimumAda)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_utxo_t*                    utxo   = NULL;
+  cardano_transaction_output_t*      change = NULL;
+  cardano_phase1_validation_result_t report = {};
+
+  add_redeemer(tx);
+  use_inputs_as_collateral(tx);
+
+  EXPECT_EQ(cardano_utxo_list_get(utxos, 1U, &utxo), CARDANO_SUCCESS);
+
+  cardano_transaction_output_t* output  = cardano_utxo_get_output(utxo);
+  cardano_address_t*            address = cardano_transaction_output_get_address(output);
+
+  EXPECT_EQ(cardano_transaction_output_new(address, 1U, &change), CARDANO_SUCCESS);
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  EXPECT_EQ(cardano_transaction_body_set_collateral_return(body, change), CARDANO_SUCCESS);
+  cardano_transaction_body_unref(&body);
+
+  // Act
+  cardano_error_t result = cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_OUTPUT_TOO_SMALL, 0U);
+  EXPECT_EQ(report.undersized_output_count, 1U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+  cardano_utxo_unref(&utxo);
+  cardano_transaction_output_unref(&output);
+  cardano_transaction_output_unref(&change);
+  cardano_address_unref(&address);
+}
+
+TEST(cardano_transaction_validate_phase1, reportsNativeScriptsThatAreNotSatisfied)
+{
+  // Arrange
+  cardano_transaction_t*             tx      = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params  = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos   = new_default_utxo_list();
+  cardano_native_script_t*           script  = NULL;
+  cardano_native_script_set_t*       scripts = NULL;
+  cardano_phase1_validation_result_t report  = {};
+  const uint64_t                     start   = 500U;
+
+  EXPECT_EQ(cardano_native_script_from_json(TIME_LOCK_SCRIPT, strlen(TIME_LOCK_SCRIPT), &script), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_native_script_set_new(&scripts), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_native_script_set_add(scripts, script), CARDANO_SUCCESS);
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(tx);
+  EXPECT_EQ(cardano_witness_set_set_native_scripts(witness_set, scripts), CARDANO_SUCCESS);
+  cardano_witness_set_unref(&witness_set);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report), CARDANO_SUCCESS);
+  EXPECT_NE(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_NATIVE_SCRIPT_FAILED, 0U);
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  EXPECT_EQ(cardano_transaction_body_set_invalid_before(body, &start), CARDANO_SUCCESS);
+  cardano_transaction_body_unref(&body);
+
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 1000U, &report), CARDANO_SUCCESS);
+  EXPECT_EQ(report.violations & (uint32_t)CARDANO_PHASE1_VIOLATION_NATIVE_SCRIPT_FAILED, 0U);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+  cardano_native_script_unref(&script);
+  cardano_native_script_set_unref(&scripts);
+}
+
+TEST(cardano_transaction_validate_phase1, returnsErrorIfPointerIsNull)
+{
+  // Arrange
+  cardano_transaction_t*             tx     = new_default_transaction(BALANCED_TX_CBOR);
+  cardano_protocol_parameters_t*     params = new_default_protocol_parameters();
+  cardano_utxo_list_t*               utxos  = new_default_utxo_list();
+  cardano_phase1_validation_result_t report = {};
+
+  // Act & Assert
+  EXPECT_EQ(cardano_transaction_validate_phase1(nullptr, utxos, params, 0U, &report), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, nullptr, params, 0U, &report), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, nullptr, 0U, &report), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_validate_phase1(tx, utxos, params, 0U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&params);
+  cardano_utxo_list_unref(&utxos);
+}
+
+TEST(cardano_phase1_violation_to_string, canConvertToString)
+{
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_INPUT_SET_EMPTY), "Phase-1 Violation: Input Set Empty");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_BAD_INPUTS), "Phase-1 Violation: Bad Inputs");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_FEE_TOO_SMALL), "Phase-1 Violation: Fee Too Small");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_VALUE_NOT_CONSERVED), "Phase-1 Violation: Value Not Conserved");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_OUTPUT_TOO_SMALL), "Phase-1 Violation: Output Too Small");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_OUTPUT_VALUE_TOO_LARGE), "Phase-1 Violation: Output Value Too Large");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_MAX_TX_SIZE_EXCEEDED), "Phase-1 Violation: Max Transaction Size Exceeded");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_EX_UNITS_TOO_BIG), "Phase-1 Violation: Execution Units Too Big");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_OUTSIDE_VALIDITY_INTERVAL), "Phase-1 Violation: Outside Validity Interval");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_NO_COLLATERAL_INPUTS), "Phase-1 Violation: No Collateral Inputs");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_TOO_MANY_COLLATERAL_INPUTS), "Phase-1 Violation: Too Many Collateral Inputs");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_INSUFFICIENT_COLLATERAL), "Phase-1 Violation: Insufficient Collateral");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_INCORRECT_TOTAL_COLLATERAL), "Phase-1 Violation: Incorrect Total Collateral");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_MISSING_VKEY_WITNESSES), "Phase-1 Violation: Missing VKey Witnesses");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_NATIVE_SCRIPT_FAILED), "Phase-1 Violation: Native Script Failed");
+  EXPECT_STREQ(cardano_phase1_violation_to_string(CARDANO_PHASE1_VIOLATION_COLLATERAL_CONTAINS_NON_ADA), "Phase-1 Violation: Collateral Contains Non-ADA");
+  EXPECT_STREQ(cardano_phase1_violation_to_string((cardano_phase1_violation_t)0), "Phase-1 Violation: Unknown");
+}
@@ -33,6 +33,7 @@
 #include <cardano/common/guard_set.h>
 #include <cardano/crypto/blake2b_hash.h>
 #include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/crypto/ed25519_private_key.h>
 #include <cardano/scripts/native_scripts/native_script.h>
 #include <cardano/scripts/native_scripts/script_require_guard.h>
 #include <cardano/transaction/transaction.h>
@@ -43,6 +44,7 @@
 #include <cardano/voting_procedures/voting_procedures.h>
 #include <cardano/witness_set/native_script_set.h>
 #include <cardano/witness_set/redeemer_tag.h>
+#include <cardano/witness_set/vkey_witness_set.h>
 #include <cardano/witness_set/witness_set.h>
 
 #include "../json_helpers.h"
@@ -2257,3 +2259,180 @@ TEST(cardano_transaction_find_withdrawal_index, returnsErrorIfMemoryAllocationFa
   cardano_reward_address_unref(&reward_address);
   cardano_set_allocators(malloc, realloc, free);
 }
+
+/* VERIFY HELPERS ************************************************************/
+
+static const char* SIGNING_SEED_1 = "9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60";
+static const char* SIGNING_SEED_2 = "4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb";
+
+/**
+ * Signs a message with the key derived from a seed and wraps the result in a vkey witness.
+ * @return A new vkey witness.
+ */
+static cardano_vkey_witness_t*
+new_signed_witness(const char* seed, const byte_t* message, const size_t message_size)
+{
+  cardano_ed25519_private_key_t* private_key = NULL;
+  cardano_ed25519_public_key_t*  public_key  = NULL;
+  cardano_ed25519_signature_t*   signature   = NULL;
+  cardano_vkey_witness_t*        witness     = NULL;
+
+  EXPECT_EQ(cardano_ed25519_private_key_from_normal_hex(seed, strlen(seed), &private_key), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_ed25519_private_key_get_public_key(private_key, &public_key), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_ed25519_private_key_sign(private_key, message, message_size, &signature), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_vkey_witness_new(public_key, signature, &witness), CARDANO_SUCCESS);
+
+  cardano_ed25519_private_key_unref(&private_key);
+  cardano_ed25519_public_key_unref(&public_key);
+  cardano_ed25519_signature_unref(&signature);
+
+  return witness;
+}
+
+/**
+ * Creates a transaction without key witnesses and attaches two witnesses signed over its id.
+ * When tamper is set, the second witness signs a different message instead.
+ * @return A new instance of the transaction.
+ */
+static cardano_transaction_t*
+new_signed_transaction(const bool tamper)
+{
+  cardano_transaction_t*      transaction = new_default_transaction(CBOR3);
+  cardano_blake2b_hash_t*     tx_id       = cardano_transaction_get_id(transaction);
+  cardano_vkey_witness_set_t* vkeys       = NULL;
+  const byte_t                other[]     = { 0x01U, 0x02U, 0x03U };
+
+  EXPECT_EQ(cardano_vkey_witness_set_new(&vkeys), CARDANO_SUCCESS);
+
+  cardano_vkey_witness_t* first  = new_signed_witness(SIGNING_SEED_1, cardano_blake2b_hash_get_data(tx_id), cardano_blake2b_hash_get_bytes_size(tx_id));
+  cardano_vkey_witness_t* second = tamper
+    ? new_signed_witness(SIGNING_SEED_2, other, sizeof(other))
+    : new_signed_witness(SIGNING_SEED_2, cardano_blake2b_hash_get_data(tx_id), cardano_blake2b_hash_get_bytes_size(tx_id));
+
+  EXPECT_EQ(cardano_vkey_witness_set_add(vkeys, first), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_vkey_witness_set_add(vkeys, second), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_transaction_apply_vkey_witnesses(transaction, vkeys), CARDANO_SUCCESS);
+
+  cardano_vkey_witness_unref(&first);
+  cardano_vkey_witness_unref(&second);
+  cardano_vkey_witness_set_unref(&vkeys);
+  cardano_blake2b_hash_unref(&tx_id);
+
+  return transaction;
+}
+
+TEST(cardano_transaction_verify_vkey_witnesses, returnsErrorIfGivenNull)
+{
+  // Arrange
+  cardano_transaction_t* transaction = new_default_transaction(CBOR3);
+  size_t                 invalid     = 0U;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_transaction_verify_vkey_witnesses(nullptr, nullptr, 0U, nullptr, 0U, &invalid), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_verify_vkey_witnesses(transaction, nullptr, 0U, nullptr, 0U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+}
+
+TEST(cardano_transaction_verify_vkey_witnesses, acceptsValidSignatures)
+{
+  // Arrange
+  cardano_transaction_t* transaction = new_signed_transaction(false);
+  bool                   valid[2]    = { false, false };
+  size_t                 invalid     = 99U;
+
+  // Act
+  const cardano_error_t result = cardano_transaction_verify_vkey_witnesses(transaction, valid, 2U, nullptr, 0U, &invalid);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(invalid, 0U);
+  EXPECT_TRUE(valid[0]);
+  EXPECT_TRUE(valid[1]);
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+}
+
+TEST(cardano_transaction_verify_vkey_witnesses, reportsEachInvalidSignature)
+{
+  // Arrange
+  cardano_transaction_t* transaction = new_signed_transaction(true);
+  bool                   valid[2]    = { false, false };
+  size_t                 invalid     = 0U;
+
+  // Act
+  const cardano_error_t result = cardano_transaction_verify_vkey_witnesses(transaction, valid, 2U, nullptr, 0U, &invalid);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(invalid, 1U);
+  EXPECT_NE(valid[0], valid[1]);
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+}
+
+TEST(cardano_transaction_verify_vkey_witnesses, checksBootstrapWitnesses)
+{
+  // Arrange
+  cardano_transaction_t* transaction  = new_default_transaction(CBOR);
+  bool                   vkey_valid[] = { true };
+  bool                   boot_valid[] = { true };
+  size_t                 invalid      = 0U;
+
+  // Act
+  const cardano_error_t result = cardano_transaction_verify_vkey_witnesses(transaction, vkey_valid, 1U, boot_valid, 1U, &invalid);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_EQ(invalid, 2U);
+  EXPECT_FALSE(vkey_valid[0]);
+  EXPECT_FALSE(boot_valid[0]);
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+}
+
+TEST(cardano_transaction_verify_vkey_witnesses, returnsErrorIfFlagArrayIsTooSmall)
+{
+  // Arrange
+  cardano_transaction_t* transaction = new_signed_transaction(false);
+  bool                   valid[1]    = { false };
+  size_t                 invalid     = 0U;
+
+  // Act
+  const cardano_error_t result = cardano_transaction_verify_vkey_witnesses(transaction, valid, 1U, nullptr, 0U, &invalid);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE);
+
+  // Cleanup
+  cardano_transaction_unref(&transaction);
+}
+
+TEST(cardano_transaction_verify_vkey_witnesses_many, flagsEachTransaction)
+{
+  // Arrange
+  cardano_transaction_t* transactions[] = { new_signed_transaction(false), new_signed_transaction(true), new_default_transaction(CBOR3) };
+  bool                   valid[]        = { false, true, false };
+
+  // Act
+  const cardano_error_t result = cardano_transaction_verify_vkey_witnesses_many(transactions, 3U, valid);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_SUCCESS);
+  EXPECT_TRUE(valid[0]);
+  EXPECT_FALSE(valid[1]);
+  EXPECT_TRUE(valid[2]);
+
+  EXPECT_EQ(cardano_transaction_verify_vkey_witnesses_many(nullptr, 3U, valid), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_verify_vkey_witnesses_many(transactions, 3U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  for (cardano_transaction_t*& transaction : transactions)
+  {
+    cardano_transaction_unref(&transaction);
+  }
+}
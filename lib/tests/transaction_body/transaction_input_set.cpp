@@ -753,6 +753,120 @@ TEST(cardano_transaction_input_set_add, returnsErrorIfDataIsNull)
   cardano_transaction_input_set_unref(&transaction_input_set);
 }
 
+TEST(cardano_transaction_input_set_add, keepsTheSetSorted)
+{
+  // Arrange
+  cardano_transaction_input_set_t* transaction_input_set = nullptr;
+  ASSERT_EQ(cardano_transaction_input_set_new(&transaction_input_set), CARDANO_SUCCESS);
+
+  const char* inputs[] = { TRANSACTION_INPUT3_CBOR, TRANSACTION_INPUT1_CBOR, TRANSACTION_INPUT4_CBOR, TRANSACTION_INPUT2_CBOR };
+
+  // Act
+  for (const char* cbor : inputs)
+  {
+    cardano_transaction_input_t* input = new_default_transaction_input(cbor);
+
+    EXPECT_EQ(cardano_transaction_input_set_add(transaction_input_set, input), CARDANO_SUCCESS);
+
+    cardano_transaction_input_unref(&input);
+  }
+
+  // Assert
+  ASSERT_EQ(cardano_transaction_input_set_get_length(transaction_input_set), 4U);
+
+  const char* sorted[] = { TRANSACTION_INPUT1_CBOR, TRANSACTION_INPUT2_CBOR, TRANSACTION_INPUT3_CBOR, TRANSACTION_INPUT4_CBOR };
+
+  for (size_t i = 0U; i < 4U; ++i)
+  {
+    cardano_transaction_input_t* input    = nullptr;
+    cardano_transaction_input_t* expected = new_default_transaction_input(sorted[i]);
+
+    ASSERT_EQ(cardano_transaction_input_set_get(transaction_input_set, i, &input), CARDANO_SUCCESS);
+    EXPECT_TRUE(cardano_transaction_input_equals(input, expected));
+
+    cardano_transaction_input_unref(&input);
+    cardano_transaction_input_unref(&expected);
+  }
+
+  // Cleanup
+  cardano_transaction_input_set_unref(&transaction_input_set);
+}
+
+TEST(cardano_transaction_input_set_find_index, findsThePositionOfEachInput)
+{
+  // Arrange
+  cardano_transaction_input_set_t* transaction_input_set = nullptr;
+  cardano_cbor_reader_t*           reader                = cardano_cbor_reader_from_hex(CBOR, strlen(CBOR));
+
+  ASSERT_EQ(cardano_transaction_input_set_from_cbor(reader, &transaction_input_set), CARDANO_SUCCESS);
+
+  const char* inputs[] = { TRANSACTION_INPUT1_CBOR, TRANSACTION_INPUT2_CBOR, TRANSACTION_INPUT3_CBOR, TRANSACTION_INPUT4_CBOR };
+
+  // Act & Assert
+  for (size_t i = 0U; i < 4U; ++i)
+  {
+    cardano_transaction_input_t* input = new_default_transaction_input(inputs[i]);
+    cardano_blake2b_hash_t*      id    = cardano_transaction_input_get_id(input);
+    size_t                       index = 99U;
+
+    EXPECT_EQ(cardano_transaction_input_set_find_index(transaction_input_set, id, 5U, &index), CARDANO_SUCCESS);
+    EXPECT_EQ(index, i);
+
+    EXPECT_EQ(cardano_transaction_input_set_find_index(transaction_input_set, id, 4U, &index), CARDANO_ERROR_ELEMENT_NOT_FOUND);
+    EXPECT_EQ(cardano_transaction_input_set_find_index(transaction_input_set, id, 6U, &index), CARDANO_ERROR_ELEMENT_NOT_FOUND);
+
+    cardano_blake2b_hash_unref(&id);
+    cardano_transaction_input_unref(&input);
+  }
+
+  // Cleanup
+  cardano_transaction_input_set_unref(&transaction_input_set);
+  cardano_cbor_reader_unref(&reader);
+}
+
+TEST(cardano_transaction_input_set_find_index, returnsNotFoundIfSetIsEmpty)
+{
+  // Arrange
+  cardano_transaction_input_set_t* transaction_input_set = nullptr;
+  ASSERT_EQ(cardano_transaction_input_set_new(&transaction_input_set), CARDANO_SUCCESS);
+
+  cardano_transaction_input_t* input = new_default_transaction_input(TRANSACTION_INPUT1_CBOR);
+  cardano_blake2b_hash_t*      id    = cardano_transaction_input_get_id(input);
+  size_t                       index = 0U;
+
+  // Act
+  cardano_error_t error = cardano_transaction_input_set_find_index(transaction_input_set, id, 0U, &index);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_ELEMENT_NOT_FOUND);
+
+  // Cleanup
+  cardano_blake2b_hash_unref(&id);
+  cardano_transaction_input_unref(&input);
+  cardano_transaction_input_set_unref(&transaction_input_set);
+}
+
+TEST(cardano_transaction_input_set_find_index, returnsErrorIfGivenANullPtr)
+{
+  // Arrange
+  cardano_transaction_input_set_t* transaction_input_set = nullptr;
+  ASSERT_EQ(cardano_transaction_input_set_new(&transaction_input_set), CARDANO_SUCCESS);
+
+  cardano_transaction_input_t* input = new_default_transaction_input(TRANSACTION_INPUT1_CBOR);
+  cardano_blake2b_hash_t*      id    = cardano_transaction_input_get_id(input);
+  size_t                       index = 0U;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_transaction_input_set_find_index(nullptr, id, 0U, &index), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_input_set_find_index(transaction_input_set, nullptr, 0U, &index), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_transaction_input_set_find_index(transaction_input_set, id, 0U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_blake2b_hash_unref(&id);
+  cardano_transaction_input_unref(&input);
+  cardano_transaction_input_set_unref(&transaction_input_set);
+}
+
 TEST(cardano_transaction_input_set_is_tagged, returnsFalseIfHashSetIsNull)
 {
   // Act
@@ -1405,3 +1405,26 @@ TEST(cardano_transaction_output_to_cip116_json, canConvertMaryPointerOutput)
   cardano_transaction_output_unref(&output);
   free(json_str);
 }
+
+TEST(cardano_transaction_output_to_cip116_json, returnsErrorIfAddressStringAllocationFails)
+{
+  // Arrange
+  cardano_transaction_output_t* output = new_default_output(CBOR);
+
+  cardano_json_writer_t* json = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act
+  cardano_error_t error = cardano_transaction_output_to_cip116_json(output, json);
+
+  cardano_set_allocators(malloc, realloc, free);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+
+  // Cleanup
+  cardano_json_writer_unref(&json);
+  cardano_transaction_output_unref(&output);
+}
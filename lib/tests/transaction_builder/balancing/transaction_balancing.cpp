@@ -34,6 +34,8 @@
 #include <cardano/witness_set/redeemer.h>
 #include <gmock/gmock.h>
 
+#include <string>
+
 /* CONSTANTS *****************************************************************/
 
 static const char* BALANCED_TX_CBOR    = "84a300d9010282825820027b68d4c11e97d7e065cc2702912cb1a21b6d0e56c6a74dd605889a5561138500825820d3c887d17486d483a2b46b58b01cb9344745f15fdd8f8e70a57f854cdd88a633010182a2005839005cf6c91279a859a072601779fb33bb07c34e1d641d45df51ff63b967f15db05f56035465bf8900a09bdaa16c3d8b8244fea686524408dd8001821a00e4e1c0a1581c0b0d621b5c26d0a1fd0893a4b04c19d860296a69ede1fbcfc5179882a1474e46542d30303101a200583900dc435fc2638f6684bd1f9f6f917d80c92ae642a4a33a412e516479e64245236ab8056760efceebbff57e8cab220182be3e36439e520a6454011a0d294e28021a00029eb9a0f5f6";
@@ -436,6 +438,76 @@ utxo_list_contains_input(cardano_utxo_list_t* list, cardano_blake2b_hash_t* id,
   return false;
 }
 
+/**
+ * \brief Balances the default transaction with a single-signature native script in its witness set.
+ *
+ * \param key_hash_hex The key hash the native script requires, in hex.
+ * \param padding The foreign signature count passed to the balancer.
+ *
+ * \return The fee of the balanced transaction.
+ */
+static uint64_t
+balance_with_native_script_signer(const char* key_hash_hex, const size_t padding)
+{
+  cardano_transaction_t*         tx               = new_transaction_without_inputs(BALANCED_TX_CBOR, 15000000);
+  cardano_protocol_parameters_t* protocol         = init_protocol_parameters();
+  cardano_utxo_list_t*           resolved_inputs  = new_default_utxo_list();
+  cardano_utxo_list_t*           reference_inputs = new_empty_utxo_list();
+  cardano_coin_selector_t*       coin_selector    = NULL;
+  cardano_tx_evaluator_t*        evaluator        = NULL;
+  cardano_address_t*             change_address   = create_address("addr_test1qqnqfr70emn3kyywffxja44znvdw0y4aeyh0vdc3s3rky48vlp50u6nrq5s7k6h89uqrjnmr538y6e50crvz6jdv3vqqxah5fk");
+  cardano_native_script_t*       script           = NULL;
+  cardano_native_script_set_t*   scripts          = NULL;
+  const std::string              script_cbor      = std::string("8200581c") + key_hash_hex;
+  cardano_cbor_reader_t*         reader           = cardano_cbor_reader_from_hex(script_cbor.c_str(), script_cbor.size());
+
+  EXPECT_EQ(cardano_native_script_from_cbor(reader, &script), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_native_script_set_new(&scripts), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_native_script_set_add(scripts, script), CARDANO_SUCCESS);
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(tx);
+  cardano_witness_set_unref(&witness_set);
+
+  EXPECT_EQ(cardano_witness_set_set_native_scripts(witness_set, scripts), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_large_first_coin_selector_new(&coin_selector), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_tx_evaluator_new(cardano_evaluator_impl_new(), &evaluator), CARDANO_SUCCESS);
+
+  EXPECT_EQ(
+    cardano_balance_transaction(
+      tx,
+      padding,
+      protocol,
+      reference_inputs,
+      NULL,
+      NULL,
+      resolved_inputs,
+      coin_selector,
+      change_address,
+      reference_inputs,
+      change_address,
+      evaluator,
+      nullptr),
+    CARDANO_SUCCESS);
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  cardano_transaction_body_unref(&body);
+
+  const uint64_t fee = cardano_transaction_body_get_fee(body);
+
+  cardano_cbor_reader_unref(&reader);
+  cardano_native_script_unref(&script);
+  cardano_native_script_set_unref(&scripts);
+  cardano_transaction_unref(&tx);
+  cardano_protocol_parameters_unref(&protocol);
+  cardano_utxo_list_unref(&reference_inputs);
+  cardano_utxo_list_unref(&resolved_inputs);
+  cardano_coin_selector_unref(&coin_selector);
+  cardano_tx_evaluator_unref(&evaluator);
+  cardano_address_unref(&change_address);
+
+  return fee;
+}
+
 /* UNIT TESTS ****************************************************************/
 
 TEST(cardano_balance_transaction, canBalanceATransaction)
@@ -856,6 +928,27 @@ TEST(cardano_balance_transaction, forwardsReferenceInputsToTheEvaluator)
   cardano_address_unref(&change_address);
 }
 
+TEST(cardano_balance_transaction, countsNativeScriptSignersOnTopOfThePadding)
+{
+  // Arrange - the default UTxOs are all locked by the first key; the second key signs nothing else.
+  const char*                    input_key   = "287a7e37219128cfb05322626daa8b19d1ad37c6779d21853f7b9417";
+  const char*                    foreign_key = "cb0ec2692497b458e46812c8a5bfa2931d1a2d965a99893828ec810f";
+  cardano_protocol_parameters_t* protocol    = init_protocol_parameters();
+  const uint64_t                 witness_fee = 101U * cardano_protocol_parameters_get_min_fee_a(protocol);
+
+  cardano_protocol_parameters_unref(&protocol);
+
+  // Act
+  const uint64_t shared_signer         = balance_with_native_script_signer(input_key, 0U);
+  const uint64_t native_signer         = balance_with_native_script_signer(foreign_key, 0U);
+  const uint64_t native_signer_and_pad = balance_with_native_script_signer(foreign_key, 1U);
+
+  // Assert - a native-script signer costs one witness unless an input already needs it, and
+  // padding is charged on top of it, so padding must not repeat native-script signers.
+  EXPECT_EQ(native_signer - shared_signer, witness_fee);
+  EXPECT_EQ(native_signer_and_pad - native_signer, witness_fee);
+}
+
 TEST(cardano_is_transaction_balanced, returnsTrueIfTheTransactionIsBalanced)
 {
   // Arrange
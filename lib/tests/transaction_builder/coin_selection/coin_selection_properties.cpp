@@ -28,6 +28,7 @@
 #include <cardano/assets/asset_id_map.h>
 #include <cardano/assets/asset_name.h>
 #include <cardano/assets/multi_asset.h>
+#include <cardano/cbor/cbor_writer.h>
 #include <cardano/common/utxo.h>
 #include <cardano/common/utxo_list.h>
 #include <cardano/crypto/blake2b_hash.h>
@@ -1414,6 +1415,194 @@ TEST(cardano_coin_selector_properties, randomImproveSplitsOversizedChange)
   cardano_coin_selector_unref(&selector);
 }
 
+/**
+ * Generates a quantity whose CBOR encoding lands in a random width class, signed or not.
+ */
+static int64_t
+gen_sized_quantity(prop_rng_t& rng)
+{
+  static const int64_t bounds[] = { 23, 255, 65535, 4294967295LL, INT64_MAX };
+
+  const int64_t magnitude = rng.range(1, bounds[rng.next() % 5U]);
+
+  return ((rng.next() % 4U) == 0U) ? -magnitude : magnitude;
+}
+
+/**
+ * Builds a value with the largest ada quantity and random policies, asset names and quantities,
+ * feeding the same assets to an analytic size model as it goes.
+ */
+static cardano_value_t*
+build_sized_value(prop_rng_t& rng, const size_t max_assets, cardano_value_size_t* size)
+{
+  cardano_multi_asset_t* multi_asset = NULL;
+
+  EXPECT_EQ(cardano_multi_asset_new(&multi_asset), CARDANO_SUCCESS);
+
+  _cardano_coin_selection_value_size_init(size, 45000000000000000U);
+
+  const size_t policy_count = rng.next() % 4U;
+
+  for (size_t p = 0U; p < policy_count; ++p)
+  {
+    uint8_t policy_bytes[28] = { 0 };
+    policy_bytes[0]          = (uint8_t)p;
+
+    cardano_blake2b_hash_t* policy = NULL;
+    EXPECT_EQ(cardano_blake2b_hash_from_bytes(policy_bytes, sizeof(policy_bytes), &policy), CARDANO_SUCCESS);
+
+    const size_t asset_count = 1U + (rng.next() % max_assets);
+
+    for (size_t a = 0U; a < asset_count; ++a)
+    {
+      uint8_t name_bytes[32] = { 0 };
+
+      // The leading bytes keep every name distinct within its policy.
+      const size_t name_size = 2U + (rng.next() % 31U);
+      name_bytes[0]          = (uint8_t)(a >> 8U);
+      name_bytes[1]          = (uint8_t)a;
+
+      cardano_asset_name_t* name = NULL;
+      EXPECT_EQ(cardano_asset_name_from_bytes(name_bytes, name_size, &name), CARDANO_SUCCESS);
+
+      const int64_t quantity = gen_sized_quantity(rng);
+
+      EXPECT_EQ(cardano_multi_asset_set(multi_asset, policy, name, quantity), CARDANO_SUCCESS);
+
+      _cardano_coin_selection_value_size_add_asset(size, a == 0U, sizeof(policy_bytes), name_size, quantity);
+
+      cardano_asset_name_unref(&name);
+    }
+
+    cardano_blake2b_hash_unref(&policy);
+  }
+
+  cardano_value_t* value = NULL;
+
+  EXPECT_EQ(cardano_value_new(45000000000000000, multi_asset, &value), CARDANO_SUCCESS);
+
+  cardano_multi_asset_unref(&multi_asset);
+
+  return value;
+}
+
+static size_t
+encoded_value_size(cardano_value_t* value)
+{
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+  EXPECT_EQ(cardano_value_to_cbor(value, writer), CARDANO_SUCCESS);
+
+  const size_t size = cardano_cbor_writer_get_encode_size(writer);
+
+  cardano_cbor_writer_unref(&writer);
+
+  return size;
+}
+
+TEST(cardano_coin_selector_properties, analyticValueSizeMatchesCborEncoding)
+{
+  prop_rng_t rng(PROPERTY_SEED);
+
+  for (size_t iteration = 0U; iteration < ITERATIONS; ++iteration)
+  {
+    cardano_value_size_t size;
+    cardano_value_t*     value   = build_sized_value(rng, (iteration % 2U) ? 30U : 300U, &size);
+    const size_t         encoded = encoded_value_size(value);
+
+    ASSERT_EQ(_cardano_coin_selection_value_size_get(&size), encoded) << "iteration " << iteration;
+
+    bool is_oversized = true;
+
+    ASSERT_EQ(_cardano_coin_selection_value_is_oversized(value, encoded, &is_oversized), CARDANO_SUCCESS);
+    EXPECT_FALSE(is_oversized);
+
+    ASSERT_EQ(_cardano_coin_selection_value_is_oversized(value, encoded - 1U, &is_oversized), CARDANO_SUCCESS);
+    EXPECT_TRUE(is_oversized);
+
+    cardano_value_unref(&value);
+  }
+}
+
+TEST(cardano_coin_selector_properties, splitValueAssetsPartitionsIntoSizeCompliantParts)
+{
+  prop_rng_t rng(PROPERTY_SEED);
+
+  for (size_t iteration = 0U; iteration < 200U; ++iteration)
+  {
+    cardano_value_size_t size;
+    cardano_value_t*     value          = build_sized_value(rng, 80U, &size);
+    const uint64_t       max_value_size = (uint64_t)rng.range(100, 2000);
+
+    cardano_value_part_list_t parts = { NULL, 0U, 0U };
+
+    ASSERT_EQ(_cardano_coin_selection_split_value_assets(value, max_value_size, &parts), CARDANO_SUCCESS);
+    ASSERT_GE(parts.size, 1U);
+
+    cardano_value_t* total = cardano_value_new_zero();
+
+    for (size_t i = 0U; i < parts.size; ++i)
+    {
+      EXPECT_EQ(cardano_value_get_coin(parts.items[i]), 0);
+
+      bool is_oversized = true;
+      ASSERT_EQ(_cardano_coin_selection_value_is_oversized(parts.items[i], max_value_size, &is_oversized), CARDANO_SUCCESS);
+
+      if (is_oversized)
+      {
+        // Only a single asset too large on its own may exceed the limit.
+        EXPECT_EQ(cardano_value_get_asset_count(parts.items[i]), 1U);
+      }
+
+      cardano_value_t* sum = NULL;
+      ASSERT_EQ(cardano_value_add(total, parts.items[i], &sum), CARDANO_SUCCESS);
+
+      cardano_value_unref(&total);
+      total = sum;
+    }
+
+    ASSERT_EQ(cardano_value_set_coin(total, 45000000000000000), CARDANO_SUCCESS);
+    EXPECT_TRUE(cardano_value_equals(total, value)) << "iteration " << iteration;
+
+    cardano_value_unref(&total);
+    _cardano_coin_selection_value_parts_free(&parts);
+    cardano_value_unref(&value);
+  }
+}
+
+TEST(cardano_coin_selector_properties, splitValueAssetsDoesntCrashIfMemoryAllocationFails)
+{
+  prop_rng_t           rng(PROPERTY_SEED);
+  cardano_value_size_t size;
+  cardano_value_t*     value = build_sized_value(rng, 40U, &size);
+
+  for (int budget = 0; budget < 400; ++budget)
+  {
+    cardano_value_part_list_t parts = { NULL, 0U, 0U };
+
+    reset_allocators_run_count();
+    set_malloc_limit(budget);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    const cardano_error_t result = _cardano_coin_selection_split_value_assets(value, 200U, &parts);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      EXPECT_GE(parts.size, 1U);
+    }
+    else
+    {
+      EXPECT_EQ(parts.size, 0U);
+    }
+
+    _cardano_coin_selection_value_parts_free(&parts);
+  }
+
+  cardano_value_unref(&value);
+}
+
 TEST(cardano_coin_selector_properties, randomImproveDistributesUserAssetsProportionally)
 {
   // Golden vector adapted from unit_makeChange in the reference implementation (scaled to
@@ -4897,7 +4897,7 @@ TEST(cardano_tx_builder_delegate_stake_ex, returnsErrorOnMemoryAllocationFail)
 
   EXPECT_EQ(cardano_reward_address_from_bech32(REWARD_ADDRESS, strlen(REWARD_ADDRESS), &reward_address), CARDANO_SUCCESS);
 
-  for (int i = 0; i < 44; ++i)
+  for (int i = 0; i < 36; ++i)
   {
     cardano_tx_builder_t* tx_builder = cardano_tx_builder_new(params, &CARDANO_MAINNET_SLOT_CONFIG);
 
@@ -6743,7 +6743,7 @@ TEST(cardano_tx_builder_propose_treasury_withdrawals_ex, returnsErrorIfMemoryAll
   EXPECT_EQ(cardano_withdrawal_map_from_cbor(reader, &treasury_withdrawal), CARDANO_SUCCESS);
   cardano_cbor_reader_unref(&reader);
 
-  for (int i = 0; i < 93; ++i)
+  for (int i = 0; i < 83; ++i)
   {
     cardano_tx_builder_t* tx_builder = cardano_tx_builder_new(params, &CARDANO_MAINNET_SLOT_CONFIG);
 
@@ -32,6 +32,7 @@
 
 #include <cstdint>
 #include <gmock/gmock.h>
+#include <vector>
 
 /* STATIC HELPERS ************************************************************/
 
@@ -558,6 +559,123 @@ TEST(cardano_uplc_arena_bytes_used, accountsForAlignmentPadding)
   cardano_uplc_arena_free(&arena);
 }
 
+TEST(cardano_uplc_arena_block_count, returnsZeroWhenArenaIsNull)
+{
+  // Assert
+  EXPECT_EQ(cardano_uplc_arena_block_count(nullptr), 0U);
+}
+
+TEST(cardano_uplc_arena_block_count, countsLiveBlocksUntilReset)
+{
+  // Arrange
+  cardano_uplc_arena_t* arena = nullptr;
+  ASSERT_EQ(cardano_uplc_arena_new(128U, &arena), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_uplc_arena_block_count(arena), 0U);
+
+  // Act
+  ASSERT_THAT(cardano_uplc_arena_alloc(arena, 64U, 8U), testing::Not((void*)nullptr));
+  EXPECT_EQ(cardano_uplc_arena_block_count(arena), 1U);
+
+  ASSERT_THAT(cardano_uplc_arena_alloc(arena, 96U, 8U), testing::Not((void*)nullptr));
+  EXPECT_EQ(cardano_uplc_arena_block_count(arena), 2U);
+
+  ASSERT_THAT(cardano_uplc_arena_alloc(arena, 4096U, 8U), testing::Not((void*)nullptr));
+  EXPECT_EQ(cardano_uplc_arena_block_count(arena), 3U);
+
+  cardano_uplc_arena_reset(arena);
+
+  // Assert
+  EXPECT_EQ(cardano_uplc_arena_block_count(arena), 0U);
+
+  ASSERT_THAT(cardano_uplc_arena_alloc(arena, 64U, 8U), testing::Not((void*)nullptr));
+  EXPECT_EQ(cardano_uplc_arena_block_count(arena), 1U);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_arena_owns, returnsFalseWhenArgumentsAreNull)
+{
+  // Arrange
+  cardano_uplc_arena_t* arena = nullptr;
+  int                   local = 0;
+  ASSERT_EQ(cardano_uplc_arena_new(128U, &arena), CARDANO_SUCCESS);
+
+  // Assert
+  EXPECT_FALSE(cardano_uplc_arena_owns(nullptr, &local));
+  EXPECT_FALSE(cardano_uplc_arena_owns(arena, nullptr));
+
+  // Cleanup
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_arena_owns, recognizesOnlyLiveAllocationsOfTheArena)
+{
+  // Arrange
+  cardano_uplc_arena_t* arena = nullptr;
+  cardano_uplc_arena_t* other = nullptr;
+  int                   local = 0;
+  ASSERT_EQ(cardano_uplc_arena_new(128U, &arena), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_arena_new(128U, &other), CARDANO_SUCCESS);
+
+  // Act
+  byte_t* small   = (byte_t*)cardano_uplc_arena_alloc(arena, 16U, 8U);
+  byte_t* large   = (byte_t*)cardano_uplc_arena_alloc(arena, 4096U, 8U);
+  void*   foreign = cardano_uplc_arena_alloc(other, 16U, 8U);
+
+  ASSERT_NE(small, nullptr);
+  ASSERT_NE(large, nullptr);
+  ASSERT_NE(foreign, nullptr);
+
+  // Assert
+  EXPECT_TRUE(cardano_uplc_arena_owns(arena, small));
+  EXPECT_TRUE(cardano_uplc_arena_owns(arena, small + 15));
+  EXPECT_TRUE(cardano_uplc_arena_owns(arena, large + 4095));
+  EXPECT_FALSE(cardano_uplc_arena_owns(arena, foreign));
+  EXPECT_FALSE(cardano_uplc_arena_owns(arena, &local));
+
+  cardano_uplc_arena_reset(arena);
+
+  EXPECT_FALSE(cardano_uplc_arena_owns(arena, small));
+
+  // Cleanup
+  cardano_uplc_arena_free(&arena);
+  cardano_uplc_arena_free(&other);
+}
+
+TEST(cardano_uplc_arena_owns, rejectsAllocationsOfAnArenaWithManyBlocks)
+{
+  // Arrange
+  cardano_uplc_arena_t* arena = nullptr;
+  cardano_uplc_arena_t* other = nullptr;
+  ASSERT_EQ(cardano_uplc_arena_new(64U, &arena), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_arena_new(64U, &other), CARDANO_SUCCESS);
+
+  std::vector<void*> own;
+  std::vector<void*> foreign;
+
+  // Act
+  for (size_t i = 0U; i < 32U; ++i)
+  {
+    own.push_back(cardano_uplc_arena_alloc(arena, 48U, 8U));
+    foreign.push_back(cardano_uplc_arena_alloc(other, 48U, 8U));
+  }
+
+  // Assert
+  for (size_t i = 0U; i < own.size(); ++i)
+  {
+    ASSERT_NE(own[i], nullptr);
+    ASSERT_NE(foreign[i], nullptr);
+    EXPECT_TRUE(cardano_uplc_arena_owns(arena, own[i]));
+    EXPECT_FALSE(cardano_uplc_arena_owns(arena, foreign[i]));
+    EXPECT_TRUE(cardano_uplc_arena_owns(other, foreign[i]));
+  }
+
+  // Cleanup
+  cardano_uplc_arena_free(&arena);
+  cardano_uplc_arena_free(&other);
+}
+
 TEST(cardano_uplc_arena_free, toleratesNullArguments)
 {
   // Arrange
@@ -612,6 +612,22 @@ TEST(cardano_uplc_builtin_body, listToArrayThenLengthOfArray)
     "(con integer 0)");
 }
 
+TEST(cardano_uplc_builtin_body, sharedSmallIntegerResultsFeedBigintBuiltins)
+{
+  // addInteger returns a shared small-integer value; integerToByteString and
+  // expModInteger need its bigint, which must be built without touching the
+  // read-only shared constant, as many times as it is used.
+  EXPECT_EQ(
+    eval_ok("(program 1.0.0 [ [ [ (builtin integerToByteString) (con bool True) ] (con integer 0) ] [ [ (builtin addInteger) (con integer 1) ] (con integer 2) ] ])"),
+    "(con bytestring #03)");
+  EXPECT_EQ(
+    eval_ok("(program 1.0.0 [ (lam x [ [ [ (builtin expModInteger) x ] x ] (con integer 5) ]) [ [ (builtin addInteger) (con integer 1) ] (con integer 2) ] ])"),
+    "(con integer 2)");
+  EXPECT_EQ(
+    eval_ok("(program 1.0.0 [ [ (builtin lessThanInteger) [ [ (builtin subtractInteger) (con integer 0) ] (con integer 16) ] ] (con integer -15) ])"),
+    "(con bool True)");
+}
+
 TEST(cardano_uplc_builtin_body, lengthOfArrayRejectsAList)
 {
   cardano_uplc_eval_status_t status = CARDANO_UPLC_EVAL_SUCCESS;
@@ -22,6 +22,7 @@
 /* INCLUDES ******************************************************************/
 
 #include "../../src/uplc/ast/uplc_term.h"
+#include "../../src/uplc/machine/uplc_lower.h"
 #include "../../src/uplc/machine/uplc_machine.h"
 #include <cardano/buffer.h>
 #include <cardano/error.h>
@@ -295,7 +296,20 @@ run_case(const fs::path& input_path, Counts& counts)
                                << "\n  actual   cpu/mem: " << result.spent.cpu << "/" << result.spent.mem;
       }
 
-      case_passed = term_ok && budget_parsed && budget_ok;
+      // The lowered form of the program must reproduce the same result and
+      // spent budget bit for bit.
+      const cardano_uplc_program_t* lowered        = nullptr;
+      cardano_uplc_eval_result_t    lowered_result = {};
+      const bool                    lowered_ok =
+        (cardano_uplc_int_lower_program(arena, program, &lowered) == CARDANO_SUCCESS)
+        && (cardano_uplc_evaluate(arena, lowered, MACHINE_VERSION, initial, &lowered_result) == CARDANO_SUCCESS)
+        && (lowered_result.status == result.status)
+        && (lowered_result.spent.cpu == result.spent.cpu)
+        && (lowered_result.spent.mem == result.spent.mem)
+        && (render_term(lowered_result.result) == actual_render);
+      EXPECT_TRUE(lowered_ok) << "lowered program diverged from the decoded program: " << input_str;
+
+      case_passed = term_ok && budget_parsed && budget_ok && lowered_ok;
       break;
     }
 
@@ -24,6 +24,7 @@
 #include <cardano/error.h>
 
 #include "../../src/uplc/arena/uplc_arena.h"
+#include "../../src/uplc/builtins/uplc_builtin_site.h"
 #include "../../src/uplc/builtins/uplc_builtin_semantics.h"
 #include "../../src/uplc/cost/uplc_builtin_costs.h"
 #include "../../src/uplc/cost/uplc_cost_model.h"
@@ -2736,6 +2737,75 @@ TEST(cardano_uplc_builtin_cost, replicate_byte_uses_literal_width)
   cardano_uplc_arena_free(&arena);
 }
 
+TEST(cardano_uplc_builtin_cost_resolve, matches_general_costing)
+{
+  cardano_uplc_arena_t* arena = nullptr;
+  ASSERT_EQ(cardano_uplc_arena_new(4096U, &arena), CARDANO_SUCCESS);
+
+  cardano_uplc_builtin_costs_t costs = cardano_uplc_builtin_costs_v3();
+
+  const cardano_uplc_value_t* args[3];
+  args[0] = make_int_value(arena, 16);
+  args[1] = make_int_value(arena, 255);
+  args[2] = make_bytes_value(arena, 24U);
+
+  const cardano_uplc_builtin_t funcs[] = {
+    CARDANO_UPLC_BUILTIN_SHA2_256,
+    CARDANO_UPLC_BUILTIN_ADD_INTEGER,
+    CARDANO_UPLC_BUILTIN_REPLICATE_BYTE,
+    CARDANO_UPLC_BUILTIN_SLICE_BYTE_STRING
+  };
+  const size_t counts[] = { 1U, 2U, 2U, 3U };
+
+  for (size_t i = 0U; i < sizeof(funcs) / sizeof(funcs[0]); ++i)
+  {
+    const cardano_uplc_value_t* const* call_args = (funcs[i] == CARDANO_UPLC_BUILTIN_SHA2_256) ? &args[2] : args;
+
+    cardano_uplc_builtin_cost_fn_t cost_fn = cardano_uplc_builtin_cost_resolve(&costs, funcs[i]);
+    ASSERT_NE(cost_fn, nullptr);
+
+    cardano_uplc_budget_t expected = cardano_uplc_builtin_cost(&costs, funcs[i], call_args, counts[i], false);
+    cardano_uplc_budget_t actual   = cost_fn(&costs.entries[funcs[i]], funcs[i], call_args, counts[i], false);
+
+    EXPECT_EQ(actual.cpu, expected.cpu);
+    EXPECT_EQ(actual.mem, expected.mem);
+  }
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_builtin_sites_init, resolves_shape_and_availability)
+{
+  cardano_uplc_builtin_costs_t costs = cardano_uplc_builtin_costs_v1();
+  cardano_uplc_builtin_sites_t sites;
+
+  ASSERT_EQ(cardano_uplc_builtin_sites_init(&costs, CARDANO_UPLC_SEMANTICS_B, CARDANO_UPLC_LANG_VERSION_V1, 9U, &sites), CARDANO_SUCCESS);
+
+  const cardano_uplc_builtin_site_t* if_then_else = cardano_uplc_builtin_sites_get(&sites, CARDANO_UPLC_BUILTIN_IF_THEN_ELSE);
+  ASSERT_NE(if_then_else, nullptr);
+  EXPECT_EQ(if_then_else->func, CARDANO_UPLC_BUILTIN_IF_THEN_ELSE);
+  EXPECT_EQ(if_then_else->arity, 3U);
+  EXPECT_EQ(if_then_else->force_count, 1U);
+  EXPECT_TRUE(if_then_else->available);
+  EXPECT_EQ(if_then_else->cost, &costs.entries[CARDANO_UPLC_BUILTIN_IF_THEN_ELSE]);
+  EXPECT_NE(if_then_else->cost_fn, nullptr);
+
+  const cardano_uplc_builtin_site_t* drop_list = cardano_uplc_builtin_sites_get(&sites, CARDANO_UPLC_BUILTIN_DROP_LIST);
+  ASSERT_NE(drop_list, nullptr);
+  EXPECT_FALSE(drop_list->available);
+
+  EXPECT_EQ(cardano_uplc_builtin_sites_get(&sites, (cardano_uplc_builtin_t)CARDANO_UPLC_BUILTIN_COUNT), nullptr);
+}
+
+TEST(cardano_uplc_builtin_sites_init, returns_error_if_pointer_is_null)
+{
+  cardano_uplc_builtin_costs_t costs = cardano_uplc_builtin_costs_v1();
+  cardano_uplc_builtin_sites_t sites;
+
+  EXPECT_EQ(cardano_uplc_builtin_sites_init(nullptr, CARDANO_UPLC_SEMANTICS_B, CARDANO_UPLC_LANG_VERSION_V1, 9U, &sites), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_builtin_sites_init(&costs, CARDANO_UPLC_SEMANTICS_B, CARDANO_UPLC_LANG_VERSION_V1, 9U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+}
+
 TEST(cardano_uplc_builtin_cost, shift_byte_string_uses_abs_literal)
 {
   cardano_uplc_arena_t* arena = nullptr;
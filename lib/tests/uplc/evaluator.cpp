@@ -28,6 +28,7 @@
 #include <cardano/error.h>
 #include <cardano/plutus_data/plutus_data.h>
 #include <cardano/plutus_data/plutus_list.h>
+#include <cardano/scripts/plutus_scripts/plutus_v3_script.h>
 #include <cardano/uplc/uplc_apply_params.h>
 
 #include "../../src/uplc/arena/uplc_arena.h"
@@ -530,3 +531,183 @@ TEST(cardano_uplc_apply_params_to_script, failsWhenAnInteriorAllocationFails)
   cardano_buffer_unref(&script);
   cardano_plutus_list_unref(&params);
 }
+
+TEST(cardano_uplc_apply_params_cache_new, failsOnNullOrZeroCapacity)
+{
+  cardano_uplc_apply_params_cache_t* cache = nullptr;
+
+  EXPECT_EQ(cardano_uplc_apply_params_cache_new(4U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_new(0U, &cache), CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(cache, nullptr);
+}
+
+TEST(cardano_uplc_apply_params_cache_new, createsARefCountedCache)
+{
+  cardano_uplc_apply_params_cache_t* cache = nullptr;
+
+  ASSERT_EQ(cardano_uplc_apply_params_cache_new(4U, &cache), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_refcount(cache), 1U);
+
+  cardano_uplc_apply_params_cache_ref(cache);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_refcount(cache), 2U);
+
+  cardano_uplc_apply_params_cache_unref(&cache);
+  EXPECT_NE(cache, nullptr);
+  cardano_uplc_apply_params_cache_unref(&cache);
+  EXPECT_EQ(cache, nullptr);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_refcount(cache), 0U);
+}
+
+TEST(cardano_uplc_apply_params_cache_apply, matchesTheUncachedApplicationAndServesRepeats)
+{
+  // Arrange
+  cardano_buffer_t*      script = cardano_buffer_from_hex(kCompiledCode, strlen(kCompiledCode));
+  cardano_plutus_list_t* params = new_list();
+  list_append_int(params, 42);
+
+  cardano_uplc_apply_params_cache_t* cache    = nullptr;
+  cardano_buffer_t*                  expected = nullptr;
+  cardano_buffer_t*                  first    = nullptr;
+  cardano_buffer_t*                  second   = nullptr;
+  cardano_blake2b_hash_t*            hash     = nullptr;
+  cardano_blake2b_hash_t*            hash2    = nullptr;
+
+  ASSERT_EQ(cardano_uplc_apply_params_cache_new(4U, &cache), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_apply_params_to_script(params, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &expected), CARDANO_SUCCESS);
+
+  // Act
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, params, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &first, &hash), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, params, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &second, &hash2), CARDANO_SUCCESS);
+
+  // Assert
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_TRUE(cardano_buffer_equals(first, expected));
+  EXPECT_TRUE(cardano_buffer_equals(second, expected));
+  EXPECT_NE(first, second);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_misses(cache), 1U);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_hits(cache), 1U);
+
+  cardano_plutus_v3_script_t* v3 = nullptr;
+  ASSERT_EQ(cardano_plutus_v3_script_new_bytes(cardano_buffer_get_data(expected), cardano_buffer_get_size(expected), &v3), CARDANO_SUCCESS);
+  cardano_blake2b_hash_t* script_hash = cardano_plutus_v3_script_get_hash(v3);
+
+  EXPECT_TRUE(cardano_blake2b_hash_equals(hash, script_hash));
+  EXPECT_TRUE(cardano_blake2b_hash_equals(hash2, script_hash));
+
+  // Cleanup
+  cardano_blake2b_hash_unref(&script_hash);
+  cardano_plutus_v3_script_unref(&v3);
+  cardano_blake2b_hash_unref(&hash);
+  cardano_blake2b_hash_unref(&hash2);
+  cardano_buffer_unref(&first);
+  cardano_buffer_unref(&second);
+  cardano_buffer_unref(&expected);
+  cardano_buffer_unref(&script);
+  cardano_plutus_list_unref(&params);
+  cardano_uplc_apply_params_cache_unref(&cache);
+}
+
+TEST(cardano_uplc_apply_params_cache_apply, keysByParamsAndLanguage)
+{
+  // Arrange
+  cardano_buffer_t*      script = build_identity_script();
+  cardano_plutus_list_t* one    = new_list();
+  cardano_plutus_list_t* two    = new_list();
+  list_append_int(one, 1);
+  list_append_int(two, 2);
+
+  cardano_uplc_apply_params_cache_t* cache    = nullptr;
+  cardano_buffer_t*                  out_one  = nullptr;
+  cardano_buffer_t*                  out_two  = nullptr;
+  cardano_buffer_t*                  out_v2   = nullptr;
+  cardano_blake2b_hash_t*            hash_one = nullptr;
+  cardano_blake2b_hash_t*            hash_v2  = nullptr;
+
+  ASSERT_EQ(cardano_uplc_apply_params_cache_new(4U, &cache), CARDANO_SUCCESS);
+
+  // Act
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, one, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &out_one, &hash_one), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, two, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &out_two, nullptr), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V2, one, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &out_v2, &hash_v2), CARDANO_SUCCESS);
+
+  // Assert
+  EXPECT_FALSE(cardano_buffer_equals(out_one, out_two));
+  EXPECT_TRUE(cardano_buffer_equals(out_one, out_v2));
+  EXPECT_FALSE(cardano_blake2b_hash_equals(hash_one, hash_v2));
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_misses(cache), 3U);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_hits(cache), 0U);
+
+  // Cleanup
+  cardano_blake2b_hash_unref(&hash_one);
+  cardano_blake2b_hash_unref(&hash_v2);
+  cardano_buffer_unref(&out_one);
+  cardano_buffer_unref(&out_two);
+  cardano_buffer_unref(&out_v2);
+  cardano_buffer_unref(&script);
+  cardano_plutus_list_unref(&one);
+  cardano_plutus_list_unref(&two);
+  cardano_uplc_apply_params_cache_unref(&cache);
+}
+
+TEST(cardano_uplc_apply_params_cache_apply, evictsTheLeastRecentlyUsedApplication)
+{
+  // Arrange
+  cardano_buffer_t*      script = build_identity_script();
+  cardano_plutus_list_t* one    = new_list();
+  cardano_plutus_list_t* two    = new_list();
+  list_append_int(one, 1);
+  list_append_int(two, 2);
+
+  cardano_uplc_apply_params_cache_t* cache = nullptr;
+  ASSERT_EQ(cardano_uplc_apply_params_cache_new(1U, &cache), CARDANO_SUCCESS);
+
+  const cardano_plutus_list_t* sequence[] = { one, one, two, one };
+
+  // Act
+  for (const cardano_plutus_list_t* params : sequence)
+  {
+    cardano_buffer_t* out = nullptr;
+    EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, params, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &out, nullptr), CARDANO_SUCCESS);
+    cardano_buffer_unref(&out);
+  }
+
+  // Assert
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_hits(cache), 1U);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_misses(cache), 3U);
+
+  cardano_uplc_apply_params_cache_clear(cache);
+
+  cardano_buffer_t* out = nullptr;
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, one, cardano_buffer_get_data(script), cardano_buffer_get_size(script), &out, nullptr), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_misses(cache), 4U);
+
+  // Cleanup
+  cardano_buffer_unref(&out);
+  cardano_buffer_unref(&script);
+  cardano_plutus_list_unref(&one);
+  cardano_plutus_list_unref(&two);
+  cardano_uplc_apply_params_cache_unref(&cache);
+}
+
+TEST(cardano_uplc_apply_params_cache_apply, doesNotCacheFailures)
+{
+  // Arrange
+  const byte_t                       malformed[] = { 0x41, 0xFF };
+  cardano_uplc_apply_params_cache_t* cache       = nullptr;
+  cardano_buffer_t*                  out         = nullptr;
+
+  ASSERT_EQ(cardano_uplc_apply_params_cache_new(2U, &cache), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, nullptr, malformed, sizeof(malformed), &out, nullptr), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, nullptr, malformed, sizeof(malformed), &out, nullptr), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, nullptr, malformed, 0U, &out, nullptr), CARDANO_ERROR_DECODING);
+  EXPECT_EQ(out, nullptr);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_get_hits(cache), 0U);
+
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(nullptr, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, nullptr, malformed, sizeof(malformed), &out, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_apply_params_cache_apply(cache, CARDANO_PLUTUS_LANGUAGE_VERSION_V3, nullptr, malformed, sizeof(malformed), nullptr, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_uplc_apply_params_cache_unref(&cache);
+}
@@ -30,6 +30,7 @@
 #include "../../src/uplc/arena/uplc_arena.h"
 #include "../../src/uplc/builtins/bls.h"
 #include "../../src/uplc/flat/flat_decode.h"
+#include "../../src/uplc/flat/flat_encode.h"
 #include "../../src/uplc/flat/flat_reader.h"
 #include "../../src/uplc/flat/flat_writer.h"
 #include "../../src/uplc/syntax/pretty.h"
@@ -224,6 +225,30 @@ TEST(cardano_uplc_flat_encode_program, rejectsNullArguments)
   cardano_uplc_arena_free(&arena);
 }
 
+TEST(cardano_uplc_int_flat_term_size, measuresTermsFromAByteBoundary)
+{
+  const char*                   text    = "(program 1.0.0 [(lam x x) (con bytestring #0102)])";
+  cardano_uplc_arena_t*         arena   = make_arena();
+  const cardano_uplc_program_t* program = nullptr;
+  size_t                        offset  = 0U;
+  size_t                        bits    = 0U;
+
+  ASSERT_EQ(cardano_uplc_parse_program(arena, text, strlen(text), &program, &offset), CARDANO_SUCCESS);
+
+  EXPECT_EQ(cardano_uplc_int_flat_term_size(make_error(arena), &bits), CARDANO_SUCCESS);
+  EXPECT_EQ(bits, 4U);
+
+  // Apply and lambda tags, then (var 1), then the constant: tag, type list, filler to
+  // the byte boundary, one 2-byte chunk and the terminator.
+  EXPECT_EQ(cardano_uplc_int_flat_term_size(program->term, &bits), CARDANO_SUCCESS);
+  EXPECT_EQ(bits, 4U + 4U + 4U + 8U + 4U + 6U + 2U + 8U + 16U + 8U);
+
+  EXPECT_EQ(cardano_uplc_int_flat_term_size(nullptr, &bits), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_flat_term_size(program->term, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_uplc_arena_free(&arena);
+}
+
 TEST(cardano_uplc_flat_encode_program, matchesAikenReferenceVector)
 {
   // (program 1.0.0 (lam (var 1))) -> flat 010000200101, CBOR 46010000200101.
@@ -0,0 +1,259 @@
+/**
+ * \file lower.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../../src/uplc/arena/uplc_arena.h"
+#include "../../src/uplc/ast/uplc_program.h"
+#include "../../src/uplc/ast/uplc_term.h"
+#include "../../src/uplc/machine/uplc_lower.h"
+#include "../../src/uplc/machine/uplc_machine.h"
+#include "../../src/uplc/machine/uplc_value.h"
+#include "../../src/uplc/syntax/pretty.h"
+#include "../../src/uplc/syntax/text_parser.h"
+
+#include <cardano/buffer.h>
+#include <cardano/error.h>
+
+#include <cstring>
+#include <gmock/gmock.h>
+#include <string>
+
+/* STATIC HELPERS ************************************************************/
+
+static cardano_uplc_arena_t*
+new_arena()
+{
+  cardano_uplc_arena_t* arena = nullptr;
+  EXPECT_EQ(cardano_uplc_arena_new(4096U, &arena), CARDANO_SUCCESS);
+  return arena;
+}
+
+static const cardano_uplc_program_t*
+parse(cardano_uplc_arena_t* arena, const char* text)
+{
+  const cardano_uplc_program_t* program      = nullptr;
+  size_t                        error_offset = 0U;
+
+  EXPECT_EQ(cardano_uplc_parse_program(arena, text, strlen(text), &program, &error_offset), CARDANO_SUCCESS);
+
+  return program;
+}
+
+static const cardano_uplc_program_t*
+lower(cardano_uplc_arena_t* arena, const cardano_uplc_program_t* program)
+{
+  const cardano_uplc_program_t* lowered = nullptr;
+
+  EXPECT_EQ(cardano_uplc_int_lower_program(arena, program, &lowered), CARDANO_SUCCESS);
+
+  return lowered;
+}
+
+static std::string
+render_term(const cardano_uplc_term_t* term)
+{
+  cardano_buffer_t* out = nullptr;
+
+  EXPECT_EQ(cardano_uplc_pretty_print_term(term, &out), CARDANO_SUCCESS);
+
+  std::string text(reinterpret_cast<const char*>(cardano_buffer_get_data(out)));
+  cardano_buffer_unref(&out);
+
+  return text;
+}
+
+static std::string
+render_program(const cardano_uplc_program_t* program)
+{
+  cardano_buffer_t* out = nullptr;
+
+  EXPECT_EQ(cardano_uplc_pretty_print_program(program, &out), CARDANO_SUCCESS);
+
+  std::string text(reinterpret_cast<const char*>(cardano_buffer_get_data(out)));
+  cardano_buffer_unref(&out);
+
+  return text;
+}
+
+static const char* const CASE_PROGRAM =
+  "(program 1.1.0 "
+  "[(lam f (case (constr 1 (con integer 5) (con integer 7)) (lam a a) (lam a (lam b [f a b])))) "
+  "(builtin addInteger)])";
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_uplc_int_lower_program, returnsErrorIfPointerIsNull)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, "(program 1.1.0 (con integer 1))");
+  const cardano_uplc_program_t* lowered = nullptr;
+  cardano_uplc_program_t        empty   = { 1U, 1U, 0U, nullptr };
+
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_int_lower_program(nullptr, program, &lowered), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_lower_program(arena, nullptr, &lowered), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_lower_program(arena, &empty, &lowered), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_lower_program(arena, program, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_lower_program, preservesTheProgram)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, CASE_PROGRAM);
+
+  // Act
+  const cardano_uplc_program_t* lowered = lower(arena, program);
+
+  // Assert
+  ASSERT_NE(lowered, nullptr);
+  EXPECT_NE(lowered->term, program->term);
+  EXPECT_EQ(render_program(lowered), render_program(program));
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_lower_program, laysNodesOutContiguouslyInPreOrder)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, "(program 1.1.0 [(lam x [x (con integer 2)]) (delay (con unit ()))])");
+
+  // Act
+  const cardano_uplc_program_t* lowered = lower(arena, program);
+
+  // Assert
+  ASSERT_NE(lowered, nullptr);
+  const cardano_uplc_term_t* root = lowered->term;
+
+  ASSERT_EQ(root[0].kind, CARDANO_UPLC_TERM_APPLY);
+  EXPECT_EQ(root[0].as.apply.function, &root[1]);
+  EXPECT_EQ(root[1].kind, CARDANO_UPLC_TERM_LAMBDA);
+  EXPECT_EQ(root[1].as.unary, &root[2]);
+  EXPECT_EQ(root[2].kind, CARDANO_UPLC_TERM_APPLY);
+  EXPECT_EQ(root[2].as.apply.function, &root[3]);
+  EXPECT_EQ(root[3].kind, CARDANO_UPLC_TERM_VAR);
+  EXPECT_EQ(root[3].as.var_index, 1U);
+  EXPECT_EQ(root[2].as.apply.argument, &root[4]);
+  EXPECT_EQ(root[4].kind, CARDANO_UPLC_TERM_CONSTANT);
+  EXPECT_EQ(root[0].as.apply.argument, &root[5]);
+  EXPECT_EQ(root[5].kind, CARDANO_UPLC_TERM_DELAY);
+  EXPECT_EQ(root[5].as.unary, &root[6]);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_lower_program, preWrapsConstantsAndBuiltins)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, "(program 1.1.0 [(builtin addInteger) (con integer 3)])");
+
+  // Act
+  const cardano_uplc_program_t* lowered = lower(arena, program);
+
+  // Assert
+  ASSERT_NE(lowered, nullptr);
+  const cardano_uplc_term_t* root = lowered->term;
+
+  EXPECT_EQ(program->term->value, nullptr);
+  EXPECT_EQ(root[0].value, nullptr);
+
+  ASSERT_NE(root[1].value, nullptr);
+  EXPECT_EQ(root[1].value->kind, CARDANO_UPLC_VALUE_BUILTIN);
+  EXPECT_EQ(root[1].value->as.builtin.func, CARDANO_UPLC_BUILTIN_ADD_INTEGER);
+  EXPECT_EQ(root[1].value->as.builtin.arg_count, 0U);
+
+  ASSERT_NE(root[2].value, nullptr);
+  EXPECT_EQ(root[2].value->kind, CARDANO_UPLC_VALUE_CONSTANT);
+  EXPECT_EQ(root[2].value->as.constant, root[2].as.constant);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_lower_program, evaluatesToTheSameOutcomeAndBudget)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, CASE_PROGRAM);
+  const cardano_uplc_program_t* lowered = lower(arena, program);
+  const cardano_uplc_budget_t   budget  = { INT64_MAX, INT64_MAX };
+
+  cardano_uplc_eval_result_t expected = {};
+  cardano_uplc_eval_result_t first    = {};
+  cardano_uplc_eval_result_t second   = {};
+
+  // Act
+  ASSERT_EQ(cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &expected), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, lowered, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &first), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, lowered, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &second), CARDANO_SUCCESS);
+
+  // Assert
+  ASSERT_EQ(expected.status, CARDANO_UPLC_EVAL_SUCCESS);
+  EXPECT_EQ(render_term(expected.result), "(con integer 12)");
+
+  EXPECT_EQ(first.status, expected.status);
+  EXPECT_EQ(first.spent.cpu, expected.spent.cpu);
+  EXPECT_EQ(first.spent.mem, expected.spent.mem);
+  EXPECT_EQ(render_term(first.result), render_term(expected.result));
+
+  EXPECT_EQ(second.status, expected.status);
+  EXPECT_EQ(second.spent.cpu, expected.spent.cpu);
+  EXPECT_EQ(second.spent.mem, expected.spent.mem);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_lower_program, evaluatesErrorAndBudgetExhaustionTheSame)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, "(program 1.1.0 [(lam x (error)) (con integer 1)])");
+  const cardano_uplc_program_t* lowered = lower(arena, program);
+  const cardano_uplc_budget_t   budget  = { INT64_MAX, INT64_MAX };
+  const cardano_uplc_budget_t   tight   = { 100, 100 };
+
+  cardano_uplc_eval_result_t expected = {};
+  cardano_uplc_eval_result_t actual   = {};
+
+  // Act & Assert
+  ASSERT_EQ(cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &expected), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, lowered, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &actual), CARDANO_SUCCESS);
+
+  EXPECT_EQ(expected.status, CARDANO_UPLC_EVAL_ERROR_TERM);
+  EXPECT_EQ(actual.status, expected.status);
+  EXPECT_EQ(actual.spent.cpu, expected.spent.cpu);
+  EXPECT_EQ(actual.spent.mem, expected.spent.mem);
+
+  ASSERT_EQ(cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, tight, &expected), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, lowered, CARDANO_UPLC_MACHINE_VERSION_V3, tight, &actual), CARDANO_SUCCESS);
+
+  EXPECT_EQ(expected.status, CARDANO_UPLC_EVAL_OUT_OF_BUDGET);
+  EXPECT_EQ(actual.status, expected.status);
+  EXPECT_EQ(actual.spent.cpu, expected.spent.cpu);
+  EXPECT_EQ(actual.spent.mem, expected.spent.mem);
+
+  cardano_uplc_arena_free(&arena);
+}
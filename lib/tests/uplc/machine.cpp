@@ -669,516 +669,429 @@ TEST(cardano_uplc_value_new_constr, failsOnArenaAllocationFailure)
   cardano_uplc_arena_free(&arena);
 }
 
-/* UNIT TESTS - FRAMES ******************************************************/
-
-TEST(cardano_uplc_frame_new_no_frame, setsKindAndHasNoContext)
+TEST(cardano_uplc_value_shared_bool, returnsTheBooleanConstants)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* frame = nullptr;
-
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &frame), CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_NO_FRAME);
+  const cardano_uplc_value_t* t = cardano_uplc_value_shared_bool(true);
+  const cardano_uplc_value_t* f = cardano_uplc_value_shared_bool(false);
 
-  cardano_uplc_arena_free(&arena);
+  EXPECT_EQ(t->kind, CARDANO_UPLC_VALUE_CONSTANT);
+  EXPECT_EQ(t->as.constant->kind, CARDANO_UPLC_TYPE_BOOL);
+  EXPECT_TRUE(t->as.constant->as.boolean);
+  EXPECT_EQ(t->ex_mem, 1);
+  EXPECT_FALSE(f->as.constant->as.boolean);
+  EXPECT_EQ(cardano_uplc_value_shared_bool(true), t);
 }
 
-TEST(cardano_uplc_frame_new_no_frame, failsOnNullArgs)
+TEST(cardano_uplc_value_shared_unit, returnsTheUnitConstant)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* frame = nullptr;
+  const cardano_uplc_value_t* unit = cardano_uplc_value_shared_unit();
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(nullptr, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
-
-  cardano_uplc_arena_free(&arena);
+  EXPECT_EQ(unit->kind, CARDANO_UPLC_VALUE_CONSTANT);
+  EXPECT_EQ(unit->as.constant->kind, CARDANO_UPLC_TYPE_UNIT);
+  EXPECT_EQ(unit->ex_mem, 1);
 }
 
-TEST(cardano_uplc_frame_new_no_frame, failsOnArenaAllocationFailure)
+TEST(cardano_uplc_value_shared_int, coversTheSharedRangeOnly)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* frame = nullptr;
-
-  reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
-
-  cardano_error_t error = cardano_uplc_frame_new_no_frame(arena, &frame);
-
-  cardano_set_allocators(malloc, realloc, free);
-
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
+  for (int64_t n = CARDANO_UPLC_VALUE_SHARED_INT_MIN; n <= CARDANO_UPLC_VALUE_SHARED_INT_MAX; ++n)
+  {
+    const cardano_uplc_value_t* value = cardano_uplc_value_shared_int(n);
+
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(value->as.constant->kind, CARDANO_UPLC_TYPE_INTEGER);
+    EXPECT_TRUE(cardano_uplc_constant_int_is_small(value->as.constant));
+    EXPECT_EQ(cardano_uplc_constant_int_small(value->as.constant), n);
+    EXPECT_EQ(value->as.constant->as.integer.big, nullptr);
+    EXPECT_EQ(value->ex_mem, 1);
+  }
 
-  cardano_uplc_arena_free(&arena);
+  EXPECT_EQ(cardano_uplc_value_shared_int(CARDANO_UPLC_VALUE_SHARED_INT_MIN - 1), nullptr);
+  EXPECT_EQ(cardano_uplc_value_shared_int(CARDANO_UPLC_VALUE_SHARED_INT_MAX + 1), nullptr);
 }
 
-TEST(cardano_uplc_frame_new_await_arg, setsKindValueAndChainsContext)
+TEST(cardano_uplc_value_shared_for, mapsUnitBoolAndSmallIntConstants)
 {
-  // Arrange
-  cardano_uplc_arena_t*       arena = new_arena();
-  const cardano_uplc_value_t* fun   = new_unit_value(arena);
-  cardano_uplc_frame_t*       inner = nullptr;
-  cardano_uplc_frame_t*       frame = nullptr;
+  cardano_uplc_arena_t*    arena     = new_arena();
+  cardano_uplc_constant_t* unit      = nullptr;
+  cardano_uplc_constant_t* boolean   = nullptr;
+  cardano_uplc_constant_t* small     = nullptr;
+  cardano_uplc_constant_t* too_large = nullptr;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_constant_new_unit(arena, &unit), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_constant_new_bool(arena, true, &boolean), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_constant_new_integer_small(arena, 42, &small), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_constant_new_integer_small(arena, 1000, &too_large), CARDANO_SUCCESS);
 
-  // Act
-  cardano_error_t error = cardano_uplc_frame_new_await_arg(arena, fun, inner, &frame);
+  EXPECT_EQ(cardano_uplc_value_shared_for(unit), cardano_uplc_value_shared_unit());
+  EXPECT_EQ(cardano_uplc_value_shared_for(boolean), cardano_uplc_value_shared_bool(true));
+  EXPECT_EQ(cardano_uplc_value_shared_for(small), cardano_uplc_value_shared_int(42));
+  EXPECT_EQ(cardano_uplc_value_shared_for(too_large), nullptr);
+  EXPECT_EQ(cardano_uplc_value_shared_for(nullptr), nullptr);
 
-  // Assert
-  EXPECT_EQ(error, CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_AWAIT_ARG);
-  EXPECT_EQ(frame->as.await_arg.value, fun);
-  EXPECT_EQ(frame->as.await_arg.ctx, inner);
-
-  // Cleanup
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_await_arg, failsOnNullArgs)
+TEST(cardano_uplc_value_constant_is_shared, recognizesOnlyTheSharedConstants)
 {
-  cardano_uplc_arena_t*       arena = new_arena();
-  const cardano_uplc_value_t* fun   = new_unit_value(arena);
-  cardano_uplc_frame_t*       inner = nullptr;
-  cardano_uplc_frame_t*       frame = nullptr;
+  cardano_uplc_arena_t*    arena = new_arena();
+  cardano_uplc_constant_t* small = nullptr;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_constant_new_integer_small(arena, 7, &small), CARDANO_SUCCESS);
 
-  EXPECT_EQ(cardano_uplc_frame_new_await_arg(nullptr, fun, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_arg(arena, nullptr, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_arg(arena, fun, nullptr, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_arg(arena, fun, inner, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_TRUE(cardano_uplc_value_constant_is_shared(cardano_uplc_value_shared_int(7)->as.constant));
+  EXPECT_TRUE(cardano_uplc_value_constant_is_shared(cardano_uplc_value_shared_bool(false)->as.constant));
+  EXPECT_TRUE(cardano_uplc_value_constant_is_shared(cardano_uplc_value_shared_unit()->as.constant));
+  EXPECT_FALSE(cardano_uplc_value_constant_is_shared(small));
+  EXPECT_FALSE(cardano_uplc_value_constant_is_shared(nullptr));
 
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_await_arg, failsOnArenaAllocationFailure)
+/* UNIT TESTS - FRAMES ******************************************************/
+
+TEST(cardano_uplc_frame_stack, startsEmptyAndHasNoTop)
 {
-  cardano_uplc_arena_t*       prereq = new_arena();
-  cardano_uplc_arena_t*       arena  = new_arena();
-  const cardano_uplc_value_t* fun    = new_unit_value(prereq);
-  cardano_uplc_frame_t*       inner  = nullptr;
-  cardano_uplc_frame_t*       frame  = nullptr;
+  cardano_uplc_frame_stack_t stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(prereq, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+  EXPECT_EQ(stack.count, 0U);
+  EXPECT_EQ(stack.capacity, 0U);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(&stack), nullptr);
 
-  cardano_error_t error = cardano_uplc_frame_new_await_arg(arena, fun, inner, &frame);
+  cardano_uplc_frame_stack_pop(&stack);
 
-  cardano_set_allocators(malloc, realloc, free);
+  EXPECT_EQ(stack.count, 0U);
 
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
-
-  cardano_uplc_arena_free(&arena);
-  cardano_uplc_arena_free(&prereq);
+  cardano_uplc_frame_stack_free(&stack);
 }
 
-TEST(cardano_uplc_frame_new_await_fun_term, setsKindEnvTermAndChainsContext)
+TEST(cardano_uplc_frame_stack, ignoresNullStacks)
 {
-  // Arrange
-  cardano_uplc_arena_t*       arena = new_arena();
-  const cardano_uplc_term_t*  term  = new_error_term(arena);
-  const cardano_uplc_value_t* held  = new_unit_value(arena);
-  const cardano_uplc_env_t*   env   = nullptr;
-  cardano_uplc_frame_t*       inner = nullptr;
-  cardano_uplc_frame_t*       frame = nullptr;
-
-  EXPECT_EQ(cardano_uplc_env_extend(arena, nullptr, held, &env), CARDANO_SUCCESS);
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(nullptr);
+  cardano_uplc_frame_stack_pop(nullptr);
+  cardano_uplc_frame_stack_free(nullptr);
 
-  // Act
-  cardano_error_t error = cardano_uplc_frame_new_await_fun_term(arena, env, term, inner, &frame);
-
-  // Assert
-  EXPECT_EQ(error, CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_AWAIT_FUN_TERM);
-  EXPECT_EQ(frame->as.await_fun_term.env, env);
-  EXPECT_EQ(frame->as.await_fun_term.term, term);
-  EXPECT_EQ(frame->as.await_fun_term.ctx, inner);
-
-  // Cleanup
-  cardano_uplc_arena_free(&arena);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(nullptr), nullptr);
 }
 
-TEST(cardano_uplc_frame_new_await_fun_term, failsOnNullArgs)
+TEST(cardano_uplc_frame_stack, popsFramesInLifoOrder)
 {
-  cardano_uplc_arena_t*      arena = new_arena();
-  const cardano_uplc_term_t* term  = new_error_term(arena);
-  cardano_uplc_frame_t*      inner = nullptr;
-  cardano_uplc_frame_t*      frame = nullptr;
-
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
-
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_term(nullptr, nullptr, term, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_term(arena, nullptr, nullptr, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_term(arena, nullptr, term, nullptr, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_term(arena, nullptr, term, inner, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
-
-  cardano_uplc_arena_free(&arena);
-}
+  cardano_uplc_frame_stack_t stack;
 
-TEST(cardano_uplc_frame_new_await_fun_term, failsOnArenaAllocationFailure)
-{
-  cardano_uplc_arena_t*      prereq = new_arena();
-  cardano_uplc_arena_t*      arena  = new_arena();
-  const cardano_uplc_term_t* term   = new_error_term(prereq);
-  cardano_uplc_frame_t*      inner  = nullptr;
-  cardano_uplc_frame_t*      frame  = nullptr;
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(prereq, &inner), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_no_frame(&stack), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_force(&stack), CARDANO_SUCCESS);
+  EXPECT_EQ(stack.count, 2U);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(&stack)->kind, CARDANO_UPLC_FRAME_FORCE);
 
-  reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+  cardano_uplc_frame_stack_pop(&stack);
 
-  cardano_error_t error = cardano_uplc_frame_new_await_fun_term(arena, nullptr, term, inner, &frame);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(&stack)->kind, CARDANO_UPLC_FRAME_NO_FRAME);
 
-  cardano_set_allocators(malloc, realloc, free);
+  cardano_uplc_frame_stack_pop(&stack);
 
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(&stack), nullptr);
 
-  cardano_uplc_arena_free(&arena);
-  cardano_uplc_arena_free(&prereq);
+  cardano_uplc_frame_stack_free(&stack);
 }
 
-TEST(cardano_uplc_frame_new_await_fun_value, setsKindValueAndChainsContext)
+TEST(cardano_uplc_frame_stack, growsAndKeepsItsStorageAcrossPops)
 {
-  // Arrange
-  cardano_uplc_arena_t*       arena = new_arena();
-  const cardano_uplc_value_t* arg   = new_unit_value(arena);
-  cardano_uplc_frame_t*       inner = nullptr;
-  cardano_uplc_frame_t*       frame = nullptr;
+  cardano_uplc_frame_stack_t stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  // Act
-  cardano_error_t error = cardano_uplc_frame_new_await_fun_value(arena, arg, inner, &frame);
+  for (size_t i = 0U; i < 1000U; ++i)
+  {
+    EXPECT_EQ(cardano_uplc_frame_stack_push_force(&stack), CARDANO_SUCCESS);
+  }
 
-  // Assert
-  EXPECT_EQ(error, CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_AWAIT_FUN_VALUE);
-  EXPECT_EQ(frame->as.await_fun_value.value, arg);
-  EXPECT_EQ(frame->as.await_fun_value.ctx, inner);
+  const size_t capacity = stack.capacity;
 
-  // Cleanup
-  cardano_uplc_arena_free(&arena);
-}
+  EXPECT_EQ(stack.count, 1000U);
+  EXPECT_GE(capacity, 1000U);
 
-TEST(cardano_uplc_frame_new_await_fun_value, failsOnNullArgs)
-{
-  cardano_uplc_arena_t*       arena = new_arena();
-  const cardano_uplc_value_t* arg   = new_unit_value(arena);
-  cardano_uplc_frame_t*       inner = nullptr;
-  cardano_uplc_frame_t*       frame = nullptr;
+  while (stack.count > 0U)
+  {
+    cardano_uplc_frame_stack_pop(&stack);
+  }
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_no_frame(&stack), CARDANO_SUCCESS);
+  EXPECT_EQ(stack.capacity, capacity);
 
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_value(nullptr, arg, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_value(arena, nullptr, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_value(arena, arg, nullptr, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_await_fun_value(arena, arg, inner, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  cardano_uplc_frame_stack_free(&stack);
 
-  cardano_uplc_arena_free(&arena);
+  EXPECT_EQ(stack.frames, nullptr);
+  EXPECT_EQ(stack.count, 0U);
+  EXPECT_EQ(stack.capacity, 0U);
 }
 
-TEST(cardano_uplc_frame_new_await_fun_value, failsOnArenaAllocationFailure)
+TEST(cardano_uplc_frame_stack, failsWhenTheStackCannotGrow)
 {
-  cardano_uplc_arena_t*       prereq = new_arena();
-  cardano_uplc_arena_t*       arena  = new_arena();
-  const cardano_uplc_value_t* arg    = new_unit_value(prereq);
-  cardano_uplc_frame_t*       inner  = nullptr;
-  cardano_uplc_frame_t*       frame  = nullptr;
+  cardano_uplc_arena_t*       arena = new_arena();
+  const cardano_uplc_value_t* value = new_unit_value(arena);
+  const cardano_uplc_term_t*  term  = new_error_term(arena);
+  const cardano_uplc_value_t* resolved[1];
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(prereq, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
   reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+  cardano_set_allocators(malloc, fail_right_away_realloc, free);
 
-  cardano_error_t error = cardano_uplc_frame_new_await_fun_value(arena, arg, inner, &frame);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_no_frame(&stack), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_arg(&stack, value), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_term(&stack, nullptr, term), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_value(&stack, value), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_force(&stack), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_constr(&stack, nullptr, 0U, nullptr, 0U, resolved, 0U), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_cases(&stack, nullptr, nullptr, 0U), CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
 
   cardano_set_allocators(malloc, realloc, free);
 
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
+  EXPECT_EQ(stack.count, 0U);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
-  cardano_uplc_arena_free(&prereq);
 }
 
-TEST(cardano_uplc_frame_new_force, setsKindAndChainsContext)
+TEST(cardano_uplc_frame_stack_push_no_frame, failsOnNullStack)
 {
-  // Arrange
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  EXPECT_EQ(cardano_uplc_frame_stack_push_no_frame(nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+}
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+TEST(cardano_uplc_frame_stack_push_await_arg, setsKindAndValue)
+{
+  cardano_uplc_arena_t*       arena = new_arena();
+  const cardano_uplc_value_t* fun   = new_unit_value(arena);
+  cardano_uplc_frame_stack_t  stack;
 
-  // Act
-  cardano_error_t error = cardano_uplc_frame_new_force(arena, inner, &frame);
+  cardano_uplc_frame_stack_init(&stack);
 
-  // Assert
-  EXPECT_EQ(error, CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_FORCE);
-  EXPECT_EQ(frame->as.force.ctx, inner);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_arg(&stack, fun), CARDANO_SUCCESS);
 
-  // Cleanup
+  const cardano_uplc_frame_t* frame = cardano_uplc_frame_stack_top(&stack);
+
+  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_AWAIT_ARG);
+  EXPECT_EQ(frame->as.await_arg.value, fun);
+
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_force, failsOnNullArgs)
+TEST(cardano_uplc_frame_stack_push_await_arg, failsOnNullArgs)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  cardano_uplc_arena_t*       arena = new_arena();
+  const cardano_uplc_value_t* fun   = new_unit_value(arena);
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(cardano_uplc_frame_new_force(nullptr, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_force(arena, nullptr, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_force(arena, inner, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_arg(nullptr, fun), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_arg(&stack, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(stack.count, 0U);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_force, failsOnArenaAllocationFailure)
+TEST(cardano_uplc_frame_stack_push_await_fun_term, setsKindEnvAndTerm)
 {
-  cardano_uplc_arena_t* prereq = new_arena();
-  cardano_uplc_arena_t* arena  = new_arena();
-  cardano_uplc_frame_t* inner  = nullptr;
-  cardano_uplc_frame_t* frame  = nullptr;
+  cardano_uplc_arena_t*       arena = new_arena();
+  const cardano_uplc_term_t*  term  = new_error_term(arena);
+  const cardano_uplc_env_t*   env   = nullptr;
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(prereq, &inner), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_env_extend(arena, nullptr, new_unit_value(arena), &env), CARDANO_SUCCESS);
 
-  reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+  cardano_uplc_frame_stack_init(&stack);
 
-  cardano_error_t error = cardano_uplc_frame_new_force(arena, inner, &frame);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_term(&stack, env, term), CARDANO_SUCCESS);
 
-  cardano_set_allocators(malloc, realloc, free);
+  const cardano_uplc_frame_t* frame = cardano_uplc_frame_stack_top(&stack);
 
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
+  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_AWAIT_FUN_TERM);
+  EXPECT_EQ(frame->as.await_fun_term.env, env);
+  EXPECT_EQ(frame->as.await_fun_term.term, term);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
-  cardano_uplc_arena_free(&prereq);
 }
 
-TEST(cardano_uplc_frame_new_constr, setsAllFieldsAndChainsContext)
+TEST(cardano_uplc_frame_stack_push_await_fun_term, failsOnNullArgs)
 {
-  // Arrange
-  cardano_uplc_arena_t*       arena   = new_arena();
-  const cardano_uplc_term_t*  pending = new_error_term(arena);
-  const cardano_uplc_value_t* done    = new_unit_value(arena);
-  const cardano_uplc_value_t* held    = new_unit_value(arena);
-  const cardano_uplc_env_t*   env     = nullptr;
-  cardano_uplc_frame_t*       inner   = nullptr;
-  cardano_uplc_frame_t*       frame   = nullptr;
-  const cardano_uplc_term_t*  fields[1];
-  const cardano_uplc_value_t* resolved[1];
-
-  fields[0]   = pending;
-  resolved[0] = done;
-
-  EXPECT_EQ(cardano_uplc_env_extend(arena, nullptr, held, &env), CARDANO_SUCCESS);
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_arena_t*      arena = new_arena();
+  const cardano_uplc_term_t* term  = new_error_term(arena);
+  cardano_uplc_frame_stack_t stack;
 
-  // Act
-  cardano_error_t error = cardano_uplc_frame_new_constr(arena, env, 3U, fields, 1U, resolved, 1U, inner, &frame);
+  cardano_uplc_frame_stack_init(&stack);
 
-  // Assert
-  EXPECT_EQ(error, CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_CONSTR);
-  EXPECT_EQ(frame->as.constr.env, env);
-  EXPECT_EQ(frame->as.constr.tag, 3U);
-  EXPECT_EQ(frame->as.constr.field_count, 1U);
-  EXPECT_EQ(frame->as.constr.fields[0], pending);
-  EXPECT_EQ(frame->as.constr.resolved_count, 1U);
-  EXPECT_EQ(frame->as.constr.resolved[0], done);
-  EXPECT_EQ(frame->as.constr.ctx, inner);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_term(nullptr, nullptr, term), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_term(&stack, nullptr, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(stack.count, 0U);
 
-  // Cleanup
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_constr, acceptsEmptyFieldAndResolvedArrays)
+TEST(cardano_uplc_frame_stack_push_await_fun_value, setsKindAndValue)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  cardano_uplc_arena_t*       arena = new_arena();
+  const cardano_uplc_value_t* arg   = new_unit_value(arena);
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(
-    cardano_uplc_frame_new_constr(arena, nullptr, 0U, nullptr, 0U, nullptr, 0U, inner, &frame),
-    CARDANO_SUCCESS);
-  EXPECT_EQ(frame->as.constr.field_count, 0U);
-  EXPECT_EQ(frame->as.constr.resolved_count, 0U);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_value(&stack, arg), CARDANO_SUCCESS);
+
+  const cardano_uplc_frame_t* frame = cardano_uplc_frame_stack_top(&stack);
+
+  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_AWAIT_FUN_VALUE);
+  EXPECT_EQ(frame->as.await_fun_value.value, arg);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_constr, failsOnNullArgs)
+TEST(cardano_uplc_frame_stack_push_await_fun_value, failsOnNullArgs)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  cardano_uplc_arena_t*       arena = new_arena();
+  const cardano_uplc_value_t* arg   = new_unit_value(arena);
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(
-    cardano_uplc_frame_new_constr(nullptr, nullptr, 0U, nullptr, 0U, nullptr, 0U, inner, &frame),
-    CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(
-    cardano_uplc_frame_new_constr(arena, nullptr, 0U, nullptr, 0U, nullptr, 0U, nullptr, &frame),
-    CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(
-    cardano_uplc_frame_new_constr(arena, nullptr, 0U, nullptr, 0U, nullptr, 0U, inner, nullptr),
-    CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_value(nullptr, arg), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_await_fun_value(&stack, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(stack.count, 0U);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_constr, failsWhenCountWithoutArray)
+TEST(cardano_uplc_frame_stack_push_force, setsKind)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  cardano_uplc_frame_stack_t stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(
-    cardano_uplc_frame_new_constr(arena, nullptr, 0U, nullptr, 1U, nullptr, 0U, inner, &frame),
-    CARDANO_ERROR_INVALID_ARGUMENT);
-  EXPECT_EQ(
-    cardano_uplc_frame_new_constr(arena, nullptr, 0U, nullptr, 0U, nullptr, 1U, inner, &frame),
-    CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_force(&stack), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(&stack)->kind, CARDANO_UPLC_FRAME_FORCE);
 
-  cardano_uplc_arena_free(&arena);
+  cardano_uplc_frame_stack_free(&stack);
 }
 
-TEST(cardano_uplc_frame_new_constr, failsOnArenaAllocationFailure)
+TEST(cardano_uplc_frame_stack_push_force, failsOnNullStack)
 {
-  cardano_uplc_arena_t* prereq = new_arena();
-  cardano_uplc_arena_t* arena  = new_arena();
-  cardano_uplc_frame_t* inner  = nullptr;
-  cardano_uplc_frame_t* frame  = nullptr;
+  EXPECT_EQ(cardano_uplc_frame_stack_push_force(nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+}
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(prereq, &inner), CARDANO_SUCCESS);
+TEST(cardano_uplc_frame_stack_push_constr, setsAllFields)
+{
+  cardano_uplc_arena_t*       arena     = new_arena();
+  const cardano_uplc_term_t*  fields[1] = { new_error_term(arena) };
+  const cardano_uplc_value_t* resolved[3];
+  const cardano_uplc_env_t*   env = nullptr;
+  cardano_uplc_frame_stack_t  stack;
 
-  reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+  resolved[0] = new_unit_value(arena);
 
-  cardano_error_t error = cardano_uplc_frame_new_constr(arena, nullptr, 0U, nullptr, 0U, nullptr, 0U, inner, &frame);
+  EXPECT_EQ(cardano_uplc_env_extend(arena, nullptr, resolved[0], &env), CARDANO_SUCCESS);
 
-  cardano_set_allocators(malloc, realloc, free);
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_constr(&stack, env, 3U, fields, 1U, resolved, 1U), CARDANO_SUCCESS);
+
+  const cardano_uplc_frame_t* frame = cardano_uplc_frame_stack_top(&stack);
+
+  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_CONSTR);
+  EXPECT_EQ(frame->as.constr.env, env);
+  EXPECT_EQ(frame->as.constr.tag, 3U);
+  EXPECT_EQ(frame->as.constr.fields, fields);
+  EXPECT_EQ(frame->as.constr.field_count, 1U);
+  EXPECT_EQ(frame->as.constr.resolved, resolved);
+  EXPECT_EQ(frame->as.constr.resolved_count, 1U);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
-  cardano_uplc_arena_free(&prereq);
 }
 
-TEST(cardano_uplc_frame_new_cases, setsKindEnvBranchesAndChainsContext)
+TEST(cardano_uplc_frame_stack_push_constr, failsOnNullArgs)
 {
-  // Arrange
-  cardano_uplc_arena_t*       arena = new_arena();
-  const cardano_uplc_term_t*  b0    = new_error_term(arena);
-  const cardano_uplc_value_t* held  = new_unit_value(arena);
-  const cardano_uplc_env_t*   env   = nullptr;
-  cardano_uplc_frame_t*       inner = nullptr;
-  cardano_uplc_frame_t*       frame = nullptr;
-  const cardano_uplc_term_t*  branches[1];
-
-  branches[0] = b0;
+  const cardano_uplc_value_t* resolved[1];
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_env_extend(arena, nullptr, held, &env), CARDANO_SUCCESS);
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  // Act
-  cardano_error_t error = cardano_uplc_frame_new_cases(arena, env, branches, 1U, inner, &frame);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_constr(nullptr, nullptr, 0U, nullptr, 0U, resolved, 0U), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_constr(&stack, nullptr, 0U, nullptr, 0U, nullptr, 0U), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(stack.count, 0U);
 
-  // Assert
-  EXPECT_EQ(error, CARDANO_SUCCESS);
-  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_CASES);
-  EXPECT_EQ(frame->as.cases.env, env);
-  EXPECT_EQ(frame->as.cases.branch_count, 1U);
-  EXPECT_EQ(frame->as.cases.branches[0], b0);
-  EXPECT_EQ(frame->as.cases.ctx, inner);
-
-  // Cleanup
-  cardano_uplc_arena_free(&arena);
+  cardano_uplc_frame_stack_free(&stack);
 }
 
-TEST(cardano_uplc_frame_new_cases, acceptsNoBranches)
+TEST(cardano_uplc_frame_stack_push_constr, failsWhenFieldCountWithoutArray)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  const cardano_uplc_value_t* resolved[2];
+  cardano_uplc_frame_stack_t  stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  EXPECT_EQ(cardano_uplc_frame_new_cases(arena, nullptr, nullptr, 0U, inner, &frame), CARDANO_SUCCESS);
-  EXPECT_EQ(frame->as.cases.branch_count, 0U);
-  EXPECT_EQ(frame->as.cases.branches, nullptr);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_constr(&stack, nullptr, 0U, nullptr, 1U, resolved, 0U), CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(stack.count, 0U);
 
-  cardano_uplc_arena_free(&arena);
+  cardano_uplc_frame_stack_free(&stack);
 }
 
-TEST(cardano_uplc_frame_new_cases, failsOnNullArgs)
+TEST(cardano_uplc_frame_stack_push_cases, setsKindEnvAndBranches)
 {
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  cardano_uplc_arena_t*      arena       = new_arena();
+  const cardano_uplc_term_t* branches[1] = { new_error_term(arena) };
+  const cardano_uplc_env_t*  env         = nullptr;
+  cardano_uplc_frame_stack_t stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_env_extend(arena, nullptr, new_unit_value(arena), &env), CARDANO_SUCCESS);
 
-  EXPECT_EQ(cardano_uplc_frame_new_cases(nullptr, nullptr, nullptr, 0U, inner, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_cases(arena, nullptr, nullptr, 0U, nullptr, &frame), CARDANO_ERROR_POINTER_IS_NULL);
-  EXPECT_EQ(cardano_uplc_frame_new_cases(arena, nullptr, nullptr, 0U, inner, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  cardano_uplc_frame_stack_init(&stack);
 
-  cardano_uplc_arena_free(&arena);
-}
+  EXPECT_EQ(cardano_uplc_frame_stack_push_cases(&stack, env, branches, 1U), CARDANO_SUCCESS);
 
-TEST(cardano_uplc_frame_new_cases, failsWhenBranchCountWithoutArray)
-{
-  cardano_uplc_arena_t* arena = new_arena();
-  cardano_uplc_frame_t* inner = nullptr;
-  cardano_uplc_frame_t* frame = nullptr;
+  const cardano_uplc_frame_t* frame = cardano_uplc_frame_stack_top(&stack);
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(arena, &inner), CARDANO_SUCCESS);
-
-  EXPECT_EQ(
-    cardano_uplc_frame_new_cases(arena, nullptr, nullptr, 1U, inner, &frame),
-    CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(frame->kind, CARDANO_UPLC_FRAME_CASES);
+  EXPECT_EQ(frame->as.cases.env, env);
+  EXPECT_EQ(frame->as.cases.branches, branches);
+  EXPECT_EQ(frame->as.cases.branch_count, 1U);
 
+  cardano_uplc_frame_stack_free(&stack);
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_frame_new_cases, failsOnArenaAllocationFailure)
+TEST(cardano_uplc_frame_stack_push_cases, acceptsNoBranches)
 {
-  cardano_uplc_arena_t* prereq = new_arena();
-  cardano_uplc_arena_t* arena  = new_arena();
-  cardano_uplc_frame_t* inner  = nullptr;
-  cardano_uplc_frame_t* frame  = nullptr;
+  cardano_uplc_frame_stack_t stack;
 
-  EXPECT_EQ(cardano_uplc_frame_new_no_frame(prereq, &inner), CARDANO_SUCCESS);
+  cardano_uplc_frame_stack_init(&stack);
 
-  reset_allocators_run_count();
-  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_cases(&stack, nullptr, nullptr, 0U), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_frame_stack_top(&stack)->as.cases.branch_count, 0U);
 
-  cardano_error_t error = cardano_uplc_frame_new_cases(arena, nullptr, nullptr, 0U, inner, &frame);
+  cardano_uplc_frame_stack_free(&stack);
+}
 
-  cardano_set_allocators(malloc, realloc, free);
+TEST(cardano_uplc_frame_stack_push_cases, failsOnNullStackOrBranchCountWithoutArray)
+{
+  cardano_uplc_frame_stack_t stack;
 
-  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
-  EXPECT_EQ(frame, nullptr);
+  cardano_uplc_frame_stack_init(&stack);
 
-  cardano_uplc_arena_free(&arena);
-  cardano_uplc_arena_free(&prereq);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_cases(nullptr, nullptr, nullptr, 0U), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_frame_stack_push_cases(&stack, nullptr, nullptr, 1U), CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(stack.count, 0U);
+
+  cardano_uplc_frame_stack_free(&stack);
 }
 
 /* UNIT TESTS - EVALUATE ****************************************************/
@@ -2280,7 +2193,7 @@ TEST(cardano_uplc_evaluate, anUnknownVersionDefaultsToV3)
   cardano_uplc_arena_free(&arena);
 }
 
-TEST(cardano_uplc_evaluate, failsCleanlyWhenTheArenaCannotAllocateTheNoFrame)
+TEST(cardano_uplc_evaluate, failsCleanlyWhenTheArenaCannotAllocateTheFirstValue)
 {
   cardano_uplc_arena_t*      prereq  = new_arena();
   cardano_uplc_arena_t*      arena   = nullptr;
@@ -2303,6 +2216,25 @@ TEST(cardano_uplc_evaluate, failsCleanlyWhenTheArenaCannotAllocateTheNoFrame)
   cardano_uplc_arena_free(&prereq);
 }
 
+TEST(cardano_uplc_evaluate, failsCleanlyWhenTheFrameStackCannotGrow)
+{
+  cardano_uplc_arena_t*      arena   = new_arena();
+  cardano_uplc_program_t*    program = new_program(arena, new_int_term(arena, 1));
+  cardano_uplc_budget_t      budget  = { 10000000000LL, 10000000000LL };
+  cardano_uplc_eval_result_t result;
+
+  reset_allocators_run_count();
+  cardano_set_allocators(malloc, fail_right_away_realloc, free);
+
+  cardano_error_t error = cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &result);
+
+  cardano_set_allocators(malloc, realloc, free);
+
+  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+
+  cardano_uplc_arena_free(&arena);
+}
+
 TEST(cardano_uplc_evaluate, failsCleanlyWhenAnInteriorAllocationFails)
 {
   cardano_uplc_arena_t* prereq = new_arena();
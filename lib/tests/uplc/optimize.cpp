@@ -0,0 +1,378 @@
+/**
+ * \file optimize.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../../src/uplc/arena/uplc_arena.h"
+#include "../../src/uplc/ast/uplc_program.h"
+#include "../../src/uplc/machine/uplc_machine.h"
+#include "../../src/uplc/machine/uplc_optimize.h"
+#include "../../src/uplc/syntax/pretty.h"
+#include "../../src/uplc/syntax/text_parser.h"
+#include "../allocators_helpers.h"
+#include "../src/allocators.h"
+
+#include <cardano/buffer.h>
+#include <cardano/error.h>
+
+#include <cstring>
+#include <gmock/gmock.h>
+#include <string>
+
+/* STATIC HELPERS ************************************************************/
+
+static cardano_uplc_arena_t*
+new_arena()
+{
+  cardano_uplc_arena_t* arena = nullptr;
+  EXPECT_EQ(cardano_uplc_arena_new(4096U, &arena), CARDANO_SUCCESS);
+  return arena;
+}
+
+static const cardano_uplc_program_t*
+parse(cardano_uplc_arena_t* arena, const char* text)
+{
+  const cardano_uplc_program_t* program      = nullptr;
+  size_t                        error_offset = 0U;
+
+  EXPECT_EQ(cardano_uplc_parse_program(arena, text, strlen(text), &program, &error_offset), CARDANO_SUCCESS);
+
+  return program;
+}
+
+static const cardano_uplc_program_t*
+optimize(cardano_uplc_arena_t* arena, const cardano_uplc_program_t* program, const uint64_t protocol_major = 11U)
+{
+  const cardano_uplc_program_t* optimized = nullptr;
+
+  EXPECT_EQ(cardano_uplc_int_optimize_program(arena, program, CARDANO_UPLC_LANG_VERSION_V3, protocol_major, &optimized), CARDANO_SUCCESS);
+
+  return optimized;
+}
+
+static std::string
+render_program(const cardano_uplc_program_t* program)
+{
+  cardano_buffer_t* out = nullptr;
+
+  EXPECT_EQ(cardano_uplc_pretty_print_program(program, &out), CARDANO_SUCCESS);
+
+  std::string text(reinterpret_cast<const char*>(cardano_buffer_get_data(out)));
+  cardano_buffer_unref(&out);
+
+  return text;
+}
+
+/**
+ * Optimizes \p source for a V3 script at \p protocol_major and checks it renders
+ * as \p expected does.
+ */
+static void
+expect_optimized(const char* source, const char* expected, const uint64_t protocol_major = 11U)
+{
+  cardano_uplc_arena_t*         arena     = new_arena();
+  const cardano_uplc_program_t* program   = parse(arena, source);
+  const cardano_uplc_program_t* optimized = optimize(arena, program, protocol_major);
+
+  ASSERT_NE(optimized, nullptr);
+  EXPECT_EQ(render_program(optimized), render_program(parse(arena, expected)));
+
+  cardano_uplc_arena_free(&arena);
+}
+
+/**
+ * Evaluates \p source before and after optimization and checks the result is the
+ * same and the optimized program costs no more.
+ */
+static void
+expect_same_result_at_lower_cost(const char* source)
+{
+  cardano_uplc_arena_t*         arena     = new_arena();
+  const cardano_uplc_program_t* program   = parse(arena, source);
+  const cardano_uplc_program_t* optimized = optimize(arena, program);
+  const cardano_uplc_budget_t   budget    = { INT64_MAX, INT64_MAX };
+
+  cardano_uplc_eval_result_t expected = {};
+  cardano_uplc_eval_result_t actual   = {};
+
+  cardano_buffer_t* expected_text = nullptr;
+  cardano_buffer_t* actual_text   = nullptr;
+
+  ASSERT_NE(optimized, nullptr);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, program, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &expected), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, optimized, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &actual), CARDANO_SUCCESS);
+
+  ASSERT_EQ(expected.status, CARDANO_UPLC_EVAL_SUCCESS);
+  ASSERT_EQ(actual.status, expected.status);
+  EXPECT_LE(actual.spent.cpu, expected.spent.cpu);
+  EXPECT_LE(actual.spent.mem, expected.spent.mem);
+
+  ASSERT_EQ(cardano_uplc_pretty_print_term(expected.result, &expected_text), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_pretty_print_term(actual.result, &actual_text), CARDANO_SUCCESS);
+  EXPECT_STREQ(reinterpret_cast<const char*>(cardano_buffer_get_data(actual_text)), reinterpret_cast<const char*>(cardano_buffer_get_data(expected_text)));
+
+  cardano_buffer_unref(&expected_text);
+  cardano_buffer_unref(&actual_text);
+  cardano_uplc_arena_free(&arena);
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_uplc_int_optimize_program, returnsErrorIfPointerIsNull)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena     = new_arena();
+  const cardano_uplc_program_t* program   = parse(arena, "(program 1.1.0 (con integer 1))");
+  const cardano_uplc_program_t  empty     = {};
+  const cardano_uplc_program_t* optimized = nullptr;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_int_optimize_program(nullptr, program, CARDANO_UPLC_LANG_VERSION_V3, 11U, &optimized), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_optimize_program(arena, nullptr, CARDANO_UPLC_LANG_VERSION_V3, 11U, &optimized), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_optimize_program(arena, &empty, CARDANO_UPLC_LANG_VERSION_V3, 11U, &optimized), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_int_optimize_program(arena, program, CARDANO_UPLC_LANG_VERSION_V3, 11U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(optimized, nullptr);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_optimize_program, sharesAProgramWithNothingToRewrite)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, "(program 1.0.0 (lam x (lam f [f [f x]])))");
+
+  // Act
+  const cardano_uplc_program_t* optimized = optimize(arena, program);
+
+  // Assert
+  ASSERT_NE(optimized, nullptr);
+  EXPECT_EQ(optimized->term, program->term);
+  EXPECT_EQ(optimized->version_major, 1U);
+  EXPECT_EQ(optimized->version_minor, 0U);
+  EXPECT_EQ(optimized->version_patch, 0U);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_optimize_program, cancelsForceOfDelay)
+{
+  expect_optimized("(program 1.1.0 (lam x (force (delay [x x]))))", "(program 1.1.0 (lam x [x x]))");
+}
+
+TEST(cardano_uplc_int_optimize_program, substitutesDuplicableArgumentsAtEveryUse)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam y [(lam x [[(builtin addInteger) x] x]) y]))",
+    "(program 1.1.0 (lam y [[(builtin addInteger) y] y]))");
+}
+
+TEST(cardano_uplc_int_optimize_program, dropsUnusedBindings)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam y [(lam x y) (lam z (delay z))]))",
+    "(program 1.1.0 (lam y y))");
+}
+
+TEST(cardano_uplc_int_optimize_program, keepsLambdasThatWouldBeDuplicated)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam y [(lam f [f [f y]]) (lam z [z z])]))",
+    "(program 1.1.0 (lam y [(lam f [f [f y]]) (lam z [z z])]))");
+}
+
+TEST(cardano_uplc_int_optimize_program, shiftsFreeVariablesOfSubstitutedValues)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam y [(lam f (lam w [f w])) (lam z [z y])]))",
+    "(program 1.1.0 (lam y (lam w [w y])))");
+}
+
+TEST(cardano_uplc_int_optimize_program, keepsApplicationsOfNonValues)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam y [(lam x (con integer 1)) [y y]]))",
+    "(program 1.1.0 (lam y [(lam x (con integer 1)) [y y]]))");
+}
+
+TEST(cardano_uplc_int_optimize_program, foldsSaturatedBuiltins)
+{
+  expect_optimized(
+    "(program 1.1.0 [[(builtin equalsInteger) [[(builtin addInteger) (con integer 2)] (con integer 3)]] (con integer 5)])",
+    "(program 1.1.0 (con bool True))");
+  expect_optimized(
+    "(program 1.1.0 [[[(force (builtin ifThenElse)) (con bool False)] (con string \"yes\")] (con string \"no\")])",
+    "(program 1.1.0 (con string \"no\"))");
+  expect_optimized(
+    "(program 1.1.0 [[(builtin appendByteString) (con bytestring #01)] (con bytestring #02)])",
+    "(program 1.1.0 (con bytestring #0102))");
+}
+
+TEST(cardano_uplc_int_optimize_program, doesNotFoldTracesFailuresOrPartialApplications)
+{
+  expect_optimized(
+    "(program 1.1.0 [[(force (builtin trace)) (con string \"x\")] (con unit ())])",
+    "(program 1.1.0 [[(force (builtin trace)) (con string \"x\")] (con unit ())])");
+  expect_optimized(
+    "(program 1.1.0 [[(builtin divideInteger) (con integer 1)] (con integer 0)])",
+    "(program 1.1.0 [[(builtin divideInteger) (con integer 1)] (con integer 0)])");
+  expect_optimized(
+    "(program 1.1.0 [(builtin addInteger) (con integer 1)])",
+    "(program 1.1.0 [(builtin addInteger) (con integer 1)])");
+}
+
+TEST(cardano_uplc_int_optimize_program, doesNotFoldResultsLargerThanTheirApplication)
+{
+  expect_optimized(
+    "(program 1.1.0 [(builtin sha3_256) (con bytestring #)])",
+    "(program 1.1.0 [(builtin sha3_256) (con bytestring #)])");
+  expect_optimized(
+    "(program 1.1.0 [[(builtin replicateByte) (con integer 100)] (con integer 0)])",
+    "(program 1.1.0 [[(builtin replicateByte) (con integer 100)] (con integer 0)])");
+}
+
+TEST(cardano_uplc_int_optimize_program, doesNotFoldBuiltinsUnavailableAtTheProtocolVersion)
+{
+  // countSetBits reaches V3 scripts at protocol version 10.
+  expect_optimized(
+    "(program 1.1.0 [(builtin countSetBits) (con bytestring #ff)])",
+    "(program 1.1.0 [(builtin countSetBits) (con bytestring #ff)])",
+    9U);
+  expect_optimized(
+    "(program 1.1.0 [(builtin countSetBits) (con bytestring #ff)])",
+    "(program 1.1.0 (con integer 8))",
+    10U);
+}
+
+TEST(cardano_uplc_int_optimize_program, selectsTheBranchOfAKnownConstructor)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam g (case (constr 1 g (con integer 7)) (lam a a) (lam a (lam b [b a])))))",
+    "(program 1.1.0 (lam g [(con integer 7) g]))");
+  expect_optimized(
+    "(program 1.1.0 "
+    "[(lam f (case (constr 1 (con integer 5) (con integer 7)) (lam a a) (lam a (lam b [f a b])))) "
+    "(builtin addInteger)])",
+    "(program 1.1.0 (con integer 12))");
+}
+
+TEST(cardano_uplc_int_optimize_program, keepsCasesItCannotResolve)
+{
+  expect_optimized(
+    "(program 1.1.0 (lam g (case (constr 2 g) (lam a a))))",
+    "(program 1.1.0 (lam g (case (constr 2 g) (lam a a))))");
+  expect_optimized(
+    "(program 1.1.0 (lam g (case (constr 0 g g g) (lam a (lam b (lam c a))))))",
+    "(program 1.1.0 (lam g (case (constr 0 g g g) (lam a (lam b (lam c a))))))");
+  expect_optimized(
+    "(program 1.1.0 (lam g (case (constr 0 [g g]) (lam a a))))",
+    "(program 1.1.0 (lam g (case (constr 0 [g g]) (lam a a))))");
+}
+
+TEST(cardano_uplc_int_optimize_program, preservesTheResultAtNoHigherCost)
+{
+  expect_same_result_at_lower_cost(
+    "(program 1.1.0 "
+    "[(lam f (case (constr 1 (con integer 5) (con integer 7)) (lam a a) (lam a (lam b [f a b])))) "
+    "(builtin addInteger)])");
+  expect_same_result_at_lower_cost(
+    "(program 1.1.0 "
+    "[(lam fix [[fix (lam self (lam k (force "
+    "[(force (builtin ifThenElse)) [(builtin lessThanEqualsInteger) k (con integer 0)] "
+    "(delay (con integer 0)) (delay [(builtin addInteger) k [self [(builtin subtractInteger) k (con integer 1)]]])])))] "
+    "[(builtin addInteger) (con integer 6) (con integer 4)]]) "
+    "(lam g [(lam h [g (lam v [[h h] v])]) (lam h [g (lam v [[h h] v])])])])");
+  expect_same_result_at_lower_cost(
+    "(program 1.1.0 [(lam x (force (delay [(lam y [[(builtin appendByteString) y] y]) x]))) (con bytestring #0102)])");
+}
+
+TEST(cardano_uplc_int_optimize_program, keepsFailingProgramsFailing)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena     = new_arena();
+  const cardano_uplc_program_t* program   = parse(arena, "(program 1.1.0 [(lam x (error)) (con integer 1)])");
+  const cardano_uplc_program_t* optimized = optimize(arena, program);
+  const cardano_uplc_budget_t   budget    = { INT64_MAX, INT64_MAX };
+
+  cardano_uplc_eval_result_t result = {};
+
+  // Act
+  ASSERT_NE(optimized, nullptr);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, optimized, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &result), CARDANO_SUCCESS);
+
+  // Assert
+  EXPECT_EQ(result.status, CARDANO_UPLC_EVAL_ERROR_TERM);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_optimize_program, keepsApplicationsOfFreeVariables)
+{
+  // Arrange
+  cardano_uplc_arena_t*         arena   = new_arena();
+  const cardano_uplc_program_t* program = parse(arena, "(program 1.1.0 [(lam x (con integer 1)) (con unit ())])");
+  const cardano_uplc_budget_t   budget  = { INT64_MAX, INT64_MAX };
+  cardano_uplc_term_t*          unbound = nullptr;
+  cardano_uplc_term_t*          apply   = nullptr;
+
+  cardano_uplc_eval_result_t result = {};
+
+  ASSERT_EQ(cardano_uplc_term_new_var(arena, 1U, &unbound), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_term_new_apply(arena, program->term->as.apply.function, unbound, &apply), CARDANO_SUCCESS);
+
+  cardano_uplc_program_t ill_scoped = *program;
+  ill_scoped.term                   = apply;
+
+  // Act
+  const cardano_uplc_program_t* optimized = optimize(arena, &ill_scoped);
+
+  // Assert
+  ASSERT_NE(optimized, nullptr);
+  EXPECT_EQ(optimized->term, apply);
+  ASSERT_EQ(cardano_uplc_evaluate(arena, optimized, CARDANO_UPLC_MACHINE_VERSION_V3, budget, &result), CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_EVAL_ERROR_TERM);
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_int_optimize_program, failsCleanlyWhenTheArenaCannotAllocate)
+{
+  // Arrange
+  cardano_uplc_arena_t*         source    = new_arena();
+  cardano_uplc_arena_t*         arena     = new_arena();
+  const cardano_uplc_program_t* program   = parse(source, "(program 1.1.0 (lam y [(lam x [x x]) y]))");
+  const cardano_uplc_program_t* optimized = nullptr;
+
+  reset_allocators_run_count();
+  cardano_set_allocators(fail_right_away_malloc, realloc, free);
+
+  // Act
+  cardano_error_t error = cardano_uplc_int_optimize_program(arena, program, CARDANO_UPLC_LANG_VERSION_V3, 11U, &optimized);
+
+  cardano_set_allocators(malloc, realloc, free);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED);
+  EXPECT_EQ(optimized, nullptr);
+
+  cardano_uplc_arena_free(&arena);
+  cardano_uplc_arena_free(&source);
+}
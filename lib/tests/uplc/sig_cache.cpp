@@ -0,0 +1,198 @@
+/**
+ * \file sig_cache.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../../src/uplc/arena/uplc_arena.h"
+#include "../../src/uplc/ast/uplc_program.h"
+#include "../../src/uplc/builtins/uplc_sig_cache.h"
+#include "../../src/uplc/cost/uplc_builtin_costs.h"
+#include "../../src/uplc/cost/uplc_cost_model.h"
+#include "../../src/uplc/cost/uplc_machine_costs.h"
+#include "../../src/uplc/machine/uplc_machine.h"
+#include "../../src/uplc/syntax/text_parser.h"
+
+#include <cardano/error.h>
+
+#include <cstring>
+#include <gmock/gmock.h>
+
+/* STATIC HELPERS ************************************************************/
+
+static const char* const KEY = "#3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c";
+static const char* const SIG = "#92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00";
+static const char* const BAD = "#92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c01";
+
+static std::string
+verify_call(const char* key, const char* sig)
+{
+  return std::string("[ [ [ (builtin verifyEd25519Signature) (con bytestring ") + key + ") ] (con bytestring #72) ] (con bytestring " + sig + ") ]";
+}
+
+static std::string
+twice(const char* key, const char* sig)
+{
+  return "(program 1.0.0 [ (lam x " + verify_call(key, sig) + ") " + verify_call(key, sig) + " ])";
+}
+
+static cardano_uplc_eval_result_t
+run(const std::string& text, cardano_uplc_sig_cache_t* cache)
+{
+  cardano_uplc_arena_t*         arena        = nullptr;
+  const cardano_uplc_program_t* program      = nullptr;
+  size_t                        error_offset = 0U;
+  cardano_uplc_cost_model_t     model        = {};
+  cardano_uplc_eval_result_t    result       = {};
+  const cardano_uplc_budget_t   budget       = { INT64_MAX, INT64_MAX };
+
+  model.machine  = cardano_uplc_machine_costs_default(CARDANO_UPLC_COST_MODEL_VERSION_V3);
+  model.builtins = cardano_uplc_builtin_costs_v3();
+
+  EXPECT_EQ(cardano_uplc_arena_new(4096U, &arena), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_parse_program(arena, text.c_str(), text.size(), &program, &error_offset), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_int_evaluate_with_costs(arena, program, &model, CARDANO_UPLC_SEMANTICS_C, CARDANO_UPLC_LANG_VERSION_V3, 10U, budget, cache, &result), CARDANO_SUCCESS);
+
+  result.result = nullptr;
+  cardano_uplc_arena_free(&arena);
+
+  return result;
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_uplc_sig_cache_new, returnsErrorIfPointerIsNullOrCapacityIsZero)
+{
+  // Arrange
+  cardano_uplc_sig_cache_t* cache = nullptr;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_sig_cache_new(16U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_sig_cache_new(0U, &cache), CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(cache, nullptr);
+}
+
+TEST(cardano_uplc_sig_cache_free, ignoresNull)
+{
+  // Arrange
+  cardano_uplc_sig_cache_t* cache = nullptr;
+
+  // Act & Assert
+  cardano_uplc_sig_cache_free(nullptr);
+  cardano_uplc_sig_cache_free(&cache);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_hits(nullptr), 0U);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_misses(nullptr), 0U);
+}
+
+TEST(cardano_uplc_sig_cache_lookup, remembersStoredOutcomesPerAlgorithm)
+{
+  // Arrange
+  cardano_uplc_sig_cache_t* cache = nullptr;
+  const byte_t              key[] = { 1U, 2U, 3U };
+  const byte_t              msg[] = { 4U };
+  const byte_t              sig[] = { 5U, 6U };
+  byte_t                    digest[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE];
+  byte_t                    other[CARDANO_UPLC_SIG_CACHE_DIGEST_SIZE];
+  bool                      valid = false;
+
+  ASSERT_EQ(cardano_uplc_sig_cache_new(3U, &cache), CARDANO_SUCCESS);
+
+  // Act & Assert
+  EXPECT_FALSE(cardano_uplc_sig_cache_lookup(cache, CARDANO_UPLC_BUILTIN_VERIFY_ED25519_SIGNATURE, key, sizeof(key), msg, sizeof(msg), sig, sizeof(sig), digest, &valid));
+
+  cardano_uplc_sig_cache_store(cache, digest, true);
+
+  EXPECT_TRUE(cardano_uplc_sig_cache_lookup(cache, CARDANO_UPLC_BUILTIN_VERIFY_ED25519_SIGNATURE, key, sizeof(key), msg, sizeof(msg), sig, sizeof(sig), other, &valid));
+  EXPECT_TRUE(valid);
+  EXPECT_EQ(memcmp(digest, other, sizeof(digest)), 0);
+
+  EXPECT_FALSE(cardano_uplc_sig_cache_lookup(cache, CARDANO_UPLC_BUILTIN_VERIFY_SCHNORR_SECP256K1_SIGNATURE, key, sizeof(key), msg, sizeof(msg), sig, sizeof(sig), other, &valid));
+  EXPECT_FALSE(cardano_uplc_sig_cache_lookup(cache, CARDANO_UPLC_BUILTIN_VERIFY_ED25519_SIGNATURE, key, sizeof(key), nullptr, 0U, sig, sizeof(sig), other, &valid));
+
+  EXPECT_EQ(cardano_uplc_sig_cache_get_hits(cache), 1U);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_misses(cache), 3U);
+
+  cardano_uplc_sig_cache_free(&cache);
+  EXPECT_EQ(cache, nullptr);
+}
+
+TEST(cardano_uplc_sig_cache, leavesOutcomeAndBudgetUnchanged)
+{
+  // Arrange
+  cardano_uplc_sig_cache_t* cache = nullptr;
+
+  ASSERT_EQ(cardano_uplc_sig_cache_new(16U, &cache), CARDANO_SUCCESS);
+
+  // Act
+  const cardano_uplc_eval_result_t expected = run(twice(KEY, SIG), nullptr);
+  const cardano_uplc_eval_result_t actual   = run(twice(KEY, SIG), cache);
+
+  // Assert
+  EXPECT_EQ(expected.status, CARDANO_UPLC_EVAL_SUCCESS);
+  EXPECT_EQ(actual.status, expected.status);
+  EXPECT_EQ(actual.spent.cpu, expected.spent.cpu);
+  EXPECT_EQ(actual.spent.mem, expected.spent.mem);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_misses(cache), 1U);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_hits(cache), 1U);
+
+  cardano_uplc_sig_cache_free(&cache);
+}
+
+TEST(cardano_uplc_sig_cache, reusesOutcomesAcrossEvaluations)
+{
+  // Arrange
+  cardano_uplc_sig_cache_t* cache = nullptr;
+  const std::string         valid = "(program 1.0.0 " + verify_call(KEY, SIG) + ")";
+  const std::string         bad   = "(program 1.0.0 " + verify_call(KEY, BAD) + ")";
+
+  ASSERT_EQ(cardano_uplc_sig_cache_new(16U, &cache), CARDANO_SUCCESS);
+
+  // Act
+  const cardano_uplc_eval_result_t first_valid  = run(valid, cache);
+  const cardano_uplc_eval_result_t first_bad    = run(bad, cache);
+  const cardano_uplc_eval_result_t second_valid = run(valid, cache);
+  const cardano_uplc_eval_result_t second_bad   = run(bad, cache);
+
+  // Assert
+  EXPECT_EQ(cardano_uplc_sig_cache_get_misses(cache), 2U);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_hits(cache), 2U);
+  EXPECT_EQ(second_valid.spent.cpu, first_valid.spent.cpu);
+  EXPECT_EQ(second_bad.spent.cpu, first_bad.spent.cpu);
+
+  cardano_uplc_sig_cache_free(&cache);
+}
+
+TEST(cardano_uplc_sig_cache, doesNotHideMalformedArguments)
+{
+  // Arrange
+  cardano_uplc_sig_cache_t* cache = nullptr;
+
+  ASSERT_EQ(cardano_uplc_sig_cache_new(16U, &cache), CARDANO_SUCCESS);
+
+  // Act
+  const cardano_uplc_eval_result_t result = run(twice("#3d4017", SIG), cache);
+
+  // Assert
+  EXPECT_EQ(result.status, CARDANO_UPLC_EVAL_ERROR_TERM);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_misses(cache), 0U);
+  EXPECT_EQ(cardano_uplc_sig_cache_get_hits(cache), 0U);
+
+  cardano_uplc_sig_cache_free(&cache);
+}
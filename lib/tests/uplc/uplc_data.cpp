@@ -258,6 +258,87 @@ TEST(cardano_uplc_data_equals, matchesAcrossInlineAndBignumIntegers)
   cardano_uplc_arena_free(&arena);
 }
 
+TEST(cardano_uplc_data_node_hash, matchesForEqualTreesAndIsMemoized)
+{
+  cardano_uplc_arena_t* arena = make_arena();
+
+  std::vector<uint8_t> a_bytes = from_hex("d8799f0102a1414a9f0304ffff");
+  std::vector<uint8_t> b_bytes = from_hex("d8799f0102a1414a9f0304ffff");
+  std::vector<uint8_t> c_bytes = from_hex("d8799f0102a1414a9f0305ffff");
+
+  cardano_uplc_data_t* a = nullptr;
+  cardano_uplc_data_t* b = nullptr;
+  cardano_uplc_data_t* c = nullptr;
+
+  ASSERT_EQ(cardano_uplc_data_from_cbor_bytes(arena, a_bytes.data(), a_bytes.size(), &a), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_data_from_cbor_bytes(arena, b_bytes.data(), b_bytes.size(), &b), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_data_from_cbor_bytes(arena, c_bytes.data(), c_bytes.size(), &c), CARDANO_SUCCESS);
+
+  uint64_t a_hash = 0U;
+  uint64_t b_hash = 0U;
+  uint64_t c_hash = 0U;
+
+  EXPECT_FALSE(a->has_hash);
+  ASSERT_TRUE(cardano_uplc_data_node_hash(a, &a_hash));
+  ASSERT_TRUE(cardano_uplc_data_node_hash(b, &b_hash));
+  ASSERT_TRUE(cardano_uplc_data_node_hash(c, &c_hash));
+
+  EXPECT_TRUE(a->has_hash);
+  EXPECT_EQ(a->hash, a_hash);
+  EXPECT_EQ(a_hash, b_hash);
+  EXPECT_NE(a_hash, c_hash);
+
+  EXPECT_TRUE(cardano_uplc_data_equals(a, b));
+  EXPECT_FALSE(cardano_uplc_data_equals(a, c));
+
+  uint64_t null_hash = 1U;
+
+  EXPECT_TRUE(cardano_uplc_data_node_hash(nullptr, &null_hash));
+  EXPECT_EQ(null_hash, 0U);
+  EXPECT_FALSE(cardano_uplc_data_node_hash(a, nullptr));
+
+  cardano_uplc_arena_free(&arena);
+}
+
+TEST(cardano_uplc_data_node_hash, ignoresIntegerRepresentationAndMapFlag)
+{
+  cardano_uplc_arena_t* arena = make_arena();
+  cardano_uplc_data_t*  small = nullptr;
+  cardano_bigint_t*     big   = nullptr;
+  cardano_uplc_data_t*  wide  = nullptr;
+
+  ASSERT_EQ(cardano_uplc_data_new_integer_small(arena, -42, &small), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_bigint_from_int(-42, &big), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_data_new_integer(arena, big, &wide), CARDANO_SUCCESS);
+  cardano_bigint_unref(&big);
+
+  uint64_t small_hash = 0U;
+  uint64_t wide_hash  = 0U;
+
+  ASSERT_TRUE(cardano_uplc_data_node_hash(small, &small_hash));
+  ASSERT_TRUE(cardano_uplc_data_node_hash(wide, &wide_hash));
+  EXPECT_EQ(small_hash, wide_hash);
+
+  std::vector<uint8_t> definite   = from_hex("a10102");
+  std::vector<uint8_t> indefinite = from_hex("bf0102ff");
+
+  cardano_uplc_data_t* lhs = nullptr;
+  cardano_uplc_data_t* rhs = nullptr;
+
+  ASSERT_EQ(cardano_uplc_data_from_cbor_bytes(arena, definite.data(), definite.size(), &lhs), CARDANO_SUCCESS);
+  ASSERT_EQ(cardano_uplc_data_from_cbor_bytes(arena, indefinite.data(), indefinite.size(), &rhs), CARDANO_SUCCESS);
+
+  uint64_t lhs_hash = 0U;
+  uint64_t rhs_hash = 0U;
+
+  ASSERT_TRUE(cardano_uplc_data_node_hash(lhs, &lhs_hash));
+  ASSERT_TRUE(cardano_uplc_data_node_hash(rhs, &rhs_hash));
+  EXPECT_EQ(lhs_hash, rhs_hash);
+  EXPECT_TRUE(cardano_uplc_data_equals(lhs, rhs));
+
+  cardano_uplc_arena_free(&arena);
+}
+
 /* NEGATIVE INTEGER DECODE **************************************************/
 
 TEST(cardano_uplc_data_from_cbor_bytes, negativeIntegerBeyondInt64MatchesLibrary)
@@ -556,6 +637,9 @@ TEST(cardano_uplc_data_deep, degenerateDepthDoesNotOverflowTheStack)
   EXPECT_TRUE(cardano_uplc_data_equals(list_chain, list_chain));
   EXPECT_FALSE(cardano_uplc_data_equals(constr_chain, list_chain));
 
+  uint64_t chain_hash = 0U;
+  EXPECT_TRUE(cardano_uplc_data_node_hash(list_chain, &chain_hash));
+
   EXPECT_GT(cardano_uplc_data_node_ex_mem(constr_chain), 0);
   EXPECT_GT(cardano_uplc_data_node_count(constr_chain), 0);
   EXPECT_GT(cardano_uplc_data_node_ex_mem(list_chain), 0);
@@ -0,0 +1,598 @@
+/**
+ * \file uplc_script.cpp
+ *
+ * \author angel.castillo
+ * \date   Oct 18, 2026
+ *
+ * Copyright 2026 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/error.h>
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/protocol_params/cost_model.h>
+#include <cardano/uplc/uplc_script.h>
+
+#include "../../src/uplc/arena/uplc_arena.h"
+#include "../../src/uplc/ast/uplc_program.h"
+#include "../../src/uplc/syntax/pretty.h"
+#include "../../src/uplc/syntax/text_parser.h"
+
+#include "../allocators_helpers.h"
+#include "../src/allocators.h"
+
+#include <cstring>
+#include <gmock/gmock.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t MAX_CPU    = 10000000000U;
+static const uint64_t MAX_MEMORY = 14000000U;
+
+/**
+ * \brief A validator that succeeds on an integer argument and fails on any other.
+ */
+static const char* UN_I_DATA_SCRIPT = "(program 1.1.0 (lam d [ (builtin unIData) d ]))";
+
+/**
+ * \brief A script whose builtin needs a bigint view of the program's own integer constants.
+ */
+static const char* INTEGER_TO_BYTE_STRING_SCRIPT =
+  "(program 1.1.0 (lam d [ (builtin integerToByteString) (con bool True) (con integer 0) (con integer 1000) ]))";
+
+/* STATIC HELPERS ************************************************************/
+
+/**
+ * \brief Compiles a textual program to the CBOR-wrapped flat bytes of a witness set.
+ */
+static cardano_buffer_t*
+compile(const char* source)
+{
+  cardano_uplc_arena_t*         arena   = nullptr;
+  const cardano_uplc_program_t* program = nullptr;
+  cardano_buffer_t*             cbor    = nullptr;
+  size_t                        offset  = 0U;
+
+  EXPECT_EQ(cardano_uplc_arena_new(4096U, &arena), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_parse_program(arena, source, std::strlen(source), &program, &offset), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_program_to_cbor(program, &cbor), CARDANO_SUCCESS);
+
+  cardano_uplc_arena_free(&arena);
+
+  return cbor;
+}
+
+/**
+ * \brief Loads a textual program as a script with the default cost model.
+ */
+static cardano_uplc_script_t*
+load(const char* source, cardano_plutus_language_version_t language)
+{
+  cardano_buffer_t*      cbor   = compile(source);
+  cardano_uplc_script_t* script = nullptr;
+
+  EXPECT_EQ(
+    cardano_uplc_script_new(language, cardano_buffer_get_data(cbor), cardano_buffer_get_size(cbor), nullptr, 10U, &script),
+    CARDANO_SUCCESS);
+
+  cardano_buffer_unref(&cbor);
+
+  return script;
+}
+
+static cardano_plutus_data_t*
+new_int_data(int64_t value)
+{
+  cardano_plutus_data_t* data = nullptr;
+  EXPECT_EQ(cardano_plutus_data_new_integer_from_int(value, &data), CARDANO_SUCCESS);
+  return data;
+}
+
+static cardano_plutus_data_t*
+new_bytes_data()
+{
+  static const byte_t    bytes[] = { 0xCAU, 0xFEU };
+  cardano_plutus_data_t* data    = nullptr;
+  EXPECT_EQ(cardano_plutus_data_new_bytes(bytes, sizeof(bytes), &data), CARDANO_SUCCESS);
+  return data;
+}
+
+/* UNIT TESTS ****************************************************************/
+
+TEST(cardano_uplc_script_new, loadsAScript)
+{
+  // Act
+  cardano_uplc_script_t* script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+
+  // Assert
+  ASSERT_NE(script, nullptr);
+  EXPECT_EQ(cardano_uplc_script_get_language(script), CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  EXPECT_EQ(cardano_uplc_script_refcount(script), 1U);
+
+  // Cleanup
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_new, returnsErrorIfPointersAreNull)
+{
+  // Arrange
+  const byte_t           bytes[] = { 0x41U, 0x00U };
+  cardano_uplc_script_t* script  = nullptr;
+
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_script_new(CARDANO_PLUTUS_LANGUAGE_VERSION_V3, nullptr, 2U, nullptr, 10U, &script), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_script_new(CARDANO_PLUTUS_LANGUAGE_VERSION_V3, bytes, sizeof(bytes), nullptr, 10U, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+}
+
+TEST(cardano_uplc_script_new, returnsErrorIfBytesAreNotAScript)
+{
+  // Arrange
+  const byte_t           bytes[] = { 0x43U, 0xFFU, 0xFFU, 0xFFU };
+  cardano_uplc_script_t* script  = nullptr;
+
+  // Act
+  cardano_error_t result = cardano_uplc_script_new(CARDANO_PLUTUS_LANGUAGE_VERSION_V3, bytes, sizeof(bytes), nullptr, 10U, &script);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_DECODING);
+  EXPECT_EQ(script, nullptr);
+}
+
+TEST(cardano_uplc_script_new, returnsErrorIfLanguageIsUnknown)
+{
+  // Arrange
+  cardano_buffer_t*      cbor   = compile(UN_I_DATA_SCRIPT);
+  cardano_uplc_script_t* script = nullptr;
+
+  // Act
+  cardano_error_t result = cardano_uplc_script_new(
+    (cardano_plutus_language_version_t)42,
+    cardano_buffer_get_data(cbor),
+    cardano_buffer_get_size(cbor),
+    nullptr,
+    10U,
+    &script);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(script, nullptr);
+
+  // Cleanup
+  cardano_buffer_unref(&cbor);
+}
+
+TEST(cardano_uplc_script_new, returnsErrorIfCostModelIsForAnotherLanguage)
+{
+  // Arrange
+  const int64_t          costs[]    = { 1, 2, 3 };
+  cardano_cost_model_t*  cost_model = nullptr;
+  cardano_buffer_t*      cbor       = compile(UN_I_DATA_SCRIPT);
+  cardano_uplc_script_t* script     = nullptr;
+
+  ASSERT_EQ(cardano_cost_model_new(CARDANO_PLUTUS_LANGUAGE_VERSION_V1, costs, 3U, &cost_model), CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t result = cardano_uplc_script_new(
+    CARDANO_PLUTUS_LANGUAGE_VERSION_V3,
+    cardano_buffer_get_data(cbor),
+    cardano_buffer_get_size(cbor),
+    cost_model,
+    10U,
+    &script);
+
+  // Assert
+  EXPECT_EQ(result, CARDANO_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(script, nullptr);
+
+  // Cleanup
+  cardano_cost_model_unref(&cost_model);
+  cardano_buffer_unref(&cbor);
+}
+
+TEST(cardano_uplc_script_new, returnsErrorIfMemoryAllocationFails)
+{
+  // Arrange
+  cardano_buffer_t* cbor = compile(UN_I_DATA_SCRIPT);
+
+  for (int i = 0; i < 16; ++i)
+  {
+    cardano_uplc_script_t* script = nullptr;
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    // Act
+    cardano_error_t result = cardano_uplc_script_new(
+      CARDANO_PLUTUS_LANGUAGE_VERSION_V3,
+      cardano_buffer_get_data(cbor),
+      cardano_buffer_get_size(cbor),
+      nullptr,
+      10U,
+      &script);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    // Assert
+    if (result != CARDANO_SUCCESS)
+    {
+      EXPECT_EQ(script, nullptr);
+    }
+
+    cardano_uplc_script_unref(&script);
+  }
+
+  // Cleanup
+  cardano_buffer_unref(&cbor);
+}
+
+TEST(cardano_uplc_script_evaluate, succeedsOnAnAcceptedArgument)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       arg    = new_int_data(42);
+  cardano_uplc_script_result_t result = {};
+
+  // Act
+  cardano_error_t error = cardano_uplc_script_evaluate(script, &arg, 1U, MAX_CPU, MAX_MEMORY, &result);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+  EXPECT_GT(result.cpu, 0U);
+  EXPECT_GT(result.memory, 0U);
+  EXPECT_NE(result.term, nullptr);
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, returnsTheResultTermUntilTheNextRun)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       arg    = new_int_data(42);
+  cardano_uplc_script_result_t result = {};
+  cardano_buffer_t*            text   = nullptr;
+
+  // Act
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, &arg, 1U, MAX_CPU, MAX_MEMORY, &result), CARDANO_SUCCESS);
+
+  // Assert
+  ASSERT_NE(result.term, nullptr);
+  ASSERT_EQ(cardano_uplc_pretty_print_term(result.term, &text), CARDANO_SUCCESS);
+  EXPECT_STREQ((const char*)cardano_buffer_get_data(text), "(con integer 42)");
+
+  // Cleanup
+  cardano_buffer_unref(&text);
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, failsOnARejectedArgument)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       arg    = new_bytes_data();
+  cardano_uplc_script_result_t result = {};
+
+  // Act
+  cardano_error_t error = cardano_uplc_script_evaluate(script, &arg, 1U, MAX_CPU, MAX_MEMORY, &result);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_FAILURE);
+  EXPECT_EQ(result.term, nullptr);
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, failsOnAnErrorTerm)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load("(program 1.0.0 (error))", CARDANO_PLUTUS_LANGUAGE_VERSION_V2);
+  cardano_uplc_script_result_t result = {};
+
+  // Act
+  cardano_error_t error = cardano_uplc_script_evaluate(script, nullptr, 0U, MAX_CPU, MAX_MEMORY, &result);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_FAILURE);
+
+  // Cleanup
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, reportsOutOfBudget)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       arg    = new_int_data(42);
+  cardano_uplc_script_result_t result = {};
+
+  // Act
+  cardano_error_t error = cardano_uplc_script_evaluate(script, &arg, 1U, 1U, MAX_MEMORY, &result);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_OUT_OF_BUDGET);
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, clampsBudgetsBeyondTheMachineRange)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       arg    = new_int_data(42);
+  cardano_uplc_script_result_t result = {};
+
+  // Act
+  cardano_error_t error = cardano_uplc_script_evaluate(script, &arg, 1U, UINT64_MAX, UINT64_MAX, &result);
+
+  // Assert
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, evaluatesTheLoadedScriptOnEveryRun)
+{
+  // Arrange
+  cardano_uplc_script_t*       script   = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       accepted = new_int_data(7);
+  cardano_plutus_data_t*       rejected = new_bytes_data();
+  cardano_uplc_script_result_t first    = {};
+  cardano_uplc_script_result_t second   = {};
+  cardano_uplc_script_result_t failed   = {};
+
+  // Act
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, &accepted, 1U, MAX_CPU, MAX_MEMORY, &first), CARDANO_SUCCESS);
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, &rejected, 1U, MAX_CPU, MAX_MEMORY, &failed), CARDANO_SUCCESS);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(cardano_uplc_script_evaluate(script, &accepted, 1U, MAX_CPU, MAX_MEMORY, &second), CARDANO_SUCCESS);
+  }
+
+  // Assert
+  EXPECT_EQ(first.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+  EXPECT_EQ(failed.status, CARDANO_UPLC_SCRIPT_STATUS_FAILURE);
+  EXPECT_EQ(second.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+  EXPECT_EQ(second.cpu, first.cpu);
+  EXPECT_EQ(second.memory, first.memory);
+  EXPECT_EQ(cardano_plutus_data_refcount(rejected), 1U);
+
+  // The last run keeps its argument until the script is released.
+  cardano_uplc_script_unref(&script);
+
+  EXPECT_EQ(cardano_plutus_data_refcount(accepted), 1U);
+
+  // Cleanup
+  cardano_plutus_data_unref(&accepted);
+  cardano_plutus_data_unref(&rejected);
+}
+
+TEST(cardano_uplc_script_evaluate, keepsProgramConstantsValidAcrossRuns)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(INTEGER_TO_BYTE_STRING_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       arg    = new_int_data(1);
+  cardano_uplc_script_result_t first  = {};
+  cardano_uplc_script_result_t later  = {};
+
+  // Act
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, &arg, 1U, MAX_CPU, MAX_MEMORY, &first), CARDANO_SUCCESS);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(cardano_uplc_script_evaluate(script, &arg, 1U, MAX_CPU, MAX_MEMORY, &later), CARDANO_SUCCESS);
+    EXPECT_EQ(later.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+    EXPECT_EQ(later.cpu, first.cpu);
+    EXPECT_EQ(later.memory, first.memory);
+  }
+
+  // Assert
+  EXPECT_EQ(first.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, chargesTheGivenCostModel)
+{
+  // Arrange
+  const int64_t                costs[]    = { 1, 2, 3 };
+  cardano_cost_model_t*        cost_model = nullptr;
+  cardano_buffer_t*            cbor       = compile(UN_I_DATA_SCRIPT);
+  cardano_uplc_script_t*       script     = nullptr;
+  cardano_plutus_data_t*       arg        = new_int_data(42);
+  cardano_uplc_script_result_t result     = {};
+
+  ASSERT_EQ(cardano_cost_model_new(CARDANO_PLUTUS_LANGUAGE_VERSION_V3, costs, 3U, &cost_model), CARDANO_SUCCESS);
+  ASSERT_EQ(
+    cardano_uplc_script_new(
+      CARDANO_PLUTUS_LANGUAGE_VERSION_V3,
+      cardano_buffer_get_data(cbor),
+      cardano_buffer_get_size(cbor),
+      cost_model,
+      10U,
+      &script),
+    CARDANO_SUCCESS);
+
+  // Act
+  cardano_error_t error = cardano_uplc_script_evaluate(script, &arg, 1U, MAX_CPU, MAX_MEMORY, &result);
+
+  // Assert - the parameters the model lacks cost the maximum, so no budget covers the run.
+  EXPECT_EQ(error, CARDANO_SUCCESS);
+  EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_OUT_OF_BUDGET);
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+  cardano_cost_model_unref(&cost_model);
+  cardano_buffer_unref(&cbor);
+}
+
+TEST(cardano_uplc_script_evaluate, returnsErrorIfPointersAreNull)
+{
+  // Arrange
+  cardano_uplc_script_t*       script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t*       args[] = { nullptr };
+  cardano_uplc_script_result_t result = {};
+
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_script_evaluate(nullptr, nullptr, 0U, MAX_CPU, MAX_MEMORY, &result), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, nullptr, 0U, MAX_CPU, MAX_MEMORY, nullptr), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, nullptr, 1U, MAX_CPU, MAX_MEMORY, &result), CARDANO_ERROR_POINTER_IS_NULL);
+  EXPECT_EQ(cardano_uplc_script_evaluate(script, args, 1U, MAX_CPU, MAX_MEMORY, &result), CARDANO_ERROR_POINTER_IS_NULL);
+
+  // Cleanup
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_evaluate, returnsErrorIfMemoryAllocationFails)
+{
+  // Arrange
+  cardano_uplc_script_t* script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+  cardano_plutus_data_t* arg    = new_int_data(42);
+
+  for (int i = 0; i < 8; ++i)
+  {
+    cardano_uplc_script_t*       fresh  = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+    cardano_uplc_script_result_t result = {};
+
+    reset_allocators_run_count();
+    set_malloc_limit(i);
+    cardano_set_allocators(fail_malloc_at_limit, realloc, free);
+
+    // Act
+    cardano_error_t error = cardano_uplc_script_evaluate(fresh, &arg, 1U, MAX_CPU, MAX_MEMORY, &result);
+
+    cardano_set_allocators(malloc, realloc, free);
+
+    // Assert
+    if (error == CARDANO_SUCCESS)
+    {
+      EXPECT_EQ(result.status, CARDANO_UPLC_SCRIPT_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(cardano_plutus_data_refcount(arg), 1U);
+
+    cardano_uplc_script_unref(&fresh);
+  }
+
+  // Cleanup
+  cardano_plutus_data_unref(&arg);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_get_language, returnsV1IfScriptIsNull)
+{
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_script_get_language(nullptr), CARDANO_PLUTUS_LANGUAGE_VERSION_V1);
+}
+
+TEST(cardano_uplc_script_ref, increasesTheReferenceCount)
+{
+  // Arrange
+  cardano_uplc_script_t* script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+
+  // Act
+  cardano_uplc_script_ref(script);
+
+  // Assert
+  EXPECT_EQ(cardano_uplc_script_refcount(script), 2U);
+
+  // Cleanup - We need to unref twice since one reference was added.
+  cardano_uplc_script_unref(&script);
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_ref, doesntCrashIfGivenANullPtr)
+{
+  // Act
+  cardano_uplc_script_ref(nullptr);
+}
+
+TEST(cardano_uplc_script_unref, doesntCrashIfGivenAPtrToANullPtr)
+{
+  // Arrange
+  cardano_uplc_script_t* script = nullptr;
+
+  // Act
+  cardano_uplc_script_unref(&script);
+  cardano_uplc_script_unref(nullptr);
+}
+
+TEST(cardano_uplc_script_unref, decreasesTheReferenceCount)
+{
+  // Arrange
+  cardano_uplc_script_t* script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+
+  // Act
+  cardano_uplc_script_ref(script);
+  size_t ref_count = cardano_uplc_script_refcount(script);
+
+  cardano_uplc_script_unref(&script);
+  size_t updated_ref_count = cardano_uplc_script_refcount(script);
+
+  // Assert
+  EXPECT_EQ(ref_count, 2U);
+  EXPECT_EQ(updated_ref_count, 1U);
+
+  // Cleanup
+  cardano_uplc_script_unref(&script);
+  EXPECT_EQ(script, nullptr);
+}
+
+TEST(cardano_uplc_script_refcount, returnsZeroIfGivenANullPtr)
+{
+  // Act & Assert
+  EXPECT_EQ(cardano_uplc_script_refcount(nullptr), 0U);
+}
+
+TEST(cardano_uplc_script_get_last_error, returnsNullTerminatedMessage)
+{
+  // Arrange
+  cardano_uplc_script_t* script = load(UN_I_DATA_SCRIPT, CARDANO_PLUTUS_LANGUAGE_VERSION_V3);
+
+  // Act
+  cardano_uplc_script_set_last_error(script, "This is a test message");
+
+  // Assert
+  EXPECT_STREQ(cardano_uplc_script_get_last_error(script), "This is a test message");
+
+  // Cleanup
+  cardano_uplc_script_unref(&script);
+}
+
+TEST(cardano_uplc_script_get_last_error, returnsObjectIsNullIfGivenANullPtr)
+{
+  // Act & Assert
+  EXPECT_STREQ(cardano_uplc_script_get_last_error(nullptr), "Object is NULL.");
+}